@@ -1209,6 +1209,7 @@ m4_include([m4/ax_append_flag.m4])
 m4_include([m4/ax_arg_enable_assert.m4])
 m4_include([m4/ax_arg_enable_debugging.m4])
 m4_include([m4/ax_arg_enable_efence.m4])
+m4_include([m4/ax_arg_enable_usdt.m4])
 m4_include([m4/ax_arg_enable_warnings.m4])
 m4_include([m4/ax_arg_gnutls.m4])
 m4_include([m4/ax_arg_ioloop_mechanism.m4])
@@ -0,0 +1,64 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file accounting.h
+ * \brief Resources used by each local connection.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_accounting_h
+#define INCLUDED_accounting_h
+
+/** Length of an accounting window in seconds. The recent figures cover the
+ *  current and the previous window, that is between one and two of them. */
+enum { ACCOUNTING_WINDOW = 30 };
+
+struct Client;
+
+/*! \brief Per-connection counters, embedded in struct Connection */
+struct Accounting
+{
+  uintmax_t cpu;     /**< Time spent in handlers of commands read from the connection, in clock ticks */
+  uintmax_t output;  /**< Bytes queued to any client while handling these commands */
+  size_t sendq_peak;  /**< Largest the sendq has been */
+  size_t recvq_peak;  /**< Largest the recvq has been */
+
+  uintmax_t window;             /**< Window the first entries of the recent counters belong to */
+  uintmax_t recent_cpu[2];      /**< cpu of the current and the previous window */
+  uintmax_t recent_output[2];   /**< output of the current and the previous window */
+};
+
+extern uintmax_t accounting_queued;
+
+extern void accounting_charge(struct Accounting *, uintmax_t, uintmax_t);
+extern uintmax_t accounting_recent_cpu(const struct Accounting *);
+extern uintmax_t accounting_recent_output(const struct Accounting *);
+extern uintmax_t accounting_cpu_usec(uintmax_t);
+extern const char *accounting_summary(const struct Client *);
+
+/*! \brief Records the size of a queue if it is the largest seen so far */
+static inline void
+accounting_peak(size_t *peak, size_t length)
+{
+  if (*peak < length)
+    *peak = length;
+}
+#endif  /* INCLUDED_accounting_h */
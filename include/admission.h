@@ -0,0 +1,59 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file admission.h
+ * \brief Latency histograms of the connection admission stages.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_admission_h
+#define INCLUDED_admission_h
+
+/** Stages a new client connection passes through before it is registered */
+enum admission_stage
+{
+  ADMISSION_ACCEPT,    /**< accept() up to the TLS handshake or auth_start() */
+  ADMISSION_TLS,       /**< TLS handshake */
+  ADMISSION_DNS,       /**< Reverse and forward DNS lookup */
+  ADMISSION_IDENT,     /**< RFC 1413 ident query */
+  ADMISSION_ACCESS,    /**< check_client() including verify_access() */
+  ADMISSION_REGISTER,  /**< Accepted to fully registered */
+  ADMISSION_STAGE_COUNT
+};
+
+enum
+{
+  ADMISSION_BUCKETS = 32  /**< Bucket i counts samples of [2^i, 2^(i+1)) microseconds */
+};
+
+struct admission_histogram
+{
+  uintmax_t bucket[ADMISSION_BUCKETS];
+  uintmax_t count;  /**< Number of samples */
+  uintmax_t sum;    /**< Sum of all samples, in microseconds */
+  uintmax_t max;    /**< Largest sample, in microseconds */
+};
+
+extern void admission_record(enum admission_stage, uintmax_t);
+extern const char *admission_stage_name(enum admission_stage);
+extern const struct admission_histogram *admission_histogram_get(enum admission_stage);
+extern uintmax_t admission_percentile(enum admission_stage, unsigned int);
+#endif  /* INCLUDED_admission_h */
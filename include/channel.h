@@ -28,6 +28,7 @@
 #define INCLUDED_channel_h
 
 #include "ircd_defs.h"        /* KEYLEN, CHANNELLEN */
+#include "list_index.h"
 
 /* channel visible */
 #define ShowChannel(v,c)        (PubChannel(c) || IsMember((v),(c)))
@@ -89,6 +90,8 @@ struct Channel
 
   float number_joined;
 
+  struct ListIndexEntry list_index;
+
   char name[CHANNELLEN + 1];
   size_t name_len;
 };
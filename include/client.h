@@ -34,6 +34,8 @@
 #include "dbuf.h"
 #include "channel.h"
 #include "auth.h"
+#include "who_index.h"
+#include "accounting.h"
 
 
 /*
@@ -267,9 +269,18 @@ struct Server
 struct ListTask
 {
   dlink_node node;  /**< Embedded list node used to link into listing_client_list */
+  dlink_node ready;  /**< Entry in the list of tasks to resume; data is NULL if not linked */
   dlink_list show_mask;  /**< Channels to show */
   dlink_list hide_mask;  /**< Channels to hide */
 
+  char *snapshot;  /**< Names of channels picked from an index that didn't fit into the sendq */
+  size_t snapshot_len;
+  size_t snapshot_size;
+  size_t snapshot_pos;  /**< Offset of the next name to show */
+
+  unsigned int started;  /**< Set once the channels to show have been picked */
+  unsigned int indexed;  /**< Set if they have been picked from an index */
+  unsigned int blocked;  /**< Set while waiting for the sendq to drain */
   unsigned int hash_index;  /**< The hash bucket we are currently in */
   unsigned int users_min;
   unsigned int users_max;
@@ -325,6 +336,26 @@ struct Connection
     uintmax_t bytes;             /**< Statistics: total bytes sent/received */
   } recv, send;
 
+  struct
+  {
+    unsigned int records;      /**< Statistics: TLS records written */
+    unsigned int record_size;  /**< Current limit for coalesced TLS records */
+    unsigned int pending;      /**< Length of a tls_write() that has to be retried */
+    uintmax_t last_write;      /**< Last time a TLS record has been written */
+  } tls;
+
+  dlink_node flush_node;  /**< Entry in the deferred flush list; data is NULL if unlinked */
+
+  struct Accounting accounting;  /**< Resources used on behalf of this connection */
+
+  struct
+  {
+    uintmax_t accept;  /**< Connection has been accepted */
+    uintmax_t tls;     /**< TLS handshake has been started */
+    uintmax_t dns;     /**< DNS lookup has been started */
+    uintmax_t ident;   /**< Ident query has been started */
+  } admission;  /**< clock_usec() timestamps of the admission stages */
+
   struct
   {
     unsigned int count;  /**< How many AWAY/INVITE/KNOCK/NICK requests client has sent */
@@ -377,6 +408,7 @@ struct Client
   dlink_list        svstags;   /**< List of ServicesTag items */
 
   struct irc_ssaddr ip;  /**< Real IP address */
+  struct WhoIndexEntry who_index;  /**< Links into the WHO indexes */
 
   char away[AWAYLEN + 1]; /**< Client's AWAY message. Can be set/unset via AWAY command */
   char name[HOSTLEN + 1]; /**< Unique name for a client nick or host */
@@ -435,6 +467,7 @@ extern dlink_list oper_list;          /* our opers, duplicated in local_client_l
 
 extern int accept_message(struct Client *, struct Client *);
 extern unsigned int client_get_idle_time(const struct Client *, const struct Client *);
+extern const char *client_get_tls_mode(const struct Client *);
 extern struct split_nuh_item *find_accept(const char *, const char *,
                                           const char *, struct Client *,
                                           int (*)(const char *, const char *));
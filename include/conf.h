@@ -60,7 +60,8 @@ enum
   CONF_FLAGS_EXEMPTRESV      = 1 << 12,
   CONF_FLAGS_SSL             = 1 << 13,
   CONF_FLAGS_WEBIRC          = 1 << 14,
-  CONF_FLAGS_EXEMPTXLINE     = 1 << 15
+  CONF_FLAGS_EXEMPTXLINE     = 1 << 15,
+  CONF_FLAGS_ARENA           = 1 << 16
 };
 
 /* Macros for struct MaskItem */
@@ -82,6 +83,7 @@ enum
 #define IsConfSSL(x)              ((x)->flags & CONF_FLAGS_SSL)
 #define IsConfDatabase(x)         ((x)->flags & CONF_FLAGS_IN_DATABASE)
 #define SetConfDatabase(x)        ((x)->flags |= CONF_FLAGS_IN_DATABASE)
+#define IsConfArena(x)            ((x)->flags & CONF_FLAGS_ARENA)
 
 
 enum maskitem_type
@@ -156,6 +158,7 @@ struct CidrItem
 {
   dlink_node node;
   struct irc_ssaddr mask;
+  uint32_t hash;
   unsigned int number_on_this_cidr;
 };
 
@@ -176,6 +179,7 @@ struct config_general_entry
   const char *xlinefile;
   const char *dlinefile;
   const char *resvfile;
+  char *metrics_socket;
 
   unsigned int dline_min_cidr;
   unsigned int dline_min_cidr6;
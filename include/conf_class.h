@@ -35,12 +35,20 @@ enum
   CLASS_FLAGS_HIDE_IDLE_FROM_OPERS = 1 << 2
 };
 
+/* Hash map of struct CidrItem, keyed by the masked address */
+struct cidr_map
+{
+  dlink_list *table;   /* buckets; NULL while the map is empty */
+  unsigned int size;   /* number of buckets, a power of two */
+  unsigned int count;  /* number of CidrItems */
+};
+
 struct ClassItem
 {
   char *name;
   dlink_node node;
-  dlink_list list_ipv4;         /* base of per cidr ipv4 client link list */
-  dlink_list list_ipv6;         /* base of per cidr ipv6 client link list */
+  struct cidr_map cidr_ipv4;    /* clients per ipv4 cidr */
+  struct cidr_map cidr_ipv6;    /* clients per ipv6 cidr */
   unsigned int ref_count;
   unsigned int max_sendq;
   unsigned int max_recvq;
@@ -28,9 +28,13 @@
 #ifndef INCLUDED_conf_db_h
 #define INCLUDED_conf_db_h
 
+struct MaskItem;
+struct GecosItem;
+struct ResvItem;
+
 struct dbFILE
 {
-  char mode;  /**< 'r' for reading, 'w' for writing */
+  char mode;  /**< 'r' for reading, 'w' for writing, 'a' for appending */
   FILE *fp;  /**< The file pointer itself */
   char filename[HYB_PATH_MAX + 1];  /**< Name of the database file */
   char tempname[HYB_PATH_MAX + 1];  /**< Name of the temporary file (for writing) */
@@ -46,15 +50,27 @@ extern int read_string(char **, struct dbFILE *);
 extern int write_string(const char *, struct dbFILE *);
 
 extern void load_kline_database(const char *);
-extern void save_kline_database(const char *);
+extern int save_kline_database(const char *);
 extern void load_dline_database(const char *);
-extern void save_dline_database(const char *);
+extern int save_dline_database(const char *);
 extern void load_xline_database(const char *);
-extern void save_xline_database(const char *);
+extern int save_xline_database(const char *);
 extern void load_resv_database(const char *);
-extern void save_resv_database(const char *);
+extern int save_resv_database(const char *);
 extern void save_all_databases(void *);
+extern void database_arena_release(const struct MaskItem *);
+
+extern void journal_add_conf(const struct MaskItem *);
+extern void journal_del_conf(const struct MaskItem *);
+extern void journal_add_gecos(const struct GecosItem *);
+extern void journal_del_gecos(const struct GecosItem *);
+extern void journal_add_resv(const struct ResvItem *);
+extern void journal_del_resv(const struct ResvItem *);
+extern void journal_sync(void *);
+extern void compact_databases(void *);
 
 enum { DATABASE_UPDATE_TIMEOUT = 300 };
 enum { KLINE_DB_VERSION = 1 };
+enum { MAPPED_DB_VERSION = 2 };
+enum { JOURNAL_DB_VERSION = 1 };
 #endif
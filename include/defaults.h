@@ -109,7 +109,16 @@
 #define MAX_TARGETS_DEFAULT 4           /* default for max_targets */
 
 #define CONNECTTIMEOUT  30      /* Recommended value: 30 */
+#define LOOP_SLOW_LAP 100        /* Log main loop iterations busy for longer than this many milliseconds */
+#define LOOP_STATS_INTERVAL 300  /* Seconds between main loop statistics log lines */
+#define LISTENER_ACCEPT_BUDGET 64  /* Connections accepted per listener socket and loop */
 #define IDENT_TIMEOUT 10
+#define TLS_HANDSHAKE_QUEUE_DEFAULT 512  /* TLS handshakes that may wait for a worker thread */
+#define TLS_SESSION_CACHE_SIZE 4096  /* Sessions kept for resumption by session ID */
+#define TLS_SESSION_TIMEOUT 7200     /* Lifetime of cached sessions and tickets */
+#define TLS_TICKET_KEY_LIFETIME 3600 /* Rotation interval of session ticket keys */
+/* Keys kept for tickets that were issued just before a rotation, up to TLS_SESSION_TIMEOUT later */
+#define TLS_TICKET_KEY_SLOTS ((TLS_SESSION_TIMEOUT + TLS_TICKET_KEY_LIFETIME - 1) / TLS_TICKET_KEY_LIFETIME + 1)
 
 #define MIN_JOIN_LEAVE_TIME  60
 #define MAX_JOIN_LEAVE_COUNT  25
@@ -45,6 +45,8 @@ enum
 };
 
 struct Client;
+struct tls_handshake_job;
+struct worker_io;
 
 typedef struct _fde
 {
@@ -76,6 +78,8 @@ typedef struct _fde
   {
     unsigned int open:1;
     unsigned int is_socket:1;
+    unsigned int ktls_send:1;  /* TLS records are encrypted by the kernel */
+    unsigned int ktls_recv:1;  /* TLS records are decrypted by the kernel */
   } flags;
 
   struct
@@ -90,6 +94,8 @@ typedef struct _fde
   } connect;
 
   tls_data_t ssl;
+  struct tls_handshake_job *handshake;  /* TLS handshake step running on a worker thread */
+  struct worker_io *io;  /* Worker thread that does all reading and writing */
 } fde_t;
 
 extern int number_fd;
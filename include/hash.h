@@ -58,6 +58,8 @@ extern void *hash_get_bucket(int, unsigned int);
 
 extern void free_list_task(struct Client *);
 extern void safe_list_channels(struct Client *, int);
+extern void safe_list_unblock(struct Client *);
+extern void safe_list_run(void);
 
 extern unsigned int strhash(const char *);
 #endif  /* INCLUDED_hash_h */
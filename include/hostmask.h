@@ -72,8 +72,10 @@ extern int match_ipv6(const struct irc_ssaddr *, const struct irc_ssaddr *, int)
 extern int match_ipv4(const struct irc_ssaddr *, const struct irc_ssaddr *, int);
 
 extern void mask_addr(struct irc_ssaddr *, int);
+extern void link_conf_by_address(const unsigned int, struct MaskItem *, struct AddressRec *);
 extern struct AddressRec *add_conf_by_address(const unsigned int, struct MaskItem *);
 extern void delete_one_address_conf(const char *, struct MaskItem *);
+extern struct MaskItem *find_database_address_conf(const char *, const char *, enum maskitem_type);
 extern void clear_out_address_conf(void);
 extern void hostmask_expire_temporary(void);
 
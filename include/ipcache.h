@@ -28,24 +28,32 @@
 #define INCLUDED_ipcache_h
 #include "ircd_defs.h"
 
-/*
- * Usually, with hash tables, you use a prime number...
- * but in this case I am dealing with ip addresses,
- * not ascii strings.
- */
-enum { IP_HASH_SIZE = 0x1000 };
+enum
+{
+  IPCACHE_SIZE_MIN    = 0x1000,   /**< Initial number of slots; a power of two */
+  IPCACHE_ENTRIES_MAX = 0x40000   /**< Hard limit of cached addresses not in use */
+};
 
+/*! \brief Per-address state, kept inline in an open addressing table.
+ *
+ * Entries move around when others are inserted or deleted, so pointers
+ * to them are only good until the next call into ipcache.
+ */
 struct ip_entry
 {
-  dlink_node node;                /**< Doubly linked list node */
-  struct irc_ssaddr ip;           /**< Holds an IPv6 or IPv4 address */
-  unsigned int count_local;       /**< Number of local users using this IP */
-  unsigned int count_remote;      /**< Number of remote users using this IP */
-  unsigned int connection_count;  /**< Number of connections from this IP in the last throttle_time duration */
-  uintmax_t last_attempt;         /**< The last time someone connected from this IP */
+  unsigned char addr[16];       /**< Packed address; IPv4 is stored v4-mapped */
+  uint32_t hash;                /**< Cached hash of addr */
+  uint32_t lru_prev;            /**< Older idle entry, or IPCACHE_NONE */
+  uint32_t lru_next;            /**< More recently used idle entry, or IPCACHE_NONE */
+  unsigned int count_local;     /**< Number of local users using this IP */
+  unsigned int count_remote;    /**< Number of remote users using this IP */
+  unsigned int throttle_count;  /**< Connection tokens taken out of the bucket */
+  uintmax_t throttle_time;      /**< When the bucket has last been refilled */
+  unsigned char used;           /**< Slot is occupied */
 };
 
-extern struct ip_entry *ipcache_find_or_add_address(const struct irc_ssaddr *);
+extern int ipcache_throttle(const struct irc_ssaddr *);
+extern struct ip_entry *ipcache_add_address(const struct irc_ssaddr *, int);
 extern void ipcache_remove_address(const struct irc_ssaddr *, int);
 extern void ipcache_get_stats(unsigned int *const, size_t *const);
 extern void ipcache_init(void);
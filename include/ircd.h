@@ -43,6 +43,9 @@ struct SetOptions
   unsigned int ident_timeout; /* timeout for identd lookups        */
   int spam_num;
   unsigned int spam_time;
+  unsigned int tls_handshake_queue;  /* max. TLS handshakes waiting for a worker */
+  unsigned int ktls;  /* hand TLS session keys to the kernel? */
+  unsigned int cmdtiming;  /* time command handlers for STATS m? */
 };
 
 /*
@@ -71,6 +74,10 @@ struct ServerStatistics
   unsigned int    is_kill; /* number of kills generated on collisions */
   unsigned int    is_asuc; /* successful auth requests */
   unsigned int    is_abad; /* bad auth requests */
+  unsigned int    is_tlsoff;   /* TLS handshake steps run by worker threads */
+  unsigned int    is_tlsshed;  /* TLS connections refused due to a full queue */
+  unsigned int    is_tlsres;   /* TLS sessions resumed from the cache or a ticket */
+  unsigned int    is_tlsfull;  /* TLS sessions that needed a full handshake */
 };
 
 struct Counter
@@ -86,6 +93,7 @@ struct Counter
 struct ServerState_t
 {
   unsigned int foreground;
+  unsigned int workers;  /* number of worker threads to start */
 };
 
 struct ServerTime
@@ -0,0 +1,66 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file list_index.h
+ * \brief Channel indexes and cached replies used by LIST.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_list_index_h
+#define INCLUDED_list_index_h
+
+#include "list.h"
+
+struct Channel;
+struct ListCountGroup;
+
+/*! \brief Per-channel index state, embedded in struct Channel */
+struct ListIndexEntry
+{
+  struct ListCountGroup *group;  /**< Group of channels with the same number of members */
+  dlink_node group_node;  /**< Entry in group->channels */
+  dlink_node pending;     /**< Entry in the list of channels not yet merged into
+                               the creation time table; data is NULL once merged */
+  uintmax_t created;      /**< Creation time the channel is indexed with */
+
+  char *reply;             /**< Cached RPL_LIST parameters; NULL if never built */
+  size_t reply_len;
+  unsigned int reply_mode;  /**< chptr->mode.mode the reply has been built with */
+  unsigned int reply_limit;
+  unsigned int reply_key;
+  unsigned int reply_stale;  /**< Set when the topic or member count has changed */
+};
+
+/*! \brief Called for every candidate of a lookup. Returning non-zero stops the walk. */
+typedef int (*list_index_cb)(struct Channel *, void *);
+
+extern void list_index_add(struct Channel *);
+extern void list_index_del(struct Channel *);
+extern void list_index_update(struct Channel *);
+extern void list_index_invalidate(struct Channel *);
+extern const char *list_index_reply(struct Channel *, size_t *);
+extern unsigned int list_index_count_users(unsigned int, unsigned int);
+extern unsigned int list_index_count_created(uintmax_t, uintmax_t);
+extern void list_index_find_users(unsigned int, unsigned int, list_index_cb, void *);
+extern void list_index_find_created(uintmax_t, uintmax_t, list_index_cb, void *);
+extern void list_index_count_memory(unsigned int *const, size_t *const,
+                                    unsigned int *const, size_t *const);
+#endif  /* INCLUDED_list_index_h */
@@ -32,11 +32,14 @@
 
 enum
 {
-  LISTENER_SSL    = 1 << 0,
-  LISTENER_HIDDEN = 1 << 1,
-  LISTENER_SERVER = 1 << 2
+  LISTENER_SSL       = 1 << 0,
+  LISTENER_HIDDEN    = 1 << 1,
+  LISTENER_SERVER    = 1 << 2,
+  LISTENER_REUSEPORT = 1 << 3
 };
 
+enum { LISTENER_REUSEPORT_MAX = 16 };  /**< Upper limit of sockets per listener */
+
 struct Listener
 {
   dlink_node node;           /**< Doubly linked list node */
@@ -46,7 +49,18 @@ struct Listener
   int active;                /**< Current state of listener */
   struct irc_ssaddr addr;    /**< Holds an IPv6 or IPv4 address */
   char name[HOSTIPLEN + 1];  /**< Holds an IPv6 or IPv4 address in string representation*/
-  unsigned int flags;        /**< Listener flags (ssl, hidden, server) */
+  unsigned int flags;        /**< Listener flags (ssl, hidden, server, reuseport) */
+
+  fde_t *reuseport_fd[LISTENER_REUSEPORT_MAX - 1];  /**< Additional SO_REUSEPORT sockets */
+  unsigned int reuseport_count;  /**< Number of additional sockets in use */
+
+  uintmax_t accepted;        /**< Statistics: connections accepted */
+  uintmax_t refused;         /**< Statistics: connections refused */
+  unsigned int budget_hits;  /**< Statistics: wakeups that ran out of accept budget */
+  unsigned int rate;         /**< Statistics: accepts during the last full second */
+  unsigned int rate_peak;    /**< Statistics: highest rate seen */
+  unsigned int rate_count;   /**< Accepts during the current second */
+  uintmax_t rate_time;       /**< Second rate_count belongs to */
 };
 
 extern const dlink_list *listener_get_list(void);
@@ -54,5 +68,6 @@ extern void listener_add(int, const char *, unsigned int);
 extern void listener_release(struct Listener *);
 extern void listener_close_marked(void);
 extern const char *listener_get_name(const struct Listener *);
+extern unsigned int listener_get_rate(const struct Listener *);
 extern void listener_count_memory(unsigned int *, size_t *);
 #endif
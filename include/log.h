@@ -47,12 +47,16 @@ struct LogFile
 {
   char *path;
   size_t size;
-  FILE *file;
+  int active;  /**< Lines are being written to path; main thread only */
 };
 
 extern void log_set_file(enum log_type, size_t, const char *);
 extern void log_free(struct LogFile *);
 extern void log_reopen(struct LogFile *);
 extern void log_iterate(void (*func)(struct LogFile *));
+extern void log_init(void);
+extern void log_flush(void);
+extern unsigned int log_queued(void);
+extern uintmax_t log_dropped(void);
 extern void ilog(enum log_type, const char *, ...) AFP(2,3);
 #endif  /* INCLUDED_log_h */
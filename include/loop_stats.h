@@ -0,0 +1,72 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file loop_stats.h
+ * \brief Timing and backlog counters of the main I/O loop.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_loop_stats_h
+#define INCLUDED_loop_stats_h
+
+/** Phases of one io_loop() iteration, in the order they are run */
+enum loop_phase
+{
+  LOOP_PHASE_LIST,    /**< safe_list_run() */
+  LOOP_PHASE_EVENTS,  /**< event_run() */
+  LOOP_PHASE_FLUSH,   /**< send_queued_deferred() */
+  LOOP_PHASE_WAIT,    /**< Blocked in epoll_wait() or the like */
+  LOOP_PHASE_IO,      /**< Read and write handlers run by comm_select() */
+  LOOP_PHASE_EXIT,    /**< exit_aborted_clients() */
+  LOOP_PHASE_FREE,    /**< free_exited_clients() */
+  LOOP_PHASE_SIGNAL,  /**< Rehash and MOTD reload requested by signals */
+  LOOP_PHASE_COUNT
+};
+
+struct loop_phase_stats
+{
+  uintmax_t sum;  /**< Time spent in the phase, in microseconds */
+  uintmax_t max;  /**< Longest single run, in microseconds */
+};
+
+struct loop_stats
+{
+  uintmax_t laps;            /**< io_loop() iterations */
+  uintmax_t busy_sum;        /**< Time spent outside of LOOP_PHASE_WAIT, in microseconds */
+  uintmax_t busy_max;        /**< Longest lap, not counting LOOP_PHASE_WAIT */
+  uintmax_t polls;           /**< comm_select() calls */
+  uintmax_t ready;           /**< Descriptors reported ready by all of these */
+  uintmax_t ready_max;       /**< Most descriptors reported ready by one call */
+  uintmax_t saturated;       /**< Calls that filled the whole event array */
+  uintmax_t flood_deferred;  /**< Clients left with unparsed lines by flood control */
+  struct loop_phase_stats phase[LOOP_PHASE_COUNT];
+};
+
+extern void loop_stats_init(void);
+extern void loop_stats_phase(enum loop_phase);
+extern void loop_stats_lap(void);
+extern void loop_stats_polled(int, unsigned int);
+extern void loop_stats_operation(const char *, uintmax_t);
+extern void loop_stats_flood_deferred(void);
+extern const char *loop_stats_phase_name(enum loop_phase);
+extern const struct loop_stats *loop_stats_get(void);
+extern unsigned int loop_stats_capacity(void);
+#endif  /* INCLUDED_loop_stats_h */
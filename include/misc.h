@@ -31,6 +31,8 @@ extern const char *date(uintmax_t);
 extern const char *date_iso8601(uintmax_t);
 extern const char *date_ctime(uintmax_t);
 extern const char *time_dissect(uintmax_t);
+extern const char *time_usec(uintmax_t, char *, size_t);
+extern uintmax_t clock_usec(void);
 extern void binary_to_hex(const unsigned char *, char *, unsigned int);
 
 /* Just blindly define our own MIN/MAX macro */
@@ -51,7 +51,11 @@ enum
   MAX_FLOOD_BURST = MAX_FLOOD * 8
 };
 
+struct dbuf_queue;
+
+extern unsigned int extract_one_line(struct dbuf_queue *, char *);
 extern void read_packet(fde_t *, void *);
+extern void read_packet_received(struct Client *, const char *, int);
 extern void flood_recalc(fde_t *, void *);
 extern void flood_endgrace(struct Client *);
 #endif  /* INCLUDED_packet_h */
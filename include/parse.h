@@ -68,6 +68,28 @@ typedef enum HandlerType
 /*
  * Message table structure
  */
+enum
+{
+  MESSAGE_TIMING_BUCKETS = 32  /**< Bucket i counts handler runs of [2^i, 2^(i+1)) clock ticks */
+};
+
+/** Where a command came from, for the purpose of accounting */
+enum message_origin
+{
+  MESSAGE_LOCAL,   /**< Sent by a directly connected client */
+  MESSAGE_REMOTE,  /**< Received over a server link */
+  MESSAGE_ORIGIN_COUNT
+};
+
+/*! \brief Time spent in the handlers of a command, see parse_handle_command() */
+struct MessageTiming
+{
+  uintmax_t calls;  /**< Number of timed handler runs */
+  uintmax_t total;  /**< Sum of all runs, in clock ticks */
+  uintmax_t max;    /**< Longest run, in clock ticks */
+  unsigned int bucket[MESSAGE_TIMING_BUCKETS];
+};
+
 struct Message
 {
   const char *cmd;
@@ -81,6 +103,7 @@ struct Message
   unsigned int args_max;    /* maximum permitted parameters */
   unsigned int flags;
   uintmax_t bytes;  /* bytes received for this message */
+  struct MessageTiming timing[MESSAGE_ORIGIN_COUNT];
 
   /* handlers:
    * UNREGISTERED, CLIENT, SERVER, ENCAP, OPER, LAST
@@ -99,6 +122,7 @@ extern void mod_add_cmd(struct Message *);
 extern void mod_del_cmd(struct Message *);
 extern struct Message *find_command(const char *);
 extern void report_messages(struct Client *);
+extern uintmax_t message_ticks_to_nsec(uintmax_t);
 
 /* generic handlers */
 extern int m_ignore(struct Client *, int, char *[]);
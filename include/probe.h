@@ -0,0 +1,59 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file probe.h
+ * \brief Static tracepoints (USDT probes) of the "ircd" provider.
+ * \version $Id$
+ *
+ * With --enable-usdt, each probe compiles to a single nop plus an ELF note
+ * that bpftrace, perf and SystemTap can attach to at run time. Otherwise
+ * the macros expand to nothing and their arguments are not evaluated.
+ * doc/probes.txt lists the probes and their arguments.
+ */
+
+#ifndef INCLUDED_probe_h
+#define INCLUDED_probe_h
+
+#ifdef HAVE_USDT
+#include <sys/sdt.h>
+
+/*
+ * <sys/sdt.h> casts every argument to its own __typeof, which fails for
+ * arrays such as client names. Adding 0 turns them into pointers and
+ * leaves integers as they are. Bit-fields have to be copied by the caller.
+ */
+#define IRCD_PROBE_ARG(x)                ((x) + 0)
+
+#define IRCD_PROBE0(name)                DTRACE_PROBE(ircd, name)
+#define IRCD_PROBE1(name, a)             DTRACE_PROBE1(ircd, name, IRCD_PROBE_ARG(a))
+#define IRCD_PROBE2(name, a, b)          DTRACE_PROBE2(ircd, name, IRCD_PROBE_ARG(a), IRCD_PROBE_ARG(b))
+#define IRCD_PROBE3(name, a, b, c)       DTRACE_PROBE3(ircd, name, IRCD_PROBE_ARG(a), IRCD_PROBE_ARG(b), \
+                                                       IRCD_PROBE_ARG(c))
+#define IRCD_PROBE4(name, a, b, c, d)    DTRACE_PROBE4(ircd, name, IRCD_PROBE_ARG(a), IRCD_PROBE_ARG(b), \
+                                                       IRCD_PROBE_ARG(c), IRCD_PROBE_ARG(d))
+#else
+#define IRCD_PROBE0(name)                ((void)0)
+#define IRCD_PROBE1(name, a)             ((void)0)
+#define IRCD_PROBE2(name, a, b)          ((void)0)
+#define IRCD_PROBE3(name, a, b, c)       ((void)0)
+#define IRCD_PROBE4(name, a, b, c, d)    ((void)0)
+#endif
+#endif  /* INCLUDED_probe_h */
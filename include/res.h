@@ -112,9 +112,21 @@ typedef struct
 
 typedef void (*dns_callback_fnc)(void *, const struct irc_ssaddr *, const char *, size_t);
 
+/*! \brief Statistics of the resolver's answer cache */
+struct resolver_cache_stats
+{
+  unsigned int entries;     /**< Cached answers */
+  size_t memory;            /**< Memory used by cached answers */
+  uintmax_t hits;           /**< Queries answered from the cache */
+  uintmax_t negative_hits;  /**< Queries answered with a cached failure */
+  uintmax_t misses;         /**< Queries that had to be sent to a nameserver */
+  uintmax_t evictions;      /**< Entries dropped due to the memory cap */
+};
+
 extern void resolver_init(void);
 extern void restart_resolver(void);
 extern void delete_resolver_queries(const void *);
 extern void gethost_byname_type(dns_callback_fnc , void *, const char *, int);
 extern void gethost_byaddr(dns_callback_fnc, void *, const struct irc_ssaddr *);
+extern void resolver_get_cache_stats(struct resolver_cache_stats *);
 #endif
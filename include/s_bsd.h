@@ -42,7 +42,7 @@ enum { SELECT_DELAY = 500 };
 struct Client;
 struct Listener;
 
-extern void add_connection(struct Listener *, struct irc_ssaddr *, int);
+extern void add_connection(struct Listener *, struct irc_ssaddr *, int, uintmax_t);
 extern void report_error(int, const char *, const char *, int);
 
 extern int comm_get_sockerr(int);
@@ -56,6 +56,10 @@ extern void comm_connect_tcp(fde_t *, const char *, unsigned short, struct socka
 extern const char *comm_errstr(int);
 extern int comm_socket(int, int, int);
 extern int comm_accept(int, struct irc_ssaddr *);
+extern void comm_tls_handshake(fde_t *, tls_role_t,
+                               void (*)(fde_t *, tls_handshake_status_t, const char *, void *), void *);
+extern void comm_tls_handshake_cancel(fde_t *);
+extern unsigned int comm_tls_handshake_pending(void);
 
 /* These must be defined in the network IO loop code of your choice */
 extern void comm_select_init(void);
@@ -44,6 +44,13 @@ enum
   SEND_LOCOPS
 };
 
+enum
+{
+  TLS_RECORD_SIZE_MIN  =  1400,  /**< Fits into a single TCP segment */
+  TLS_RECORD_SIZE_MAX  = 16384,  /**< Largest plaintext a TLS record can hold */
+  TLS_RECORD_IDLE_TIME =     1   /**< Seconds after which records start out small again */
+};
+
 /* Used when sending to $#mask or $$mask */
 enum
 {
@@ -56,12 +63,18 @@ enum
  */
 struct Channel;
 struct Client;
+struct dbuf_block;
 
 /* send.c prototypes */
+extern void send_format(struct dbuf_block *, const char *, va_list);
 extern void sendq_unblocked(fde_t *, void *);
 extern void send_queued_write(struct Client *);
+extern void send_queued_written(struct Client *, size_t, unsigned int, int);
 extern void send_queued_all(void);
+extern void send_queued_cancel(struct Client *);
+extern void send_queued_deferred(void);
 extern void sendto_one(struct Client *, const char *, ...) AFP(2,3);
+extern void sendto_one_deferred(struct Client *, const char *, size_t);
 extern void sendto_one_numeric(struct Client *, const struct Client *, enum irc_numerics, ...);
 extern void sendto_one_notice(struct Client *, const struct Client *, const char *, ...) AFP(3,4);
 extern void sendto_channel_butone(struct Client *, const struct Client *,
@@ -67,6 +67,7 @@
 
 #include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 
 #ifdef HAVE_SYS_WAIT_H
 #include <sys/wait.h>
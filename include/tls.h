@@ -69,6 +69,11 @@ extern int tls_write(tls_data_t *, const char *, size_t, int *);
 extern void tls_shutdown(tls_data_t *);
 
 extern int tls_set_ciphers(tls_data_t *, const char *);
+extern int tls_session_reused(tls_data_t *);
+
+extern int tls_ktls_enable(tls_data_t *);
+extern int tls_ktls_send(tls_data_t *);
+extern int tls_ktls_recv(tls_data_t *);
 
 extern int tls_verify_cert(tls_data_t *, tls_md_t, char **);
 
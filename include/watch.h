@@ -38,10 +38,20 @@ struct Watch
   char name[NICKLEN + 1];  /**< Name of the client to watch */
 };
 
+/*! \brief Counters shown by HASH */
+struct WatchStatistics
+{
+  uintmax_t lookups;   /**< Sign-ons and sign-offs that have been checked */
+  uintmax_t hits;      /**< Of which were on somebody's watch list */
+  uintmax_t notifies;  /**< RPL_LOGON/RPL_LOGOFF lines that have been queued */
+};
+
 extern void watch_add_to_hash_table(const char *, struct Client *);
 extern void watch_del_from_hash_table(const char *, struct Client *);
 extern void watch_check_hash(const struct Client *, const enum irc_numerics);
 extern void watch_del_watch_list(struct Client *);
 extern void watch_count_memory(unsigned int *const, size_t *const);
 extern struct Watch *watch_find_hash(const char *);
+extern const dlink_list *watch_get_bucket(unsigned int);
+extern const struct WatchStatistics *watch_get_statistics(void);
 #endif  /* INCLUDED_watch_h */
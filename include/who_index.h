@@ -0,0 +1,59 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file who_index.h
+ * \brief Secondary indexes of the global client list used by WHO.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_who_index_h
+#define INCLUDED_who_index_h
+
+#include "list.h"
+
+struct Client;
+struct WhoHostNode;
+struct WhoAddrLeaf;
+
+/*! \brief Per-client index state, embedded in struct Client */
+struct WhoIndexEntry
+{
+  struct WhoHostNode *host_node;  /**< Host trie node; NULL if the client isn't indexed */
+  struct WhoAddrLeaf *addr_leaf;  /**< Address tree leaf; NULL if the address is unknown */
+  unsigned int account_hash;      /**< Account hash bucket the client is linked to */
+  dlink_node host;     /**< Entry in host_node->clients */
+  dlink_node addr;     /**< Entry in addr_leaf->clients or the list of unknown addresses */
+  dlink_node account;  /**< Entry in the account hash; data is NULL if not logged in */
+  dlink_node oper;     /**< Entry in the oper list; data is NULL if not an oper */
+};
+
+/*! \brief Called for every candidate of a lookup. Returning non-zero stops the walk. */
+typedef int (*who_index_cb)(struct Client *, void *);
+
+extern void who_index_add(struct Client *);
+extern void who_index_del(struct Client *);
+extern void who_index_update(struct Client *);
+extern int who_index_find_host(const char *, who_index_cb, void *);
+extern int who_index_find_addr(const char *, who_index_cb, void *);
+extern int who_index_find_account(const char *, who_index_cb, void *);
+extern int who_index_find_oper(who_index_cb, void *);
+extern void who_index_count_memory(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_who_index_h */
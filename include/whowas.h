@@ -31,26 +31,38 @@
 #include "client.h"
 
 
+enum
+{
+  WHOWAS_STRINGS_AVG = 160  /**< Bytes of packed strings budgeted per entry */
+};
+
+/*! \brief A WHOWAS history entry. Entries are slots of one preallocated
+ *         ring; their strings are packed into a second, byte-sized ring.
+ *         Both are only valid until the entry is overwritten.
+ */
 struct Whowas
 {
-  dlink_node hnode;  /**< List node; linked into whowas_hash */
   dlink_node cnode;  /**< List node; linked into client->whowas_list */
-  dlink_node lnode;  /**< List node; linked into whowas_list */
+  uint32_t hnext;  /**< Next (older) slot in the same hash bucket */
+  uint32_t hprev;  /**< Previous (newer) slot in the same hash bucket */
+  uint32_t strings;  /**< Offset of the packed strings in the string ring */
+  uint32_t strings_len;  /**< Length of the packed strings */
   unsigned int hashv;  /**< Hash value derived from Whowas::name */
   unsigned int shide;  /**< Client's server is hidden */
   uintmax_t logoff;  /**< When the client logged off */
-  char account[ACCOUNTLEN + 1];  /**< Services account */
-  char name[NICKLEN + 1];  /**< Client's nick name */
-  char username[USERLEN + 1];  /**< Client's user name */
-  char hostname[HOSTLEN + 1];  /**< Client's host name */
-  char realhost[HOSTLEN + 1];  /**< Client's real host name */
-  char sockhost[HOSTIPLEN + 1];  /**< Client's IP address as string */
-  char realname[REALLEN + 1];  /**< Client's real name/gecos */
-  char servername[HOSTLEN + 1];  /**< Name of the server the client is using */
+  const char *account;  /**< Services account */
+  const char *name;  /**< Client's nick name */
+  const char *username;  /**< Client's user name */
+  const char *hostname;  /**< Client's host name */
+  const char *realhost;  /**< Client's real host name */
+  const char *sockhost;  /**< Client's IP address as string */
+  const char *realname;  /**< Client's real name/gecos */
+  const char *servername;  /**< Name of the server the client is using */
   struct Client *online;  /**< Pointer to new nick name for chasing or NULL */
 };
 
-extern const dlink_list *whowas_get_hash(unsigned int);
+extern const struct Whowas *whowas_get_hash(unsigned int);
+extern const struct Whowas *whowas_next(const struct Whowas *);
 extern void whowas_trim(void);
 extern void whowas_add_history(struct Client *, const int);
 extern void whowas_off_history(struct Client *);
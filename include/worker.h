@@ -0,0 +1,85 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file worker.h
+ * \brief Worker threads for work that is moved off the main loop.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_worker_h
+#define INCLUDED_worker_h
+
+enum
+{
+  WORKER_MAX        =   64,  /**< Upper limit of worker threads */
+  WORKER_QUEUE_SIZE = 1024   /**< Slots per queue; must be a power of two */
+};
+
+struct worker;
+
+/*! \brief A unit of work handed to a worker thread
+ *
+ * run() is executed on a worker thread and must not touch any state that
+ * is owned by the main loop. Once it has returned, done() is called from
+ * within the main loop and is free to use everything again. A job that
+ * has to wait for its descriptor can be kept by calling worker_hold()
+ * from within run(), and is finished later with worker_post().
+ */
+struct worker_job
+{
+  void (*run)(struct worker_job *);   /**< Executed on a worker thread; NULL for worker_post() */
+  void (*done)(struct worker_job *);  /**< Executed on the main thread */
+  void *data;  /**< Opaque pointer for the submitter */
+
+  struct worker *worker;  /**< Worker the job has been queued on */
+  struct worker_job *next;  /**< Overflow list while the ring is full */
+  unsigned int held;  /**< run() has called worker_hold() */
+};
+
+/*! \brief A descriptor that is polled by a worker thread
+ *
+ * All members are owned by the worker thread the descriptor has been
+ * added to with worker_watch().
+ */
+struct worker_fd
+{
+  int fd;
+  short events;  /**< poll() events of interest; none stops polling the descriptor */
+  void (*handler)(struct worker_fd *, short);  /**< Called with the returned events */
+  unsigned int index;  /**< Slot in the worker's poll set */
+};
+
+extern void worker_init(unsigned int);
+extern int worker_submit(struct worker_job *);
+extern void worker_submit_to(struct worker *, struct worker_job *);
+extern struct worker *worker_assign(void);
+extern void worker_unassign(struct worker *);
+extern unsigned int worker_count(void);
+extern unsigned int worker_sockets(void);
+extern unsigned int worker_queued(void);
+extern uintmax_t worker_completed(void);
+
+/* Worker thread only */
+extern void worker_hold(struct worker_job *);
+extern void worker_post(struct worker *, struct worker_job *);
+extern void worker_watch(struct worker *, struct worker_fd *);
+extern void worker_unwatch(struct worker *, struct worker_fd *);
+#endif  /* INCLUDED_worker_h */
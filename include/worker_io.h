@@ -0,0 +1,42 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file worker_io.h
+ * \brief Client sockets that are read from and written to by worker threads.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_worker_io_h
+#define INCLUDED_worker_io_h
+
+#include "fdlist.h"
+
+enum
+{
+  WORKER_IO_READBUF_SIZE = 16384,  /**< Bytes read at once */
+  WORKER_IO_BLOCK_SIZE   = 32768   /**< Largest part of a sendq handed to a worker at once */
+};
+
+extern int worker_io_attach(struct Client *);
+extern void worker_io_detach(fde_t *);
+extern void worker_io_send(struct Client *);
+extern const char *worker_io_cipher(const fde_t *);
+#endif  /* INCLUDED_worker_io_h */
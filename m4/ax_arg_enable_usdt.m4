@@ -0,0 +1,7 @@
+AC_DEFUN([AX_ARG_ENABLE_USDT],[
+  AC_ARG_ENABLE([usdt],[AS_HELP_STRING([--enable-usdt],[Enable USDT probes for tracing with bpftrace, perf or SystemTap (needs sys/sdt.h).])],[usdt="$enableval"],[usdt="no"])
+
+  AS_IF([test "$usdt" = "yes"], [
+    AC_CHECK_HEADER(sys/sdt.h, [AC_DEFINE(HAVE_USDT, 1, [Define to 1 to compile in USDT probes.])], [AC_MSG_FAILURE([sys/sdt.h not found; install the SystemTap SDT headers])])
+  ])
+])
@@ -167,6 +167,8 @@ ms_join(struct Client *source_p, int parc, char *parv[])
   else
     keep_new_modes = 0;
 
+  list_index_update(chptr);
+
   if (!keep_new_modes)
     mode = *oldmode;
   else if (keep_our_modes)
@@ -104,6 +104,7 @@ set_user_mode(struct Client *source_p, const int parc, char *parv[])
           {
             ++Count.oper;
             SetOper(source_p);
+            who_index_update(source_p);
           }
         }
         else
@@ -113,6 +114,7 @@ set_user_mode(struct Client *source_p, const int parc, char *parv[])
 
           ClearOper(source_p);
           --Count.oper;
+          who_index_update(source_p);
 
           if (MyConnect(source_p))
           {
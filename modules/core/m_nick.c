@@ -373,8 +373,7 @@ uid_from_server(struct Client *source_p, int parc, char *parv[])
   hash_add_client(client_p);
   hash_add_id(client_p);
 
-  struct ip_entry *ipcache = ipcache_find_or_add_address(&client_p->ip);
-  ++ipcache->count_remote;
+  ipcache_add_address(&client_p->ip, 0);
   AddFlag(client_p, FLAGS_IPHASH);
 
   /* Parse user modes */
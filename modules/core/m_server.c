@@ -46,6 +46,7 @@
 #include "memory.h"
 #include "modules.h"
 #include "fdlist.h"
+#include "worker_io.h"
 
 
 /*! Parses server flags to be potentially set
@@ -291,16 +292,16 @@ server_estab(struct Client *client_p)
     /* Show the real host/IP to admins */
     sendto_realops_flags(UMODE_SERVNOTICE, L_ADMIN, SEND_NOTICE,
                          "Link with %s established: [TLS: %s] (Capabilities: %s)",
-                         client_get_name(client_p, SHOW_IP), tls_get_cipher(&client_p->connection->fd->ssl),
+                         client_get_name(client_p, SHOW_IP), worker_io_cipher(client_p->connection->fd),
                          capab_get(client_p));
 
     /* Now show the masked hostname/IP to opers */
     sendto_realops_flags(UMODE_SERVNOTICE, L_OPER, SEND_NOTICE,
                          "Link with %s established: [TLS: %s] (Capabilities: %s)",
-                         client_get_name(client_p, MASK_IP), tls_get_cipher(&client_p->connection->fd->ssl),
+                         client_get_name(client_p, MASK_IP), worker_io_cipher(client_p->connection->fd),
                          capab_get(client_p));
     ilog(LOG_TYPE_IRCD, "Link with %s established: [TLS: %s] (Capabilities: %s)",
-         client_get_name(client_p, SHOW_IP), tls_get_cipher(&client_p->connection->fd->ssl),
+         client_get_name(client_p, SHOW_IP), worker_io_cipher(client_p->connection->fd),
          capab_get(client_p));
   }
   else
@@ -198,6 +198,8 @@ ms_sjoin(struct Client *source_p, int parc, char *parv[])
     tstosend = oldts;
   }
 
+  list_index_update(chptr);
+
   if (!keep_new_modes)
     mode = *oldmode;
   else if (keep_our_modes)
@@ -41,6 +41,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 static void
@@ -192,6 +193,7 @@ dline_handle(struct Client *source_p, const char *addr, const char *reason, uint
          get_oper_name(source_p), conf->host, conf->reason);
   }
 
+  journal_add_conf(conf);
   dline_check(add_conf_by_address(CONF_DLINE, conf));
 }
 
@@ -59,6 +59,8 @@ report_this_status(struct Client *source_p, const struct Client *target_p)
                      target_p->username,
                      target_p->host,
                      target_p->sockhost,
+                     accounting_summary(target_p),
+                     client_get_tls_mode(target_p),
                      target_p->info);
 }
 
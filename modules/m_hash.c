@@ -33,6 +33,7 @@
 #include "send.h"
 #include "parse.h"
 #include "modules.h"
+#include "watch.h"
 
 
 /*! \brief HASH command handler
@@ -117,6 +118,32 @@ mo_hash(struct Client *source_p, int parc, char *parv[])
 
   sendto_one_notice(source_p, &me, ":Id: entries: %u buckets: %u "
                     "max chain: %u", count, buckets, max_chain);
+
+  count     = 0;
+  buckets   = 0;
+  max_chain = 0;
+
+  for (i = 0; i < HASHSIZE; ++i)
+  {
+    const unsigned int len = dlink_list_length(watch_get_bucket(i));
+
+    if (len)
+    {
+      ++buckets;
+      if (len > max_chain)
+        max_chain = len;
+      count += len;
+    }
+  }
+
+  const struct WatchStatistics *const stats = watch_get_statistics();
+
+  sendto_one_notice(source_p, &me, ":Watch: entries: %u buckets: %u "
+                    "max chain: %u", count, buckets, max_chain);
+  sendto_one_notice(source_p, &me, ":Watch: lookups: %ju hits: %ju (%.1f%%) "
+                    "notifies: %ju", stats->lookups, stats->hits,
+                    stats->lookups ? stats->hits * 100.0 / stats->lookups : 0.0,
+                    stats->notifies);
   return 0;
 }
 
@@ -41,6 +41,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 static void
@@ -183,6 +184,7 @@ kline_handle(struct Client *source_p, const char *user, const char *host,
          get_oper_name(source_p), conf->user, conf->host, conf->reason);
   }
 
+  journal_add_conf(conf);
   kline_check(add_conf_by_address(CONF_KLINE, conf));
 }
 
@@ -52,6 +52,7 @@ oper_up(struct Client *source_p)
 
   ++Count.oper;
   SetOper(source_p);
+  who_index_update(source_p);
 
   if (conf->modes)
     AddUMode(source_p, conf->modes);
@@ -38,6 +38,7 @@
 #include "conf_resv.h"
 #include "conf_shared.h"
 #include "log.h"
+#include "conf_db.h"
 
 
 /* parse_resv()
@@ -112,6 +113,8 @@ resv_handle(struct Client *source_p, const char *mask, uintmax_t duration, const
     ilog(LOG_TYPE_RESV, "%s added RESV for [%s] [%s]",
          get_oper_name(source_p), resv->mask, resv->reason);
   }
+
+  journal_add_resv(resv);
 }
 
 /* mo_resv()
@@ -237,6 +237,54 @@ quote_jfloodcount(struct Client *source_p, const char *arg, int newval)
                       GlobalSetOptions.joinfloodcount);
 }
 
+/* SET KTLS */
+static void
+quote_ktls(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval >= 0)
+  {
+    GlobalSetOptions.ktls = newval != 0;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed KTLS to %u",
+                         get_oper_name(source_p), GlobalSetOptions.ktls);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":KTLS is currently %u",
+                      GlobalSetOptions.ktls);
+}
+
+/* SET TLSQUEUE */
+static void
+quote_tlsqueue(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval > 0)
+  {
+    GlobalSetOptions.tls_handshake_queue = newval;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed TLSQUEUE to %u",
+                         get_oper_name(source_p), GlobalSetOptions.tls_handshake_queue);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":TLSQUEUE is currently %u",
+                      GlobalSetOptions.tls_handshake_queue);
+}
+
+/* SET CMDTIMING */
+static void
+quote_cmdtiming(struct Client *source_p, const char *arg, int newval)
+{
+  if (newval >= 0)
+  {
+    GlobalSetOptions.cmdtiming = newval != 0;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed CMDTIMING to %u",
+                         get_oper_name(source_p), GlobalSetOptions.cmdtiming);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":CMDTIMING is currently %u",
+                      GlobalSetOptions.cmdtiming);
+}
+
 /* Structure used for the SET table itself */
 struct SetStruct
 {
@@ -269,6 +317,9 @@ static const struct SetStruct set_cmd_table[] =
   { "SPAMTIME",         quote_spamtime,         0,      1 },
   { "JFLOODTIME",       quote_jfloodtime,       0,      1 },
   { "JFLOODCOUNT",      quote_jfloodcount,      0,      1 },
+  { "KTLS",             quote_ktls,             0,      1 },
+  { "TLSQUEUE",         quote_tlsqueue,         0,      1 },
+  { "CMDTIMING",        quote_cmdtiming,        0,      1 },
   /* -------------------------------------------------------- */
   { NULL,               NULL,                   0,      0 }
 };
@@ -26,6 +26,7 @@
 
 #include "stdinc.h"
 #include "list.h"
+#include "admission.h"
 #include "client.h"
 #include "irc_string.h"
 #include "ircd.h"
@@ -43,6 +44,7 @@
 #include "numeric.h"
 #include "send.h"
 #include "fdlist.h"
+#include "s_bsd.h"
 #include "misc.h"
 #include "server.h"
 #include "server_capab.h"
@@ -50,9 +52,14 @@
 #include "modules.h"
 #include "whowas.h"
 #include "watch.h"
+#include "list_index.h"
+#include "res.h"
 #include "reslib.h"
 #include "motd.h"
 #include "ipcache.h"
+#include "worker.h"
+#include "log.h"
+#include "loop_stats.h"
 
 
 static void
@@ -300,6 +307,14 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   unsigned int listener_count = 0;
   size_t listener_memory = 0;
 
+  unsigned int who_index_count = 0;
+  size_t who_index_memory = 0;
+
+  unsigned int list_index_count = 0;
+  size_t list_index_memory = 0;
+  unsigned int list_reply_count = 0;
+  size_t list_reply_memory = 0;
+
 
   DLINK_FOREACH(node, local_server_list.head)
   {
@@ -351,6 +366,8 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
 
       DLINK_FOREACH(node2, acptr->connection->list_task->hide_mask.head)
         safelist_memory += strlen(node2->data);
+
+      safelist_memory += acptr->connection->list_task->snapshot_size;
     }
   }
 
@@ -367,6 +384,11 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      dlink_list_length(&global_client_list),
                      dlink_list_length(&global_client_list) * sizeof(struct Client));
 
+  who_index_count_memory(&who_index_count, &who_index_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :WHO index nodes %u(%zu)",
+                     who_index_count, who_index_memory);
+
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Servers %u(%zu, %zu)",
                      dlink_list_length(&global_server_list),
@@ -423,6 +445,13 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      "z :Safelist %u(%zu)",
                      safelist_count, safelist_memory);
 
+  list_index_count_memory(&list_index_count, &list_index_memory,
+                          &list_reply_count, &list_reply_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :LIST index %u(%zu) cached replies %u(%zu)",
+                     list_index_count, list_index_memory,
+                     list_reply_count, list_reply_memory);
+
   whowas_count_memory(&wwu, &wwm);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Whowas users %u(%zu)", wwu, wwm);
@@ -457,6 +486,14 @@ stats_dns_servers(struct Client *source_p, int parc, char *parv[])
                 sizeof(ipaddr), NULL, 0, NI_NUMERICHOST);
     sendto_one_numeric(source_p, &me, RPL_STATSALINE, ipaddr);
   }
+
+  struct resolver_cache_stats cache;
+  resolver_get_cache_stats(&cache);
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "A :DNS cache entries %u (%zu bytes) hits %ju negative hits %ju misses %ju evictions %ju",
+                     cache.entries, cache.memory, cache.hits, cache.negative_hits,
+                     cache.misses, cache.evictions);
 }
 
 /* stats_deny()
@@ -900,6 +937,7 @@ show_ports(struct Client *source_p)
   {
     char buf[8];
     char *p = buf;
+    char counters[128] = "";
     const struct Listener *listener = node->data;
 
     if (listener->flags & LISTENER_HIDDEN)
@@ -913,17 +951,26 @@ show_ports(struct Client *source_p)
       *p++ = 'S';
     if (listener->flags & LISTENER_SSL)
       *p++ = 's';
+    if (listener->flags & LISTENER_REUSEPORT)
+      *p++ = 'R';
     *p = '\0';
 
+    if (HasUMode(source_p, UMODE_OPER))
+      snprintf(counters, sizeof(counters),
+               " sockets %u accepted %ju refused %ju rate %u/s peak %u/s budget %u",
+               listener->reuseport_count + (listener->fd != NULL),
+               listener->accepted, listener->refused, listener_get_rate(listener),
+               listener->rate_peak, listener->budget_hits);
+
     if (HasUMode(source_p, UMODE_ADMIN) && !ConfigServerHide.hide_server_ips)
       sendto_one_numeric(source_p, &me, RPL_STATSPLINE, 'P', listener->port,
                          listener->name,
                          listener->ref_count, buf,
-                         listener->active ? "active" : "disabled");
+                         listener->active ? "active" : "disabled", counters);
     else
       sendto_one_numeric(source_p, &me, RPL_STATSPLINE, 'P', listener->port,
                          me.name, listener->ref_count, buf,
-                         listener->active ? "active" : "disabled");
+                         listener->active ? "active" : "disabled", counters);
   }
 }
 
@@ -996,6 +1043,63 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :time connected %ju %ju",
                      sp.is_cti, sp.is_sti);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :worker threads %u sockets %u jobs queued %u completed %ju",
+                     worker_count(), worker_sockets(), worker_queued(), worker_completed());
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :log bytes queued %u lines dropped %ju",
+                     log_queued(), log_dropped());
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :TLS handshakes offloaded %u pending %u shed %u",
+                     sp.is_tlsoff, comm_tls_handshake_pending(), sp.is_tlsshed);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :TLS sessions resumed %u full %u",
+                     sp.is_tlsres, sp.is_tlsfull);
+}
+
+static void
+stats_admission(struct Client *source_p, int parc, char *parv[])
+{
+  for (unsigned int i = 0; i < ADMISSION_STAGE_COUNT; ++i)
+  {
+    const struct admission_histogram *const h = admission_histogram_get(i);
+    char avg[32], p50[32], p99[32], max[32];
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "r :%-8s samples %ju avg %s p50 %s p99 %s max %s",
+                       admission_stage_name(i), h->count,
+                       time_usec(h->count ? h->sum / h->count : 0, avg, sizeof(avg)),
+                       time_usec(admission_percentile(i, 50), p50, sizeof(p50)),
+                       time_usec(admission_percentile(i, 99), p99, sizeof(p99)),
+                       time_usec(h->max, max, sizeof(max)));
+  }
+}
+
+static void
+stats_loop(struct Client *source_p, int parc, char *parv[])
+{
+  const struct loop_stats *const s = loop_stats_get();
+  char avg[32], max[32];
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "w :laps %ju busy avg %s max %s",
+                     s->laps,
+                     time_usec(s->laps ? s->busy_sum / s->laps : 0, avg, sizeof(avg)),
+                     time_usec(s->busy_max, max, sizeof(max)));
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "w :polls %ju ready avg %ju max %ju event array %u full %ju",
+                     s->polls, s->polls ? s->ready / s->polls : 0, s->ready_max,
+                     loop_stats_capacity(), s->saturated);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "w :clients deferred by flood control %ju",
+                     s->flood_deferred);
+
+  for (unsigned int i = 0; i < LOOP_PHASE_COUNT; ++i)
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "w :%-6s avg %s max %s",
+                       loop_stats_phase_name(i),
+                       time_usec(s->laps ? s->phase[i].sum / s->laps : 0, avg, sizeof(avg)),
+                       time_usec(s->phase[i].max, max, sizeof(max)));
 }
 
 static void
@@ -1068,6 +1172,26 @@ stats_class(struct Client *source_p, int parc, char *parv[])
   }
 }
 
+/* stats_tls_records()
+ *
+ * inputs       - pointer to a local client
+ * output       - " TLS:<n>" with n being the average number of bytes
+ *                per TLS record written, or an empty string
+ * side effects - NONE
+ */
+static const char *
+stats_tls_records(const struct Client *target_p)
+{
+  static char buf[32];
+
+  if (target_p->connection->tls.records == 0)
+    return "";
+
+  snprintf(buf, sizeof(buf), " TLS:%ju",
+           target_p->connection->send.bytes / target_p->connection->tls.records);
+  return buf;
+}
+
 static void
 stats_servlinks(struct Client *source_p, int parc, char *parv[])
 {
@@ -1092,7 +1216,7 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
     sendB += target_p->connection->send.bytes;
     recvB += target_p->connection->recv.bytes;
 
-    /* ":%s 211 %s %s %u %u %ju %u %ju :%u %u %s" */
+    /* ":%s 211 %s %s %u %u %ju %u %ju :%u %u %s%s%s" */
     sendto_one_numeric(source_p, &me, RPL_STATSLINKINFO,
                client_get_name(target_p, HasUMode(source_p, UMODE_ADMIN) ? SHOW_IP : MASK_IP),
                dbuf_length(&target_p->connection->buf_sendq),
@@ -1102,7 +1226,9 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
                target_p->connection->recv.bytes >> 10,
                (unsigned int)(CurrentTime - target_p->connection->firsttime),
                (CurrentTime > target_p->connection->since) ? (unsigned int)(CurrentTime - target_p->connection->since) : 0,
-               HasUMode(source_p, UMODE_OPER) ? capab_get(target_p) : "TS");
+               HasUMode(source_p, UMODE_OPER) ? capab_get(target_p) : "TS",
+               stats_tls_records(target_p),
+               accounting_summary(target_p));
   }
 
   sendB >>= 10;
@@ -1201,7 +1327,9 @@ stats_L_list(struct Client *source_p, const char *name, int doall, int wilds,
                        target_p->connection->recv.bytes >> 10,
                        (unsigned int)(CurrentTime - target_p->connection->firsttime),
                        (CurrentTime > target_p->connection->since) ? (unsigned int)(CurrentTime - target_p->connection->since) : 0,
-                       IsServer(target_p) ? capab_get(target_p) : "-");
+                       IsServer(target_p) ? capab_get(target_p) : "-",
+                       stats_tls_records(target_p),
+                       accounting_summary(target_p));
   }
 }
 
@@ -1275,6 +1403,8 @@ static const struct StatsStruct  stats_tab[] =
   { 'P',  stats_ports,       0           },
   { 'q',  stats_resv,        UMODE_OPER  },
   { 'Q',  stats_resv,        UMODE_OPER  },
+  { 'r',  stats_admission,   UMODE_OPER  },
+  { 'R',  stats_admission,   UMODE_OPER  },
   { 's',  stats_pseudo,      UMODE_OPER  },
   { 'S',  stats_service,     UMODE_OPER  },
   { 't',  stats_tstats,      UMODE_OPER  },
@@ -1282,6 +1412,8 @@ static const struct StatsStruct  stats_tab[] =
   { 'u',  stats_uptime,      0           },
   { 'U',  stats_shared,      UMODE_OPER  },
   { 'v',  stats_servers,     UMODE_OPER  },
+  { 'w',  stats_loop,        UMODE_OPER  },
+  { 'W',  stats_loop,        UMODE_OPER  },
   { 'x',  stats_gecos,       UMODE_OPER  },
   { 'X',  stats_gecos,       UMODE_OPER  },
   { 'y',  stats_class,       UMODE_OPER  },
@@ -0,0 +1,185 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file m_top.c
+ * \brief Includes required functions for processing the TOP command.
+ * \version $Id$
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "accounting.h"
+#include "ircd.h"
+#include "misc.h"
+#include "numeric.h"
+#include "send.h"
+#include "parse.h"
+#include "modules.h"
+
+
+enum
+{
+  TOP_DEFAULT =  10,  /**< Connections listed if no count is given */
+  TOP_MAX     = 100   /**< Most connections listed at once */
+};
+
+struct top_entry
+{
+  const struct Client *client_p;
+  uintmax_t cpu;
+  uintmax_t output;
+};
+
+/*! \brief Tells whether a connection has been more expensive than another one.
+ *         Time spent in handlers is what counts, output breaks ties.
+ */
+static int
+top_before(const struct top_entry *a, const struct top_entry *b)
+{
+  if (a->cpu != b->cpu)
+    return a->cpu > b->cpu;
+  return a->output > b->output;
+}
+
+/* top_collect()
+ *
+ * inputs       - list of local clients
+ *              - array holding the most expensive connections seen so far
+ *              - number of entries in use
+ *              - number of entries wanted
+ * output       - number of entries in use afterwards
+ * side effects - connections from list are sorted into the array
+ */
+static unsigned int
+top_collect(const dlink_list *list, struct top_entry *top, unsigned int used,
+            unsigned int count)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, list->head)
+  {
+    const struct Client *target_p = node->data;
+    const struct Accounting *const accounting = &target_p->connection->accounting;
+    struct top_entry entry = { .client_p = target_p };
+
+    entry.cpu = accounting_recent_cpu(accounting);
+    entry.output = accounting_recent_output(accounting);
+
+    if (entry.cpu == 0 && entry.output == 0)
+      continue;
+
+    if (used == count && !top_before(&entry, &top[used - 1]))
+      continue;
+
+    unsigned int i = used < count ? used++ : used - 1;
+    for (; i && top_before(&entry, &top[i - 1]); --i)
+      top[i] = top[i - 1];
+    top[i] = entry;
+  }
+
+  return used;
+}
+
+/*! \brief TOP command handler
+ *
+ * \param source_p Pointer to allocated Client struct from which the message
+ *                 originally comes from.  This can be a local or remote client.
+ * \param parc     Integer holding the number of supplied arguments.
+ * \param parv     Argument vector where parv[0] .. parv[parc-1] are non-NULL
+ *                 pointers.
+ * \note Valid arguments for this command are:
+ *      - parv[0] = command
+ *      - parv[1] = number of connections to list
+ */
+static int
+mo_top(struct Client *source_p, int parc, char *parv[])
+{
+  struct top_entry top[TOP_MAX];
+  unsigned int count = TOP_DEFAULT, used = 0;
+
+  if (parc > 1)
+  {
+    int i = atoi(parv[1]);
+
+    if (i > 0)
+      count = IRCD_MIN(i, TOP_MAX);
+  }
+
+  used = top_collect(&local_client_list, top, used, count);
+  used = top_collect(&local_server_list, top, used, count);
+  used = top_collect(&unknown_list, top, used, count);
+
+  sendto_one_notice(source_p, &me, ":TOP %u connection(s) over the last %u-%u seconds%s",
+                    used, ACCOUNTING_WINDOW, ACCOUNTING_WINDOW * 2,
+                    GlobalSetOptions.cmdtiming ? "" : " (CMDTIMING is off)");
+  sendto_one_notice(source_p, &me, ":TOP rank name CPU recent/total (ms) "
+                    "OUT recent/total (KB) SQ/RQ peak (KB)");
+
+  for (unsigned int i = 0; i < used; ++i)
+  {
+    const struct Client *target_p = top[i].client_p;
+    const struct Accounting *const accounting = &target_p->connection->accounting;
+
+    sendto_one_notice(source_p, &me, ":TOP %2u %s %ju.%03ju/%ju.%03ju %ju/%ju %zu/%zu",
+                      i + 1,
+                      client_get_name(target_p, HasUMode(source_p, UMODE_ADMIN) ? SHOW_IP : MASK_IP),
+                      accounting_cpu_usec(top[i].cpu) / 1000,
+                      accounting_cpu_usec(top[i].cpu) % 1000,
+                      accounting_cpu_usec(accounting->cpu) / 1000,
+                      accounting_cpu_usec(accounting->cpu) % 1000,
+                      top[i].output >> 10, accounting->output >> 10,
+                      accounting->sendq_peak >> 10, accounting->recvq_peak >> 10);
+  }
+
+  sendto_one_notice(source_p, &me, ":End of TOP");
+  return 0;
+}
+
+static struct Message top_msgtab =
+{
+  .cmd = "TOP",
+  .args_max = MAXPARA,
+  .handlers[UNREGISTERED_HANDLER] = m_unregistered,
+  .handlers[CLIENT_HANDLER] = m_not_oper,
+  .handlers[SERVER_HANDLER] = m_ignore,
+  .handlers[ENCAP_HANDLER] = m_ignore,
+  .handlers[OPER_HANDLER] = mo_top
+};
+
+static void
+module_init(void)
+{
+  mod_add_cmd(&top_msgtab);
+}
+
+static void
+module_exit(void)
+{
+  mod_del_cmd(&top_msgtab);
+}
+
+struct module module_entry =
+{
+  .version = "$Revision$",
+  .modinit = module_init,
+  .modexit = module_exit,
+};
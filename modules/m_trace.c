@@ -90,12 +90,16 @@ report_this_status(struct Client *source_p, const struct Client *target_p)
         sendto_one_numeric(source_p, &me, RPL_TRACEOPERATOR, class_name, name,
                            target_p->sockhost,
                            CurrentTime - target_p->connection->lasttime,
-                           client_get_idle_time(source_p, target_p));
+                           client_get_idle_time(source_p, target_p),
+                           accounting_summary(target_p),
+                           client_get_tls_mode(target_p));
       else
         sendto_one_numeric(source_p, &me, RPL_TRACEUSER, class_name, name,
                            target_p->sockhost,
                            CurrentTime - target_p->connection->lasttime,
-                           client_get_idle_time(source_p, target_p));
+                           client_get_idle_time(source_p, target_p),
+                           accounting_summary(target_p),
+                           client_get_tls_mode(target_p));
       break;
     case STAT_SERVER:
     {
@@ -41,6 +41,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 /* static int remove_tkline_match(const char *host, const char *user)
@@ -72,6 +73,7 @@ kline_remove(const char *user, const char *host)
   {
     if (IsConfDatabase(conf))
     {
+      journal_del_conf(conf);
       delete_one_address_conf(host, conf);
       return 1;
     }
@@ -40,6 +40,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 static void
@@ -63,6 +64,7 @@ resv_remove(struct Client *source_p, const char *mask)
     return;
   }
 
+  journal_del_resv(resv);
   resv_delete(resv);
 
   if (IsClient(source_p))
@@ -40,6 +40,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 /* static int remove_tkline_match(const char *host, const char *user)
@@ -57,6 +58,7 @@ xline_remove(const char *mask)
   {
     if (gecos->in_database)
     {
+      journal_del_gecos(gecos);
       gecos_delete(gecos);
       return 1;
     }
@@ -38,14 +38,178 @@
 #include "conf.h"
 #include "parse.h"
 #include "modules.h"
+#include "isupport.h"
+#include "who_index.h"
 
 
 enum { WHO_MAX_REPLIES = 500 };
 
+/** Fields a mask is matched against; selected with the flags in front of '%' */
+enum
+{
+  WHO_MATCH_NICK    = 1 << 0,
+  WHO_MATCH_USER    = 1 << 1,
+  WHO_MATCH_HOST    = 1 << 2,
+  WHO_MATCH_IP      = 1 << 3,
+  WHO_MATCH_SERVER  = 1 << 4,
+  WHO_MATCH_REAL    = 1 << 5,
+  WHO_MATCH_ACCOUNT = 1 << 6,
+  WHO_MATCH_DEFAULT = WHO_MATCH_NICK | WHO_MATCH_USER | WHO_MATCH_HOST |
+                      WHO_MATCH_IP | WHO_MATCH_SERVER | WHO_MATCH_REAL
+};
+
+/** WHOX fields that may follow the '%', in the order they are sent in */
+static const char who_fields[] = "tcuihsnfdlaor";
+
+struct who_query
+{
+  struct Client *source_p;
+  const char *mask;  /**< Mask to match; NULL matches everybody */
+  int userhost;      /**< mask is of the form nick!user@host */
+  char nick[IRCD_BUFSIZE];  /**< Parts of a nick!user@host mask */
+  char user[IRCD_BUFSIZE];
+  char host[IRCD_BUFSIZE];
+  unsigned int match;   /**< WHO_MATCH_* fields mask is matched against */
+  unsigned int fields;  /**< Bit i is set if who_fields[i] has been requested */
+  char token[4];        /**< Query type sent as the 't' field */
+  int server_oper;      /**< Show opers only */
+  unsigned int replies;  /**< Replies sent by a global WHO so far */
+};
+
+
+/* who_parse_options()
+ *
+ * inputs       - pointer to query
+ *              - options of the form [flags][%fields[,querytype]]
+ * output       - NONE
+ * side effects - fills in which fields to match and which ones to send
+ */
+static void
+who_parse_options(struct who_query *query, const char *options)
+{
+  for (; *options && *options != '%'; ++options)
+  {
+    switch (*options)
+    {
+      case 'o': query->server_oper = 1; break;
+      case 'n': query->match |= WHO_MATCH_NICK; break;
+      case 'u': query->match |= WHO_MATCH_USER; break;
+      case 'h': query->match |= WHO_MATCH_HOST; break;
+      case 'i': query->match |= WHO_MATCH_IP; break;
+      case 's': query->match |= WHO_MATCH_SERVER; break;
+      case 'r': query->match |= WHO_MATCH_REAL; break;
+      case 'a': query->match |= WHO_MATCH_ACCOUNT; break;
+      default: break;
+    }
+  }
+
+  if (*options == '%')
+  {
+    for (++options; *options && *options != ','; ++options)
+    {
+      const char *const p = strchr(who_fields, *options);
+
+      if (p && *p)
+        query->fields |= 1 << (p - who_fields);
+    }
+
+    if (*options == ',')
+    {
+      const char *const token = options + 1;
+      size_t len = strspn(token, "0123456789");
+
+      if (len && len < sizeof(query->token) && token[len] == '\0')
+        strlcpy(query->token, token, sizeof(query->token));
+    }
+  }
+}
+
+/* who_send_whox()
+ *
+ * inputs       - pointer to query
+ *              - pointer to client to do who on
+ *              - The reported name
+ *              - status flags as sent with RPL_WHOREPLY
+ * output       - NONE
+ * side effects - sends the requested WHOX fields only
+ */
+static void
+who_send_whox(const struct who_query *query, const struct Client *target_p,
+              const char *name, const char *status)
+{
+  struct Client *const source_p = query->source_p;
+  const int oper = HasUMode(source_p, UMODE_OPER);
+  const int hidden = !oper && (ConfigServerHide.hide_servers || IsHidden(target_p->servptr));
+  char buf[IRCD_BUFSIZE];
+  size_t len = 0;
+
+  for (unsigned int i = 0; who_fields[i] && len < sizeof(buf); ++i)
+  {
+    char num[32];
+    const char *str = NULL;
+
+    if (!(query->fields & (1 << i)))
+      continue;
+
+    switch (who_fields[i])
+    {
+      case 't':
+        str = query->token[0] ? query->token : "0";
+        break;
+      case 'c':
+        str = name ? name : "*";
+        break;
+      case 'u':
+        str = target_p->username;
+        break;
+      case 'i':
+        str = (oper || source_p == target_p) ? target_p->sockhost : "255.255.255.255";
+        break;
+      case 'h':
+        str = target_p->host;
+        break;
+      case 's':
+        str = hidden ? "*" : target_p->servptr->name;
+        break;
+      case 'n':
+        str = target_p->name;
+        break;
+      case 'f':
+        str = status;
+        break;
+      case 'd':
+        snprintf(num, sizeof(num), "%u", hidden ? 0 : target_p->hopcount);
+        str = num;
+        break;
+      case 'l':
+        if (MyConnect(target_p) && (!HasUMode(target_p, UMODE_HIDEIDLE) || oper ||
+                                    source_p == target_p))
+          snprintf(num, sizeof(num), "%u", client_get_idle_time(source_p, target_p));
+        else
+          strlcpy(num, "0", sizeof(num));
+        str = num;
+        break;
+      case 'a':
+        str = strcmp(target_p->account, "*") ? target_p->account : "0";
+        break;
+      case 'o':
+        str = "n/a";
+        break;
+      case 'r':
+        str = target_p->info;
+        break;
+    }
+
+    len += snprintf(buf + len, sizeof(buf) - len, "%s%s%s", len ? " " : "",
+                    who_fields[i] == 'r' ? ":" : "", str);
+  }
+
+  sendto_one_numeric(source_p, &me, RPL_WHOSPCRPL, buf);
+}
 
 /* do_who()
  *
- * inputs       - pointer to client requesting who
+ * inputs       - pointer to query
  *              - pointer to client to do who on
  *              - The reported name
  *              - channel flags
@@ -53,9 +217,10 @@ enum { WHO_MAX_REPLIES = 500 };
  * side effects - do a who on given person
  */
 static void
-do_who(struct Client *source_p, const struct Client *target_p,
+do_who(const struct who_query *query, const struct Client *target_p,
        const char *name, const char *op_flags)
 {
+  struct Client *const source_p = query->source_p;
   char status[IRCD_BUFSIZE] = "";
 
   if (HasUMode(source_p, UMODE_OPER))
@@ -68,7 +233,9 @@ do_who(struct Client *source_p, const struct Client *target_p,
              HasUMode(target_p, UMODE_OPER) &&
              !HasUMode(target_p, UMODE_HIDDEN) ? "*" : "", op_flags);
 
-  if (ConfigServerHide.hide_servers || IsHidden(target_p->servptr))
+  if (query->fields)
+    who_send_whox(query, target_p, name, status);
+  else if (ConfigServerHide.hide_servers || IsHidden(target_p->servptr))
     sendto_one_numeric(source_p, &me, RPL_WHOREPLY,
                (name) ? (name) : "*",
                target_p->username, target_p->host,
@@ -83,55 +250,86 @@ do_who(struct Client *source_p, const struct Client *target_p,
 }
 
 /*!
- * \param source_p Pointer to client requesting who
+ * \param query Pointer to query
  * \param target_p Pointer to client to do who on
- * \param mask Mask to match
  * \return 1 if mask matches, 0 otherwise
  */
 static int
-who_matches(struct Client *source_p, struct Client *target_p, const char *mask)
+who_matches(const struct who_query *query, const struct Client *target_p)
 {
+  const struct Client *const source_p = query->source_p;
+  const char *const mask = query->mask;
+
   if (!mask)
     return 1;
 
-  if (!match(mask, target_p->name))
+  if (query->userhost)
+    return !match(query->nick, target_p->name) &&
+           !match(query->user, target_p->username) &&
+           !match(query->host, target_p->host);
+
+  if ((query->match & WHO_MATCH_NICK) && !match(mask, target_p->name))
+    return 1;
+
+  if ((query->match & WHO_MATCH_USER) && !match(mask, target_p->username))
     return 1;
 
-  if (!match(mask, target_p->username))
+  if ((query->match & WHO_MATCH_HOST) && !match(mask, target_p->host))
     return 1;
 
-  if (!match(mask, target_p->host))
+  if ((query->match & WHO_MATCH_REAL) && !match(mask, target_p->info))
     return 1;
 
-  if (!match(mask, target_p->info))
+  if ((query->match & WHO_MATCH_ACCOUNT) && !match(mask, target_p->account))
     return 1;
 
   if (HasUMode(source_p, UMODE_OPER))
-    if (!match(mask, target_p->sockhost))
+    if ((query->match & WHO_MATCH_IP) && !match(mask, target_p->sockhost))
       return 1;
 
   if (HasUMode(source_p, UMODE_OPER) ||
       (!ConfigServerHide.hide_servers && !IsHidden(target_p->servptr)))
-    if (!match(mask, target_p->servptr->name))
+    if ((query->match & WHO_MATCH_SERVER) && !match(mask, target_p->servptr->name))
       return 1;
 
   return 0;
 }
 
+/* who_global_reply()
+ *
+ * inputs       - pointer to query
+ *              - pointer to client to do who on
+ * output       - 1 if the reply limit has been reached, 0 otherwise
+ * side effects - sends a reply unless the limit has been reached already,
+ *                and tells the client when it was the last one
+ */
+static int
+who_global_reply(struct who_query *query, const struct Client *target_p)
+{
+  if (query->replies >= WHO_MAX_REPLIES)
+    return 1;
+
+  do_who(query, target_p, NULL, "");
+
+  if (++query->replies == WHO_MAX_REPLIES)
+  {
+    sendto_one_numeric(query->source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
+    return 1;
+  }
+
+  return 0;
+}
+
 /* who_common_channel
- * inputs	- pointer to client requesting who
+ * inputs	- pointer to query
  * 		- pointer to channel member chain.
- *		- char * mask to match
- *		- int if oper on a server or not
- *		- pointer to int maxmatches
- * output	- NONE
+ * output	- 1 if the reply limit has been reached, 0 otherwise
  * side effects - lists matching clients on specified channel,
  * 		  marks matched clients.
  *
  */
-static void
-who_common_channel(struct Client *source_p, struct Channel *chptr, const char *mask,
-                   int server_oper, unsigned int *maxmatches)
+static int
+who_common_channel(struct who_query *query, struct Channel *chptr)
 {
   dlink_node *node;
 
@@ -142,43 +340,104 @@ who_common_channel(struct Client *source_p, struct Channel *chptr, const char *m
     if (!HasUMode(target_p, UMODE_INVISIBLE) || HasFlag(target_p, FLAGS_MARK))
       continue;
 
-    if (server_oper)
+    if (query->server_oper)
       if (!HasUMode(target_p, UMODE_OPER) ||
-          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
+          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(query->source_p, UMODE_OPER)))
         continue;
 
     AddFlag(target_p, FLAGS_MARK);
 
-    if (who_matches(source_p, target_p, mask))
+    if (who_matches(query, target_p))
+      if (who_global_reply(query, target_p))
+        return 1;
+  }
+
+  return 0;
+}
+
+/* who_global_visible()
+ *
+ * inputs       - pointer to client to do who on
+ *              - pointer to query
+ * output       - 1 if the reply limit has been reached, 0 otherwise
+ * side effects - lists the client if it is visible and matches
+ */
+static int
+who_global_visible(struct Client *target_p, void *data)
+{
+  struct who_query *const query = data;
+
+  assert(IsClient(target_p));
+
+  if (HasUMode(target_p, UMODE_INVISIBLE))
+    return 0;
+
+  if (query->server_oper)
+    if (!HasUMode(target_p, UMODE_OPER) ||
+        (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(query->source_p, UMODE_OPER)))
+      return 0;
+
+  if (who_matches(query, target_p))
+    return who_global_reply(query, target_p);
+
+  return 0;
+}
+
+/* who_global_indexed()
+ *
+ * inputs       - pointer to query
+ * output       - -1 if none of the indexes can resolve the query,
+ *                otherwise 1 if the reply limit has been reached
+ * side effects - lists matching visible clients, looking at the
+ *                candidates an index returns rather than at everybody
+ */
+static int
+who_global_indexed(struct who_query *query)
+{
+  const char *const mask = query->userhost ? query->host : query->mask;
+  int ret = -1;
+
+  if (mask == NULL)
+    ret = -1;
+  else if (query->userhost || query->match == WHO_MATCH_HOST)
+    ret = who_index_find_host(mask, who_global_visible, query);
+  else if (query->match == WHO_MATCH_IP)
+    ret = who_index_find_addr(mask, who_global_visible, query);
+  else if (query->match == WHO_MATCH_ACCOUNT)
+    ret = who_index_find_account(mask, who_global_visible, query);
+  else if (query->match == WHO_MATCH_SERVER && !strpbrk(mask, "*?\\"))
+  {
+    const struct Client *const server_p = hash_find_server(mask);
+    dlink_node *node;
+
+    ret = 0;
+
+    if (server_p && (IsServer(server_p) || IsMe(server_p)))
     {
-      do_who(source_p, target_p, NULL, "");
-
-      if (*maxmatches)
-      {
-        if (--(*maxmatches) == 0)
-        {
-          sendto_one_numeric(source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
-          return;
-        }
-      }
+      DLINK_FOREACH(node, server_p->serv->client_list.head)
+        if ((ret = who_global_visible(node->data, query)))
+          break;
     }
   }
+
+  if (ret == -1 && query->server_oper)
+    ret = who_index_find_oper(who_global_visible, query);
+
+  return ret;
 }
 
 /* who_global()
  *
- * inputs	- pointer to client requesting who
- *		- char * mask to match
- *		- int if oper on a server or not
+ * inputs	- pointer to query
  * output	- NONE
  * side effects - do a global scan of all clients looking for match
  *		  this is slightly expensive on EFnet ...
  */
 static void
-who_global(struct Client *source_p, const char *mask, int server_oper)
+who_global(struct who_query *query)
 {
-  dlink_node *node;
-  unsigned int maxmatches = WHO_MAX_REPLIES;
+  struct Client *const source_p = query->source_p;
+  dlink_node *node, *node2;
   static uintmax_t last_used = 0;
 
   if (!HasUMode(source_p, UMODE_OPER))
@@ -193,61 +452,42 @@ who_global(struct Client *source_p, const char *mask, int server_oper)
   }
 
   /* First, list all matching invisible clients on common channels */
+  int stopped = 0;
+
   DLINK_FOREACH(node, source_p->channel.head)
-  {
-    struct Channel *chptr = ((struct Membership *)node->data)->chptr;
-    who_common_channel(source_p, chptr, mask, server_oper, &maxmatches);
-  }
+    if ((stopped = who_common_channel(query, ((struct Membership *)node->data)->chptr)))
+      break;
 
   /* Second, list all matching visible clients */
-  DLINK_FOREACH(node, global_client_list.head)
+  if (stopped == 0 && who_global_indexed(query) == -1)
   {
-    struct Client *target_p = node->data;
-
-    assert(IsClient(target_p));
-
-    if (HasUMode(target_p, UMODE_INVISIBLE))
-    {
-      DelFlag(target_p, FLAGS_MARK);
-      continue;
-    }
+    /* Nothing to narrow the search down; that's the expensive case */
+    DLINK_FOREACH(node, global_client_list.head)
+      if (who_global_visible(node->data, query))
+        break;
+  }
 
-    if (server_oper)
-      if (!HasUMode(target_p, UMODE_OPER) ||
-          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-        continue;
+  DLINK_FOREACH(node, source_p->channel.head)
+  {
+    const struct Channel *const chptr = ((struct Membership *)node->data)->chptr;
 
-    if (who_matches(source_p, target_p, mask))
-    {
-      do_who(source_p, target_p, NULL, "");
-
-      if (maxmatches)
-      {
-        if (--maxmatches == 0)
-        {
-          sendto_one_numeric(source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
-          return;
-        }
-      }
-    }
+    DLINK_FOREACH(node2, chptr->members.head)
+      DelFlag(((struct Membership *)node2->data)->client_p, FLAGS_MARK);
   }
 }
 
 /* do_who_on_channel()
  *
- * inputs	- pointer to client requesting who
+ * inputs	- pointer to query
  *		- pointer to channel to do who on
- *		- The "real name" of this channel
- *		- int if source_p is a server oper or not
  *		- int if client is member or not
- *		- int server_op flag
  * output	- NONE
  * side effects - do a who on given channel
  */
 static void
-do_who_on_channel(struct Client *source_p, struct Channel *chptr,
-                  int is_member, int server_oper)
+do_who_on_channel(const struct who_query *query, struct Channel *chptr, int is_member)
 {
+  struct Client *const source_p = query->source_p;
   dlink_node *node;
 
   DLINK_FOREACH(node, chptr->members.head)
@@ -257,11 +497,11 @@ do_who_on_channel(struct Client *source_p, struct Channel *chptr,
 
     if (is_member || !HasUMode(target_p, UMODE_INVISIBLE))
     {
-      if (server_oper)
+      if (query->server_oper)
         if (!HasUMode(target_p, UMODE_OPER) ||
             (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
           continue;
-      do_who(source_p, target_p, chptr->name, get_member_status(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
+      do_who(query, target_p, chptr->name, get_member_status(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
     }
   }
 }
@@ -275,8 +515,11 @@ do_who_on_channel(struct Client *source_p, struct Channel *chptr,
  *                 pointers.
  * \note Valid arguments for this command are:
  *      - parv[0] = command
- *      - parv[1] = nickname/channelname
- *      - parv[2] = additional selection flag, only 'o' for now
+ *      - parv[1] = nickname/channelname/mask
+ *      - parv[2] = options: [flags][%fields[,querytype]]. Flags are 'o'
+ *                  for opers only, and any of "nuhisra" to select the
+ *                  fields the mask is matched against. Fields are any
+ *                  of "tcuihsnfdlaor" and make the reply RPL_WHOSPCRPL.
  */
 static int
 m_who(struct Client *source_p, int parc, char *parv[])
@@ -285,12 +528,17 @@ m_who(struct Client *source_p, int parc, char *parv[])
   struct Client *target_p = NULL;
   struct Channel *chptr = NULL;
   char *mask = parv[1];
-  const int server_oper = parc > 2 && *parv[2] == 'o';  /* Show OPERS only */
+  struct who_query query = { .source_p = source_p };
+
+  who_parse_options(&query, parc > 2 ? parv[2] : "");
 
   /* See if mask is there, collapse it or return if not there */
   if (EmptyString(mask))
   {
-    who_global(source_p, NULL, server_oper);
+    if (query.match == 0)
+      query.match = WHO_MATCH_DEFAULT;
+
+    who_global(&query);
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
     return 0;
   }
@@ -305,9 +553,9 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((chptr = hash_find_channel(mask)))
     {
       if (HasUMode(source_p, UMODE_ADMIN) || IsMember(source_p, chptr))
-        do_who_on_channel(source_p, chptr, 1, server_oper);
+        do_who_on_channel(&query, chptr, 1);
       else if (!SecretChannel(chptr))
-        do_who_on_channel(source_p, chptr, 0, server_oper);
+        do_who_on_channel(&query, chptr, 0);
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
@@ -316,7 +564,7 @@ m_who(struct Client *source_p, int parc, char *parv[])
 
   /* '/who nick' */
   if ((target_p = find_person(source_p, mask)) &&
-      (!server_oper || HasUMode(target_p, UMODE_OPER)))
+      (!query.server_oper || HasUMode(target_p, UMODE_OPER)))
   {
     DLINK_FOREACH(node, target_p->channel.head)
     {
@@ -326,10 +574,10 @@ m_who(struct Client *source_p, int parc, char *parv[])
     }
 
     if (node)
-      do_who(source_p, target_p, chptr->name,
+      do_who(&query, target_p, chptr->name,
              get_member_status(node->data, !!HasCap(source_p, CAP_MULTI_PREFIX)));
     else
-      do_who(source_p, target_p, NULL, "");
+      do_who(&query, target_p, NULL, "");
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
     return 0;
@@ -341,18 +589,40 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((node = source_p->channel.head))
     {
       chptr = ((struct Membership *)node->data)->chptr;
-      do_who_on_channel(source_p, chptr, 1, server_oper);
+      do_who_on_channel(&query, chptr, 1);
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
     return 0;
   }
 
+  /* '/who nick!user@host' */
+  if (strpbrk(mask, "!@"))
+  {
+    char nuh[IRCD_BUFSIZE];
+    struct split_nuh_item nuh_item;
+
+    strlcpy(nuh, mask, sizeof(nuh));
+    nuh_item.nuhmask = nuh;
+    nuh_item.nickptr = query.nick;
+    nuh_item.userptr = query.user;
+    nuh_item.hostptr = query.host;
+    nuh_item.nicksize = sizeof(query.nick);
+    nuh_item.usersize = sizeof(query.user);
+    nuh_item.hostsize = sizeof(query.host);
+    split_nuh(&nuh_item);
+
+    query.userhost = 1;
+  }
+
   /* '/who 0' */
-  if (!strcmp(mask, "0"))
-    who_global(source_p, NULL, server_oper);
-  else
-    who_global(source_p, mask, server_oper);
+  if (strcmp(mask, "0"))
+    query.mask = mask;
+
+  if (query.match == 0)
+    query.match = WHO_MATCH_DEFAULT;
+
+  who_global(&query);
 
   /* Wasn't a nick, wasn't a channel, wasn't a '*' so ... */
   sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
@@ -374,12 +644,14 @@ static void
 module_init(void)
 {
   mod_add_cmd(&who_msgtab);
+  isupport_add("WHOX", NULL, -1);
 }
 
 static void
 module_exit(void)
 {
   mod_del_cmd(&who_msgtab);
+  isupport_delete("WHOX");
 }
 
 struct module module_entry =
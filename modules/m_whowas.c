@@ -46,7 +46,6 @@ static void
 do_whowas(struct Client *source_p, const int parc, char *parv[])
 {
   int count = 0, max = -1;
-  dlink_node *node;
 
   if (parc > 2 && !EmptyString(parv[2]))
     max = atoi(parv[2]);
@@ -54,10 +53,9 @@ do_whowas(struct Client *source_p, const int parc, char *parv[])
   if (!MyConnect(source_p) && (max <= 0 || max > WHOWAS_MAX_REPLIES))
     max = WHOWAS_MAX_REPLIES;
 
-  DLINK_FOREACH(node, whowas_get_hash(strhash(parv[1]))->head)
+  for (const struct Whowas *whowas = whowas_get_hash(strhash(parv[1])); whowas;
+       whowas = whowas_next(whowas))
   {
-    const struct Whowas *whowas = node->data;
-
     if (!irccmp(parv[1], whowas->name))
     {
       sendto_one_numeric(source_p, &me, RPL_WHOWASUSER, whowas->name,
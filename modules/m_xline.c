@@ -41,6 +41,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "memory.h"
+#include "conf_db.h"
 
 
 static void
@@ -132,6 +133,7 @@ xline_handle(struct Client *source_p, const char *mask, const char *reason, uint
          get_oper_name(source_p), gecos->mask, gecos->reason);
   }
 
+  journal_add_gecos(gecos);
   xline_check(gecos);
 }
 
@@ -0,0 +1,144 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file accounting.c
+ * \brief Resources used by each local connection.
+ * \version $Id$
+ *
+ * parse_handle_command() charges the time spent in a command handler and
+ * the bytes queued meanwhile, to whichever client they end up at, to the
+ * connection the command has been read from. For remote clients that is
+ * the server link they are behind. The handler time is only measured
+ * while SET CMDTIMING is on.
+ */
+
+#include "stdinc.h"
+#include "accounting.h"
+#include "client.h"
+#include "ircd.h"
+#include "parse.h"
+
+/** Bytes queued to all sendqs since startup; sampled around command handlers */
+uintmax_t accounting_queued;
+
+
+/*! \brief Moves the recent counters along to the current window */
+static void
+accounting_rotate(struct Accounting *accounting)
+{
+  const uintmax_t window = CurrentTime / ACCOUNTING_WINDOW;
+
+  if (accounting->window == window)
+    return;
+
+  if (accounting->window + 1 == window)
+  {
+    accounting->recent_cpu[1] = accounting->recent_cpu[0];
+    accounting->recent_output[1] = accounting->recent_output[0];
+  }
+  else
+  {
+    accounting->recent_cpu[1] = 0;
+    accounting->recent_output[1] = 0;
+  }
+
+  accounting->recent_cpu[0] = 0;
+  accounting->recent_output[0] = 0;
+  accounting->window = window;
+}
+
+/*! \brief Charges a connection for a command it has sent
+ * \param accounting Counters of the connection
+ * \param ticks      Time spent in the handler, in clock ticks
+ * \param output     Bytes queued while handling the command
+ */
+void
+accounting_charge(struct Accounting *accounting, uintmax_t ticks, uintmax_t output)
+{
+  accounting_rotate(accounting);
+
+  accounting->cpu += ticks;
+  accounting->output += output;
+  accounting->recent_cpu[0] += ticks;
+  accounting->recent_output[0] += output;
+}
+
+/*! \brief Returns the age in windows of the first recent counters, as seen from now */
+static uintmax_t
+accounting_age(const struct Accounting *accounting)
+{
+  return CurrentTime / ACCOUNTING_WINDOW - accounting->window;
+}
+
+/*! \brief Clock ticks spent on a connection in the current and the previous window */
+uintmax_t
+accounting_recent_cpu(const struct Accounting *accounting)
+{
+  switch (accounting_age(accounting))
+  {
+    case 0:
+      return accounting->recent_cpu[0] + accounting->recent_cpu[1];
+    case 1:
+      return accounting->recent_cpu[0];
+    default:
+      return 0;
+  }
+}
+
+/*! \brief Bytes a connection has caused to be queued in the current and the previous window */
+uintmax_t
+accounting_recent_output(const struct Accounting *accounting)
+{
+  switch (accounting_age(accounting))
+  {
+    case 0:
+      return accounting->recent_output[0] + accounting->recent_output[1];
+    case 1:
+      return accounting->recent_output[0];
+    default:
+      return 0;
+  }
+}
+
+uintmax_t
+accounting_cpu_usec(uintmax_t ticks)
+{
+  return message_ticks_to_nsec(ticks) / 1000;
+}
+
+/* accounting_summary()
+ *
+ * inputs       - pointer to a local client
+ * output       - " CPU:<ms> OUT:<KB> SQ:<KB> RQ:<KB>" with the handler
+ *                time, the output caused and the peak sendq and recvq
+ * side effects - NONE; used as a suffix by TRACE, ETRACE and STATS L
+ */
+const char *
+accounting_summary(const struct Client *client_p)
+{
+  static char buf[96];
+  const struct Accounting *const accounting = &client_p->connection->accounting;
+
+  snprintf(buf, sizeof(buf), " CPU:%ju OUT:%ju SQ:%zu RQ:%zu",
+           accounting_cpu_usec(accounting->cpu) / 1000, accounting->output >> 10,
+           accounting->sendq_peak >> 10, accounting->recvq_peak >> 10);
+  return buf;
+}
@@ -0,0 +1,112 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file admission.c
+ * \brief Latency histograms of the connection admission stages.
+ * \version $Id$
+ *
+ * Samples are sorted into power-of-two buckets, which keeps recording
+ * down to a couple of instructions and the memory use constant, at the
+ * price of percentiles that are only accurate to within a factor of two.
+ */
+
+#include "stdinc.h"
+#include "admission.h"
+#include "misc.h"
+
+static struct admission_histogram admission_table[ADMISSION_STAGE_COUNT];
+
+static const char *const admission_names[ADMISSION_STAGE_COUNT] =
+{
+  [ADMISSION_ACCEPT] = "accept",
+  [ADMISSION_TLS] = "tls",
+  [ADMISSION_DNS] = "dns",
+  [ADMISSION_IDENT] = "ident",
+  [ADMISSION_ACCESS] = "access",
+  [ADMISSION_REGISTER] = "register"
+};
+
+
+/*! \brief Adds the time elapsed since a stage has been entered to that
+ *         stage's histogram.
+ * \param stage Stage that has been completed
+ * \param start clock_usec() value taken when the stage was entered
+ */
+void
+admission_record(enum admission_stage stage, uintmax_t start)
+{
+  struct admission_histogram *const h = &admission_table[stage];
+  const uintmax_t now = clock_usec();
+  const uintmax_t usec = now > start ? now - start : 0;
+  unsigned int i = 0;
+
+  while (i < ADMISSION_BUCKETS - 1 && (usec >> (i + 1)))
+    ++i;
+
+  ++h->bucket[i];
+  ++h->count;
+  h->sum += usec;
+
+  if (h->max < usec)
+    h->max = usec;
+}
+
+const char *
+admission_stage_name(enum admission_stage stage)
+{
+  return admission_names[stage];
+}
+
+const struct admission_histogram *
+admission_histogram_get(enum admission_stage stage)
+{
+  return &admission_table[stage];
+}
+
+/*! \brief Estimates a percentile of a stage's latency.
+ * \param stage Stage to look at
+ * \param percent Percentile to compute, 1 to 100
+ * \return Upper bound of the bucket the percentile falls into, in
+ *         microseconds, but never more than the largest sample
+ */
+uintmax_t
+admission_percentile(enum admission_stage stage, unsigned int percent)
+{
+  const struct admission_histogram *const h = &admission_table[stage];
+  const uintmax_t rank = (h->count * percent + 99) / 100;
+  uintmax_t seen = 0;
+
+  if (h->count == 0)
+    return 0;
+
+  for (unsigned int i = 0; i < ADMISSION_BUCKETS; ++i)
+  {
+    seen += h->bucket[i];
+
+    if (seen >= rank)
+    {
+      const uintmax_t bound = ((uintmax_t)1 << (i + 1)) - 1;
+      return bound < h->max ? bound : h->max;
+    }
+  }
+
+  return h->max;
+}
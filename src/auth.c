@@ -37,6 +37,8 @@
 
 #include "stdinc.h"
 #include "list.h"
+#include "admission.h"
+#include "misc.h"
 #include "ircd_defs.h"
 #include "fdlist.h"
 #include "auth.h"
@@ -180,6 +182,7 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
   struct AuthRequest *const auth = vptr;
 
   ClearDNSPending(auth);
+  admission_record(ADMISSION_DNS, auth->client->connection->admission.dns);
 
   if (EmptyString(name))
     auth_sendheader(auth->client, REPORT_FAIL_DNS);
@@ -239,6 +242,7 @@ auth_error(struct AuthRequest *auth)
   auth->fd = NULL;
 
   ClearAuth(auth);
+  admission_record(ADMISSION_IDENT, auth->client->connection->admission.ident);
 
   auth_sendheader(auth->client, REPORT_FAIL_ID);
 
@@ -361,6 +365,7 @@ auth_read_reply(fde_t *F, void *data)
   auth->fd = NULL;
 
   ClearAuth(auth);
+  admission_record(ADMISSION_IDENT, auth->client->connection->admission.ident);
 
   if (EmptyString(username))
   {
@@ -459,6 +464,7 @@ auth_start_query(struct AuthRequest *auth)
   }
 
   auth->fd = fd_open(fd, 1, "ident");
+  auth->client->connection->admission.ident = clock_usec();
 
   SetDoingAuth(auth);
   auth_sendheader(auth->client, REPORT_DO_ID);
@@ -502,6 +508,7 @@ auth_start(struct Client *client_p)
   if (ConfigGeneral.disable_auth == 0)
     auth_start_query(auth);
 
+  client_p->connection->admission.dns = clock_usec();
   gethost_byaddr(auth_dns_callback, auth, &client_p->ip);
 }
 
@@ -552,6 +559,7 @@ auth_timeout_queries(void *notused)
       auth->fd = NULL;
 
       ClearAuth(auth);
+      admission_record(ADMISSION_IDENT, auth->client->connection->admission.ident);
 
       auth_sendheader(auth->client, REPORT_FAIL_ID);
     }
@@ -560,6 +568,7 @@ auth_timeout_queries(void *notused)
     {
       delete_resolver_queries(auth);
       ClearDNSPending(auth);
+      admission_record(ADMISSION_DNS, auth->client->connection->admission.dns);
 
       auth_sendheader(auth->client, REPORT_FAIL_DNS);
     }
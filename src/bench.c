@@ -0,0 +1,1021 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file bench.c
+ * \brief Microbenchmarks for the string and data structure primitives.
+ * \version $Id$
+ *
+ * Built by "make bench" into ircd-bench, which is linked against the
+ * same objects as the ircd itself. Every benchmark runs until it has
+ * taken at least -benchtime milliseconds and prints one line in the
+ * format of Go benchmarks, so that the output of two builds can be
+ * compared with benchstat or a few lines of awk:
+ *
+ *   BenchmarkMatch/ban-mask    4194304    61.2 ns/op
+ *
+ * Inputs are generated from a fixed seed, so runs are comparable. A file
+ * of "nick user host ip" lines, e.g. taken from WHO replies on a real
+ * network, can be given with -users instead.
+ *
+ * The TLSHandshake benchmarks need a certificate and key given with
+ * -tlscert and -tlskey. They measure the server side of a handshake,
+ * including tls_new(), with and without resumption of an earlier
+ * session. The client side runs in the same thread and isn't counted.
+ * Their setup fails if a session ticket can't be resumed for as long as
+ * it is valid, because the ticket key rotation has dropped its key.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "conf.h"
+#include "dbuf.h"
+#include "event.h"
+#include "fdlist.h"
+#include "hash.h"
+#include "hostmask.h"
+#include "irc_string.h"
+#include "ircd.h"
+#include "ircd_getopt.h"
+#include "memory.h"
+#include "packet.h"
+#include "parse.h"
+#include "patricia.h"
+#include "rng_mt.h"
+#include "send.h"
+#include "tls.h"
+
+
+enum
+{
+  BENCH_USERS = 20000,  /* Generated users, unless read from a file */
+  BENCH_MASKS = 4096,
+  BENCH_LINES = 1024
+};
+
+struct BenchUser
+{
+  char nick[NICKLEN + 1];
+  char user[USERLEN + 1];
+  char host[HOSTLEN + 1];
+  char ip[HOSTIPLEN + 1];
+  char mask[NICKLEN + USERLEN + HOSTLEN + 3];  /* nick!user@host */
+  struct irc_ssaddr addr;
+  int aftype;
+};
+
+struct Benchmark
+{
+  const char *name;
+  int (*setup)(void);  /* Returns 0 if the benchmark can't run */
+  void (*run)(uintmax_t);
+};
+
+static int bench_time = 1000;  /* Milliseconds per benchmark */
+static int bench_count = 1;
+static int bench_klines = 100000;
+static const char *bench_filter;
+static const char *bench_users_file;
+static const char *bench_tls_cert;
+static const char *bench_tls_key;
+static const char *bench_tls_dh;
+
+static struct lgetopt myopts[] =
+{
+  { "benchtime", &bench_time,
+   INTEGER, "Milliseconds to run each benchmark for" },
+  { "count",     &bench_count,
+   INTEGER, "Number of times to run each benchmark" },
+  { "filter",    &bench_filter,
+   STRING, "Only run benchmarks with this string in their name" },
+  { "klines",    &bench_klines,
+   INTEGER, "Number of K-lines and D-lines to load" },
+  { "users",     &bench_users_file,
+   STRING, "File of \"nick user host ip\" lines to use as input" },
+  { "tlscert",   &bench_tls_cert,
+   STRING, "Certificate for the TLS handshake benchmarks" },
+  { "tlskey",    &bench_tls_key,
+   STRING, "Private key for the TLS handshake benchmarks" },
+  { "tlsdh",     &bench_tls_dh,
+   STRING, "Diffie-Hellman parameters for the TLS handshake benchmarks" },
+  { "help", NULL, USAGE, "Print this text" },
+  { NULL, NULL, STRING, NULL },
+};
+
+static struct BenchUser *users;
+static unsigned int users_count;
+static char *masks[BENCH_MASKS];
+static char *lines[BENCH_LINES];  /* Client protocol lines, without CR LF */
+
+static struct Client *bench_client;
+static patricia_tree_t *bench_tree;
+static char bench_buf[IRCD_BUFSIZE * 2];
+
+static uintmax_t paused_since;
+static uintmax_t paused_total;
+
+/* Results are accumulated in here so the compiler can't drop the work */
+static volatile uintmax_t sink;
+
+
+static uintmax_t
+bench_clock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Excludes the time until bench_resume() from the measurement, for refilling inputs */
+static void
+bench_pause(void)
+{
+  paused_since = bench_clock();
+}
+
+static void
+bench_resume(void)
+{
+  paused_total += bench_clock() - paused_since;
+}
+
+static unsigned int
+random_below(unsigned int n)
+{
+  return genrand_int32() % n;
+}
+
+static const char *
+random_pick(const char *const *table, unsigned int count)
+{
+  return table[random_below(count)];
+}
+
+/*
+ * Generates nicks, idents and hosts shaped like those seen on public
+ * networks: mostly short nicks from a limited vocabulary with digits
+ * and underscores, dynamic reverse DNS names, cloaks and bare IPs.
+ */
+static void
+users_generate(void)
+{
+  static const char *const words[] =
+  {
+    "alex", "anna", "ben", "chris", "dan", "dark", "emma", "fox", "ghost", "jay",
+    "kate", "lisa", "max", "mike", "neo", "nick", "pixel", "sam", "shadow", "tom",
+    "wolf", "zero", "Guest", "Cyber", "Mr", "The", "Lord", "bot", "dev", "linux"
+  };
+  static const char *const idents[] =
+  {
+    "~user", "~guest", "~kiwi", "~quassel", "~znc", "~ubuntu", "~pi", "~root", "sid", "uid"
+  };
+  static const char *const isps[] =
+  {
+    "hsd1.ca.comcast.net", "dyn.telus.net", "dip0.t-ipconnect.de", "cable.virginm.net",
+    "res.rr.com", "bredband.comhem.se", "fbx.proxad.net", "adsl.tpnet.pl",
+    "static.ngn.ovh.net", "compute.amazonaws.com"
+  };
+
+  users_count = BENCH_USERS;
+  users = xcalloc(users_count * sizeof(*users));
+
+  for (unsigned int i = 0; i < users_count; ++i)
+  {
+    struct BenchUser *const u = &users[i];
+    const unsigned int a = random_below(223) + 1, b = random_below(256),
+                       c = random_below(256), d = random_below(254) + 1;
+
+    switch (random_below(4))
+    {
+      case 0:
+        snprintf(u->nick, sizeof(u->nick), "%s", random_pick(words, 30));
+        break;
+      case 1:
+        snprintf(u->nick, sizeof(u->nick), "%s%u", random_pick(words, 30), random_below(1000));
+        break;
+      case 2:
+        snprintf(u->nick, sizeof(u->nick), "%s_%s", random_pick(words, 30), random_pick(words, 30));
+        break;
+      default:
+        snprintf(u->nick, sizeof(u->nick), "[%s]%s`", random_pick(words, 30), random_pick(words, 30));
+        break;
+    }
+
+    /* Make nicks unique, as they would be on a network */
+    if (i >= 30)
+      snprintf(u->nick + strlen(u->nick), sizeof(u->nick) - strlen(u->nick), "%u", i);
+
+    snprintf(u->user, sizeof(u->user), "%s", random_pick(idents, 10));
+
+    const unsigned int kind = random_below(100);
+    if (kind < 10)
+    {
+      snprintf(u->ip, sizeof(u->ip), "2001:db8:%x:%x::%x", random_below(65536),
+               random_below(65536), random_below(65536));
+      snprintf(u->host, sizeof(u->host), "%s", u->ip);
+    }
+    else
+    {
+      snprintf(u->ip, sizeof(u->ip), "%u.%u.%u.%u", a, b, c, d);
+
+      if (kind < 55)
+        snprintf(u->host, sizeof(u->host), "c-%u-%u-%u-%u.%s", a, b, c, d, random_pick(isps, 10));
+      else if (kind < 75)
+        snprintf(u->host, sizeof(u->host), "user/%s", u->nick);
+      else if (kind < 85)
+        snprintf(u->host, sizeof(u->host), "%08X.%08X.%s", genrand_int32(), genrand_int32(),
+                 random_pick(isps, 10));
+      else
+        snprintf(u->host, sizeof(u->host), "%s", u->ip);
+    }
+  }
+}
+
+static void
+users_load(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  char line[IRCD_BUFSIZE];
+  unsigned int size = 0;
+
+  if (file == NULL)
+  {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+
+  while (fgets(line, sizeof(line), file))
+  {
+    char nick[NICKLEN + 1], user[USERLEN + 1], host[HOSTLEN + 1], ip[HOSTIPLEN + 1];
+
+    if (sscanf(line, "%30s %10s %63s %45s", nick, user, host, ip) != 4)
+      continue;
+
+    if (users_count == size)
+    {
+      size = size ? size * 2 : 1024;
+      users = xrealloc(users, size * sizeof(*users));
+    }
+
+    struct BenchUser *const u = &users[users_count++];
+    memset(u, 0, sizeof(*u));
+    strlcpy(u->nick, nick, sizeof(u->nick));
+    strlcpy(u->user, user, sizeof(u->user));
+    strlcpy(u->host, host, sizeof(u->host));
+    strlcpy(u->ip, ip, sizeof(u->ip));
+  }
+
+  fclose(file);
+
+  if (users_count == 0)
+  {
+    fprintf(stderr, "%s: no usable lines\n", path);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void
+users_prepare(void)
+{
+  for (unsigned int i = 0; i < users_count; ++i)
+  {
+    struct BenchUser *const u = &users[i];
+    int bits = 0;
+
+    snprintf(u->mask, sizeof(u->mask), "%s!%s@%s", u->nick, u->user, u->host);
+
+    switch (parse_netmask(u->ip, &u->addr, &bits))
+    {
+      case HM_IPV6:
+        u->aftype = AF_INET6;
+        break;
+      case HM_IPV4:
+        u->aftype = AF_INET;
+        break;
+      default:
+        u->aftype = 0;
+        break;
+    }
+  }
+}
+
+/* Ban masks of the kinds channel operators actually set, based on the users */
+static void
+masks_generate(void)
+{
+  char buf[NICKLEN + USERLEN + HOSTLEN + 8];
+
+  for (unsigned int i = 0; i < BENCH_MASKS; ++i)
+  {
+    const struct BenchUser *const u = &users[random_below(users_count)];
+    const char *domain = strchr(u->host, '.');
+
+    switch (random_below(6))
+    {
+      case 0:
+        snprintf(buf, sizeof(buf), "*!*@%s", u->host);
+        break;
+      case 1:
+        snprintf(buf, sizeof(buf), "*!*@*%s", domain ? domain : u->host);
+        break;
+      case 2:
+        snprintf(buf, sizeof(buf), "%s!*@*", u->nick);
+        break;
+      case 3:
+        snprintf(buf, sizeof(buf), "*!%s@*", u->user);
+        break;
+      case 4:
+        snprintf(buf, sizeof(buf), "*%.4s*!*@*", u->nick);
+        break;
+      default:
+        snprintf(buf, sizeof(buf), "*!*%s@%s", u->user + (*u->user == '~'), u->host);
+        break;
+    }
+
+    masks[i] = xstrdup(buf);
+  }
+}
+
+static void
+lines_generate(void)
+{
+  char buf[IRCD_BUFSIZE];
+
+  for (unsigned int i = 0; i < BENCH_LINES; ++i)
+  {
+    const struct BenchUser *const u = &users[random_below(users_count)];
+    const unsigned int chan = random_below(500);
+
+    switch (random_below(10))
+    {
+      case 0:
+        snprintf(buf, sizeof(buf), "JOIN #channel%u", chan);
+        break;
+      case 1:
+        snprintf(buf, sizeof(buf), "MODE #channel%u +b *!*@%s", chan, u->host);
+        break;
+      case 2:
+        snprintf(buf, sizeof(buf), "WHO #channel%u", chan);
+        break;
+      case 3:
+        snprintf(buf, sizeof(buf), "PING :%u", genrand_int32());
+        break;
+      case 4:
+        snprintf(buf, sizeof(buf), "NOTICE %s :\001VERSION HexChat 2.14.3\001", u->nick);
+        break;
+      default:
+        snprintf(buf, sizeof(buf), "PRIVMSG #channel%u :%s: did you see the %u new messages"
+                 " in the log, the last one at %u?", chan, u->nick, random_below(100),
+                 genrand_int32());
+        break;
+    }
+
+    lines[i] = xstrdup(buf);
+  }
+}
+
+/* Fills the K-line, D-line and patricia tables */
+static void
+klines_generate(void)
+{
+  char host[HOSTLEN + 2], user[USERLEN + 1];
+
+  bench_tree = patricia_new(128);
+
+  for (int i = 0; i < bench_klines; ++i)
+  {
+    const struct BenchUser *const u = &users[random_below(users_count)];
+    const unsigned int kind = random_below(100);
+    const char *domain = strchr(u->host, '.');
+    struct MaskItem *conf;
+
+    strlcpy(user, "*", sizeof(user));
+
+    if (kind < 50)
+    {
+      /* Mostly single addresses, some networks */
+      static const int bits_v4[] = { 32, 32, 32, 24, 16 };
+      const int bits = bits_v4[random_below(5)];
+
+      snprintf(host, sizeof(host), "%u.%u.%u.%u/%d", random_below(223) + 1,
+               random_below(256), bits > 16 ? random_below(256) : 0,
+               bits > 24 ? random_below(254) + 1 : 0, bits);
+    }
+    else if (kind < 60)
+      snprintf(host, sizeof(host), "2001:db8:%x:%x::/64", random_below(65536), random_below(65536));
+    else if (kind < 85 || domain == NULL)
+      strlcpy(host, u->host, sizeof(host));
+    else if (kind < 95)
+    {
+      /* Part of the first label, like c-73-12-* for a dynamic range */
+      const size_t len = (domain - u->host + 1) / 2;
+
+      snprintf(host, sizeof(host), "%.*s*%s", (int)len, u->host, domain);
+    }
+    else
+    {
+      snprintf(user, sizeof(user), "*%.3s*", u->nick);
+      snprintf(host, sizeof(host), "%s", u->host);
+    }
+
+    conf = conf_make(CONF_KLINE);
+    conf->user = xstrdup(user);
+    conf->host = xstrdup(host);
+    conf->reason = xstrdup("Benchmark K-line");
+    add_conf_by_address(CONF_KLINE, conf);
+
+    if (kind < 60)
+    {
+      conf = conf_make(CONF_DLINE);
+      conf->host = xstrdup(host);
+      conf->reason = xstrdup("Benchmark D-line");
+      add_conf_by_address(CONF_DLINE, conf);
+
+      patricia_make_and_lookup(bench_tree, host);
+    }
+  }
+}
+
+static int
+bench_handler(struct Client *source_p, int parc, char *parv[])
+{
+  sink += parc;
+  return 0;
+}
+
+/* Commands registered for Benchmark/parse, so that the trie looks like the real one */
+static struct Message bench_msgtab[] =
+{
+  { .cmd = "PRIVMSG" }, { .cmd = "NOTICE" }, { .cmd = "JOIN" }, { .cmd = "PART" },
+  { .cmd = "MODE" }, { .cmd = "WHO" }, { .cmd = "WHOIS" }, { .cmd = "PING" },
+  { .cmd = "PONG" }, { .cmd = "NICK" }, { .cmd = "USER" }, { .cmd = "QUIT" },
+  { .cmd = "TOPIC" }, { .cmd = "KICK" }, { .cmd = "PASS" }, { .cmd = "CAP" },
+  { .cmd = "LIST" }, { .cmd = "NAMES" }, { .cmd = "AWAY" }, { .cmd = "ISON" }
+};
+
+static int
+setup_parse(void)
+{
+  int fd;
+
+  if (bench_client)
+    return 1;
+
+  for (unsigned int i = 0; i < sizeof(bench_msgtab) / sizeof(bench_msgtab[0]); ++i)
+  {
+    struct Message *const message = &bench_msgtab[i];
+
+    message->args_max = MAXPARA;
+
+    for (unsigned int j = 0; j < LAST_HANDLER_TYPE; ++j)
+      message->handlers[j] = bench_handler;
+
+    mod_add_cmd(message);
+  }
+
+  if ((fd = open("/dev/null", O_RDWR)) < 0)
+  {
+    perror("/dev/null");
+    exit(EXIT_FAILURE);
+  }
+
+  bench_client = client_make(NULL);
+  bench_client->connection->fd = fd_open(fd, 0, "Benchmark client");
+  return 1;
+}
+
+static void
+run_match_ban(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+    sink += match(masks[i % BENCH_MASKS], users[i % users_count].mask);
+}
+
+static void
+run_match_host(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const char *const mask = masks[i % BENCH_MASKS];
+    sink += match(strchr(mask, '@') + 1, users[i % users_count].host);
+  }
+}
+
+static void
+run_collapse(uintmax_t n)
+{
+  static const char *const input[] =
+  {
+    "**!*@*", "*?*!**@*.example.net", "nick**!*@*", "*!*@**.*.**", "***!~user@*.*"
+  };
+  char buf[64];
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    strlcpy(buf, input[i % 5], sizeof(buf));
+    sink += *collapse(buf);
+  }
+}
+
+static void
+run_irccmp_equal(uintmax_t n)
+{
+  static char upper[BENCH_LINES][NICKLEN + 1];
+  static unsigned int prepared;
+
+  for (; prepared < BENCH_LINES; ++prepared)
+  {
+    const char *const nick = users[prepared % users_count].nick;
+
+    for (unsigned int j = 0; j <= strlen(nick); ++j)
+      upper[prepared][j] = ToUpper(nick[j]);
+  }
+
+  for (uintmax_t i = 0; i < n; ++i)
+    sink += irccmp(users[i % BENCH_LINES % users_count].nick, upper[i % BENCH_LINES]);
+}
+
+static void
+run_irccmp_differ(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+    sink += irccmp(users[i % users_count].nick, users[(i + 1) % users_count].nick);
+}
+
+static void
+run_strhash(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+    sink += strhash(users[i % users_count].nick);
+}
+
+static void
+run_parse(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const char *const line = lines[i % BENCH_LINES];
+    const size_t len = strlen(line);
+
+    /* parse() modifies the buffer */
+    memcpy(bench_buf, line, len + 1);
+    parse(bench_client, bench_buf, bench_buf + len);
+  }
+}
+
+static void
+bench_send_format(struct dbuf_block *block, const char *pattern, ...)
+{
+  va_list args;
+
+  va_start(args, pattern);
+  send_format(block, pattern, args);
+  va_end(args);
+}
+
+static void
+run_send_format(uintmax_t n)
+{
+  struct dbuf_block *block = dbuf_alloc();
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const struct BenchUser *const u = &users[i % users_count];
+
+    block->size = 0;
+    bench_send_format(block, ":%s!%s@%s PRIVMSG %s :%s", u->nick, u->user, u->host,
+                      "#channel", lines[i % BENCH_LINES]);
+    sink += block->size;
+  }
+
+  dbuf_ref_free(block);
+}
+
+static void
+run_dbuf_put(uintmax_t n)
+{
+  struct dbuf_queue queue = { .blocks = { NULL, NULL, 0 } };
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const char *const line = lines[i % BENCH_LINES];
+
+    dbuf_put(&queue, line, strlen(line));
+
+    /* Keep the queue at sendq-like sizes */
+    if ((i % BENCH_LINES) == BENCH_LINES - 1)
+    {
+      bench_pause();
+      dbuf_clear(&queue);
+      bench_resume();
+    }
+  }
+
+  dbuf_clear(&queue);
+}
+
+static void
+run_dbuf_delete(uintmax_t n)
+{
+  struct dbuf_queue queue = { .blocks = { NULL, NULL, 0 } };
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    if (dbuf_length(&queue) == 0)
+    {
+      bench_pause();
+      for (unsigned int j = 0; j < BENCH_LINES; ++j)
+        dbuf_put(&queue, lines[j], strlen(lines[j]));
+      bench_resume();
+    }
+
+    dbuf_delete(&queue, strlen(lines[i % BENCH_LINES]));
+  }
+
+  dbuf_clear(&queue);
+}
+
+static void
+run_extract_one_line(uintmax_t n)
+{
+  struct dbuf_queue queue = { .blocks = { NULL, NULL, 0 } };
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    if (dbuf_length(&queue) == 0)
+    {
+      bench_pause();
+      for (unsigned int j = 0; j < BENCH_LINES; ++j)
+      {
+        dbuf_put(&queue, lines[j], strlen(lines[j]));
+        dbuf_put(&queue, "\r\n", 2);
+      }
+      bench_resume();
+    }
+
+    sink += extract_one_line(&queue, bench_buf);
+  }
+
+  dbuf_clear(&queue);
+}
+
+static void
+run_find_kline(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const struct BenchUser *const u = &users[i % users_count];
+
+    sink += find_conf_by_address(u->host, u->aftype ? &u->addr : NULL, CONF_KLINE, u->aftype,
+                                 u->user, NULL, 1) != NULL;
+  }
+}
+
+static void
+run_find_dline(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    const struct BenchUser *const u = &users[i % users_count];
+
+    if (u->aftype)
+      sink += find_dline_conf(&u->addr, u->aftype) != NULL;
+  }
+}
+
+static void
+run_patricia_best(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    struct BenchUser *const u = &users[i % users_count];
+
+    if (u->aftype)
+      sink += patricia_try_search_best_addr(bench_tree, (struct sockaddr *)&u->addr.ss, 0) != NULL;
+  }
+}
+
+static void
+run_patricia_insert(uintmax_t n)
+{
+  patricia_tree_t *tree = patricia_new(128);
+
+  for (uintmax_t i = 0; i < n; ++i)
+  {
+    if ((unsigned int)tree->num_active_node >= users_count)
+    {
+      bench_pause();
+      patricia_destroy(tree, NULL);
+      tree = patricia_new(128);
+      bench_resume();
+    }
+
+    sink += patricia_make_and_lookup(tree, users[i % users_count].ip) != NULL;
+  }
+
+  patricia_destroy(tree, NULL);
+}
+
+#ifdef HAVE_TLS
+/*
+ * The client keeps the session of its last handshake, to offer it
+ * for resumption in the next one. This is the only part that has to
+ * go around the TLS abstraction.
+ */
+#ifdef HAVE_TLS_OPENSSL
+static SSL_SESSION *bench_tls_session;
+
+static void
+bench_tls_session_save(tls_data_t *tls_data)
+{
+  if (bench_tls_session)
+    SSL_SESSION_free(bench_tls_session);
+  bench_tls_session = SSL_get1_session(*tls_data);
+}
+
+static void
+bench_tls_session_offer(tls_data_t *tls_data)
+{
+  SSL_set_session(*tls_data, bench_tls_session);
+}
+#else
+static gnutls_datum_t bench_tls_session;
+
+static void
+bench_tls_session_save(tls_data_t *tls_data)
+{
+  gnutls_free(bench_tls_session.data);
+  bench_tls_session.data = NULL;
+  gnutls_session_get_data2(tls_data->session, &bench_tls_session);
+}
+
+static void
+bench_tls_session_offer(tls_data_t *tls_data)
+{
+  gnutls_session_set_data(tls_data->session, bench_tls_session.data, bench_tls_session.size);
+}
+#endif
+
+/*
+ * Runs one handshake between a server and a client over a socketpair.
+ * Everything but the server side is excluded from the measurement.
+ */
+static void
+bench_tls_handshake(int resume)
+{
+  tls_data_t server, client;
+  int sv[2], server_done = 0, client_done = 0;
+  const char *errstr = NULL;
+  char buf[64];
+
+  bench_pause();
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+  {
+    perror("socketpair");
+    exit(EXIT_FAILURE);
+  }
+
+  fcntl(sv[0], F_SETFL, fcntl(sv[0], F_GETFL, 0) | O_NONBLOCK);
+  fcntl(sv[1], F_SETFL, fcntl(sv[1], F_GETFL, 0) | O_NONBLOCK);
+
+  tls_new(&client, sv[1], TLS_ROLE_CLIENT);
+  if (resume)
+    bench_tls_session_offer(&client);
+  bench_resume();
+
+  tls_new(&server, sv[0], TLS_ROLE_SERVER);
+
+  while (!server_done || !client_done)
+  {
+    if (!server_done)
+    {
+      switch (tls_handshake(&server, TLS_ROLE_SERVER, &errstr))
+      {
+        case TLS_HANDSHAKE_DONE:
+          server_done = 1;
+          break;
+        case TLS_HANDSHAKE_ERROR:
+          fprintf(stderr, "TLS handshake failed on the server side: %s\n", errstr ? errstr : "unknown error");
+          exit(EXIT_FAILURE);
+        default:
+          break;
+      }
+    }
+
+    bench_pause();
+    if (!client_done)
+    {
+      switch (tls_handshake(&client, TLS_ROLE_CLIENT, &errstr))
+      {
+        case TLS_HANDSHAKE_DONE:
+          client_done = 1;
+          break;
+        case TLS_HANDSHAKE_ERROR:
+          fprintf(stderr, "TLS handshake failed on the client side: %s\n", errstr ? errstr : "unknown error");
+          exit(EXIT_FAILURE);
+        default:
+          break;
+      }
+    }
+    bench_resume();
+  }
+
+  bench_pause();
+  if (resume && !tls_session_reused(&server))
+  {
+    fprintf(stderr, "TLS session was not resumed\n");
+    exit(EXIT_FAILURE);
+  }
+
+  /* With TLS 1.3, the session tickets only arrive after the handshake */
+  int want_write = 0;
+  tls_read(&client, buf, sizeof(buf), &want_write);
+  bench_tls_session_save(&client);
+
+  /* A session that hasn't been shut down cleanly can't be resumed */
+  tls_shutdown(&client);
+  tls_shutdown(&server);
+  tls_free(&client);
+  tls_free(&server);
+  close(sv[0]);
+  close(sv[1]);
+  bench_resume();
+}
+
+static int
+setup_tls(void)
+{
+  static int warned;
+
+  if (tls_is_initialized())
+    return 1;
+
+  if (bench_tls_cert == NULL || bench_tls_key == NULL)
+  {
+    if (!warned++)
+      printf("# TLSHandshake benchmarks skipped, they need -tlscert and -tlskey\n");
+    return 0;
+  }
+
+  ConfigServerInfo.ssl_certificate_file = xstrdup(bench_tls_cert);
+  ConfigServerInfo.rsa_private_key_file = xstrdup(bench_tls_key);
+  if (bench_tls_dh)
+    ConfigServerInfo.ssl_dh_param_file = xstrdup(bench_tls_dh);
+
+  tls_init();
+
+  if (!tls_new_cred() || !tls_is_initialized())
+  {
+    fprintf(stderr, "Could not load %s and %s\n", bench_tls_cert, bench_tls_key);
+    exit(EXIT_FAILURE);
+  }
+
+  /*
+   * A session for the first resumed handshake. It is also the worst case
+   * for the ticket keys: issued just before a key rotation, and offered
+   * when it is about to expire, after running the rotation event through
+   * that much (faked) time.
+   */
+  paused_total = 0;
+  SystemTime.tv_sec += TLS_TICKET_KEY_LIFETIME - 1;
+  event_run();
+  bench_tls_handshake(0);
+
+  for (unsigned int i = 0; i < TLS_SESSION_TIMEOUT; ++i)
+  {
+    ++SystemTime.tv_sec;
+    event_run();
+  }
+
+  bench_tls_handshake(1);
+  return 1;
+}
+
+static void
+run_tls_full(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+    bench_tls_handshake(0);
+}
+
+static void
+run_tls_resumed(uintmax_t n)
+{
+  for (uintmax_t i = 0; i < n; ++i)
+    bench_tls_handshake(1);
+}
+#endif  /* HAVE_TLS */
+
+static const struct Benchmark benchmarks[] =
+{
+  { "Match/ban-mask", NULL, run_match_ban },
+  { "Match/host", NULL, run_match_host },
+  { "Collapse", NULL, run_collapse },
+  { "Irccmp/equal", NULL, run_irccmp_equal },
+  { "Irccmp/differ", NULL, run_irccmp_differ },
+  { "Strhash/nick", NULL, run_strhash },
+  { "Parse/client", setup_parse, run_parse },
+  { "SendFormat/privmsg", NULL, run_send_format },
+  { "Dbuf/put", NULL, run_dbuf_put },
+  { "Dbuf/delete", NULL, run_dbuf_delete },
+  { "ExtractOneLine", NULL, run_extract_one_line },
+  { "FindConfByAddress/kline", NULL, run_find_kline },
+  { "FindConfByAddress/dline", NULL, run_find_dline },
+  { "Patricia/search-best", NULL, run_patricia_best },
+  { "Patricia/insert", NULL, run_patricia_insert },
+#ifdef HAVE_TLS
+  { "TLSHandshake/full", setup_tls, run_tls_full },
+  { "TLSHandshake/resumed", setup_tls, run_tls_resumed },
+#endif
+  { NULL, NULL, NULL }
+};
+
+/* Finds the number of iterations that takes at least bench_time, like Go's testing package */
+static void
+bench_run(const struct Benchmark *bench)
+{
+  const uintmax_t target = (uintmax_t)bench_time * 1000000;
+  uintmax_t n = 1, elapsed = 0;
+
+  while (1)
+  {
+    paused_total = 0;
+
+    const uintmax_t start = bench_clock();
+    bench->run(n);
+    elapsed = bench_clock() - start - paused_total;
+
+    if (elapsed >= target || n >= UINTMAX_MAX / 100)
+      break;
+
+    /* Aim 20% past the target, but don't grow more than 100x at once */
+    uintmax_t next = elapsed ? target * 6 / 5 * n / elapsed : n * 100;
+    if (next > n * 100)
+      next = n * 100;
+    if (next <= n)
+      next = n + 1;
+    n = next;
+  }
+
+  printf("Benchmark%-32s %12ju %12.2f ns/op\n", bench->name, n, (double)elapsed / n);
+  fflush(stdout);
+}
+
+int
+main(int argc, char *argv[])
+{
+  parseargs(&argc, &argv, myopts);
+
+  set_time();
+  init_genrand(20180101);  /* Fixed, so inputs are the same on every run */
+  fdlist_init();
+  hash_init();
+
+  if (bench_users_file)
+    users_load(bench_users_file);
+  else
+    users_generate();
+
+  users_prepare();
+  masks_generate();
+  lines_generate();
+  klines_generate();
+
+  printf("# ircd-hybrid %s microbenchmarks: %u users, %u masks, %d K-lines\n",
+         ircd_version, users_count, BENCH_MASKS, bench_klines);
+
+  for (int count = 0; count < bench_count; ++count)
+  {
+    for (const struct Benchmark *bench = benchmarks; bench->name; ++bench)
+    {
+      if (bench_filter && strstr(bench->name, bench_filter) == NULL)
+        continue;
+
+      if (bench->setup && !bench->setup())
+        continue;
+
+      bench_run(bench);
+    }
+  }
+
+  return 0;
+}
@@ -111,6 +111,7 @@ add_user_to_channel(struct Channel *chptr, struct Client *client_p,
     dlinkAdd(member, &member->locchannode, &chptr->locmembers);
 
   dlinkAdd(member, &member->usernode, &client_p->channel);
+  list_index_update(chptr);
 }
 
 /*! \brief Deletes an user from a channel by removing a link in the
@@ -134,6 +135,8 @@ remove_user_from_channel(struct Membership *member)
 
   if (chptr->members.head == NULL)
     channel_free(chptr);
+  else
+    list_index_update(chptr);
 }
 
 /* channel_send_members()
@@ -342,6 +345,7 @@ channel_make(const char *name)
 
   dlinkAdd(chptr, &chptr->node, &channel_list);
   hash_add_channel(chptr);
+  list_index_add(chptr);
 
   return chptr;
 }
@@ -361,6 +365,7 @@ channel_free(struct Channel *chptr)
 
   dlinkDelete(&chptr->node, &channel_list);
   hash_del_channel(chptr);
+  list_index_del(chptr);
 
   xfree(chptr);
 }
@@ -879,6 +884,7 @@ channel_set_topic(struct Channel *chptr, const char *topic,
 
   strlcpy(chptr->topic_info, topic_info, sizeof(chptr->topic_info));
   chptr->topic_time = topicts;
+  list_index_invalidate(chptr);
 }
 
 void
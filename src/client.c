@@ -50,6 +50,7 @@
 #include "rng_mt.h"
 #include "parse.h"
 #include "ipcache.h"
+#include "probe.h"
 
 
 dlink_list listing_client_list;
@@ -573,6 +574,8 @@ client_close_connection(struct Client *client_p)
     DelFlag(client_p, FLAGS_BLOCKED);
     send_queued_write(client_p);
   }
+  else
+    send_queued_cancel(client_p);
 
   if (IsClient(client_p))
   {
@@ -607,7 +610,8 @@ client_close_connection(struct Client *client_p)
   else
     ++ServerStats.is_ni;
 
-  if (tls_isusing(&client_p->connection->fd->ssl))
+  /* While a worker thread owns the socket, the shutdown is left to fd_close() */
+  if (tls_isusing(&client_p->connection->fd->ssl) && client_p->connection->fd->io == NULL)
     tls_shutdown(&client_p->connection->fd->ssl);
 
   if (client_p->connection->fd)
@@ -648,6 +652,7 @@ exit_one_client(struct Client *source_p, const char *comment)
 
     dlinkDelete(&source_p->lnode, &source_p->servptr->serv->client_list);
     dlinkDelete(&source_p->node, &global_client_list);
+    who_index_del(source_p);
 
     /*
      * If a person is on a channel, send a QUIT notice
@@ -744,6 +749,8 @@ exit_client(struct Client *source_p, const char *comment)
   assert(!IsMe(source_p));
   assert(source_p != &me);
 
+  IRCD_PROBE3(exit__client, source_p->name, comment, MyConnect(source_p));
+
   if (MyConnect(source_p))
   {
     /*
@@ -1076,6 +1083,27 @@ del_all_accepts(struct Client *client_p)
     del_accept(node->data, client_p);
 }
 
+/* client_get_tls_mode()
+ *
+ * inputs       - pointer to a local client
+ * output       - " TLS" or " kTLS" (or " kTLS-tx" if only sending is done
+ *                by the kernel) for encrypted connections, empty otherwise
+ * side effects - none; used as a suffix by TRACE and ETRACE
+ */
+const char *
+client_get_tls_mode(const struct Client *client_p)
+{
+  const fde_t *const F = client_p->connection->fd;
+
+  if (!HasFlag(client_p, FLAGS_SSL) || F == NULL)
+    return "";
+  if (F->flags.ktls_send && F->flags.ktls_recv)
+    return " kTLS";
+  if (F->flags.ktls_send)
+    return " kTLS-tx";
+  return " TLS";
+}
+
 unsigned int
 client_get_idle_time(const struct Client *source_p,
                      const struct Client *target_p)
@@ -60,6 +60,7 @@
 #include "ipcache.h"
 #include "isupport.h"
 #include "whowas.h"
+#include "metrics.h"
 
 
 struct config_channel_entry ConfigChannel;
@@ -166,6 +167,13 @@ conf_free(struct MaskItem *conf)
   dlink_node *node = NULL, *node_next = NULL;
   dlink_list *list = NULL;
 
+  /* K-lines and D-lines loaded from a snapshot, strings included */
+  if (IsConfArena(conf))
+  {
+    database_arena_release(conf);
+    return;
+  }
+
   if ((list = map_to_list(conf->type)))
     dlinkFindDelete(list, conf);
 
@@ -219,8 +227,7 @@ attach_iline(struct Client *client_p, struct MaskItem *conf)
   const struct ClassItem *const class = conf->class;
   int a_limit_reached = 0;
 
-  struct ip_entry *ipcache = ipcache_find_or_add_address(&client_p->ip);
-  ++ipcache->count_local;
+  const struct ip_entry *ipcache = ipcache_add_address(&client_p->ip, 1);
   AddFlag(client_p, FLAGS_IPHASH);
 
   if (class->max_total && class->ref_count >= class->max_total)
@@ -761,7 +768,6 @@ lookup_confhost(struct MaskItem *conf)
 int
 conf_connect_allowed(struct irc_ssaddr *addr, int aftype)
 {
-  struct ip_entry *ip_found = NULL;
   const struct MaskItem *conf = find_dline_conf(addr, aftype);
 
   if (conf)
@@ -772,19 +778,9 @@ conf_connect_allowed(struct irc_ssaddr *addr, int aftype)
     return BANNED_CLIENT;
   }
 
-  ip_found = ipcache_find_or_add_address(addr);
-
-  if ((CurrentTime - ip_found->last_attempt) < ConfigGeneral.throttle_time)
-  {
-    if (ip_found->connection_count >= ConfigGeneral.throttle_count)
-      return TOO_FAST;
+  if (ipcache_throttle(addr))
+    return TOO_FAST;
 
-    ++ip_found->connection_count;
-  }
-  else
-    ip_found->connection_count = 1;
-
-  ip_found->last_attempt = CurrentTime;
   return 0;
 }
 
@@ -983,6 +979,10 @@ clear_out_old_conf(void)
   xfree(ConfigServerInfo.ssl_message_digest_algorithm);
   ConfigServerInfo.ssl_message_digest_algorithm = NULL;
 
+  /* Clean out ConfigGeneral */
+  xfree(ConfigGeneral.metrics_socket);
+  ConfigGeneral.metrics_socket = NULL;
+
   /* Clean out ConfigAdminInfo */
   xfree(ConfigAdminInfo.name);
   ConfigAdminInfo.name = NULL;
@@ -1069,6 +1069,7 @@ read_conf_files(int cold)
 
   log_iterate(log_reopen);
   conf_handle_tls(cold);
+  metrics_listen(ConfigGeneral.metrics_socket);
 
   isupport_add("NICKLEN", NULL, ConfigServerInfo.max_nick_length);
   isupport_add("NETWORK", ConfigServerInfo.network_name, -1);
@@ -174,71 +174,169 @@ class_delete_marked(void)
 }
 
 /*
- * cidr_limit_reached
+ * cidr_hash
  *
- * inputs	- int flag allowing over_rule of limits
- *		- pointer to the ip to be added
- *		- pointer to the class
- * output	- non zero if limit reached
- *		  0 if limit not reached
- * side effects	-
+ * inputs	- pointer to a masked address
+ * output	- FNV-1a hash of the address bytes
+ * side effects	- none
  */
-int
-cidr_limit_reached(int over_rule, struct irc_ssaddr *ip, struct ClassItem *class)
+static uint32_t
+cidr_hash(const struct irc_ssaddr *addr)
+{
+  const unsigned char *p;
+  size_t len;
+  uint32_t hash = 2166136261U;
+
+  if (addr->ss.ss_family == AF_INET)
+  {
+    p = (const unsigned char *)&((const struct sockaddr_in *)addr)->sin_addr;
+    len = sizeof(struct in_addr);
+  }
+  else
+  {
+    p = (const unsigned char *)&((const struct sockaddr_in6 *)addr)->sin6_addr;
+    len = sizeof(struct in6_addr);
+  }
+
+  while (len--)
+    hash = (hash ^ *p++) * 16777619U;
+
+  return hash;
+}
+
+static int
+cidr_equal(const struct irc_ssaddr *a, const struct irc_ssaddr *b)
+{
+  if (a->ss.ss_family == AF_INET)
+    return !memcmp(&((const struct sockaddr_in *)a)->sin_addr,
+                   &((const struct sockaddr_in *)b)->sin_addr, sizeof(struct in_addr));
+  return !memcmp(&((const struct sockaddr_in6 *)a)->sin6_addr,
+                 &((const struct sockaddr_in6 *)b)->sin6_addr, sizeof(struct in6_addr));
+}
+
+static struct CidrItem *
+cidr_find(const struct cidr_map *map, const struct irc_ssaddr *mask, uint32_t hash)
 {
   dlink_node *node;
 
-  if (class->number_per_cidr == 0)
-    return 0;
+  if (map->table == NULL)
+    return NULL;
 
-  if (ip->ss.ss_family == AF_INET)
+  DLINK_FOREACH(node, map->table[hash & (map->size - 1)].head)
   {
-    if (class->cidr_bitlen_ipv4 == 0)
-      return 0;
+    struct CidrItem *cidr = node->data;
 
-    DLINK_FOREACH(node, class->list_ipv4.head)
-    {
-      struct CidrItem *cidr = node->data;
+    if (cidr->hash == hash && cidr_equal(&cidr->mask, mask))
+      return cidr;
+  }
+
+  return NULL;
+}
 
-      if (match_ipv4(ip, &cidr->mask, class->cidr_bitlen_ipv4))
+static void
+cidr_add(struct cidr_map *map, struct CidrItem *cidr)
+{
+  if (map->count >= map->size)
+  {
+    /* Keep the load factor at or below one */
+    const unsigned int size = map->size ? map->size * 2 : 64;
+    dlink_list *table = xcalloc(size * sizeof(*table));
+
+    for (unsigned int i = 0; i < map->size; ++i)
+    {
+      while (map->table[i].head)
       {
-        if (!over_rule && (cidr->number_on_this_cidr >= class->number_per_cidr))
-          return -1;
+        struct CidrItem *item = map->table[i].head->data;
 
-        cidr->number_on_this_cidr++;
-        return 0;
+        dlinkDelete(&item->node, &map->table[i]);
+        dlinkAdd(item, &item->node, &table[item->hash & (size - 1)]);
       }
     }
 
-    struct CidrItem *cidr = xcalloc(sizeof(*cidr));
-    cidr->number_on_this_cidr = 1;
-    cidr->mask = *ip;
-    mask_addr(&cidr->mask, class->cidr_bitlen_ipv4);
-    dlinkAdd(cidr, &cidr->node, &class->list_ipv4);
+    xfree(map->table);
+    map->table = table;
+    map->size = size;
+  }
+
+  dlinkAdd(cidr, &cidr->node, &map->table[cidr->hash & (map->size - 1)]);
+  ++map->count;
+}
+
+/*
+ * cidr_map_get
+ *
+ * inputs	- pointer to the ip
+ *		- pointer to the class
+ *		- pointer to where to store the masked ip
+ * output	- the class' map for the ip's family, or NULL if there's
+ *		  no limit on it
+ * side effects	-
+ */
+static struct cidr_map *
+cidr_map_get(const struct irc_ssaddr *ip, struct ClassItem *class, struct irc_ssaddr *mask)
+{
+  struct cidr_map *map;
+  unsigned int bitlen;
+
+  if (class->number_per_cidr == 0)
+    return NULL;
+
+  if (ip->ss.ss_family == AF_INET)
+  {
+    map = &class->cidr_ipv4;
+    bitlen = class->cidr_bitlen_ipv4;
   }
-  else if (class->cidr_bitlen_ipv6 > 0)
+  else
   {
-    DLINK_FOREACH(node, class->list_ipv6.head)
-    {
-      struct CidrItem *cidr = node->data;
+    map = &class->cidr_ipv6;
+    bitlen = class->cidr_bitlen_ipv6;
+  }
 
-      if (match_ipv6(ip, &cidr->mask, class->cidr_bitlen_ipv6))
-      {
-        if (!over_rule && (cidr->number_on_this_cidr >= class->number_per_cidr))
-          return -1;
+  if (bitlen == 0)
+    return NULL;
 
-        cidr->number_on_this_cidr++;
-        return 0;
-      }
-    }
+  *mask = *ip;
+  mask_addr(mask, bitlen);
+  return map;
+}
+
+/*
+ * cidr_limit_reached
+ *
+ * inputs	- int flag allowing over_rule of limits
+ *		- pointer to the ip to be added
+ *		- pointer to the class
+ * output	- non zero if limit reached
+ *		  0 if limit not reached
+ * side effects	-
+ */
+int
+cidr_limit_reached(int over_rule, struct irc_ssaddr *ip, struct ClassItem *class)
+{
+  struct irc_ssaddr mask;
+  struct cidr_map *map = cidr_map_get(ip, class, &mask);
+
+  if (map == NULL)
+    return 0;
 
-    struct CidrItem *cidr = xcalloc(sizeof(*cidr));
-    cidr->number_on_this_cidr = 1;
-    cidr->mask = *ip;
-    mask_addr(&cidr->mask, class->cidr_bitlen_ipv6);
-    dlinkAdd(cidr, &cidr->node, &class->list_ipv6);
+  const uint32_t hash = cidr_hash(&mask);
+  struct CidrItem *cidr = cidr_find(map, &mask, hash);
+
+  if (cidr)
+  {
+    if (!over_rule && (cidr->number_on_this_cidr >= class->number_per_cidr))
+      return -1;
+
+    cidr->number_on_this_cidr++;
+    return 0;
   }
 
+  cidr = xcalloc(sizeof(*cidr));
+  cidr->number_on_this_cidr = 1;
+  cidr->mask = mask;
+  cidr->hash = hash;
+  cidr_add(map, cidr);
+
   return 0;
 }
 
@@ -253,51 +351,20 @@ cidr_limit_reached(int over_rule, struct irc_ssaddr *ip, struct ClassItem *class
 void
 remove_from_cidr_check(struct irc_ssaddr *ip, struct ClassItem *aclass)
 {
-  dlink_node *node, *node_next;
+  struct irc_ssaddr mask;
+  struct cidr_map *map = cidr_map_get(ip, aclass, &mask);
 
-  if (aclass->number_per_cidr == 0)
+  if (map == NULL)
     return;
 
-  if (ip->ss.ss_family == AF_INET)
-  {
-    if (aclass->cidr_bitlen_ipv4 == 0)
-      return;
-
-    DLINK_FOREACH_SAFE(node, node_next, aclass->list_ipv4.head)
-    {
-      struct CidrItem *cidr = node->data;
+  const uint32_t hash = cidr_hash(&mask);
+  struct CidrItem *cidr = cidr_find(map, &mask, hash);
 
-      if (match_ipv4(ip, &cidr->mask, aclass->cidr_bitlen_ipv4))
-      {
-        cidr->number_on_this_cidr--;
-
-        if (cidr->number_on_this_cidr == 0)
-        {
-          dlinkDelete(node, &aclass->list_ipv4);
-          xfree(cidr);
-          return;
-        }
-      }
-    }
-  }
-  else if (aclass->cidr_bitlen_ipv6 > 0)
+  if (cidr && --cidr->number_on_this_cidr == 0)
   {
-    DLINK_FOREACH_SAFE(node, node_next, aclass->list_ipv6.head)
-    {
-      struct CidrItem *cidr = node->data;
-
-      if (match_ipv6(ip, &cidr->mask, aclass->cidr_bitlen_ipv6))
-      {
-        cidr->number_on_this_cidr--;
-
-        if (cidr->number_on_this_cidr == 0)
-        {
-          dlinkDelete(node, &aclass->list_ipv6);
-          xfree(cidr);
-          return;
-        }
-      }
-    }
+    dlinkDelete(&cidr->node, &map->table[hash & (map->size - 1)]);
+    --map->count;
+    xfree(cidr);
   }
 }
 
@@ -320,21 +387,27 @@ rebuild_cidr_list(struct ClassItem *class)
 }
 
 /*
- * destroy_cidr_list
+ * destroy_cidr_map
  *
- * inputs	- pointer to class dlink list of cidr blocks
+ * inputs	- pointer to class map of cidr blocks
  * output	- none
- * side effects	- completely destroys the class link list of cidr blocks
+ * side effects	- completely destroys the map of cidr blocks
  */
 static void
-destroy_cidr_list(dlink_list *list)
+destroy_cidr_map(struct cidr_map *map)
 {
-  while (list->head)
+  for (unsigned int i = 0; i < map->size; ++i)
   {
-    struct CidrItem *cidr = list->head->data;
-    dlinkDelete(&cidr->node, list);
-    xfree(cidr);
+    while (map->table[i].head)
+    {
+      struct CidrItem *cidr = map->table[i].head->data;
+      dlinkDelete(&cidr->node, &map->table[i]);
+      xfree(cidr);
+    }
   }
+
+  xfree(map->table);
+  memset(map, 0, sizeof(*map));
 }
 
 /*
@@ -342,11 +415,11 @@ destroy_cidr_list(dlink_list *list)
  *
  * inputs	- pointer to class
  * output	- none
- * side effects	- completely destroys the class link list of cidr blocks
+ * side effects	- completely destroys the maps of cidr blocks
  */
 void
 destroy_cidr_class(struct ClassItem *class)
 {
-  destroy_cidr_list(&class->list_ipv4);
-  destroy_cidr_list(&class->list_ipv6);
+  destroy_cidr_map(&class->cidr_ipv4);
+  destroy_cidr_map(&class->cidr_ipv6);
 }
@@ -36,6 +36,14 @@
 #include "send.h"
 #include "irc_string.h"
 #include "hostmask.h"
+#include "misc.h"
+#include "ircd.h"
+#include "fdlist.h"
+
+
+/*! \brief Set in the child process compact_databases() forks off. The child
+ * closes the sockets it inherits, so it must not send anything to clients. */
+static int compaction_child;
 
 
 /*! \brief Return the version number on the file.  Return 0 if there is no version
@@ -155,7 +163,7 @@ open_db_write(const char *filename, uint32_t version)
     int errno_save = errno;
     static int walloped = 0;
 
-    if (!walloped++)
+    if (!walloped++ && !compaction_child)
       sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
                            "Cannot create temporary database file %s",
                            f->tempname);
@@ -177,7 +185,47 @@ open_db_write(const char *filename, uint32_t version)
   return f;
 }
 
-/*! \brief Open a database file for reading (*mode == 'r') or writing (*mode == 'w').
+/*! \brief Open a journal for appending. A version number is written first if
+ * the file is new or empty.
+ * \param filename File to open as the journal
+ * \param version Journal version
+ * \return dbFile struct
+ */
+static struct dbFILE *
+open_db_append(const char *filename, uint32_t version)
+{
+  struct dbFILE *f = xcalloc(sizeof(*f));
+  struct stat st;
+  int fd = 0;
+
+  strlcpy(f->filename, filename, sizeof(f->filename));
+  f->mode = 'a';
+
+  fd = open(f->filename, O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (fd >= 0 && (f->fp = fdopen(fd, "ab")) == NULL)
+    close(fd);
+
+  if (!f->fp || fstat(fileno(f->fp), &st) < 0 ||
+      (st.st_size == 0 && (!write_file_version(f, version) || fflush(f->fp))))
+  {
+    int errno_save = errno;
+
+    ilog(LOG_TYPE_IRCD, "Cannot open journal %s: %s", f->filename,
+         strerror(errno_save));
+
+    if (f->fp)
+      fclose(f->fp);
+
+    xfree(f);
+    errno = errno_save;
+    return NULL;
+  }
+
+  return f;
+}
+
+/*! \brief Open a database file for reading (*mode == 'r'), writing (*mode == 'w')
+ * or appending (*mode == 'a').
  * Return the stream pointer, or NULL on error.  When opening for write, the
  * file actually opened is a temporary file, which will be renamed to the
  * original file on close.
@@ -201,6 +249,9 @@ open_db(const char *filename, const char *mode, uint32_t version)
     case 'w':
       return open_db_write(filename, version);
       break;
+    case 'a':
+      return open_db_append(filename, version);
+      break;
     default:
       errno = EINVAL;
       return NULL;
@@ -246,6 +297,13 @@ close_db(struct dbFILE *f)
     return -1;
   }
 
+  /* The file is renamed over the old one, make sure it's on disk first */
+  if (f->mode == 'w' && (fflush(f->fp) || fsync(fileno(f->fp))))
+  {
+    restore_db(f);
+    return -1;
+  }
+
   res = fclose(f->fp);
   f->fp = NULL;
 
@@ -258,13 +316,16 @@ close_db(struct dbFILE *f)
     {
       int errno_save = errno;
 
-      sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE, "Unable to move new "
-                           "data to database file %s; new data NOT saved.",
-                           f->filename);
+      if (!compaction_child)
+        sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE, "Unable to move new "
+                             "data to database file %s; new data NOT saved.",
+                             f->filename);
       errno = errno_save;
       ilog(LOG_TYPE_IRCD, "Unable to move new data to database file %s; new "
            "data NOT saved.", f->filename);
       remove(f->tempname);
+      xfree(f);
+      return -1;
     }
   }
 
@@ -475,197 +536,351 @@ write_string(const char *s, struct dbFILE *f)
   return 0;
 }
 
-#define SAFE_READ(x) do {                             \
-    if ((x) < 0) {                                    \
-        break;                                        \
-    }                                                 \
-} while (0)
-
 #define SAFE_WRITE(x,db) do {                         \
     if ((x) < 0) {                                    \
         restore_db(f);                                \
         ilog(LOG_TYPE_IRCD, "Write error on %s", db); \
-        return;                                       \
+        return -1;                                    \
     }                                                 \
 } while (0)
 
-void
-save_kline_database(const char *filename)
+/*
+ * K-line and D-line snapshots can hold millions of entries, so from
+ * MAPPED_DB_VERSION on they use a layout that can be loaded straight from
+ * a memory mapping: after the version number, the number of records and the
+ * size of the string table follow fixed-size records of three string offsets
+ * (user, host, reason; MAPPED_DB_NONE for NULL), a reserved word, setat and
+ * until. The string table holds the NUL-terminated strings. All numbers are
+ * big-endian like the rest of the format. load_mapped_database() copies the
+ * string table and builds all MaskItems and AddressRecs in a single arena.
+ */
+enum
 {
-  uint32_t i = 0;
-  uint32_t records = 0;
-  struct dbFILE *f = NULL;
-  dlink_node *ptr = NULL;
-
-  if (!(f = open_db(filename, "w", KLINE_DB_VERSION)))
-    return;
-
-  for (i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(ptr, atable[i].head)
-    {
-      struct AddressRec *arec = ptr->data;
+  MAPPED_DB_HEADER = 12,
+  MAPPED_DB_RECORD = 32,
+  MAPPED_DB_NONE = UINT32_MAX
+};
+
+/*! \brief Block holding the entries and strings of one loaded snapshot.
+ * It's freed when the last of its entries is. */
+struct DatabaseArena
+{
+  dlink_node node;  /**< Entry in arena_list */
+  char *base;
+  size_t size;
+  unsigned int refs;  /**< Number of entries still in use */
+};
 
-      if (arec->type == CONF_KLINE && IsConfDatabase(arec->conf))
-        ++records;
-    }
-  }
+struct DatabaseEntry
+{
+  struct MaskItem conf;
+  struct AddressRec arec;
+};
 
-  SAFE_WRITE(write_uint32(records, f), filename);
+static dlink_list arena_list;
 
-  for (i = 0; i < ATABLE_SIZE; ++i)
-  {
-    DLINK_FOREACH(ptr, atable[i].head)
-    {
-      struct AddressRec *arec = ptr->data;
+static void
+put_uint32(unsigned char *p, uint32_t val)
+{
+  p[0] = val >> 24;
+  p[1] = val >> 16;
+  p[2] = val >> 8;
+  p[3] = val;
+}
 
-      if (arec->type == CONF_KLINE && IsConfDatabase(arec->conf))
-      {
-        SAFE_WRITE(write_string(arec->conf->user, f), filename);
-        SAFE_WRITE(write_string(arec->conf->host, f), filename);
-        SAFE_WRITE(write_string(arec->conf->reason, f), filename);
-        SAFE_WRITE(write_uint64(arec->conf->setat, f), filename);
-        SAFE_WRITE(write_uint64(arec->conf->until, f), filename);
-      }
-    }
-  }
+static void
+put_uint64(unsigned char *p, uint64_t val)
+{
+  put_uint32(p, val >> 32);
+  put_uint32(p + 4, val);
+}
 
-  close_db(f);
+static uint32_t
+get_uint32(const unsigned char *p)
+{
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
 }
 
-void
-load_kline_database(const char *filename)
+static uint64_t
+get_uint64(const unsigned char *p)
 {
-  struct dbFILE *f = NULL;
-  struct MaskItem *conf = NULL;
-  char *field_1 = NULL;
-  char *field_2 = NULL;
-  char *field_3 = NULL;
-  uint32_t i = 0;
-  uint32_t records = 0;
-  uint64_t field_4 = 0;
-  uint64_t field_5 = 0;
+  return (uint64_t)get_uint32(p) << 32 | get_uint32(p + 4);
+}
 
-  if (!(f = open_db(filename, "r", KLINE_DB_VERSION)))
-    return;
+static uint32_t
+mapped_string_offset(const char *str, uint32_t *offset)
+{
+  uint32_t ret = *offset;
 
-  if (get_file_version(f) < 1)
-  {
-    close_db(f);
-    return;
-  }
+  if (str == NULL)
+    return MAPPED_DB_NONE;
 
-  read_uint32(&records, f);
+  *offset += strlen(str) + 1;
+  return ret;
+}
 
-  for (i = 0; i < records; ++i)
-  {
-    SAFE_READ(read_string(&field_1, f));
-    SAFE_READ(read_string(&field_2, f));
-    SAFE_READ(read_string(&field_3, f));
-    SAFE_READ(read_uint64(&field_4, f));
-    SAFE_READ(read_uint64(&field_5, f));
+/*! \brief Writes one MAPPED_DB_VERSION record
+ * \return -1 on error, 0 otherwise.
+ */
+static int
+write_mapped_record(const struct MaskItem *conf, uint32_t *offset, struct dbFILE *f)
+{
+  unsigned char record[MAPPED_DB_RECORD] = "";
 
-    conf = conf_make(CONF_KLINE);
-    conf->user = field_1;
-    conf->host = field_2;
-    conf->reason = field_3;
-    conf->setat = field_4;
-    conf->until = field_5;
-    SetConfDatabase(conf);
+  put_uint32(record, mapped_string_offset(conf->user, offset));
+  put_uint32(record + 4, mapped_string_offset(conf->host, offset));
+  put_uint32(record + 8, mapped_string_offset(conf->reason, offset));
+  put_uint64(record + 16, conf->setat);
+  put_uint64(record + 24, conf->until);
 
-    add_conf_by_address(CONF_KLINE, conf);
-  }
+  if (fwrite(record, sizeof(record), 1, f->fp) != 1)
+    return -1;
+  return 0;
+}
 
-  close_db(f);
+static int
+write_mapped_table(const char *str, struct dbFILE *f)
+{
+  if (str && fwrite(str, strlen(str) + 1, 1, f->fp) != 1)
+    return -1;
+  return 0;
 }
 
-void
-save_dline_database(const char *filename)
+static int
+save_address_database(const char *filename, enum maskitem_type type)
 {
-  uint32_t i = 0;
   uint32_t records = 0;
+  uint32_t offset = 0;
+  uint64_t strings = 0;
   struct dbFILE *f = NULL;
-  dlink_node *ptr = NULL;
-
-  if (!(f = open_db(filename, "w", KLINE_DB_VERSION)))
-    return;
+  dlink_node *node = NULL;
 
-  for (i = 0; i < ATABLE_SIZE; ++i)
+  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
   {
-    DLINK_FOREACH(ptr, atable[i].head)
+    DLINK_FOREACH(node, atable[i].head)
     {
-      struct AddressRec *arec = ptr->data;
+      const struct AddressRec *arec = node->data;
 
-      if (arec->type == CONF_DLINE && IsConfDatabase(arec->conf))
+      if (arec->type == type && IsConfDatabase(arec->conf))
+      {
         ++records;
+
+        if (arec->conf->user)
+          strings += strlen(arec->conf->user) + 1;
+        if (arec->conf->host)
+          strings += strlen(arec->conf->host) + 1;
+        if (arec->conf->reason)
+          strings += strlen(arec->conf->reason) + 1;
+      }
     }
   }
 
+  if (strings >= MAPPED_DB_NONE)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot write %s: String table too large", filename);
+    return -1;
+  }
+
+  if (!(f = open_db(filename, "w", MAPPED_DB_VERSION)))
+    return -1;
+
   SAFE_WRITE(write_uint32(records, f), filename);
+  SAFE_WRITE(write_uint32(strings, f), filename);
 
-  for (i = 0; i < ATABLE_SIZE; ++i)
+  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
   {
-    DLINK_FOREACH(ptr, atable[i].head)
+    DLINK_FOREACH(node, atable[i].head)
     {
-      struct AddressRec *arec = ptr->data;
+      const struct AddressRec *arec = node->data;
 
-      if (arec->type == CONF_DLINE && IsConfDatabase(arec->conf))
+      if (arec->type == type && IsConfDatabase(arec->conf))
       {
-        SAFE_WRITE(write_string(arec->conf->host, f), filename);
-        SAFE_WRITE(write_string(arec->conf->reason, f), filename);
-        SAFE_WRITE(write_uint64(arec->conf->setat, f), filename);
-        SAFE_WRITE(write_uint64(arec->conf->until, f), filename);
+        SAFE_WRITE(write_mapped_record(arec->conf, &offset, f), filename);
       }
     }
   }
 
-  close_db(f);
+  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
+  {
+    DLINK_FOREACH(node, atable[i].head)
+    {
+      const struct AddressRec *arec = node->data;
+
+      if (arec->type == type && IsConfDatabase(arec->conf))
+      {
+        SAFE_WRITE(write_mapped_table(arec->conf->user, f), filename);
+        SAFE_WRITE(write_mapped_table(arec->conf->host, f), filename);
+        SAFE_WRITE(write_mapped_table(arec->conf->reason, f), filename);
+      }
+    }
+  }
+
+  return close_db(f);
+}
+
+int
+save_kline_database(const char *filename)
+{
+  return save_address_database(filename, CONF_KLINE);
+}
+
+int
+save_dline_database(const char *filename)
+{
+  return save_address_database(filename, CONF_DLINE);
 }
 
+/*! \brief Gives back an entry of a snapshot arena, called by conf_free().
+ * The arena is freed along with its last entry.
+ */
 void
-load_dline_database(const char *filename)
+database_arena_release(const struct MaskItem *conf)
 {
-  struct dbFILE *f = NULL;
-  struct MaskItem *conf = NULL;
-  char *field_1 = NULL;
-  char *field_2 = NULL;
-  uint32_t i = 0;
-  uint32_t records = 0;
-  uint64_t field_3 = 0;
-  uint64_t field_4 = 0;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, arena_list.head)
+  {
+    struct DatabaseArena *arena = node->data;
+
+    if ((const char *)conf < arena->base || (const char *)conf >= arena->base + arena->size)
+      continue;
+
+    assert(arena->refs);
+
+    if (--arena->refs == 0)
+    {
+      dlinkDelete(&arena->node, &arena_list);
+      munmap(arena->base, arena->size);
+      xfree(arena);
+    }
 
-  if (!(f = open_db(filename, "r", KLINE_DB_VERSION)))
     return;
+  }
 
-  if (get_file_version(f) < 1)
+  assert(0);
+}
+
+/*! \brief Loads a K-line or D-line snapshot in the MAPPED_DB_VERSION layout.
+ * \param f Snapshot; its version number has been read already
+ * \param type CONF_KLINE or CONF_DLINE
+ * \return Number of entries loaded.
+ */
+static uint32_t
+load_mapped_database(struct dbFILE *f, enum maskitem_type type)
+{
+  struct DatabaseArena *arena = NULL;
+  struct DatabaseEntry *entry = NULL;
+  unsigned char *map = NULL;
+  const unsigned char *record = NULL;
+  const char *table = NULL;
+  char *strings = NULL;
+  uint32_t records = 0, size = 0, loaded = 0, invalid = 0;
+  struct stat st;
+
+  if (fstat(fileno(f->fp), &st) < 0 || st.st_size < MAPPED_DB_HEADER)
   {
-    close_db(f);
-    return;
+    ilog(LOG_TYPE_IRCD, "Cannot load %s: Truncated file", f->filename);
+    return 0;
+  }
+
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f->fp), 0);
+  if (map == MAP_FAILED)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot map %s: %s", f->filename, strerror(errno));
+    return 0;
   }
 
-  read_uint32(&records, f);
+  posix_madvise(map, st.st_size, POSIX_MADV_SEQUENTIAL);
+
+  records = get_uint32(map + 4);
+  size = get_uint32(map + 8);
+  table = (const char *)map + MAPPED_DB_HEADER + (uint64_t)records * MAPPED_DB_RECORD;
 
-  for (i = 0; i < records; ++i)
+  if ((uint64_t)MAPPED_DB_HEADER + (uint64_t)records * MAPPED_DB_RECORD + size != (uint64_t)st.st_size ||
+      (size && table[size - 1]))
   {
-    SAFE_READ(read_string(&field_1, f));
-    SAFE_READ(read_string(&field_2, f));
-    SAFE_READ(read_uint64(&field_3, f));
-    SAFE_READ(read_uint64(&field_4, f));
+    ilog(LOG_TYPE_IRCD, "Cannot load %s: Corrupt file", f->filename);
+    munmap(map, st.st_size);
+    return 0;
+  }
 
-    conf = conf_make(CONF_DLINE);
-    conf->host = field_1;
-    conf->reason = field_2;
-    conf->setat = field_3;
-    conf->until = field_4;
-    SetConfDatabase(conf);
+  if (records == 0)
+  {
+    munmap(map, st.st_size);
+    return 0;
+  }
+
+  arena = xcalloc(sizeof(*arena));
+  arena->size = (size_t)records * sizeof(*entry) + size;
+  arena->base = mmap(NULL, arena->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (arena->base == MAP_FAILED)
+    outofmemory();
+
+#ifdef MADV_HUGEPAGE
+  /* Touching hundreds of megabytes one small page at a time dominates the load time */
+  madvise(arena->base, arena->size, MADV_HUGEPAGE);
+#endif
+
+  entry = (struct DatabaseEntry *)arena->base;
+  strings = arena->base + (size_t)records * sizeof(*entry);
+  memcpy(strings, table, size);
+
+  record = map + MAPPED_DB_HEADER;
+
+  for (uint32_t i = 0; i < records; ++i, record += MAPPED_DB_RECORD)
+  {
+    const uint32_t user = get_uint32(record);
+    const uint32_t host = get_uint32(record + 4);
+    const uint32_t reason = get_uint32(record + 8);
+    const uint64_t until = get_uint64(record + 24);
+    struct MaskItem *conf = &entry->conf;
+
+    if (host >= size || strings[host] == '\0' ||
+        (user != MAPPED_DB_NONE && user >= size) ||
+        (reason != MAPPED_DB_NONE && reason >= size))
+    {
+      ++invalid;
+      continue;
+    }
 
-    add_conf_by_address(CONF_DLINE, conf);
+    if (until && until <= (uint64_t)CurrentTime)
+      continue;
+
+    /* As conf_make() would, minus the allocation */
+    conf->type = type;
+    conf->active = 1;
+    conf->aftype = AF_INET;
+    conf->flags = CONF_FLAGS_IN_DATABASE | CONF_FLAGS_ARENA;
+    conf->user = user == MAPPED_DB_NONE ? NULL : strings + user;
+    conf->host = strings + host;
+    conf->reason = reason == MAPPED_DB_NONE ? NULL : strings + reason;
+    conf->setat = get_uint64(record + 16);
+    conf->until = until;
+
+    link_conf_by_address(type, conf, &entry->arec);
+    ++entry;
+    ++loaded;
   }
 
-  close_db(f);
+  munmap(map, st.st_size);
+
+  if (invalid)
+    ilog(LOG_TYPE_IRCD, "Skipped %u invalid records in %s", invalid, f->filename);
+
+  if (loaded == 0)
+  {
+    munmap(arena->base, arena->size);
+    xfree(arena);
+    return 0;
+  }
+
+  arena->refs = loaded;
+  dlinkAdd(arena, &arena->node, &arena_list);
+  return loaded;
 }
 
-void
+int
 save_resv_database(const char *filename)
 {
   uint32_t records = 0;
@@ -674,7 +889,7 @@ save_resv_database(const char *filename)
   const struct ResvItem *resv = NULL;
 
   if (!(f = open_db(filename, "w", KLINE_DB_VERSION)))
-    return;
+    return -1;
 
   DLINK_FOREACH(node, resv_chan_get_list()->head)
   {
@@ -720,53 +935,10 @@ save_resv_database(const char *filename)
     SAFE_WRITE(write_uint64(resv->expire, f), filename);
   }
 
-  close_db(f);
-}
-
-void
-load_resv_database(const char *filename)
-{
-  uint32_t i = 0;
-  uint32_t records = 0;
-  uint64_t tmp64_hold = 0, tmp64_setat = 0;
-  struct dbFILE *f = NULL;
-  char *name = NULL;
-  char *reason = NULL;
-  struct ResvItem *resv = NULL;
-
-  if (!(f = open_db(filename, "r", KLINE_DB_VERSION)))
-    return;
-
-  if (get_file_version(f) < 1)
-  {
-    close_db(f);
-    return;
-  }
-
-  read_uint32(&records, f);
-
-  for (i = 0; i < records; ++i)
-  {
-    SAFE_READ(read_string(&name, f));
-    SAFE_READ(read_string(&reason, f));
-    SAFE_READ(read_uint64(&tmp64_setat, f));
-    SAFE_READ(read_uint64(&tmp64_hold, f));
-
-    if ((resv = resv_make(name, reason, NULL)) == NULL)
-      continue;
-
-    resv->setat = tmp64_setat;
-    resv->expire = tmp64_hold;
-    resv->in_database = 1;
-
-    xfree(name);
-    xfree(reason);
-  }
-
-  close_db(f);
+  return close_db(f);
 }
 
-void
+int
 save_xline_database(const char *filename)
 {
   uint32_t records = 0;
@@ -775,7 +947,7 @@ save_xline_database(const char *filename)
   struct GecosItem *gecos = NULL;
 
   if (!(f = open_db(filename, "w", KLINE_DB_VERSION)))
-    return;
+    return -1;
 
   DLINK_FOREACH(ptr, gecos_get_list()->head)
   {
@@ -800,54 +972,744 @@ save_xline_database(const char *filename)
     SAFE_WRITE(write_uint64(gecos->expire, f), filename);
   }
 
-  close_db(f);
+  return close_db(f);
 }
 
-void
-load_xline_database(const char *filename)
+/*
+ * Every database is a snapshot plus a journal. Adding or removing an entry
+ * appends one record to "<database>.journal"; the records use the same
+ * encoding as the snapshot, preceded by a 2-byte JOURNAL_RECORD_* type.
+ * Records are flushed to the kernel right away and fsync()ed in batches by
+ * journal_sync(). compact_databases() periodically moves the journals aside
+ * to "<database>.journal.old" and forks a child that writes fresh snapshots
+ * and then removes the old journals, so the main loop never stalls on writing
+ * the full tables. On startup the snapshot is loaded first, then the old
+ * journal a failed compaction may have left behind, then the journal.
+ * Replaying is idempotent: adding an entry that already exists or has expired,
+ * or removing one that doesn't exist, does nothing.
+ */
+enum
 {
-  uint32_t i = 0;
-  uint32_t records = 0;
-  uint64_t tmp64_hold = 0, tmp64_setat = 0;
-  struct dbFILE *f = NULL;
-  char *name = NULL;
-  char *reason = NULL;
-  struct GecosItem *gecos = NULL;
+  SNAPSHOT_RECORD = 0,  /**< Snapshot entry, added without looking for a duplicate */
+  JOURNAL_RECORD_ADD = 1,
+  JOURNAL_RECORD_DEL = 2
+};
 
-  if (!(f = open_db(filename, "r", KLINE_DB_VERSION)))
-    return;
+enum
+{
+  DATABASE_KLINE,
+  DATABASE_DLINE,
+  DATABASE_XLINE,
+  DATABASE_RESV,
+  DATABASE_COUNT
+};
+
+struct Database
+{
+  const char *name;  /**< Name used in log messages */
+  enum maskitem_type type;  /**< CONF_KLINE or CONF_DLINE if snapshots use the MAPPED_DB_VERSION layout */
+  int (*record)(struct dbFILE *, uint16_t);  /**< Reads one record and adds or removes the entry */
+  int (*save)(const char *);  /**< Writes a snapshot of the table */
+  char filename[HYB_PATH_MAX + 1];  /**< Snapshot file, set when the database is loaded */
+  struct dbFILE *journal;  /**< NULL if the journal couldn't be opened */
+  unsigned int records;  /**< Records journaled since the last compaction */
+  unsigned int unsynced;  /**< Records not fsync()ed yet */
+  unsigned int compacting;  /**< Set while the compaction child writes the snapshot */
+};
+
+static int kline_record(struct dbFILE *, uint16_t);
+static int dline_record(struct dbFILE *, uint16_t);
+static int xline_record(struct dbFILE *, uint16_t);
+static int resv_record(struct dbFILE *, uint16_t);
+
+static struct Database database_table[DATABASE_COUNT] =
+{
+  [DATABASE_KLINE] = { .name = "K-lines", .type = CONF_KLINE, .record = kline_record, .save = save_kline_database },
+  [DATABASE_DLINE] = { .name = "D-lines", .type = CONF_DLINE, .record = dline_record, .save = save_dline_database },
+  [DATABASE_XLINE] = { .name = "X-lines", .record = xline_record, .save = save_xline_database },
+  [DATABASE_RESV] = { .name = "RESVs", .record = resv_record, .save = save_resv_database }
+};
+
+/*! \brief Read end of the pipe the compaction child reports its result on;
+ * -1 if no compaction is running. */
+static int compaction_fd = -1;
+static uintmax_t compaction_started;
+
+/*! \brief What the compaction child writes to the pipe before it exits */
+struct CompactionResult
+{
+  unsigned int failed;  /**< Number of snapshots that couldn't be written */
+  uintmax_t elapsed;  /**< Microseconds spent writing the snapshots */
+};
+
+/*! \brief Reads one K-line (type == CONF_KLINE) or D-line record and adds
+ * or removes the entry.
+ * \param record SNAPSHOT_RECORD or JOURNAL_RECORD_*
+ * \return -1 on read error, 1 if an entry has been added, 0 otherwise.
+ */
+static int
+address_record(struct dbFILE *f, uint16_t record, enum maskitem_type type)
+{
+  struct MaskItem *conf = NULL;
+  char *user = NULL;
+  char *host = NULL;
+  char *reason = NULL;
+  uint64_t setat = 0;
+  uint64_t until = 0;
 
-  if (get_file_version(f) < 1)
+  if ((type == CONF_KLINE && read_string(&user, f) < 0) ||
+      read_string(&host, f) < 0 || read_string(&reason, f) < 0 ||
+      read_uint64(&setat, f) < 0 || read_uint64(&until, f) < 0)
   {
-    close_db(f);
-    return;
+    xfree(user);
+    xfree(host);
+    xfree(reason);
+    return -1;
   }
 
-  read_uint32(&records, f);
+  if (record != SNAPSHOT_RECORD && !EmptyString(host))
+    conf = find_database_address_conf(host, user, type);
 
-  for (i = 0; i < records; ++i)
+  if (record != JOURNAL_RECORD_DEL && conf == NULL && !EmptyString(host) &&
+      !(until && until <= (uint64_t)CurrentTime))
   {
-    SAFE_READ(read_string(&name, f));
-    SAFE_READ(read_string(&reason, f));
-    SAFE_READ(read_uint64(&tmp64_setat, f));
-    SAFE_READ(read_uint64(&tmp64_hold, f));
+    conf = conf_make(type);
+    conf->user = user;
+    conf->host = host;
+    conf->reason = reason;
+    conf->setat = setat;
+    conf->until = until;
+    SetConfDatabase(conf);
 
-    gecos = gecos_make();
-    gecos->in_database = 1;
-    gecos->mask = name;
-    gecos->reason = reason;
-    gecos->setat = tmp64_setat;
-    gecos->expire = tmp64_hold;
+    add_conf_by_address(type, conf);
+    return 1;
   }
 
-  close_db(f);
-}
+  if (record == JOURNAL_RECORD_DEL && conf)
+    delete_one_address_conf(conf->host, conf);
 
+  xfree(user);
+  xfree(host);
+  xfree(reason);
+  return 0;
+}
+
+static int
+kline_record(struct dbFILE *f, uint16_t record)
+{
+  return address_record(f, record, CONF_KLINE);
+}
+
+static int
+dline_record(struct dbFILE *f, uint16_t record)
+{
+  return address_record(f, record, CONF_DLINE);
+}
+
+/*! \brief Reads one X-line record and adds or removes the entry.
+ * \param record SNAPSHOT_RECORD or JOURNAL_RECORD_*
+ * \return -1 on read error, 1 if an entry has been added, 0 otherwise.
+ */
+static int
+xline_record(struct dbFILE *f, uint16_t record)
+{
+  struct GecosItem *gecos = NULL;
+  char *mask = NULL;
+  char *reason = NULL;
+  uint64_t setat = 0;
+  uint64_t expire = 0;
+
+  if (read_string(&mask, f) < 0 || read_string(&reason, f) < 0 ||
+      read_uint64(&setat, f) < 0 || read_uint64(&expire, f) < 0)
+  {
+    xfree(mask);
+    xfree(reason);
+    return -1;
+  }
+
+  if (record != SNAPSHOT_RECORD && !EmptyString(mask))
+    gecos = gecos_find(mask, irccmp);
+
+  if (record != JOURNAL_RECORD_DEL && gecos == NULL && !EmptyString(mask) &&
+      !(expire && expire <= (uint64_t)CurrentTime))
+  {
+    gecos = gecos_make();
+    gecos->in_database = 1;
+    gecos->mask = mask;
+    gecos->reason = reason;
+    gecos->setat = setat;
+    gecos->expire = expire;
+    return 1;
+  }
+
+  if (record == JOURNAL_RECORD_DEL && gecos && gecos->in_database)
+    gecos_delete(gecos);
+
+  xfree(mask);
+  xfree(reason);
+  return 0;
+}
+
+/*! \brief Reads one RESV record and adds or removes the entry.
+ * \param record SNAPSHOT_RECORD or JOURNAL_RECORD_*
+ * \return -1 on read error, 1 if an entry has been added, 0 otherwise.
+ */
+static int
+resv_record(struct dbFILE *f, uint16_t record)
+{
+  struct ResvItem *resv = NULL;
+  char *mask = NULL;
+  char *reason = NULL;
+  uint64_t setat = 0;
+  uint64_t expire = 0;
+  int added = 0;
+
+  if (read_string(&mask, f) < 0 || read_string(&reason, f) < 0 ||
+      read_uint64(&setat, f) < 0 || read_uint64(&expire, f) < 0)
+  {
+    xfree(mask);
+    xfree(reason);
+    return -1;
+  }
+
+  if (EmptyString(mask))
+    ;
+  else if (record != JOURNAL_RECORD_DEL)
+  {
+    if (!(expire && expire <= (uint64_t)CurrentTime) &&
+        (resv = resv_make(mask, reason, NULL)))
+    {
+      resv->setat = setat;
+      resv->expire = expire;
+      resv->in_database = 1;
+      added = 1;
+    }
+  }
+  else if ((resv = resv_find(mask, irccmp)) && resv->in_database)
+    resv_delete(resv);
+
+  xfree(mask);
+  xfree(reason);
+  return added;
+}
+
+/*! \brief Builds the names of the journal and of the journal left behind by
+ * an unfinished compaction.
+ * \return -1 if the names are too long, 0 otherwise.
+ */
+static int
+journal_names(const struct Database *db, char *name, char *old, size_t size)
+{
+  if (snprintf(name, size, "%s.journal", db->filename) >= (int)size ||
+      snprintf(old, size, "%s.journal.old", db->filename) >= (int)size)
+    return -1;
+  return 0;
+}
+
+/*! \brief Replays a journal on top of the loaded table. A record cut short
+ * by a crash ends the replay and is cut off, so records appended later can
+ * be read again.
+ * \return Number of records replayed.
+ */
+static unsigned int
+journal_replay(struct Database *db, const char *filename)
+{
+  struct dbFILE *f = NULL;
+  unsigned int records = 0;
+  uint16_t type = 0;
+  off_t valid = 0, end = 0;
+
+  if (!(f = open_db(filename, "r", JOURNAL_DB_VERSION)))
+    return 0;
+
+  if (get_file_version(f) < 1)
+  {
+    close_db(f);
+    return 0;
+  }
+
+  valid = ftello(f->fp);
+
+  while (read_uint16(&type, f) == 0)
+  {
+    if (type != JOURNAL_RECORD_ADD && type != JOURNAL_RECORD_DEL)
+    {
+      ilog(LOG_TYPE_IRCD, "Invalid record type %u in %s after %u records",
+           type, filename, records);
+      break;
+    }
+
+    if (db->record(f, type) < 0)
+    {
+      ilog(LOG_TYPE_IRCD, "Incomplete record in %s after %u records",
+           filename, records);
+      break;
+    }
+
+    ++records;
+    valid = ftello(f->fp);
+  }
+
+  end = ftello(f->fp);
+  close_db(f);
+
+  if (valid > 0 && end > valid && truncate(filename, valid))
+    ilog(LOG_TYPE_IRCD, "Cannot remove incomplete record from %s: %s",
+         filename, strerror(errno));
+
+  return records;
+}
+
+/*! \brief Loads a snapshot, replays its journals and opens the journal
+ * for appending.
+ */
+static void
+load_database(struct Database *db, const char *filename)
+{
+  const uintmax_t started = clock_usec();
+  char name[HYB_PATH_MAX + 1], old[HYB_PATH_MAX + 1];
+  struct dbFILE *f = NULL;
+  uint32_t version = 0;
+  uint32_t records = 0;
+  unsigned int replayed = 0;
+
+  strlcpy(db->filename, filename, sizeof(db->filename));
+
+  if (journal_names(db, name, old, sizeof(name)) < 0)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot load %s: Filename too long", filename);
+    db->filename[0] = '\0';
+    return;
+  }
+
+  if ((f = open_db(filename, "r", KLINE_DB_VERSION)))
+  {
+    version = get_file_version(f);
+
+    if (version == MAPPED_DB_VERSION && db->type)
+      records = load_mapped_database(f, db->type);
+    else if (version >= 1 && read_uint32(&records, f) == 0)
+      for (uint32_t i = 0; i < records; ++i)
+        if (db->record(f, SNAPSHOT_RECORD) < 0)
+          break;
+
+    close_db(f);
+  }
+
+  replayed += journal_replay(db, old);
+  replayed += journal_replay(db, name);
+
+  /*
+   * Entries only in the journals aren't in the snapshot yet, so
+   * have the next compaction write one.
+   */
+  db->records = replayed;
+
+  /* Have the next compaction convert an old K-line or D-line snapshot */
+  if (db->type && records && version != MAPPED_DB_VERSION)
+    ++db->records;
+
+  db->journal = open_db(name, "a", JOURNAL_DB_VERSION);
+
+  ilog(LOG_TYPE_IRCD, "Loaded %s from %s: %u snapshot and %u journal records in %ju ms",
+       db->name, filename, records, replayed, (clock_usec() - started) / 1000);
+}
+
+/*! \brief Appends one record to the journal of a database. If writing fails
+ * the record is cut off again and the journal closed; the entry then only
+ * makes it to disk with the next compaction.
+ */
+static struct dbFILE *
+journal_begin(struct Database *db, uint16_t type, off_t *start)
+{
+  ++db->records;
+
+  if (db->journal == NULL)
+    return NULL;
+
+  if ((*start = ftello(db->journal->fp)) < 0 ||
+      write_uint16(type, db->journal) < 0)
+  {
+    ilog(LOG_TYPE_IRCD, "Write error on %s", db->journal->filename);
+    close_db(db->journal);
+    db->journal = NULL;
+    return NULL;
+  }
+
+  return db->journal;
+}
+
+static void
+journal_end(struct Database *db, off_t start, int res)
+{
+  char name[HYB_PATH_MAX + 1];
+
+  if (res == 0 && fflush(db->journal->fp) == 0)
+  {
+    ++db->unsynced;
+    return;
+  }
+
+  strlcpy(name, db->journal->filename, sizeof(name));
+
+  ilog(LOG_TYPE_IRCD, "Write error on %s", name);
+
+  close_db(db->journal);
+  db->journal = NULL;
+
+  /* Replaying would stop at the incomplete record */
+  if (truncate(name, start))
+    ilog(LOG_TYPE_IRCD, "Cannot remove incomplete record from %s: %s",
+         name, strerror(errno));
+}
+
+static void
+journal_write_conf(const struct MaskItem *conf, uint16_t type)
+{
+  struct Database *db = &database_table[conf->type == CONF_KLINE ? DATABASE_KLINE : DATABASE_DLINE];
+  struct dbFILE *f = NULL;
+  off_t start = 0;
+  int res = 0;
+
+  if (!(f = journal_begin(db, type, &start)))
+    return;
+
+  if (conf->type == CONF_KLINE)
+    res |= write_string(conf->user, f);
+  res |= write_string(conf->host, f);
+  res |= write_string(conf->reason, f);
+  res |= write_uint64(conf->setat, f);
+  res |= write_uint64(conf->until, f);
+
+  journal_end(db, start, res);
+}
+
+static void
+journal_write_mask(struct Database *db, uint16_t type, const char *mask,
+                   const char *reason, uintmax_t setat, uintmax_t expire)
+{
+  struct dbFILE *f = NULL;
+  off_t start = 0;
+  int res = 0;
+
+  if (!(f = journal_begin(db, type, &start)))
+    return;
+
+  res |= write_string(mask, f);
+  res |= write_string(reason, f);
+  res |= write_uint64(setat, f);
+  res |= write_uint64(expire, f);
+
+  journal_end(db, start, res);
+}
+
+/*! \brief Journals a K-line or D-line that has been added to the database */
+void
+journal_add_conf(const struct MaskItem *conf)
+{
+  journal_write_conf(conf, JOURNAL_RECORD_ADD);
+}
+
+/*! \brief Journals a K-line or D-line that is about to be removed from the database */
+void
+journal_del_conf(const struct MaskItem *conf)
+{
+  journal_write_conf(conf, JOURNAL_RECORD_DEL);
+}
+
+void
+journal_add_gecos(const struct GecosItem *gecos)
+{
+  journal_write_mask(&database_table[DATABASE_XLINE], JOURNAL_RECORD_ADD,
+                     gecos->mask, gecos->reason, gecos->setat, gecos->expire);
+}
+
+void
+journal_del_gecos(const struct GecosItem *gecos)
+{
+  journal_write_mask(&database_table[DATABASE_XLINE], JOURNAL_RECORD_DEL,
+                     gecos->mask, gecos->reason, gecos->setat, gecos->expire);
+}
+
+void
+journal_add_resv(const struct ResvItem *resv)
+{
+  journal_write_mask(&database_table[DATABASE_RESV], JOURNAL_RECORD_ADD,
+                     resv->mask, resv->reason, resv->setat, resv->expire);
+}
+
+void
+journal_del_resv(const struct ResvItem *resv)
+{
+  journal_write_mask(&database_table[DATABASE_RESV], JOURNAL_RECORD_DEL,
+                     resv->mask, resv->reason, resv->setat, resv->expire);
+}
+
+/*! \brief Collects the result of a running compaction.
+ * \param wait Whether to block until the child is done
+ */
+static void
+compaction_poll(int wait)
+{
+  struct CompactionResult result;
+  ssize_t len = 0;
+
+  if (compaction_fd == -1)
+    return;
+
+  if (wait)
+    fcntl(compaction_fd, F_SETFL, fcntl(compaction_fd, F_GETFL) & ~O_NONBLOCK);
+
+  do
+    len = read(compaction_fd, &result, sizeof(result));
+  while (len < 0 && errno == EINTR);
+
+  if (len < 0 && errno == EAGAIN)
+    return;
+
+  close(compaction_fd);
+  compaction_fd = -1;
+
+  for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+    database_table[i].compacting = 0;
+
+  if (len != sizeof(result))
+    ilog(LOG_TYPE_IRCD, "Database compaction died, old journals are kept");
+  else if (result.failed)
+    ilog(LOG_TYPE_IRCD, "Database compaction failed for %u databases after %ju ms, "
+         "old journals are kept", result.failed, result.elapsed / 1000);
+  else
+    ilog(LOG_TYPE_IRCD, "Database compaction finished, snapshots written in %ju ms",
+         result.elapsed / 1000);
+}
+
+/*! \brief fsync()s the records journaled since the last call and collects
+ * the result of a finished compaction. Runs once a second.
+ */
+void
+journal_sync(void *unused)
+{
+  for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+  {
+    struct Database *db = &database_table[i];
+
+    if (db->unsynced && db->journal)
+      if (fsync(fileno(db->journal->fp)))
+        ilog(LOG_TYPE_IRCD, "Cannot sync %s: %s", db->journal->filename, strerror(errno));
+
+    db->unsynced = 0;
+  }
+
+  compaction_poll(0);
+}
+
+/*! \brief Appends the records of a journal to another one.
+ * \return -1 on error, 0 otherwise.
+ */
+static int
+journal_append(const char *from, const char *to)
+{
+  char buf[8192];
+  size_t len = 0;
+  FILE *in = NULL, *out = NULL;
+  int res = 0;
+
+  if (!(in = fopen(from, "rb")))
+    return errno == ENOENT ? 0 : -1;
+
+  if (!(out = fopen(to, "ab")))
+  {
+    fclose(in);
+    return -1;
+  }
+
+  /* Skip the version number */
+  if (fseek(in, sizeof(uint32_t), SEEK_SET) == 0)
+    while ((len = fread(buf, 1, sizeof(buf), in)) > 0)
+      if (fwrite(buf, 1, len, out) != len)
+        res = -1;
+
+  if (ferror(in) || fflush(out) || fsync(fileno(out)))
+    res = -1;
+
+  fclose(in);
+  if (fclose(out))
+    res = -1;
+  return res;
+}
+
+/*! \brief Moves a journal aside so the compaction child can snapshot the
+ * table, and starts a new one.
+ * \return -1 if the journal couldn't be moved, 0 otherwise.
+ */
+static int
+journal_rotate(struct Database *db)
+{
+  char name[HYB_PATH_MAX + 1], old[HYB_PATH_MAX + 1];
+
+  journal_names(db, name, old, sizeof(name));
+
+  if (db->journal)
+  {
+    if (fsync(fileno(db->journal->fp)))
+      ilog(LOG_TYPE_IRCD, "Cannot sync %s: %s", name, strerror(errno));
+
+    close_db(db->journal);
+    db->journal = NULL;
+  }
+
+  db->unsynced = 0;
+
+  /* An old journal is still there if the last compaction failed; keep its records */
+  if (access(old, F_OK) == 0)
+  {
+    if (journal_append(name, old) < 0)
+    {
+      ilog(LOG_TYPE_IRCD, "Cannot append %s to %s: %s", name, old, strerror(errno));
+      db->journal = open_db(name, "a", JOURNAL_DB_VERSION);
+      return -1;
+    }
+
+    unlink(name);
+  }
+  else if (rename(name, old) < 0 && errno != ENOENT)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot rename %s to %s: %s", name, old, strerror(errno));
+    db->journal = open_db(name, "a", JOURNAL_DB_VERSION);
+    return -1;
+  }
+
+  db->journal = open_db(name, "a", JOURNAL_DB_VERSION);
+  db->records = 0;
+  db->compacting = 1;
+  return 0;
+}
+
+/*! \brief Writes fresh snapshots of every database that has been changed since
+ * the last compaction. The snapshots are written by a forked child working on
+ * a copy of the tables; the result is collected by journal_sync().
+ */
+void
+compact_databases(void *unused)
+{
+  unsigned int count = 0;
+  int fds[2];
+  pid_t pid;
+
+  if (compaction_fd != -1)
+    return;  /* Still running */
+
+  for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+    if (database_table[i].records && database_table[i].filename[0])
+      ++count;
+
+  if (count == 0)
+    return;
+
+  if (pipe(fds) < 0)
+  {
+    ilog(LOG_TYPE_IRCD, "Cannot compact databases, pipe() failed: %s", strerror(errno));
+    return;
+  }
+
+  count = 0;
+  for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+    if (database_table[i].records && database_table[i].filename[0])
+      if (journal_rotate(&database_table[i]) == 0)
+        ++count;
+
+  compaction_started = clock_usec();
+
+  if (count == 0 || (pid = fork()) < 0)
+  {
+    if (count)
+      ilog(LOG_TYPE_IRCD, "Cannot compact databases, fork() failed: %s", strerror(errno));
+
+    for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+      database_table[i].compacting = 0;
+
+    close(fds[0]);
+    close(fds[1]);
+    return;
+  }
+
+  if (pid == 0)
+  {
+    struct CompactionResult result = { .failed = 0 };
+
+    compaction_child = 1;
+    close(fds[0]);
+
+    /*
+     * Don't hold on to the client, server and listener sockets (or the
+     * worker pipes) while writing; the parent may have closed them long
+     * before the child is done. Log and journal files aren't in fd_table.
+     */
+    for (int fd = 0; fd <= highest_fd; ++fd)
+      if (fd_table[fd].flags.open)
+        close(fd);
+
+    for (unsigned int i = 0; i < DATABASE_COUNT; ++i)
+    {
+      struct Database *db = &database_table[i];
+      char name[HYB_PATH_MAX + 1], old[HYB_PATH_MAX + 1];
+
+      if (db->compacting == 0)
+        continue;
+
+      journal_names(db, name, old, sizeof(name));
+
+      if (db->save(db->filename) == 0)
+        unlink(old);
+      else
+        ++result.failed;
+    }
+
+    result.elapsed = clock_usec() - compaction_started;
+
+    if (write(fds[1], &result, sizeof(result)) != sizeof(result))
+      _exit(EXIT_FAILURE);  /* The parent takes EOF as failure */
+    _exit(result.failed ? EXIT_FAILURE : EXIT_SUCCESS);
+  }
+
+  close(fds[1]);
+  fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+  compaction_fd = fds[0];
+
+  ilog(LOG_TYPE_IRCD, "Compacting %u databases, fork() took %ju us",
+       count, clock_usec() - compaction_started);
+}
+
+void
+load_kline_database(const char *filename)
+{
+  load_database(&database_table[DATABASE_KLINE], filename);
+}
+
+void
+load_dline_database(const char *filename)
+{
+  load_database(&database_table[DATABASE_DLINE], filename);
+}
+
+void
+load_xline_database(const char *filename)
+{
+  load_database(&database_table[DATABASE_XLINE], filename);
+}
+
+void
+load_resv_database(const char *filename)
+{
+  load_database(&database_table[DATABASE_RESV], filename);
+}
+
+/*! \brief Makes sure everything is on disk before the server exits: waits for
+ * a running compaction and syncs the journals.
+ */
 void
 save_all_databases(void *unused)
 {
-  save_kline_database(ConfigGeneral.klinefile);
-  save_dline_database(ConfigGeneral.dlinefile);
-  save_xline_database(ConfigGeneral.xlinefile);
-  save_resv_database(ConfigGeneral.resvfile);
+  compaction_poll(1);
+  journal_sync(NULL);
 }
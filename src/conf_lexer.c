@@ -355,8 +355,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 256
-#define YY_END_OF_BUFFER 257
+#define YY_NUM_RULES 258
+#define YY_END_OF_BUFFER 259
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -364,25 +364,25 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1634] =
+static const flex_int16_t yy_accept[1653] =
     {   0,
-        4,    4,  257,  255,    4,    3,  255,    5,  255,  255,
-        6,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,    4,    3,    0,    7,
-        5,  254,    0,    2,    5,    6,    0,    0,    0,    0,
+        4,    4,  259,  257,    4,    3,  257,    5,  257,  257,
+        6,  257,  257,  257,  257,  257,  257,  257,  257,  257,
+      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
+      257,  257,  257,  257,  257,  257,    4,    3,    0,    7,
+        5,  256,    0,    2,    5,    6,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   88,    0,  248,    0,    0,    0,    0,    0,
-        0,    0,  253,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   88,    0,  250,    0,    0,    0,    0,    0,
+        0,    0,  255,    0,    0,    0,    0,    0,    0,    0,
 
-      227,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      229,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   12,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  235,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  237,    0,    0,    0,
         0,    0,   43,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,   79,    0,    0,    0,    0,    0,    0,
@@ -390,162 +390,164 @@ static const flex_int16_t yy_accept[1634] =
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  160,    0,    0,
-        0,    0,    0,    0,  174,    0,    0,  177,    0,    0,
-        0,    0,  183,    0,  185,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  161,    0,
+        0,    0,    0,    0,    0,    0,  176,    0,    0,  179,
+        0,    0,    0,    0,  185,    0,  187,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  226,    0,    0,
-        0,    0,    0,   15,    0,    0,   19,  243,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  234,
-       34,    0,    0,   41,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,   58,    0,    0,   63,    0,
-        0,    0,    0,    0,    0,   78,  237,    0,    0,    0,
-       89,   90,   91,    0,   92,    0,    0,    0,    0,    0,
-        0,  103,    0,    0,    0,    0,    0,    0,    0,  123,
-      124,    0,    0,    0,  130,    0,    0,    0,    0,  137,
-      142,    0,    0,  147,    0,  150,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  164,    0,    0,    0,
-        0,    0,    0,  178,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  206,    0,    0,    0,    0,
-        0,    0,    0,  215,    0,    0,    0,    0,    0,  233,
-
-        0,    0,    0,  229,    0,    0,    9,    0,    0,    0,
-        0,  242,    0,    0,   23,    0,    0,   27,   28,    0,
-        0,    0,    0,   35,    0,    0,    0,   47,    0,   51,
-        0,    0,    0,    0,    0,    0,   59,    0,   64,    0,
-        0,    0,    0,    0,    0,    0,  236,    0,    0,    0,
-        0,  247,    0,    0,   94,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  252,    0,    0,
-        0,    0,    0,  231,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  228,
+        0,    0,    0,    0,    0,   15,    0,    0,   19,  245,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  156,    0,    0,    0,    0,    0,    0,    0,
-
-      168,    0,    0,    0,    0,    0,    0,  179,    0,  181,
-      184,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  216,    0,
-        0,    0,  232,  222,    0,  224,  228,    0,    0,    0,
-       11,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  236,   34,    0,    0,   41,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   58,    0,    0,
+       63,    0,    0,    0,    0,    0,    0,   78,  239,    0,
+        0,    0,   89,   90,   91,    0,   92,    0,    0,    0,
+        0,    0,    0,  103,    0,    0,    0,    0,    0,    0,
+        0,    0,  124,  125,    0,    0,    0,  131,    0,    0,
+        0,    0,  138,  143,    0,    0,  148,    0,  151,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  166,
+        0,    0,    0,    0,    0,    0,    0,  180,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  208,
+        0,    0,    0,    0,    0,    0,    0,  217,    0,    0,
+
+        0,    0,    0,  235,    0,    0,    0,  231,    0,    0,
+        9,    0,    0,    0,    0,  244,    0,    0,   23,    0,
+        0,   27,   28,    0,    0,    0,    0,   35,    0,    0,
+        0,   47,    0,   51,    0,    0,    0,    0,    0,    0,
+       59,    0,   64,    0,    0,    0,    0,    0,    0,    0,
+      238,    0,    0,    0,    0,  249,    0,    0,   94,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  254,    0,    0,    0,    0,    0,    0,  233,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   54,    0,    0,    0,    0,    0,    0,    0,   70,
-        0,    0,    0,    0,    0,    0,    0,    0,  246,    0,
-        0,    0,    0,    0,  100,  101,  104,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  251,    0,  239,
-
-        0,    0,  121,  230,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  145,    0,    0,
-        0,    0,  152,    0,    0,  155,    0,    0,  159,  161,
-        0,    0,    0,  241,    0,  169,    0,    0,  175,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  200,    0,
-        0,    0,    0,  207,  208,    0,    0,    0,  212,    0,
-        0,  217,  218,    0,  221,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   24,    0,
-       29,   30,   31,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   65,   68,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  157,    0,    0,
 
+        0,    0,    0,    0,    0,    0,  170,    0,    0,    0,
+        0,    0,    0,  181,    0,  183,  186,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  218,    0,    0,    0,  234,  224,
+        0,  226,  230,    0,    0,    0,   11,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  238,    0,    0,  122,  125,
+        0,    0,    0,    0,    0,    0,    0,   54,    0,    0,
+        0,    0,    0,    0,    0,   70,    0,    0,    0,    0,
+        0,    0,    0,    0,  248,    0,    0,    0,    0,    0,
+      100,  101,  104,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,  253,    0,    0,  241,    0,    0,  122,
+      232,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  146,    0,    0,    0,    0,  153,
+        0,    0,  156,    0,    0,  160,  162,    0,    0,    0,
+        0,  243,    0,  171,    0,    0,  177,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  202,    0,    0,    0,
+        0,  209,  210,    0,    0,    0,  214,    0,    0,  219,
+      220,    0,  223,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   24,    0,   29,   30,
+       31,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   65,   68,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  151,    0,    0,    0,    0,
-        0,  163,    0,    0,  240,    0,    0,    0,  172,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  209,
-      210,    0,  213,    0,  219,    0,    0,    0,    0,    0,
-        0,    0,    0,   16,    0,    0,   21,    0,    0,    0,
+        0,    0,    0,    0,  240,    0,    0,  123,  126,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  152,    0,    0,    0,    0,    0,
+      164,    0,    0,    0,  242,    0,    0,    0,  174,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  211,
+      212,    0,  215,    0,  221,    0,    0,    0,    0,    0,
 
+        0,    0,    0,   16,    0,    0,   21,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   55,
         0,    0,    0,    0,    0,    0,   73,    0,    0,   80,
-        0,    0,    0,    0,    0,    0,  245,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  247,    0,    0,    0,
         0,    0,    0,  106,    0,  109,    0,    0,    0,    0,
-        0,    0,  250,  118,    0,    0,    0,    0,  133,    0,
-      132,    0,  140,    0,    0,    0,    0,  146,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  252,    0,  119,    0,    0,    0,    0,  134,
+        0,  133,    0,  141,    0,    0,    0,    0,  147,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,   18,    0,   22,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   52,
-        0,    0,    0,    0,    0,    0,   72,    0,    0,    0,
-       82,    0,    0,    0,    0,  244,    0,    0,    0,    0,
-       99,    0,    0,    0,    0,    0,    0,    0,    0,  117,
-      249,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  143,    0,  149,    0,    0,  157,  158,  162,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   18,    0,   22,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   52,    0,    0,    0,    0,    0,    0,   72,    0,
+        0,    0,   82,    0,    0,    0,    0,  246,    0,    0,
+        0,    0,   99,    0,    0,    0,    0,    0,    0,    0,
+        0,  117,  251,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  144,    0,  150,    0,    0,  158,
+      159,  163,    0,  165,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  211,    0,    0,    0,    0,
 
-        0,    1,    0,    1,    0,    0,    0,    0,   17,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  213,
+        0,    0,    0,    0,    0,    1,    0,    1,    0,    0,
+        0,    0,   17,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   57,    0,
+       69,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  105,    0,    0,    0,    0,
+        0,    0,  114,    0,    0,    0,    0,  127,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  154,    0,
+        0,    0,    0,  172,  173,  175,  178,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   57,    0,   69,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  105,    0,    0,    0,    0,    0,    0,  114,    0,
-        0,    0,  126,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  153,    0,    0,    0,    0,  170,  171,
-      173,  176,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   32,    0,    0,
+        0,    0,   42,    0,    0,    0,    0,    0,    0,    0,
+        0,   71,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  110,    0,    0,
+        0,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  140,    0,  149,  155,  167,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  216,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,   32,    0,    0,    0,    0,   42,    0,    0,
-        0,    0,    0,    0,    0,    0,   71,    0,    0,    0,
+        0,    0,    0,   44,    0,    0,    0,    0,   53,    0,
+        0,    0,   76,    0,    0,    0,    0,    0,    0,    0,
+        0,   95,    0,    0,    0,    0,  108,    0,    0,    0,
+        0,    0,    0,    0,  129,  130,    0,    0,    0,    0,
+        0,    0,    0,    0,  182,  184,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  110,    0,    0,    0,  115,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  139,    0,  148,  154,
-      165,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  206,    0,    0,    0,  227,    0,   10,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  214,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   44,    0,    0,
-        0,    0,   53,    0,    0,    0,   76,    0,    0,    0,
-
-        0,    0,    0,    0,    0,   95,    0,    0,    0,    0,
-      108,    0,    0,    0,    0,    0,    0,  128,  129,    0,
-        0,    0,    0,    0,    0,    0,    0,  180,  182,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  204,    0,    0,    0,  225,
-        0,   10,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   50,    0,   60,    0,    0,   77,    0,
+       50,    0,   60,    0,    0,   77,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  113,    0,
+
+        0,    0,  128,  132,    0,    0,    0,    0,    0,    0,
+      169,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  204,    0,  207,    0,    0,
+        0,    0,    0,   20,    0,    0,    0,    0,    0,    0,
+        0,    0,   48,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   66,    0,    0,    0,  107,    0,    0,
+        0,  118,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  113,    0,    0,  127,  131,    0,    0,    0,    0,
-        0,    0,  167,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  203,    0,    0,    0,    8,   13,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   49,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  202,    0,  205,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,    0,
-        0,    0,    0,    0,   48,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   66,    0,    0,    0,  107,
+        0,    0,   75,   81,    0,    0,    0,    0,    0,    0,
+       67,    0,    0,    0,    0,  112,    0,  120,  135,    0,
+        0,    0,    0,    0,    0,    0,  190,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   25,   26,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  201,    0,    0,    0,    8,   13,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   49,    0,
-        0,    0,    0,   75,   81,    0,    0,    0,    0,    0,
-        0,   67,    0,    0,    0,    0,  112,    0,  119,  134,
-
-        0,    0,    0,    0,    0,    0,    0,  188,    0,    0,
+        0,    0,    0,    0,  111,  116,    0,    0,    0,    0,
+      139,  145,    0,    0,    0,    0,    0,    0,  195,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   25,   26,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  111,  116,    0,    0,    0,
-        0,  138,  144,    0,    0,    0,    0,    0,    0,  193,
+        0,   37,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   97,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  193,    0,  196,
+      197,  198,  199,  200,  201,    0,    0,    0,    0,    0,
+       36,    0,    0,    0,    0,   56,    0,   62,    0,    0,
+        0,   85,    0,   87,    0,   96,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   37,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   97,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  191,    0,
+        0,    0,   40,    0,    0,   61,    0,    0,   84,    0,
+        0,   98,    0,    0,  137,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   33,    0,    0,    0,
+        0,   74,   83,   86,    0,    0,  136,    0,  168,  188,
 
-      194,  195,  196,  197,  198,  199,    0,    0,    0,    0,
-        0,   36,    0,    0,    0,    0,   56,    0,   62,    0,
-        0,    0,   85,    0,   87,    0,   96,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   40,    0,    0,   61,    0,    0,   84,
-        0,    0,   98,    0,    0,  136,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   33,    0,    0,
-        0,    0,   74,   83,   86,    0,    0,  135,    0,  166,
-      186,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   45,    0,   93,    0,  141,    0,    0,  190,    0,
-
-      203,  220,  223,    0,    0,    0,    0,  120,    0,    0,
-        0,    0,    0,   39,   46,    0,  189,    0,    0,   38,
-        0,    0,    0,    0,    0,    0,    0,    0,   14,  187,
-        0,  192,    0
+       45,    0,   93,    0,  142,    0,    0,  192,    0,  205,
+      222,  225,    0,    0,    0,    0,  121,    0,    0,    0,
+        0,    0,   39,   46,    0,  191,    0,    0,   38,    0,
+        0,    0,    0,    0,    0,    0,    0,   14,  189,    0,
+      194,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -591,375 +593,379 @@ static const YY_CHAR yy_meta[67] =
         1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1639] =
+static const flex_int16_t yy_base[1658] =
     {   0,
-        0,    0, 3134, 3135, 3131,    0,   64,    0,   62,   64,
+        0,    0, 3171, 3172, 3168,    0,   64,    0,   62,   64,
        64,   96,   43,  146,  198,   50,   68,   74,  124,  107,
        50,  155,   61,  240,  282,   51,  330,   57,  158,  372,
-      419,  187,   74,  204,   72,   83, 3130,    0,   82, 3135,
-        0, 3135,  110, 3135,    0,  134,  135,  130,  133,  144,
+      419,  187,   74,  204,   72,   83, 3167,    0,   82, 3172,
+        0, 3172,  110, 3172,    0,  134,  135,  130,  133,  144,
       142,  148,  174,  167,  172,  209,  178,  196,  204,  210,
       203,  226,  221,  471,  242,  242,  233,  253,  254,  272,
       253,  247,  262,  254,  291,  264,  273,  292,  280,  298,
       293,  286,  287,  302,  288,  303,  307,  302,  319,  306,
-      326,  322,  312,  344,  341,  365,  344,  351,  385,  364,
-
-      384,  357,  396,  420,  381,  381,  397,  416,  423,  417,
-      517,  432,  450,  434,  430,  433,  446,  459,  434,  447,
-      474,  460,  463,  475, 3091,  472,  474,  563,  487,  481,
-      495,  524,  491,  501,  523,  519,  523,  522,  507, 3135,
-      526,  531,  513,  522,  538,  532, 3090,  536,  547,  554,
-      557,  559,  560,  567,  568,  571,  565,  579,  565,  588,
-      565,  589, 3135,  592,  581,  577,  588,  580,  595,  591,
-      610,  606,  618,  621,  621,  617,  615,  627,  631,  629,
-      631,  617,  620, 3089,  624,  631,  181,  629,  624,  634,
-      633,  647,  645,  632,  639, 3135,  647, 3088,  649,  671,
-
-      659,  654,  662,  679,  679,  686,  684,  666,  679,  676,
-      677,  691,  676,  690,  693,  681,  693,  696,  684,  689,
-      685,  690,  708,  694,  701,  717,  728, 3135,  719,  716,
-     3087,  722,  737,  720, 3135,  725,  726, 3135,  740,  734,
-      727,  733, 3135,  740, 3086,  731,  745,  739,  746,  744,
-      753,  755,  739,  750,  754,  768,  775,  771,  770,  771,
-      779,  778,  786,  785,  789,  785,  782, 3135,  789,  786,
-      789,  789, 3085, 3135,  803, 3084, 3135,  789,  804,  805,
-      799,  800, 3083,  797,  815,  801,  823,  826,  829, 3135,
-     3135,  830,  821, 3135,  826,  843,  841, 3082,  837,  825,
-
-      847,  837,  836,  850,  841, 3135,  838,  839, 3135,  841,
-      844,  848, 3081,  860,  882, 3135,  847,  854,  850,  855,
-     3135, 3135, 3135,  865, 3080,  876,  883,  885, 3079,  893,
-      883,  895,  927,  899,  904,  887,  899,  898,  903, 3135,
-     3135,  902, 3078,  902, 3135,  905,  905,  913,  919,  951,
-     3135, 3077,  909, 3135, 3076, 3135,  934,  938,  944,  938,
-      939,  941,  942,  942,  942,  963, 3075,  949,  953,  956,
-      981,  966,  955, 3135,  964,  979,  978,  973, 1001,  977,
-      994,  981,  992, 1006, 1007, 3135, 1005,  992, 1006, 1007,
-     1005, 1000, 1012, 3135, 1012, 1005, 1012, 3074, 1011, 1011,
-
-     1017, 1037, 1035, 1025, 1026, 1029, 1041, 1048, 1041, 1043,
-     1058, 3135, 1041, 1050, 3135, 1059, 1064, 3135, 3135, 1063,
-     1055, 1067, 3073, 3135, 1060, 1064, 1063, 3072, 1070, 3135,
-     1065, 1079, 1064, 1076, 1088, 1080, 3135, 1093, 3135, 1100,
-     1087, 1095, 1093, 1101, 1108, 1104, 3135, 1113, 1110, 1107,
-     1113, 1101, 1119, 1099, 3071, 3070, 1113, 1113, 1110, 1128,
-     1130, 1134, 1129, 1134, 1137, 1151, 1143, 1136, 1132, 1156,
-     1159, 1152, 1163, 1150, 1163, 1165, 1154, 1158, 1172, 1166,
-     1162, 1163, 3069, 1171, 1164, 1185, 1195, 1177, 1187, 1192,
-     1196, 1197, 3135, 1201, 1204, 1216, 1204, 1218, 1206, 1222,
-
-     3135, 1212, 1212, 1228, 1217, 1230, 3068, 3135, 1234, 3067,
-     3135, 1251, 1229, 1235, 3066, 1221, 1223, 1240, 1222, 1234,
-     1235, 1255, 1251, 1255, 1262, 1252, 1261, 1261, 3094, 1261,
-     1264, 1277, 3135, 3135, 1263, 3064, 3135, 1280, 3063, 1266,
-     3135, 1277, 1272, 1275, 1276, 1285, 1290, 1280, 1285, 1291,
-     1288, 1304, 1290, 1299, 1299, 1304, 1318, 1312, 1314, 1309,
-     3062, 3135, 1329, 3061, 1317, 1318, 1322, 1317, 1334, 3060,
-     1338, 1328, 1338, 1338, 1325, 3059, 1343, 3058, 3135, 1340,
-     1329, 1349, 1370, 1350, 3135, 3135, 3135, 1350, 1346, 1363,
-     1356, 1355, 1376, 1369, 1365, 1368, 1365, 3135, 1366, 1369,
-
-     1378, 1378, 1374, 3135, 1389, 1392, 1396, 1387, 1394, 1384,
-     1399, 3057, 1390, 1405, 1394, 1401, 1415, 3135, 1400, 1407,
-     1418, 1424, 3135, 1411, 3056, 3135, 1418, 1431, 3135, 1435,
-     1418, 1415, 1431, 1423, 1443, 1438, 1443, 1430, 3135, 1438,
-     1440, 1439, 1438, 1441, 1445, 3055, 1442, 1484, 3135, 1464,
-     3054, 3053, 1467, 3135, 3135, 1477, 1480, 1467, 3135, 1485,
-     1484, 3135, 1473, 1479, 3135, 3052, 1491, 1493, 1485, 1482,
-     1501, 1505, 1493, 1489, 1498, 1509, 1506, 1515, 3135, 1515,
-     3135, 3135, 1530, 1525, 3051, 1521, 3050, 1534, 3049, 1539,
-     1533, 1534, 1532, 1543, 3048, 3135, 3135, 1544, 1536, 1537,
-
-     1547, 1541, 1536, 1544, 1554, 1546, 1556, 1563, 1560, 1543,
-     1560, 1572, 1584, 1571, 1588, 1576, 1583, 1593, 1590, 1589,
-     1599, 1595, 1594, 1601, 1600, 3135, 1601, 1584, 3135, 3135,
-     1603, 1590, 3047, 1603, 3046, 1607, 1597, 1596, 1590, 1606,
-     1604, 1612, 1619, 1623, 1630, 3135, 1635, 1638, 1631, 1633,
-     1651, 3135, 1648, 1632, 3135, 1636, 1647, 1643, 3135, 1649,
-     1644, 1648, 1646, 1642, 1655, 1650, 1661, 1648, 3045, 3044,
-     3043, 3042, 3041, 3040, 3039, 1663, 1664, 1668, 3038, 3135,
-     3135, 1668, 3135, 1668, 3135, 3037, 1684, 1673,  129, 1697,
-     1683, 1692, 1692, 3135, 1692, 1702, 3135, 1704, 1705, 1698,
-
-     1693, 3036, 1707, 1703, 1725, 1700, 1706, 1714, 1712, 3135,
-     1706, 1720, 1715, 1715, 1745, 1732, 3135, 1747, 1733, 3135,
-     1742, 1754, 1748, 1756, 1738, 1744, 1745, 1760, 1752, 1758,
-     1756, 1758, 1755, 3035, 1758, 3135, 1754, 3034, 1770, 1771,
-     1774, 1772, 1762, 3135, 1774, 1771, 1778, 1801, 3135, 1794,
-     3135, 1801, 3135, 1793, 1786, 1809, 1794, 3135, 1805, 1812,
-     1804, 1815, 1800, 1799, 1808, 1810, 1824, 1807, 1824, 1823,
-     1827, 1811, 1829, 1815, 1828, 1834, 1846, 1842, 1858, 1859,
-     1859, 1850, 1852, 1853, 1854, 1855, 1856, 3033, 1848, 1868,
-     1870, 1871, 1867, 1874, 1870, 1875,  372, 3068, 3058, 1863,
-
-     1882, 3030, 3029, 1864, 3135, 3028, 3135, 1880, 1883, 1881,
-     1879, 1878, 1904, 1893, 1892, 1913, 1912, 3027, 1915, 3135,
-     1908, 1917, 1903, 1915, 1905, 1913, 3135, 3026, 1922, 1921,
-     3025, 1920, 1918, 1917, 1929, 3135, 1923, 3024, 1932, 1937,
-     3135, 1919, 1930, 1938, 1940, 1956, 1929, 1942, 3023, 3135,
-     3135, 1955, 1951, 1950, 1970, 1976, 1966, 1961, 1979, 3022,
-     1976, 3015, 1973, 3135, 1978, 1972, 3135, 3135, 3135, 1969,
-     1967, 1965, 1985, 1976, 1987, 1989, 1978, 1988, 1993, 1983,
-     2010, 2004, 2003, 2015, 2016, 2011, 2013, 2014, 2015, 2016,
-     2017, 2031, 2019, 2024, 2032, 3135, 2024, 2024, 2022, 2029,
-
-     3048, 3045, 3027, 3025, 2025, 2025, 2040, 2042, 3135, 2027,
-     2039, 2038, 2052, 2055, 2066, 2052, 2065, 2061, 2072, 2071,
-     2082, 2081, 2078, 2070, 3135, 2075, 3135, 2085, 2085, 2074,
-     2090, 2074, 2081, 2093, 2098, 2091, 2996, 2085, 2101, 2091,
-     2082, 3135, 2108, 2109, 2105, 2121, 2125, 2124, 3135, 2116,
-     2125, 2134, 3135, 2124, 2121, 2128, 2127, 2995, 2124, 2123,
-     2126, 2127, 2142, 3135, 2144, 2130, 2147, 2138, 3135, 3135,
-     3135, 3135, 2145, 2152, 2149, 1689, 2139, 2152, 2162, 2170,
-     2159, 2178, 2179, 2182, 2184, 2186, 2187, 2178, 2185, 2186,
-     2176, 2185, 2191, 2185, 2180, 2185, 2180, 2189, 2194, 2183,
-
-     2207, 1445, 3135, 2190, 2197, 2199, 1443, 3135, 2207, 2212,
-     2214, 2223, 2223, 2218, 1441, 2230, 3135, 2225, 2226, 2241,
-     2228, 2234, 2235, 2225, 2233, 2232, 2234, 2246, 2237, 1435,
-     2240, 2241, 3135, 2260, 2248, 2250, 3135, 2261, 2264, 2251,
-     2268, 2275, 2268, 2283, 2272, 2282, 3135, 2288, 3135, 3135,
-     3135,  893, 2281, 2296, 2296, 2299, 2291, 2295, 2289, 2293,
-      887, 2307, 2291, 2293, 2294, 2296, 2297, 2298, 2296, 2307,
-     2303, 2322, 2305, 3135, 2320, 2322, 2320, 2330, 2328, 2334,
-     2342, 2344, 2345, 2335, 2352,  876, 2354, 3135,  533, 2338,
-     2355, 2340, 3135, 2348, 2344, 2350, 3135, 2357, 2349,  482,
-
-      476, 2349,  471, 2365, 2362, 3135, 2370,  467, 2372, 2370,
-     3135, 2365, 2381, 2386, 2380, 2398, 2396, 3135, 3135, 2399,
-     2396, 2391,  466, 2393, 2396, 2399, 2407, 3135, 3135, 2411,
-     2404, 2399, 2396,  436, 2413, 2417,  419,  418,  416,  414,
-      410,  386, 2406, 2417, 2418, 3135, 2423, 2420, 2410, 3135,
-     2411, 3135, 2416, 2413, 2422, 2429,  376, 2445, 2447, 2442,
-     2454, 2454, 2443, 3135, 2447,  373, 2450, 2448, 3135, 2446,
-     2464,  366, 2465,  347, 2457, 2453, 2476, 2465, 2469, 2469,
-     2457, 3135, 2471, 2464, 3135, 3135, 2479,  338, 2482, 2483,
-     2483, 2497, 3135, 2487, 2489, 2497, 2504, 2509, 2507, 2505,
-
-     2503, 2504, 2505, 2506, 2507, 2509, 2505, 3135,  335, 3135,
-     2524, 2503, 2526, 2527,  327, 3135, 2510, 2530, 2521, 2528,
-     2527, 2532, 2542,  326,  352, 2533, 2561,  243, 2537, 2542,
-     2547, 2566, 2562, 2551, 2567,  269, 2558, 2565, 2574, 3135,
-     2571, 2570, 2559, 2577, 2564, 2578, 2583, 2582, 2579, 2568,
-     2590, 2584,  233, 2604, 2601, 2608, 2611, 2605, 2607, 2609,
-     2610, 2611, 2612, 3135, 2613, 2608,  195, 3135, 3135, 2616,
-      267, 2622, 2611, 2620, 2620, 2631, 2637, 2636, 3135, 2631,
-     2636, 2635, 2630, 3135, 3135, 2633, 2634, 2649, 2660, 2655,
-      191, 3135, 2648, 2657, 2659, 2656, 3135, 2669,  188, 3135,
-
-     2666, 2664, 2668, 2662, 2677,  146,  115, 3135, 2665,  113,
-     2672, 2681, 2683, 2677, 2678, 2680, 2681, 2682, 2683, 2683,
-      109, 2687, 2696, 3135, 3135, 2702, 2698, 2710, 2703, 2709,
-     2710, 2712, 2726, 2719, 2720, 2717, 2720, 2714, 2723, 2723,
-     2725, 2728, 2727, 2738, 2730, 3135, 3135, 2727, 2732, 2745,
-     2737, 3135, 3135, 2746, 2747, 2750, 2754, 2761, 2750, 3135,
-     2747, 2752, 2753, 2756, 2758, 2760, 2766, 2785, 2783, 2770,
-     2776, 2771, 3135, 2788, 2774, 2781, 2784, 2793, 2799, 2796,
-     2797, 2798, 2792, 2802, 2795, 2806, 2811, 2803, 3135, 2821,
-     2822, 2830, 2834, 2832, 2830, 2831, 2824, 2821, 3135, 2823,
-
-     3135, 3135, 3135, 3135, 3135, 3135, 2835, 2833, 2832, 2829,
-     2842, 3135,  107, 2832, 2847, 2841, 3135, 2830, 3135, 2838,
-     2854, 2840, 3135, 2856, 3135, 2850, 3135, 2853, 2861, 2876,
-     2868, 2867, 2874, 2877, 2872, 2876,   95, 2892, 2881, 2890,
-     2897, 2894, 2897, 3135, 2890, 2902, 3135, 2886, 2886, 3135,
-     2896, 2900, 3135, 2894, 2899, 3135, 2905, 2910, 2914, 2921,
-     2922, 2912, 2938, 2935, 2940, 2925, 2940, 3135, 2933, 2940,
-     2931, 2937, 3135, 3135, 3135, 2932, 2941, 3135, 2950, 3135,
-     3135, 2951, 2939, 2954, 2948, 2943, 2952, 2956, 2960, 2947,
-     2956, 3135, 2967, 3135, 2968, 3135, 2964, 2980, 3135, 2981,
-
-     3135, 3135, 3135,   85, 2979, 2989, 2978, 3135, 2983, 2997,
-     2987, 2983, 2984, 3135, 3135, 2987, 3135, 2988, 2998, 3135,
-     2999, 3001, 2998, 2999, 2994, 3011, 2997, 3010, 3135, 3135,
-     3006, 3135, 3135,   99, 3059,   95,   93,   87
+      326,  322,  312,  350,  337,  365,  342,  351,  385,  364,
+
+      384,  361,  408,  423,  381,  384,  404,  418,  423,  414,
+      517,  430,  446,  460,  448,  426,  435,  467,  435,  447,
+      466,  460,  462,  469, 3128,  468,  474,  565,  490,  481,
+      514,  508,  482,  497,  527,  511,  510,  520,  506, 3172,
+      525,  536,  510,  524,  555,  552, 3127,  553,  554,  554,
+      555,  556,  560,  567,  567,  570,  565,  579,  565,  587,
+      565,  589, 3172,  596,  584,  581,  596,  596,  613,  607,
+      616,  610,  620,  621,  622,  616,  615,  626,  631,  629,
+      631,  617,  620, 3126,  624,  631,  181,  629,  624,  639,
+      632,  649,  653,  648,  657, 3172,  663, 3125,  655,  675,
+
+      659,  661,  659,  663,  680,  680,  686,  685,  667,  680,
+      677,  678,  692,  678,  692,  695,  686,  698,  701,  693,
+      699,  701,  708,  724,  710,  708,  722,  733, 3172,  721,
+      717,  719, 3124,  726,  739,  722, 3172,  727,  728, 3172,
+      742,  736,  730,  736, 3172,  743, 3123,  734,  752,  745,
+      753,  767,  762,  765,  755,  770,  771,  775,  780,  776,
+      773,  773,  781,  781,  788,  787,  790,  787,  784, 3172,
+      792,  789,  792,  792, 3122, 3172,  811, 3121, 3172,  797,
+      816,  817,  813,  816, 3120,  815,  831,  817,  837,  834,
+      837, 3172, 3172,  837,  824, 3172,  828,  845,  844, 3119,
+
+      839,  827,  848,  839,  838,  853,  844, 3172,  841,  842,
+     3172,  848,  850,  855, 3118,  870,  881, 3172,  858,  875,
+      873,  873, 3172, 3172, 3172,  891, 3117,  896,  894,  889,
+     3116,  896,  887,  900,  932,  904,  908,  903,  893,  907,
+      910,  916, 3172, 3172,  915, 3115,  916, 3172,  924,  926,
+      935,  940,  956, 3172, 3114,  924, 3172, 3113, 3172,  945,
+      949,  953,  944,  948,  947,  948,  948,  950,  975, 3112,
+      973,  969,  973,  971,  987,  984,  975, 3172,  987,  997,
+      998,  986, 1004,  990, 1005,  991,  999, 1017, 1019, 3172,
+     1016, 1004, 1016, 1020, 1017, 1013, 1030, 3172, 1029, 1022,
+
+     1028, 3111, 1028, 1030, 1031, 1052, 1049, 1036, 1037, 1040,
+     1052, 1057, 1053, 1048, 1071, 3172, 1047, 1059, 3172, 1070,
+     1076, 3172, 3172, 1074, 1069, 1081, 3110, 3172, 1074, 1084,
+     1083, 3109, 1087, 3172, 1081, 1096, 1083, 1090, 1103, 1094,
+     3172, 1104, 3172, 1111, 1098, 1106, 1102, 1109, 1115, 1119,
+     3172, 1120, 1120, 1117, 1124, 1113, 1130, 1112, 3108, 3107,
+     1127, 1131, 1128, 1145, 1147, 1150, 1146, 1154, 1148, 1160,
+     1161, 1144, 1141, 1167, 1166, 1169, 1164, 1175, 1163, 1176,
+     1178, 1168, 1173, 1187, 1187, 1183, 1183, 3106, 1190, 1181,
+     1208, 1205, 1201, 1201, 1203, 1207, 1208, 3172, 1208, 1221,
+
+     1228, 1216, 1231, 1221, 1222, 1237, 3172, 1229, 1228, 1245,
+     1238, 1251, 3105, 3172, 1256, 3104, 3172, 1261, 1250, 1254,
+     3103, 1242, 1245, 1264, 1247, 1256, 1258, 1270, 1265, 1267,
+     1274, 1265, 1274, 1275, 3131, 1275, 1280, 1292, 3172, 3172,
+     1280, 3101, 3172, 1296, 3100, 1283, 3172, 1298, 1293, 1297,
+     1297, 1304, 1310, 1301, 1308, 1314, 1306, 1321, 1308, 1315,
+     1311, 1316, 1328, 1322, 1327, 1322, 3099, 3172, 1343, 3098,
+     1331, 1334, 1337, 1334, 1350, 3097, 1355, 1349, 1359, 1359,
+     1346, 3096, 1364, 3095, 3172, 1359, 1350, 1369, 1374, 1372,
+     3172, 3172, 3172, 1376, 1370, 1384, 1374, 1365, 1386, 1382,
+
+     1378, 1382, 1379, 3172, 1382, 1384, 1388, 1396, 1396, 1396,
+     3172, 1412, 1414, 1418, 1409, 1416, 1406, 1423, 3094, 1413,
+     1429, 1418, 1420, 1435, 3172, 1420, 1424, 1431, 1437, 3172,
+     1423, 3093, 3172, 1434, 1445, 3172, 1450, 1433, 1432, 1442,
+     1452, 1443, 1463, 1463, 1464, 1453, 3172, 1461, 1463, 1464,
+     1463, 1466, 1471, 3092, 1467, 1509, 3172, 1478, 3091, 3090,
+     1478, 3172, 3172, 1489, 1499, 1486, 3172, 1502, 1503, 3172,
+     1492, 1500, 3172, 3089, 1511, 1518, 1510, 1507, 1525, 1528,
+     1518, 1514, 1523, 1535, 1531, 1529, 3172, 1526, 3172, 3172,
+     1542, 1544, 3088, 1540, 3087, 1552, 3086, 1559, 1553, 1556,
+
+     1554, 1565, 3085, 3172, 3172, 1567, 1560, 1562, 1572, 1566,
+     1561, 1569, 1579, 1570, 1607, 1585, 1584, 1566, 1584, 1582,
+     1593, 1581, 1597, 1595, 1601, 1613, 1610, 1611, 1621, 1617,
+     1617, 1625, 1625, 3084, 3172, 1626, 1609, 3172, 3172, 1628,
+     1615, 3083, 1628, 3082, 1631, 1624, 1625, 1619, 1635, 1633,
+     1643, 1650, 1641, 1651, 3172, 1656, 1657, 1650, 1651, 1671,
+     3172, 1668, 1658, 1655, 3172, 1659, 1671, 1668, 3172, 1675,
+     1670, 1674, 1672, 1668, 1681, 1676, 1692, 1675, 3081, 3080,
+     3079, 3078, 3077, 3076, 3075, 1693, 1696, 1698, 3074, 3172,
+     3172, 1701, 3172, 1703, 3172, 3073, 1710, 1695,  129, 1719,
+
+     1704, 1712, 1713, 3172, 1713, 1725, 3172, 1727, 1728, 1722,
+     1718, 3072, 1738, 1729, 1754, 1725, 1731, 1737, 1733, 3172,
+     1727, 1749, 1744, 1748, 1763, 1754, 3172, 1769, 1754, 3172,
+     1762, 1775, 1769, 1779, 1761, 1767, 1769, 1785, 1778, 1784,
+     1782, 1784, 1780, 3071, 1783, 3172, 1778, 3067, 1797, 1800,
+     1803, 1801, 1791, 1795, 3172, 1807, 1804, 1807, 1824, 3172,
+     1821, 3172, 1825, 3172, 1815, 1809, 1831, 1819, 3172, 1829,
+     1837, 1830, 1842, 1827, 1826, 1835, 1837, 1831, 1851, 1837,
+     1855, 1854, 1860, 1844, 1863, 1850, 1863, 1875, 1876, 1870,
+     1883, 1884, 1884, 1874, 1877, 1878, 1879, 1881, 1883, 3066,
+
+     1876, 1896, 1898, 1899, 1895, 1902, 1897, 1905,  372, 3101,
+     3091, 1894, 1913, 3062, 3061, 1897, 3172, 3059, 3172, 1913,
+     1917, 1916, 1914, 1919, 1934, 1921, 1917, 1938, 1937, 3057,
+     1939, 3172, 1933, 1942, 1928, 1941, 1932, 1941, 3172, 3055,
+     1950, 1949, 3054, 1948, 1946, 1944, 1959, 3172, 1954, 3053,
+     1963, 1970, 3172, 1952, 1964, 1973, 1975, 1989, 1970, 1969,
+     3050, 3172, 3172, 1975, 1981, 1976, 1974, 1995, 2001, 1992,
+     1988, 2007, 3049, 2005, 3046, 2002, 3172, 2007, 2001, 3172,
+     3172, 3172, 1998, 3172, 1998, 1998, 2017, 2010, 2021, 2026,
+     2014, 2025, 2036, 2025, 2041, 2034, 2029, 2043, 2042, 2038,
+
+     2039, 2040, 2042, 2044, 2046, 2060, 2048, 2053, 2061, 3172,
+     2053, 2053, 2053, 2062, 3081, 3079, 3069, 1584, 2057, 2059,
+     2078, 2081, 3172, 2065, 2082, 2080, 2083, 2085, 2092, 2080,
+     2091, 2088, 2098, 2097, 2109, 2109, 2107, 2099, 3172, 2104,
+     3172, 2114, 2114, 2103, 2119, 2105, 2114, 2125, 2132, 2125,
+     1556, 2122, 2137, 2128, 2125, 3172, 2150, 2140, 2135, 2147,
+     2153, 2150, 3172, 2143, 2151, 2161, 2162, 3172, 2153, 2151,
+     2158, 2157, 1476, 2154, 2153, 2156, 2157, 2175, 3172, 2178,
+     2164, 2182, 2173, 3172, 3172, 3172, 3172, 2183, 2191, 2187,
+     1470, 2184, 2196, 2205, 2203, 2190, 2207, 2208, 2211, 2212,
+
+     2213, 2215, 2207, 2215, 2216, 2206, 2215, 2221, 2215, 2210,
+     2218, 2214, 2223, 2229, 2218, 2245, 1468, 3172, 2229, 2235,
+     2244, 1466, 3172, 2251, 2255, 2247, 2254, 2252, 2247, 1460,
+     2259, 3172, 2253, 2253, 2269, 2257, 2264, 2265, 2256, 2264,
+     2263, 2264, 2279, 2271, 1037, 2274, 2276, 3172, 2295, 2286,
+     2289, 3172, 2299, 2296, 2309, 2295, 2311, 2311, 2302, 2317,
+     2302, 2311, 3172, 2316, 3172, 3172, 3172,  887, 2310, 2326,
+     2327, 2330, 2323, 2327, 2321, 2325,  880, 2341, 2327, 2328,
+     2331, 2332, 2336, 2338, 2337, 2348, 2348, 2366, 2348, 3172,
+     2356, 2356, 2354, 2360, 2360, 2364, 2371, 2373, 2375, 2366,
+
+     2383,  879, 2386, 3172,  854, 2370, 2387, 2372, 3172, 2382,
+     2380, 2385, 3172, 2394, 2385,  523,  522, 2388,  512, 2405,
+     2403, 3172, 2411,  476, 2417, 2414, 3172, 2408, 2417, 2420,
+     2414, 2424, 2431, 2429, 3172, 3172, 2430, 2427, 2422,  471,
+     2425, 2428, 2432, 2440, 3172, 3172, 2444, 2437, 2435, 2433,
+      436, 2450, 2455,  419,  418,  412,  410,  407,  406, 2444,
+     2457, 2459, 3172, 2465, 2464, 2456, 3172, 2457, 3172, 2461,
+     2458, 2459, 2466,  376, 2480, 2480, 2475, 2485, 2485, 2474,
+     3172, 2479,  373, 2482, 2481, 3172, 2478, 2496,  372, 2501,
+      366, 2494, 2490, 2508, 2504, 2511, 2511, 2500, 3172, 2516,
+
+     2509, 2512, 3172, 3172, 2528,  338, 2530, 2532, 2521, 2535,
+     3172, 2521, 2523, 2530, 2537, 2542, 2540, 2539, 2537, 2538,
+     2539, 2543, 2546, 2547, 2545, 3172,  335, 3172, 2563, 2545,
+     2568, 2570,  327, 3172, 2555, 2579, 2568, 2575, 2574, 2578,
+     2582,  326,  352, 2571, 2590,  243, 2576, 2579, 2585, 2599,
+     2595, 2585, 2601,  269, 2592, 2599, 2611, 3172, 2610, 2608,
+     2600, 3172, 2620, 2608, 2624, 2627, 2632, 2626, 2615, 2636,
+     2624,  233, 2642, 2639, 2642, 2645, 2638, 2640, 2642, 2643,
+     2645, 2646, 3172, 2647, 2642,  195, 3172, 3172, 2653,  267,
+     2661, 2649, 2660, 2659, 2673, 2679, 2679, 3172, 2676, 2685,
+
+     2682, 2677, 3172, 3172, 2680, 2680, 2689, 2698, 2693,  191,
+     3172, 2682, 2691, 2692, 2689, 3172, 2702,  188, 3172, 2699,
+     2698, 2702, 2696, 2711,  146,  115, 3172, 2702,  113, 2711,
+     2719, 2723, 2716, 2720, 2722, 2724, 2727, 2732, 2730,  109,
+     2734, 2743, 3172, 3172, 2748, 2738, 2748, 2741, 2743, 2744,
+     2745, 2759, 2752, 2753, 2751, 2754, 2748, 2757, 2760, 2764,
+     2766, 2767, 2777, 2772, 3172, 3172, 2769, 2775, 2790, 2786,
+     3172, 3172, 2793, 2794, 2797, 2800, 2801, 2788, 3172, 2785,
+     2786, 2787, 2789, 2791, 2793, 2799, 2819, 2817, 2804, 2810,
+     2808, 3172, 2827, 2812, 2821, 2823, 2835, 2841, 2839, 2842,
+
+     2847, 2839, 2849, 2842, 2852, 2851, 2841, 3172, 2859, 2856,
+     2864, 2867, 2865, 2863, 2864, 2858, 2855, 3172, 2857, 3172,
+     3172, 3172, 3172, 3172, 3172, 2869, 2870, 2871, 2867, 2882,
+     3172,  107, 2871, 2889, 2883, 3172, 2873, 3172, 2883, 2903,
+     2887, 3172, 2903, 3172, 2897, 3172, 2899, 2901, 2914, 2906,
+     2901, 2908, 2910, 2905, 2909,   95, 2926, 2915, 2924, 2931,
+     2931, 2940, 3172, 2927, 2939, 3172, 2925, 2928, 3172, 2938,
+     2943, 3172, 2939, 2949, 3172, 2953, 2959, 2960, 2961, 2960,
+     2950, 2972, 2969, 2973, 2958, 2973, 3172, 2966, 2974, 2965,
+     2971, 3172, 3172, 3172, 2966, 2978, 3172, 2989, 3172, 3172,
+
+     2989, 2979, 2993, 2990, 2985, 2995, 3001, 3009, 2994, 3003,
+     3172, 3014, 3172, 3014, 3172, 3004, 3018, 3172, 3019, 3172,
+     3172, 3172,   85, 3013, 3023, 3011, 3172, 3016, 3030, 3020,
+     3017, 3018, 3172, 3172, 3021, 3172, 3022, 3035, 3172, 3038,
+     3039, 3038, 3038, 3036, 3053, 3040, 3055, 3172, 3172, 3055,
+     3172, 3172,   99, 3108,   95,   93,   87
     } ;
 
-static const flex_int16_t yy_def[1639] =
+static const flex_int16_t yy_def[1658] =
     {   0,
-     1633,    1, 1633, 1633, 1633, 1634, 1635, 1636, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1634, 1635, 1633,
-     1636, 1633, 1633, 1633, 1636, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1637, 1638, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1637, 1637, 1638, 1638, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633,    0, 1633, 1633, 1633, 1633, 1633
+     1652,    1, 1652, 1652, 1652, 1653, 1654, 1655, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1653, 1654, 1652,
+     1655, 1652, 1652, 1652, 1655, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1656,
+     1657, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1656, 1656, 1657, 1657, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652,    0, 1652, 1652, 1652, 1652, 1652
     } ;
 
-static const flex_int16_t yy_nxt[3202] =
+static const flex_int16_t yy_nxt[3239] =
     {   0,
         4,    5,    6,    7,    8,    4,    9,   10,   11,   11,
        11,    4,    4,   12,   13,   14,   15,   16,   17,   18,
@@ -969,29 +975,29 @@ static const flex_int16_t yy_nxt[3202] =
        22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
        32,   33,   34,   35,   36,    4,   40,   40,   42,   44,
        54,   45,   46,   46,   46,   68,   69,   84,   89,  103,
-       55,   71,   90,   43,   40,   40,   70, 1003,   91,   72,
-      109,   75,   73, 1001,  130,   41,  134,   54,   76,   38,
+       55,   71,   90,   43,   40,   40,   70, 1017,   91,   72,
+      109,   75,   73, 1015,  130,   41,  134,   54,   76,   38,
 
       135,   74,   68,   69,   84,   89,  103,   55,   71,   90,
        43,   47,   48,   70,   49,   91,   72,  109,   75,   73,
-       50,  130,   51,  134, 1612,   76,   81,  135,   74,   52,
-      897,   53,  898,   82, 1563,   83,  136,   77,   47,   48,
-      899,   49,   46,   46,   46,   78, 1543,   50, 1468,   51,
-      137,   79, 1457,   81, 1455,  138,   52,   80,   53,   56,
+       50,  130,   51,  134, 1631,   76,   81,  135,   74,   52,
+      909,   53,  910,   82, 1582,   83,  136,   77,   47,   48,
+      911,   49,   46,   46,   46,   78, 1562,   50, 1487,   51,
+      137,   79, 1476,   81, 1474,  138,   52,   80,   53,   56,
        82,   57,   83,  136,   77,  139,   58,   59,  140,   85,
        60,  110,   78,   61,  141,  111,   86,  137,   79,   87,
-      142,   88,  138,   62,   80, 1454,   56,  143,   57,  112,
-      321,  322,  139,   58,   59,  140,   85,   60,  110,  144,
+      142,   88,  138,   62,   80, 1473,   56,  143,   57,  112,
+      323,  324,  139,   58,   59,  140,   85,   60,  110,  144,
 
        61,  141,  111,   86,  145,  148,   87,  142,   88,  149,
        62,   63,  127,  128,  143,   64,  112,  131,  129,   65,
-      150,  132,   66,  151,  133,   67,  144, 1448,  154,  155,
-     1442,  145,  148,  146, 1422,  147,  149,  152,   63,  127,
+      150,  132,   66,  151,  133,   67,  144, 1467,  154,  155,
+     1461,  145,  148,  146, 1441,  147,  149,  152,   63,  127,
       128,  156,   64,  153,  131,  129,   65,  150,  132,   66,
       151,  133,   67,   92,   93,  154,  155,   94,  157,  163,
       146,   95,  147,  165,  152,  166,  167,   96,  156,  168,
-      153,  174, 1409,  164,  172,  175, 1424, 1425,  176, 1392,
-       92,   93, 1383,  173,   94,  157,  163,  169,   95,  170,
+      153,  174, 1428,  164,  172,  175, 1443, 1444,  176, 1411,
+       92,   93, 1402,  173,   94,  157,  163,  169,   95,  170,
       165,  179,  166,  167,   96,   97,  168,   98,  174,   99,
 
       164,  172,  175,  100,  171,  176,  177,  180,  181,  101,
@@ -1000,323 +1006,326 @@ static const flex_int16_t yy_nxt[3202] =
       100,  171,  193,  177,  180,  181,  101,  194,  182,  184,
       183,  195,  102,  104,  178,  196,  185,  186,  187,  199,
       188,  105,  189,  197,  190,  191,  192,  106,  198,  193,
-      107,  108, 1379,  200,  194, 1378, 1370,  201,  195,  205,
-      104,  206,  196,  897, 1365,  898,  199, 1346,  105,  209,
-      197,  202,  212,  899,  106,  198, 1334,  107,  108,  113,
-      200,  203,  114,  115,  201,  116,  205,  204,  206,  117,
-
-      118,  119,  207,  120,  121, 1332,  209,  218,  202,  212,
-      210,  219, 1327,  213,  220, 1318,  113,  208,  203,  114,
-      115,  214,  116,  211,  204, 1306,  117,  118,  119,  207,
-      120,  121,  122,  221,  218,  215,  222,  210,  219,  123,
-      213,  220,  124,  223,  208,  231,  238,  236,  214, 1305,
-      125,  216,  217, 1304,  240, 1303,  126, 1302, 1301,  122,
-      221,  237,  215,  222,  241,  232,  123,  244,  239,  124,
-      223,  245,  231,  238,  236, 1298,  233,  125,  216,  217,
-      234,  240,  235,  126,  158,  159,  242,  246,  237,  160,
-      247,  241,  232,  248,  244,  239,  243,  161,  245,  249,
-
-      251,  252,  162,  233,  259, 1289, 1277,  234,  260,  235,
-     1273,  158,  159,  242,  246, 1271,  160,  247,  265,  261,
-      248, 1270,  266,  243,  161,  262,  249,  251,  252,  162,
-      224,  259,  225,  226,  269,  260,  267,  227,  263,  228,
-      270,  264,  229,  271,  272,  265,  261,  273,  230,  266,
-      276,  274,  262,  277,  268,  278,  279,  224,  275,  225,
-      226,  269,  281,  267,  227,  263,  228,  270,  264,  229,
-      271,  272, 1261,  282,  273,  230,  253,  276,  274,  254,
-      277,  268,  278,  279,  283,  275,  255,  256,  284,  281,
-      285,  286,  287,  257,  288,  289,  290,  291,  292,  258,
-
-      282,  293,  294,  253,  295,  296,  254,  297,  298,  299,
-      300,  283,  301,  255,  256,  284,  302,  285,  286,  287,
-      257,  288,  289,  290,  291,  292,  258,  303,  293,  294,
-      304,  295,  296,  305,  297,  298,  299,  300,  306,  301,
-      307,  309,  310,  302,  311,  312,  313,  314,  315,  316,
-      317,  319,  320,  308,  303,  323,  324,  304,  325,  327,
-      305,  326,  328,  329,  330,  306,  331,  307,  309,  310,
-      332,  311,  312,  313,  314,  315,  316,  317,  319,  320,
-      308,  334,  323,  324,  335,  325,  327,  338,  326,  328,
-      329,  330,  336,  331,  339,  340,  341,  332,  337,  342,
-
-      343,  344,  345,  346,  347,  349,  350,  351,  334,  348,
-      352,  335,  353,  354,  338,  355,  356,  357,  358,  336,
-      359,  339,  340,  341,  360,  361,  342,  343,  344,  345,
-      346,  347,  349,  350,  351,  362,  348,  352,  363,  353,
-      354,  364,  355,  356,  357,  358,  365,  359,  366,  369,
-      367,  360,  361,  370,  371,  372,  373,  374,  375,  376,
-      377,  378,  362,  380,  381,  363,  382,  383,  364,  384,
-      386,  387,  388,  365,  389,  366,  369,  367,  390,  385,
-      370,  371,  372,  373,  374,  375,  376,  377,  378,  391,
-      380,  381,  392,  382,  383,  393,  384,  386,  387,  388,
-
-      394,  389,  396,  397,  398,  390,  385,  399,  400,  395,
-      401,  403,  404,  405,  406,  407,  391,  408,  410,  392,
-      412,  413,  393,  414,  402,  415,  416,  394,  418,  396,
-      397,  398,  419,  420,  399,  400,  421,  401,  403,  404,
-      405,  406,  407,  422,  408,  410,  423,  412,  413,  424,
-      414,  402,  415,  416,  425,  418,  426,  427,  428,  419,
-      420,  430,  431,  421,  432,  433,  434,  435,  436,  437,
-      422,  438,  439,  423,  440,  441,  424,  443,  447,  448,
-      449,  425,  452,  426,  427,  428,  450,  451,  430,  431,
-      454,  432,  433,  434,  435,  436,  437,  444,  438,  439,
-
-      455,  440,  441,  445,  443,  447,  448,  449,  456,  452,
-      458,  459,  460,  450,  451, 1259,  468,  454,  469,  470,
-      471,  446,  473,  474,  444,  472, 1235,  455,  475,  477,
-      445,  478, 1226,  479,  480,  456,  481,  458,  459,  460,
-      461,  462,  463,  468,  486,  469,  470,  471,  464,  473,
-      474,  488,  472,  465,  489,  475,  477,  490,  478,  466,
-      479,  480,  467,  481,  482,  491,  492,  461,  462,  463,
-      493,  486,  494,  495,  496,  464,  497,  499,  488,  500,
-      465,  489,  483,  506,  490,  501,  466,  507,  508,  467,
-      484,  482,  491,  492,  509,  502,  510,  493,  503,  494,
-
-      495,  496,  504,  497,  499,  511,  500,  505,  515,  483,
-      506,  516,  501,  517,  507,  508,  512,  513,  518,  519,
-      520,  509,  521,  510,  522,  503,  514,  523,  524,  504,
-      525,  526,  511,  527,  505,  515,  528,  529,  516,  530,
-      517,  532,  533,  512,  513,  518,  519,  520,  534,  521,
-      535,  522,  536,  514,  523,  524,  537,  525,  526,  538,
-      527,  539,  540,  528,  529,  541,  530,  542,  532,  533,
-      544,  547,  543,  545,  548,  534,  549,  535,  550,  536,
-      551,  552,  553,  537,  555,  556,  538,  557,  539,  540,
-      546,  559,  541,  560,  542,  561,  562,  544,  547,  543,
-
-      545,  548,  563,  549,  564,  550,  565,  551,  552,  553,
-      566,  555,  556,  567,  557,  568,  569,  546,  559,  570,
-      560,  571,  561,  562,  572,  573,  575,  576,  577,  563,
-      578,  564,  579,  565,  580,  574,  581,  566,  584,  585,
-      567,  586,  568,  569,  587,  588,  570,  589,  571,  590,
-      591,  572,  573,  575,  576,  577,  597,  578,  593,  579,
-      592,  580,  574,  581,  595,  584,  585,  598,  586,  599,
-      594,  587,  588,  600,  589,  601,  590,  591,  596,  602,
-      603,  604,  605,  597,  608,  593,  606,  592,  609,  610,
-      611,  595,  612,  607,  598,  613,  599,  594,  615,  617,
-
-      600,  618,  601,  622,  616,  596,  602,  603,  604,  605,
-      620,  608,  619,  606,  623,  609,  610,  611,  624,  612,
-      607,  625,  613,  626,  629,  615,  617,  621,  618,  627,
-      622,  616,  628,  630,  631,  632,  633,  620,  634,  619,
-      635,  623,  636,  637,  638,  624,  639,  641,  625,  646,
-      626,  629,  647,  649,  621,  650,  627,  651,  652,  628,
-      630,  631,  632,  633,  653,  634,  654,  635,  643,  636,
-      637,  638,  644,  639,  641,  655,  646,  656,  645,  647,
-      649,  657,  650,  658,  651,  652,  659,  660,  661,  663,
-      664,  653,  665,  654,  666,  643,  668,  670,  671,  644,
-
-      672,  673,  655,  674,  656,  645,  675,  678,  657,  679,
-      658,  676,  680,  659,  660,  661,  663,  664,  681,  665,
-      682,  666,  683,  668,  670,  671,  684,  672,  673,  677,
-      674,  685,  686,  675,  678,  687,  679,  688,  676,  680,
-      689,  690,  692,  694,  695,  681,  696,  682,  697,  683,
-      698,  700,  701,  684,  702,  703,  704,  706,  685,  686,
-      708,  709,  687,  714,  688,  715,  710,  689,  690,  692,
-      694,  695,  716,  696,  711,  697,  717,  698,  700,  701,
-      718,  702,  703,  704,  706,  712,  713,  708,  709,  719,
-      714,  720,  715,  710,  721,  722,  723,  724,  725,  716,
-
-      726,  711,  727,  717,  728,  729,  730,  718,  731,  732,
-      733,  734,  712,  713,  735,  736,  719,  738,  720,  739,
-      740,  721,  722,  723,  724,  725,  741,  726,  742,  727,
-      743,  728,  729,  730,  744,  731,  732,  733,  734,  745,
-      746,  735,  736,  747,  738,  749,  739,  740,  750,  751,
-      752,  753,  754,  741,  755,  742,  756,  743,  757,  758,
-      759,  744,  760,  761,  762,  763,  745,  746,  764,  765,
-      747,  766,  749,  768, 1209,  750,  751,  752,  753,  754,
-     1194,  755, 1187,  756, 1183,  757,  758,  759,  776,  760,
-      761,  762,  763,  779,  780,  764,  765,  781,  766,  782,
-
-      768,  769,  783,  784,  785,  770,  786,  771,  788,  772,
-      789,  773,  774,  790,  791,  776,  792,  775,  793,  794,
-      779,  780,  795,  796,  781,  797,  782,  798,  769,  783,
-      784,  785,  770,  786,  771,  788,  772,  789,  773,  774,
-      790,  791,  799,  792,  775,  793,  794,  800,  801,  795,
-      796,  802,  797,  804,  798,  806,  808,  809,  810,  811,
-      812,  814,  815,  816,  817,  818,  819,  820,  821,  799,
-      822,  823,  824,  825,  800,  801,  826,  827,  802,  828,
-      804,  829,  806,  808,  809,  810,  811,  812,  814,  815,
-      816,  817,  818,  819,  820,  821,  830,  822,  823,  824,
-
-      825,  831,  832,  826,  827,  833,  828,  834,  829,  835,
-      836,  837,  838,  839,  840,  841,  842,  843,  844,  845,
-      846,  847,  849,  830,  851,  852,  853,  854,  831,  832,
-      855,  856,  833,  857,  834,  858,  835,  836,  837,  838,
-      839,  840,  841,  842,  843,  844,  845,  846,  847,  849,
-      859,  851,  852,  853,  854,  860,  861,  855,  856,  862,
-      857,  863,  858,  864,  865,  866,  867,  868,  869,  870,
-      871,  872,  873,  874,  875,  876,  877,  859,  878,  880,
-      888,  889,  860,  861,  890,  892,  862,  893,  863,  879,
-      864,  865,  866,  867,  868,  869,  870,  871,  872,  873,
-
-      874,  875,  876,  877,  895,  878,  880,  888,  889,  896,
-      900,  890,  892,  901,  893,  902,  879,  903,  904,  905,
-      906,  907,  908,  909,  914,  911,  918,  919, 1157,  912,
-      920,  895,  913,  921,  922,  923,  896,  900,  915,  924,
-      901,  925,  902,  916,  903,  904,  905,  906,  907,  908,
-      909,  914,  911,  918,  919,  917,  912,  920,  926,  913,
-      921,  922,  923,  927,  928,  915,  924,  929,  925,  930,
-      916,  931,  932,  933,  934,  935,  936,  937,  938,  939,
-      940,  941,  917,  942,  944,  926,  945,  947,  948,  949,
-      927,  928,  950,  951,  929,  952,  930,  953,  931,  932,
-
-      933,  934,  935,  936,  937,  938,  939,  940,  941,  954,
-      942,  944,  957,  945,  947,  948,  949,  955,  958,  950,
-      951,  959,  952,  960,  953,  961,  962,  956,  963,  964,
-      965,  966,  967,  968,  969,  970,  954,  971,  972,  957,
-      973,  974,  975,  976,  955,  958,  977,  978,  959,  979,
-      960,  980,  961,  962,  956,  963,  964,  965,  966,  967,
-      968,  969,  970,  981,  971,  972,  982,  973,  974,  975,
-      976,  983,  984,  977,  978,  985,  979,  986,  980,  987,
-      988,  989,  990,  991,  993,  994,  995,  996,  997,  998,
-      981,  999, 1000,  982, 1005, 1006, 1009, 1011,  983,  984,
-
-     1012, 1013,  985, 1014,  986, 1015,  987,  988,  989,  990,
-      991,  993,  994,  995,  996,  997,  998, 1016,  999, 1000,
-     1017, 1005, 1006, 1009, 1011, 1018, 1019, 1012, 1013, 1020,
-     1014, 1022, 1015, 1023, 1024, 1025, 1026, 1027, 1028, 1030,
-     1032, 1034, 1035, 1031, 1016, 1036, 1037, 1017, 1038, 1040,
-     1041, 1042, 1018, 1019, 1043, 1044, 1020, 1045, 1022, 1049,
-     1023, 1024, 1025, 1026, 1027, 1028, 1030, 1032, 1034, 1035,
-     1031, 1046, 1036, 1037, 1050, 1038, 1040, 1041, 1042, 1052,
-     1047, 1043, 1044, 1053, 1045, 1054, 1049, 1055, 1048, 1056,
-     1057, 1058, 1059, 1061, 1063, 1064, 1065, 1066, 1046, 1067,
-
-     1068, 1050, 1069, 1070, 1071, 1072, 1052, 1047, 1073, 1074,
-     1053, 1075, 1054, 1076, 1055, 1048, 1056, 1057, 1058, 1059,
-     1061, 1063, 1064, 1065, 1066, 1077, 1067, 1068, 1078, 1069,
-     1070, 1071, 1072, 1079, 1080, 1073, 1074, 1081, 1075, 1082,
-     1076, 1083, 1084, 1085, 1086, 1087, 1088, 1090, 1091, 1092,
-     1093, 1094, 1077, 1095, 1096, 1078, 1097, 1098, 1099, 1100,
-     1079, 1080, 1101, 1089, 1081, 1102, 1082, 1103, 1083, 1084,
-     1085, 1086, 1087, 1088, 1090, 1091, 1092, 1093, 1094, 1104,
-     1095, 1096, 1105, 1097, 1098, 1099, 1100, 1106, 1107, 1101,
-     1089, 1108, 1102, 1109, 1103, 1110, 1111, 1112, 1113, 1114,
-
-     1115, 1116, 1117, 1118, 1119, 1120, 1104, 1121, 1122, 1105,
-     1123, 1124, 1125, 1127, 1106, 1107, 1128, 1129, 1108, 1130,
-     1109, 1131, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
-     1118, 1119, 1120, 1132, 1121, 1122, 1133, 1123, 1124, 1125,
-     1127, 1134, 1135, 1128, 1129, 1136, 1130, 1137, 1131, 1138,
-     1139, 1140, 1141, 1142, 1143, 1145, 1146, 1147, 1148, 1149,
-     1132, 1150, 1151, 1133, 1152, 1153, 1154, 1155, 1134, 1135,
-     1156, 1158, 1136, 1159, 1137, 1160, 1138, 1139, 1140, 1141,
-     1142, 1143, 1145, 1146, 1147, 1148, 1149, 1161, 1150, 1151,
-     1162, 1152, 1153, 1154, 1155, 1163, 1164, 1156, 1158, 1165,
-
-     1159, 1166, 1160, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-     1174, 1175, 1176, 1177, 1161, 1178, 1179, 1162, 1180, 1181,
-     1182, 1184, 1163, 1164, 1185, 1186, 1165, 1188, 1166, 1189,
-     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
-     1177, 1190, 1178, 1179, 1191, 1180, 1181, 1182, 1184, 1192,
-     1193, 1185, 1186, 1195, 1188, 1196, 1189, 1197, 1199, 1200,
-     1201, 1202, 1203, 1204, 1205, 1198, 1206, 1207, 1190, 1208,
-     1210, 1191, 1211, 1212, 1213, 1214, 1192, 1193, 1215, 1216,
-     1195, 1217, 1196, 1218, 1197, 1199, 1200, 1201, 1202, 1203,
-     1204, 1205, 1219, 1206, 1207, 1220, 1208, 1210, 1221, 1211,
-
-     1212, 1213, 1214, 1223, 1222, 1215, 1216, 1224, 1217, 1225,
-     1218, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1219,
-     1236, 1237, 1220, 1238, 1239, 1221, 1240, 1241, 1242, 1243,
-     1223, 1222, 1244, 1245, 1224, 1246, 1225, 1247, 1227, 1228,
-     1229, 1230, 1231, 1232, 1233, 1234, 1248, 1236, 1237, 1249,
-     1238, 1239, 1250, 1240, 1241, 1242, 1243, 1251, 1252, 1244,
-     1245, 1253, 1246, 1254, 1247, 1255, 1256, 1257, 1258, 1260,
-     1262, 1263, 1264, 1248, 1265, 1266, 1249, 1267, 1268, 1250,
-     1269, 1272, 1274, 1275, 1251, 1252, 1276, 1278, 1253, 1279,
-     1254, 1280, 1255, 1256, 1257, 1258, 1260, 1262, 1263, 1264,
-
-     1281, 1265, 1266, 1282, 1267, 1268, 1283, 1269, 1272, 1274,
-     1275, 1284, 1285, 1276, 1278, 1286, 1279, 1287, 1280, 1288,
-     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1281, 1297, 1299,
-     1282, 1300, 1307, 1283, 1308, 1309, 1310, 1311, 1284, 1285,
-     1312, 1313, 1286, 1314, 1287, 1315, 1288, 1290, 1291, 1292,
-     1293, 1294, 1295, 1296, 1316, 1297, 1299, 1317, 1300, 1307,
-     1319, 1308, 1309, 1310, 1311, 1321, 1322, 1312, 1313, 1323,
-     1314, 1324, 1315, 1325, 1326, 1328, 1329, 1320, 1330, 1331,
-     1333, 1316, 1335, 1336, 1317, 1339, 1340, 1319, 1341, 1342,
-     1343, 1337, 1321, 1322, 1344, 1345, 1323, 1347, 1324, 1348,
-
-     1325, 1326, 1328, 1329, 1320, 1330, 1331, 1333, 1338, 1335,
-     1336, 1349, 1339, 1340, 1350, 1341, 1342, 1343, 1337, 1351,
-     1352, 1344, 1345, 1353, 1347, 1354, 1348, 1355, 1356, 1357,
-     1358, 1359, 1360, 1361, 1362, 1338, 1363, 1364, 1349, 1366,
-     1367, 1350, 1368, 1369, 1371, 1372, 1351, 1352, 1373, 1374,
-     1353, 1375, 1354, 1376, 1355, 1356, 1357, 1358, 1359, 1360,
-     1361, 1362, 1377, 1363, 1364, 1380, 1366, 1367, 1384, 1368,
-     1369, 1371, 1372, 1385, 1386, 1373, 1374, 1381, 1375, 1382,
-     1376, 1387, 1389, 1390, 1391, 1393, 1394, 1395, 1396, 1377,
-     1397, 1398, 1380, 1399, 1400, 1384, 1403, 1401, 1388, 1404,
-
-     1385, 1386, 1402, 1405, 1381, 1406, 1382, 1407, 1387, 1389,
-     1390, 1391, 1393, 1394, 1395, 1396, 1408, 1397, 1398, 1410,
-     1399, 1400, 1411, 1403, 1401, 1388, 1404, 1412, 1413, 1402,
-     1405, 1414, 1406, 1415, 1407, 1416, 1417, 1418, 1419, 1420,
-     1421, 1423, 1426, 1408, 1427, 1428, 1410, 1429, 1430, 1411,
-     1431, 1432, 1433, 1434, 1412, 1413, 1435, 1436, 1414, 1437,
-     1415, 1438, 1416, 1417, 1418, 1419, 1420, 1421, 1423, 1426,
-     1439, 1427, 1428, 1440, 1429, 1430, 1441, 1431, 1432, 1433,
-     1434, 1443, 1444, 1435, 1436, 1445, 1437, 1446, 1438, 1447,
-     1449, 1450, 1451, 1452, 1453, 1456, 1458, 1439, 1459, 1460,
-
-     1440, 1461, 1462, 1441, 1463, 1464, 1465, 1466, 1443, 1444,
-     1467, 1469, 1445, 1470, 1446, 1471, 1447, 1449, 1450, 1451,
-     1452, 1453, 1456, 1458, 1472, 1459, 1460, 1473, 1461, 1462,
-     1474, 1463, 1464, 1465, 1466, 1475, 1476, 1467, 1469, 1477,
-     1470, 1478, 1471, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
-     1486, 1472, 1487, 1488, 1473, 1489, 1490, 1474, 1491, 1492,
-     1493, 1494, 1475, 1476, 1495, 1496, 1477, 1497, 1478, 1498,
-     1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1499, 1487,
-     1488, 1500, 1489, 1490, 1501, 1491, 1492, 1493, 1494, 1502,
-     1503, 1495, 1496, 1504, 1497, 1505, 1498, 1506, 1507, 1508,
-
-     1509, 1510, 1511, 1512, 1513, 1499, 1514, 1515, 1500, 1516,
-     1517, 1501, 1518, 1519, 1520, 1521, 1502, 1503, 1522, 1523,
-     1504, 1524, 1505, 1525, 1506, 1507, 1508, 1509, 1510, 1511,
-     1512, 1513, 1526, 1514, 1515, 1527, 1516, 1517, 1528, 1518,
-     1519, 1520, 1521, 1529, 1530, 1522, 1523, 1531, 1524, 1532,
-     1525, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1526,
-     1541, 1542, 1527, 1544, 1545, 1528, 1546, 1547, 1548, 1549,
-     1529, 1530, 1550, 1551, 1531, 1552, 1532, 1553, 1533, 1534,
-     1535, 1536, 1537, 1538, 1539, 1540, 1554, 1541, 1542, 1555,
-     1544, 1545, 1556, 1546, 1547, 1548, 1549, 1557, 1558, 1550,
-
-     1551, 1559, 1552, 1560, 1553, 1561, 1562, 1564, 1565, 1566,
-     1567, 1568, 1569, 1554, 1571, 1572, 1555, 1573, 1574, 1556,
-     1575, 1576, 1577, 1578, 1557, 1558, 1579, 1580, 1559, 1570,
-     1560, 1581, 1561, 1562, 1564, 1565, 1566, 1567, 1568, 1569,
-     1582, 1571, 1572, 1583, 1573, 1574, 1584, 1575, 1576, 1577,
-     1578, 1585, 1586, 1579, 1580, 1587, 1570, 1588, 1581, 1589,
-     1590, 1591, 1592, 1593, 1594, 1595, 1596, 1582, 1597, 1598,
-     1583, 1599, 1600, 1584, 1601, 1602, 1603, 1604, 1585, 1586,
-     1605, 1606, 1587, 1607, 1588, 1608, 1589, 1590, 1591, 1592,
-     1593, 1594, 1595, 1596, 1609, 1597, 1598, 1610, 1599, 1600,
-
-     1611, 1601, 1602, 1603, 1604, 1613, 1614, 1605, 1606, 1615,
-     1607, 1616, 1608, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
-     1624, 1609, 1625, 1626, 1610, 1627, 1628, 1611, 1629, 1630,
-     1631, 1632, 1613, 1614, 1144, 1126, 1615, 1004, 1616, 1004,
-     1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1002, 1625,
-     1626, 1002, 1627, 1628, 1062, 1629, 1630, 1631, 1632,   39,
-       39, 1060, 1051, 1039, 1033, 1029, 1021, 1010, 1008, 1007,
-     1004, 1002,  992,  946,  943,  910,  894,  891,  887,  886,
-      885,  884,  883,  882,  881,  850,  848,  813,  807,  805,
-      803,  787,  778,  777,  767,  748,  737,  707,  705,  699,
-
-      693,  691,  669,  667,  662,  648,  642,  640,  614,  583,
-      582,  558,  554,  531,  498,  487,  485,  476,  457,  453,
-      442,  429,  417,  411,  409,  379,  368,  333,  318,  280,
-      250,   37,   37, 1633,    3, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633
+      107,  108, 1398,  202,  194, 1397, 1389,  206,  195,  200,
+      104,  207,  196,  909, 1384,  910,  199, 1365,  105,  210,
+      197,  203,  201,  911,  106,  198,  213,  107,  108,  113,
+      202,  204,  114,  115,  206,  116,  200,  205,  207,  117,
+
+      118,  119,  208,  120,  121, 1352,  210,  219,  203,  201,
+      211, 1350, 1345,  213,  220, 1336,  113,  209,  204,  114,
+      115,  221,  116,  212,  205,  214,  117,  118,  119,  208,
+      120,  121,  122,  215,  219,  222,  223,  211,  216,  123,
+      224,  220,  124,  233,  209, 1324, 1323,  242,  221, 1322,
+      125, 1321,  214,  243,  217,  218,  126, 1320, 1319,  122,
+      215,  234,  222,  223,  240,  216,  123,  224,  246,  124,
+      233,  247,  235,  238,  242, 1316,  236,  125,  237,  248,
+      243,  217,  218,  126,  158,  159,  241,  239,  234,  160,
+      249,  240,  250,  251,  244,  246,  253,  161,  247,  235,
+
+      238,  254,  162,  236,  245,  237,  248,  261,  262,  267,
+     1307,  158,  159,  241,  239, 1294,  160,  249,  268,  250,
+      251,  244,  265,  253,  161,  266,  271,  272,  254,  162,
+      225,  245,  226,  227,  261,  262,  267,  228,  263,  229,
+      269,  273,  230,  274,  264,  268,  275,  278,  231,  265,
+      232, 1290,  266,  271,  272,  279,  276,  225,  270,  226,
+      227, 1288, 1287,  277,  228,  263,  229,  269,  273,  230,
+      274,  264,  280,  275,  278,  231,  281,  232,  255,  283,
+      284,  256,  279,  276,  285,  270,  286,  287,  257,  258,
+      277,  288,  289,  290,  291,  259,  292,  293,  294,  280,
+
+      295,  260,  296,  281,  297,  255,  283,  284,  256,  298,
+      299,  285,  300,  286,  287,  257,  258,  301,  288,  289,
+      290,  291,  259,  292,  293,  294,  302,  295,  260,  296,
+      303,  297,  304,  305,  306,  307,  298,  299,  308,  300,
+      311,  309,  312,  313,  301,  314,  315,  316,  317,  318,
+      319,  321,  322,  302,  310,  325,  326,  303,  329,  304,
+      305,  306,  307,  327,  330,  308,  328,  311,  309,  312,
+      313,  331,  314,  315,  316,  317,  318,  319,  321,  322,
+      332,  310,  325,  326,  333,  329,  334,  336,  337,  338,
+      327,  330,  341,  328,  339,  342,  343,  344,  331,  345,
+
+      340,  346,  347,  348,  349,  350,  352,  332,  353,  354,
+      351,  333,  355,  334,  336,  337,  338,  356,  357,  341,
+      358,  339,  342,  343,  344,  359,  345,  360,  346,  347,
+      348,  349,  350,  352,  361,  353,  354,  351,  362,  355,
+      363,  364,  365,  366,  356,  357,  367,  358,  368,  369,
+      371,  370,  359,  373,  360,  374,  375,  376,  377,  378,
+      379,  361,  380,  381,  382,  362,  384,  363,  364,  365,
+      366,  385,  386,  367,  387,  368,  369,  371,  370,  390,
+      373,  391,  374,  375,  376,  377,  378,  379,  392,  380,
+      381,  382,  388,  384,  393,  394,  395,  396,  385,  386,
+
+      397,  387,  389,  398,  400,  401,  390,  402,  391,  403,
+      404,  405,  399,  407,  408,  392,  409,  410,  411,  388,
+      412,  393,  394,  395,  396,  406,  414,  397,  416,  389,
+      398,  400,  401,  417,  402,  418,  403,  404,  405,  419,
+      407,  408,  420,  409,  410,  411,  422,  412,  423,  424,
+      425,  426,  406,  414,  427,  416,  428,  429,  430,  431,
+      417,  432,  418,  434,  435,  436,  419,  437,  438,  420,
+      439,  440,  441,  422,  442,  423,  424,  425,  426,  443,
+      444,  427,  445,  428,  429,  430,  431,  447,  432,  451,
+      434,  435,  436, 1278,  437,  438,  448,  439,  440,  441,
+
+      452,  442,  449,  453,  454,  455,  443,  444,  456,  445,
+      458,  459,  460,  462,  447,  463,  451,  464, 1276, 1252,
+      450,  472,  473,  448,  474,  475, 1243,  452,  476,  449,
+      453,  454,  455,  477,  478,  456,  479,  458,  459,  460,
+      462,  480,  463,  482,  464,  465,  466,  467,  472,  473,
+      483,  474,  475,  468,  484,  476,  485,  486,  469,  491,
+      477,  478,  493,  479,  470,  494,  495,  471,  480,  487,
+      482,  496,  465,  466,  467,  497,  498,  483,  499,  500,
+      468,  484,  501,  485,  486,  469,  491,  488,  502,  493,
+      504,  470,  494,  495,  471,  489,  487,  505,  496,  506,
+
+      507,  512,  497,  498,  509,  499,  500,  513,  510,  501,
+      508,  514,  515,  511,  488,  502,  516,  504,  517,  518,
+      519,  521,  522,  523,  505,  524,  506,  507,  512,  520,
+      525,  509,  526,  527,  513,  510,  528,  529,  514,  515,
+      511,  530,  531,  516,  532,  517,  518,  519,  521,  522,
+      523,  533,  524,  534,  535,  536,  520,  525,  538,  526,
+      527,  539,  540,  528,  529,  541,  542,  543,  530,  531,
+      544,  532,  545,  546,  547,  550, 1225,  553,  533,  548,
+      534,  535,  536,  554,  549,  538,  551,  555,  539,  540,
+      556,  557,  541,  542,  543,  558,  559,  544,  561,  545,
+
+      546,  547,  550,  552,  553,  562,  548,  563,  565,  566,
+      554,  549,  567,  551,  555,  568,  569,  556,  557,  570,
+      571,  572,  558,  559,  573,  561,  574,  575,  576,  577,
+      552,  578,  562,  581,  563,  565,  566,  582,  583,  567,
+      579,  584,  568,  569,  585,  586,  570,  571,  572,  587,
+      580,  573,  590,  574,  575,  576,  577,  591,  578,  592,
+      581,  593,  594,  595,  582,  583,  596,  579,  584,  599,
+      597,  585,  586,  601,  603,  604,  587,  580,  605,  590,
+      598,  600,  606,  607,  591,  608,  592,  602,  593,  594,
+      595,  609,  610,  596,  611,  612,  599,  597,  615,  613,
+
+      601,  603,  604,  616,  617,  605,  614,  598,  600,  606,
+      607,  618,  608,  619,  602,  620,  624,  622,  609,  610,
+      627,  611,  612,  623,  625,  615,  613,  629,  630,  631,
+      616,  617,  632,  614,  633,  626,  634,  628,  618,  635,
+      619,  636,  620,  624,  622,  637,  638,  627,  639,  640,
+      623,  625,  641,  642,  629,  630,  631,  643,  644,  632,
+      645,  633,  626,  634,  628,  646,  635,  647,  636,  649,
+      654,  655,  637,  638,  657,  639,  640,  658,  651,  641,
+      642,  659,  652,  660,  643,  644,  661,  645,  653,  662,
+      663,  664,  646,  665,  647,  666,  649,  654,  655,  667,
+
+      668,  657,  669,  671,  658,  651,  672,  673,  659,  652,
+      660,  674,  676,  661,  678,  653,  662,  663,  664,  679,
+      665,  680,  666,  681,  682,  683,  667,  668,  686,  669,
+      671,  684,  687,  672,  673,  688,  689,  690,  674,  676,
+      691,  678,  692,  693,  694,  695,  679,  696,  680,  685,
+      681,  682,  683,  697,  698,  686,  700,  702,  684,  687,
+      703,  704,  688,  689,  690,  705,  706,  691,  708,  692,
+      693,  694,  695,  709,  696,  710,  711,  712,  714,  716,
+      697,  698,  717,  700,  702,  722,  718,  703,  704,  720,
+      721,  723,  705,  706,  719,  708,  724,  725,  726,  727,
+
+      709,  728,  710,  711,  712,  714,  716,  729,  730,  717,
+      731,  732,  722,  718,  733,  734,  720,  721,  723,  735,
+      736,  719,  737,  724,  725,  726,  727,  738,  728,  739,
+      740,  741,  742,  743,  729,  730,  744,  731,  732,  745,
+      747,  733,  734,  748,  749,  750,  735,  736,  751,  737,
+      752,  753,  754,  755,  738,  756,  739,  740,  741,  742,
+      743,  758,  759,  744,  760,  761,  745,  747,  762,  763,
+      748,  749,  750,  764,  765,  751,  766,  752,  753,  754,
+      755,  769,  756,  767,  768,  770,  771,  772,  758,  759,
+      773,  760,  761,  774,  775,  762,  763,  776,  778, 1210,
+
+      764,  765,  786,  766,  789, 1203,  790, 1199,  769, 1173,
+      767,  768,  770,  771,  772, 1160,  791,  773,  792,  793,
+      774,  775,  794,  795,  776,  778,  779,  796,  798,  786,
+      780,  789,  781,  790,  782,  799,  783,  784,  800,  801,
+      802,  803,  785,  791,  804,  792,  793,  805,  806,  794,
+      795,  807,  808,  779,  796,  798,  809,  780,  810,  781,
+      811,  782,  799,  783,  784,  800,  801,  802,  803,  785,
+      812,  804,  814,  816,  805,  806,  818,  819,  807,  808,
+      820,  821,  822,  809,  824,  810,  825,  811,  826,  827,
+      828,  829,  830,  831,  832, 1141, 1018,  812,  836,  814,
+
+      816,  837,  838,  818,  819,  839,  840,  820,  821,  822,
+      841,  824,  842,  825,  843,  826,  827,  828,  829,  830,
+      831,  832,  833,  834,  835,  836,  844,  845,  837,  838,
+      846,  847,  839,  840,  848,  849,  850,  841,  851,  842,
+      852,  843,  853,  855,  856,  857,  858,  860,  862,  833,
+      834,  835,  863,  844,  845,  864,  865,  846,  847,  866,
+      867,  848,  849,  850,  868,  851,  869,  852,  870,  853,
+      855,  856,  857,  858,  860,  862,  871,  872,  873,  863,
+      874,  875,  864,  865,  876,  877,  866,  867,  878,  879,
+      880,  868,  881,  869,  882,  870,  883,  884,  885,  886,
+
+      887,  888,  889,  871,  872,  873,  892,  874,  875,  890,
+      900,  876,  877,  901,  902,  878,  879,  880,  904,  881,
+      891,  882,  905,  883,  884,  885,  886,  887,  888,  889,
+      907,  908,  912,  892,  913,  914,  890,  900,  915,  916,
+      901,  902,  917,  918,  919,  904,  920,  891,  921,  905,
+      926,  930,  931,  932,  933,  934,  923,  907,  908,  912,
+      924,  913,  914,  925,  935,  915,  916,  927,  936,  917,
+      918,  919,  928,  920,  937,  921,  938,  926,  930,  931,
+      932,  933,  934,  923,  929,  939,  940,  924,  941,  942,
+      925,  935,  943,  944,  927,  936,  945,  946,  947,  928,
+
+      948,  937,  949,  938,  950,  951,  952,  953,  954,  956,
+      957,  929,  939,  940,  959,  941,  942,  960,  961,  943,
+      944,  962,  963,  945,  946,  947,  964,  948,  965,  949,
+      966,  950,  951,  952,  953,  954,  956,  957,  967,  970,
+      968,  959,  971,  972,  960,  961,  973,  974,  962,  963,
+      969,  975,  976,  964,  977,  965,  978,  966,  979,  980,
+      981,  982,  983,  984,  985,  967,  970,  968,  986,  971,
+      972,  987,  988,  973,  974,  989,  990,  969,  975,  976,
+      991,  977,  992,  978,  993,  979,  980,  981,  982,  983,
+      984,  985,  994,  995,  996,  986,  997,  998,  987,  988,
+
+      999, 1000,  989,  990, 1001, 1002, 1003,  991, 1004,  992,
+     1005,  993, 1007, 1008, 1009, 1010, 1011, 1012, 1013,  994,
+      995,  996, 1014,  997,  998, 1019, 1020,  999, 1000, 1023,
+     1025, 1001, 1002, 1003, 1026, 1004, 1027, 1005, 1028, 1007,
+     1008, 1009, 1010, 1011, 1012, 1013, 1029, 1030, 1031, 1014,
+     1032, 1033, 1019, 1020, 1034, 1036, 1023, 1025, 1037, 1038,
+     1039, 1026, 1040, 1027, 1041, 1028, 1042, 1044, 1046, 1048,
+     1049, 1045, 1050, 1029, 1030, 1031, 1051, 1032, 1033, 1052,
+     1054, 1034, 1036, 1055, 1056, 1037, 1038, 1039, 1057, 1040,
+     1058, 1041, 1059, 1042, 1044, 1046, 1048, 1049, 1045, 1050,
+
+     1063, 1064, 1066, 1051, 1060, 1067, 1052, 1054, 1068, 1069,
+     1055, 1056, 1070, 1061, 1071, 1057, 1072, 1058, 1073, 1059,
+     1074, 1062, 1076, 1078, 1079, 1080, 1081, 1063, 1064, 1066,
+     1082, 1060, 1067, 1083, 1084, 1068, 1069, 1085, 1086, 1070,
+     1061, 1071, 1087, 1072, 1088, 1073, 1089, 1074, 1062, 1076,
+     1078, 1079, 1080, 1081, 1090, 1091, 1092, 1082, 1093, 1094,
+     1083, 1084, 1095, 1096, 1085, 1086, 1097, 1098, 1099, 1087,
+     1100, 1088, 1101, 1089, 1102, 1103, 1105, 1106, 1107, 1108,
+     1109, 1090, 1091, 1092, 1110, 1093, 1094, 1111, 1112, 1095,
+     1096, 1113, 1104, 1097, 1098, 1099, 1114, 1100, 1115, 1101,
+
+     1116, 1102, 1103, 1105, 1106, 1107, 1108, 1109, 1117, 1118,
+     1119, 1110, 1120, 1121, 1111, 1112, 1122, 1123, 1113, 1104,
+     1124, 1125, 1126, 1114, 1127, 1115, 1128, 1116, 1129, 1130,
+     1131, 1132, 1133, 1134, 1135, 1117, 1118, 1119, 1136, 1120,
+     1121, 1137, 1138, 1122, 1123, 1139, 1140, 1124, 1125, 1126,
+     1142, 1127, 1143, 1128, 1144, 1129, 1130, 1131, 1132, 1133,
+     1134, 1135, 1145, 1146, 1147, 1136, 1148, 1149, 1137, 1138,
+     1150, 1151, 1139, 1140, 1152, 1153, 1154, 1142, 1155, 1143,
+     1156, 1144, 1157, 1158, 1159, 1161, 1162, 1163, 1164, 1145,
+     1146, 1147, 1165, 1148, 1149, 1166, 1167, 1150, 1151, 1168,
+
+     1169, 1152, 1153, 1154, 1170, 1155, 1171, 1156, 1172, 1157,
+     1158, 1159, 1161, 1162, 1163, 1164, 1174, 1175, 1176, 1165,
+     1177, 1178, 1166, 1167, 1179, 1180, 1168, 1169, 1181, 1182,
+     1183, 1170, 1184, 1171, 1185, 1172, 1186, 1187, 1188, 1189,
+     1190, 1191, 1192, 1174, 1175, 1176, 1193, 1177, 1178, 1194,
+     1195, 1179, 1180, 1196, 1197, 1181, 1182, 1183, 1198, 1184,
+     1200, 1185, 1201, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+     1202, 1204, 1205, 1193, 1206, 1207, 1194, 1195, 1208, 1209,
+     1196, 1197, 1211, 1212, 1213, 1198, 1215, 1200, 1216, 1201,
+     1217, 1218, 1214, 1219, 1220, 1221, 1222, 1202, 1204, 1205,
+
+     1223, 1206, 1207, 1224, 1226, 1208, 1209, 1227, 1228, 1211,
+     1212, 1213, 1229, 1215, 1230, 1216, 1231, 1217, 1218, 1232,
+     1219, 1220, 1221, 1222, 1233, 1234, 1235, 1223, 1236, 1237,
+     1224, 1226, 1238, 1240, 1227, 1228, 1241, 1242, 1239, 1229,
+     1244, 1230, 1245, 1231, 1246, 1247, 1232, 1248, 1249, 1250,
+     1251, 1233, 1234, 1235, 1253, 1236, 1237, 1254, 1255, 1238,
+     1240, 1256, 1257, 1241, 1242, 1239, 1258, 1244, 1259, 1245,
+     1260, 1246, 1247, 1261, 1248, 1249, 1250, 1251, 1262, 1263,
+     1264, 1253, 1265, 1266, 1254, 1255, 1267, 1268, 1256, 1257,
+     1269, 1270, 1271, 1258, 1272, 1259, 1273, 1260, 1274, 1275,
+
+     1261, 1277, 1279, 1280, 1281, 1262, 1263, 1264, 1282, 1265,
+     1266, 1283, 1284, 1267, 1268, 1285, 1286, 1269, 1270, 1271,
+     1289, 1272, 1291, 1273, 1292, 1274, 1275, 1293, 1277, 1279,
+     1280, 1281, 1295, 1296, 1297, 1282, 1298, 1299, 1283, 1284,
+     1300, 1301, 1285, 1286, 1302, 1303, 1304, 1289, 1305, 1291,
+     1306, 1292, 1308, 1309, 1293, 1310, 1311, 1312, 1313, 1295,
+     1296, 1297, 1314, 1298, 1299, 1315, 1317, 1300, 1301, 1318,
+     1325, 1302, 1303, 1304, 1326, 1305, 1327, 1306, 1328, 1308,
+     1309, 1329, 1310, 1311, 1312, 1313, 1330, 1331, 1332, 1314,
+     1333, 1334, 1315, 1317, 1335, 1337, 1318, 1325, 1339, 1340,
+
+     1341, 1326, 1342, 1327, 1343, 1328, 1344, 1346, 1329, 1347,
+     1348, 1349, 1338, 1330, 1331, 1332, 1351, 1333, 1334, 1353,
+     1354, 1335, 1337, 1355, 1357, 1339, 1340, 1341, 1358, 1342,
+     1359, 1343, 1360, 1344, 1346, 1361, 1347, 1348, 1349, 1338,
+     1356, 1362, 1363, 1351, 1364, 1366, 1353, 1354, 1367, 1368,
+     1355, 1357, 1369, 1370, 1371, 1358, 1372, 1359, 1373, 1360,
+     1374, 1375, 1361, 1376, 1377, 1378, 1379, 1356, 1362, 1363,
+     1380, 1364, 1366, 1381, 1382, 1367, 1368, 1383, 1385, 1369,
+     1370, 1371, 1386, 1372, 1387, 1373, 1388, 1374, 1375, 1390,
+     1376, 1377, 1378, 1379, 1391, 1392, 1393, 1380, 1394, 1395,
+
+     1381, 1382, 1396, 1399, 1383, 1385, 1400, 1403, 1401, 1386,
+     1404, 1387, 1405, 1388, 1406, 1408, 1390, 1409, 1410, 1412,
+     1413, 1391, 1392, 1393, 1414, 1394, 1395, 1415, 1416, 1396,
+     1399, 1407, 1417, 1400, 1403, 1401, 1418, 1404, 1419, 1405,
+     1422, 1406, 1408, 1420, 1409, 1410, 1412, 1413, 1421, 1423,
+     1424, 1414, 1425, 1426, 1415, 1416, 1427, 1429, 1407, 1417,
+     1430, 1431, 1432, 1418, 1433, 1419, 1434, 1422, 1435, 1436,
+     1420, 1437, 1438, 1439, 1440, 1421, 1423, 1424, 1442, 1425,
+     1426, 1445, 1446, 1427, 1429, 1447, 1448, 1430, 1431, 1432,
+     1449, 1433, 1450, 1434, 1451, 1435, 1436, 1452, 1437, 1438,
+
+     1439, 1440, 1453, 1454, 1455, 1442, 1456, 1457, 1445, 1446,
+     1458, 1459, 1447, 1448, 1460, 1462, 1463, 1449, 1464, 1450,
+     1465, 1451, 1466, 1468, 1452, 1469, 1470, 1471, 1472, 1453,
+     1454, 1455, 1475, 1456, 1457, 1477, 1478, 1458, 1459, 1479,
+     1480, 1460, 1462, 1463, 1481, 1464, 1482, 1465, 1483, 1466,
+     1468, 1484, 1469, 1470, 1471, 1472, 1485, 1486, 1488, 1475,
+     1489, 1490, 1477, 1478, 1491, 1492, 1479, 1480, 1493, 1494,
+     1495, 1481, 1496, 1482, 1497, 1483, 1498, 1499, 1484, 1500,
+     1501, 1502, 1503, 1485, 1486, 1488, 1504, 1489, 1490, 1505,
+     1506, 1491, 1492, 1507, 1508, 1493, 1494, 1495, 1509, 1496,
+
+     1510, 1497, 1511, 1498, 1499, 1512, 1500, 1501, 1502, 1503,
+     1513, 1514, 1515, 1504, 1516, 1517, 1505, 1506, 1518, 1519,
+     1507, 1508, 1520, 1521, 1522, 1509, 1523, 1510, 1524, 1511,
+     1525, 1526, 1512, 1527, 1528, 1529, 1530, 1513, 1514, 1515,
+     1531, 1516, 1517, 1532, 1533, 1518, 1519, 1534, 1535, 1520,
+     1521, 1522, 1536, 1523, 1537, 1524, 1538, 1525, 1526, 1539,
+     1527, 1528, 1529, 1530, 1540, 1541, 1542, 1531, 1543, 1544,
+     1532, 1533, 1545, 1546, 1534, 1535, 1547, 1548, 1549, 1536,
+     1550, 1537, 1551, 1538, 1552, 1553, 1539, 1554, 1555, 1556,
+     1557, 1540, 1541, 1542, 1558, 1543, 1544, 1559, 1560, 1545,
+
+     1546, 1561, 1563, 1547, 1548, 1549, 1564, 1550, 1565, 1551,
+     1566, 1552, 1553, 1567, 1554, 1555, 1556, 1557, 1568, 1569,
+     1570, 1558, 1571, 1572, 1559, 1560, 1573, 1574, 1561, 1563,
+     1575, 1576, 1577, 1564, 1578, 1565, 1579, 1566, 1580, 1581,
+     1567, 1583, 1584, 1585, 1586, 1568, 1569, 1570, 1587, 1571,
+     1572, 1590, 1591, 1573, 1574, 1588, 1592, 1575, 1576, 1577,
+     1593, 1578, 1594, 1579, 1595, 1580, 1581, 1596, 1583, 1584,
+     1585, 1586, 1589, 1597, 1598, 1587, 1599, 1600, 1590, 1591,
+     1601, 1602, 1588, 1592, 1603, 1604, 1605, 1593, 1606, 1594,
+     1607, 1595, 1608, 1609, 1596, 1610, 1611, 1612, 1613, 1589,
+
+     1597, 1598, 1614, 1599, 1600, 1615, 1616, 1601, 1602, 1617,
+     1618, 1603, 1604, 1605, 1619, 1606, 1620, 1607, 1621, 1608,
+     1609, 1622, 1610, 1611, 1612, 1613, 1623, 1624, 1625, 1614,
+     1626, 1627, 1615, 1616, 1628, 1629, 1617, 1618, 1630, 1632,
+     1633, 1619, 1634, 1620, 1635, 1621, 1636, 1637, 1622, 1638,
+     1639, 1640, 1641, 1623, 1624, 1625, 1642, 1626, 1627, 1643,
+     1644, 1628, 1629, 1645, 1646, 1630, 1632, 1633, 1647, 1634,
+     1648, 1635, 1649, 1636, 1637, 1650, 1638, 1639, 1640, 1641,
+     1651, 1018, 1016, 1642, 1016, 1077, 1643, 1644, 1075, 1065,
+     1645, 1646, 1053, 1047, 1043, 1647, 1035, 1648, 1024, 1649,
+
+     1022, 1021, 1650, 1018, 1016, 1006,  958, 1651,   39,   39,
+      955,  922,  906,  903,  899,  898,  897,  896,  895,  894,
+      893,  861,  859,  854,  823,  817,  815,  813,  797,  788,
+      787,  777,  757,  746,  715,  713,  707,  701,  699,  677,
+      675,  670,  656,  650,  648,  621,  589,  588,  564,  560,
+      537,  503,  492,  490,  481,  461,  457,  446,  433,  421,
+      415,  413,  383,  372,  335,  320,  282,  252,   37,   37,
+     1652,    3, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652
     } ;
 
-static const flex_int16_t yy_chk[3202] =
+static const flex_int16_t yy_chk[3239] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1326,29 +1335,29 @@ static const flex_int16_t yy_chk[3202] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    7,    7,    9,   10,
        13,   10,   11,   11,   11,   16,   16,   21,   23,   26,
-       13,   17,   23,    9,   39,   39,   16, 1638,   23,   17,
-       28,   18,   17, 1637,   33, 1636,   35,   13,   18, 1634,
+       13,   17,   23,    9,   39,   39,   16, 1657,   23,   17,
+       28,   18,   17, 1656,   33, 1655,   35,   13,   18, 1653,
 
        36,   17,   16,   16,   21,   23,   26,   13,   17,   23,
         9,   12,   12,   16,   12,   23,   17,   28,   18,   17,
-       12,   33,   12,   35, 1604,   18,   20,   36,   17,   12,
-      789,   12,  789,   20, 1537,   20,   43,   19,   12,   12,
-      789,   12,   46,   46,   46,   19, 1513,   12, 1421,   12,
-       47,   19, 1410,   20, 1407,   48,   12,   19,   12,   14,
+       12,   33,   12,   35, 1623,   18,   20,   36,   17,   12,
+      799,   12,  799,   20, 1556,   20,   43,   19,   12,   12,
+      799,   12,   46,   46,   46,   19, 1532,   12, 1440,   12,
+       47,   19, 1429,   20, 1426,   48,   12,   19,   12,   14,
        20,   14,   20,   43,   19,   49,   14,   14,   50,   22,
        14,   29,   19,   14,   51,   29,   22,   47,   19,   22,
-       52,   22,   48,   14,   19, 1406,   14,   53,   14,   29,
+       52,   22,   48,   14,   19, 1425,   14,   53,   14,   29,
       187,  187,   49,   14,   14,   50,   22,   14,   29,   54,
 
        14,   51,   29,   22,   55,   57,   22,   52,   22,   58,
        14,   15,   32,   32,   53,   15,   29,   34,   32,   15,
-       59,   34,   15,   60,   34,   15,   54, 1399,   61,   61,
-     1391,   55,   57,   56, 1367,   56,   58,   60,   15,   32,
+       59,   34,   15,   60,   34,   15,   54, 1418,   61,   61,
+     1410,   55,   57,   56, 1386,   56,   58,   60,   15,   32,
        32,   62,   15,   60,   34,   32,   15,   59,   34,   15,
        60,   34,   15,   24,   24,   61,   61,   24,   63,   65,
        56,   24,   56,   66,   60,   67,   68,   24,   62,   69,
-       60,   72, 1353,   65,   71,   73, 1371, 1371,   74, 1336,
-       24,   24, 1328,   71,   24,   63,   65,   70,   24,   70,
+       60,   72, 1372,   65,   71,   73, 1390, 1390,   74, 1354,
+       24,   24, 1346,   71,   24,   63,   65,   70,   24,   70,
        66,   76,   67,   68,   24,   25,   69,   25,   72,   25,
 
        65,   71,   73,   25,   70,   74,   75,   77,   78,   25,
@@ -1357,320 +1366,323 @@ static const flex_int16_t yy_chk[3202] =
        25,   70,   89,   75,   77,   78,   25,   90,   79,   80,
        79,   91,   25,   27,   75,   91,   81,   82,   83,   93,
        84,   27,   85,   92,   86,   87,   88,   27,   92,   89,
-       27,   27, 1325,   94,   90, 1324, 1315,   95,   91,   97,
-       27,   98,   91,  897, 1309,  897,   93, 1288,   27,  100,
-       92,   96,  102,  897,   27,   92, 1274,   27,   27,   30,
-       94,   96,   30,   30,   95,   30,   97,   96,   98,   30,
-
-       30,   30,   99,   30,   30, 1272,  100,  105,   96,  102,
-      101,  106, 1266,  103,  107, 1257,   30,   99,   96,   30,
-       30,  103,   30,  101,   96, 1242,   30,   30,   30,   99,
-       30,   30,   31,  108,  105,  104,  109,  101,  106,   31,
-      103,  107,   31,  110,   99,  112,  115,  114,  103, 1241,
-       31,  104,  104, 1240,  116, 1239,   31, 1238, 1237,   31,
-      108,  114,  104,  109,  117,  113,   31,  119,  115,   31,
-      110,  120,  112,  115,  114, 1234,  113,   31,  104,  104,
-      113,  116,  113,   31,   64,   64,  118,  121,  114,   64,
-      122,  117,  113,  123,  119,  115,  118,   64,  120,  124,
-
-      126,  127,   64,  113,  129, 1223, 1208,  113,  130,  113,
-     1203,   64,   64,  118,  121, 1201,   64,  122,  133,  131,
-      123, 1200,  134,  118,   64,  131,  124,  126,  127,   64,
-      111,  129,  111,  111,  136,  130,  135,  111,  132,  111,
-      137,  132,  111,  138,  139,  133,  131,  141,  111,  134,
-      143,  142,  131,  144,  135,  145,  146,  111,  142,  111,
-      111,  136,  148,  135,  111,  132,  111,  137,  132,  111,
-      138,  139, 1189,  149,  141,  111,  128,  143,  142,  128,
-      144,  135,  145,  146,  150,  142,  128,  128,  151,  148,
-      152,  153,  154,  128,  155,  156,  157,  158,  159,  128,
-
-      149,  160,  161,  128,  162,  164,  128,  165,  166,  167,
-      168,  150,  169,  128,  128,  151,  170,  152,  153,  154,
-      128,  155,  156,  157,  158,  159,  128,  171,  160,  161,
-      172,  162,  164,  173,  165,  166,  167,  168,  174,  169,
-      175,  176,  177,  170,  178,  179,  180,  181,  181,  182,
-      183,  185,  186,  175,  171,  188,  189,  172,  190,  191,
-      173,  190,  192,  193,  194,  174,  195,  175,  176,  177,
-      197,  178,  179,  180,  181,  181,  182,  183,  185,  186,
-      175,  199,  188,  189,  200,  190,  191,  202,  190,  192,
-      193,  194,  201,  195,  203,  204,  205,  197,  201,  206,
-
-      207,  208,  209,  210,  211,  212,  213,  214,  199,  211,
-      215,  200,  216,  217,  202,  218,  219,  220,  221,  201,
-      222,  203,  204,  205,  223,  224,  206,  207,  208,  209,
-      210,  211,  212,  213,  214,  225,  211,  215,  226,  216,
-      217,  227,  218,  219,  220,  221,  229,  222,  230,  232,
-      230,  223,  224,  233,  234,  236,  237,  239,  240,  241,
-      242,  244,  225,  246,  247,  226,  248,  249,  227,  250,
-      251,  252,  253,  229,  254,  230,  232,  230,  255,  250,
-      233,  234,  236,  237,  239,  240,  241,  242,  244,  256,
-      246,  247,  257,  248,  249,  258,  250,  251,  252,  253,
-
-      259,  254,  260,  261,  262,  255,  250,  263,  264,  259,
-      265,  266,  267,  269,  270,  271,  256,  272,  275,  257,
-      278,  279,  258,  280,  265,  281,  282,  259,  284,  260,
-      261,  262,  285,  286,  263,  264,  287,  265,  266,  267,
-      269,  270,  271,  288,  272,  275,  289,  278,  279,  292,
-      280,  265,  281,  282,  293,  284,  295,  296,  297,  285,
-      286,  299,  300,  287,  301,  302,  303,  304,  305,  307,
-      288,  308,  310,  289,  311,  312,  292,  314,  317,  318,
-      319,  293,  324,  295,  296,  297,  320,  320,  299,  300,
-      326,  301,  302,  303,  304,  305,  307,  315,  308,  310,
-
-      327,  311,  312,  315,  314,  317,  318,  319,  328,  324,
-      330,  331,  332,  320,  320, 1186,  334,  326,  335,  336,
-      337,  315,  338,  339,  315,  337, 1161,  327,  342,  344,
-      315,  346, 1152,  347,  348,  328,  349,  330,  331,  332,
-      333,  333,  333,  334,  353,  335,  336,  337,  333,  338,
-      339,  357,  337,  333,  358,  342,  344,  359,  346,  333,
-      347,  348,  333,  349,  350,  360,  361,  333,  333,  333,
-      362,  353,  363,  364,  365,  333,  366,  368,  357,  369,
-      333,  358,  350,  372,  359,  370,  333,  373,  375,  333,
-      350,  350,  360,  361,  376,  370,  377,  362,  371,  363,
-
-      364,  365,  371,  366,  368,  378,  369,  371,  380,  350,
-      372,  381,  370,  382,  373,  375,  379,  379,  383,  384,
-      385,  376,  387,  377,  388,  371,  379,  389,  390,  371,
-      391,  392,  378,  393,  371,  380,  395,  396,  381,  397,
-      382,  399,  400,  379,  379,  383,  384,  385,  401,  387,
-      402,  388,  403,  379,  389,  390,  404,  391,  392,  405,
-      393,  406,  407,  395,  396,  408,  397,  409,  399,  400,
-      410,  413,  409,  411,  414,  401,  416,  402,  417,  403,
-      420,  421,  422,  404,  425,  426,  405,  427,  406,  407,
-      411,  429,  408,  431,  409,  432,  433,  410,  413,  409,
-
-      411,  414,  434,  416,  435,  417,  436,  420,  421,  422,
-      438,  425,  426,  440,  427,  441,  442,  411,  429,  443,
-      431,  444,  432,  433,  445,  446,  448,  449,  450,  434,
-      451,  435,  452,  436,  453,  446,  454,  438,  457,  458,
-      440,  459,  441,  442,  460,  461,  443,  462,  444,  463,
-      464,  445,  446,  448,  449,  450,  467,  451,  465,  452,
-      464,  453,  446,  454,  466,  457,  458,  468,  459,  469,
-      465,  460,  461,  470,  462,  471,  463,  464,  466,  472,
-      473,  474,  475,  467,  477,  465,  476,  464,  478,  479,
-      480,  466,  481,  476,  468,  482,  469,  465,  484,  485,
-
-      470,  486,  471,  488,  484,  466,  472,  473,  474,  475,
-      487,  477,  486,  476,  489,  478,  479,  480,  490,  481,
-      476,  491,  482,  492,  495,  484,  485,  487,  486,  494,
-      488,  484,  494,  496,  497,  498,  499,  487,  500,  486,
-      502,  489,  503,  504,  505,  490,  506,  509,  491,  513,
-      492,  495,  514,  516,  487,  517,  494,  518,  519,  494,
-      496,  497,  498,  499,  520,  500,  521,  502,  512,  503,
-      504,  505,  512,  506,  509,  522,  513,  523,  512,  514,
-      516,  524,  517,  525,  518,  519,  526,  527,  528,  530,
-      531,  520,  532,  521,  535,  512,  538,  540,  542,  512,
-
-      543,  544,  522,  545,  523,  512,  546,  548,  524,  549,
-      525,  547,  550,  526,  527,  528,  530,  531,  551,  532,
-      552,  535,  553,  538,  540,  542,  554,  543,  544,  547,
-      545,  555,  556,  546,  548,  557,  549,  558,  547,  550,
-      559,  560,  563,  565,  566,  551,  567,  552,  568,  553,
-      569,  571,  572,  554,  573,  574,  575,  577,  555,  556,
-      580,  581,  557,  584,  558,  588,  582,  559,  560,  563,
-      565,  566,  589,  567,  582,  568,  590,  569,  571,  572,
-      591,  573,  574,  575,  577,  583,  583,  580,  581,  592,
-      584,  593,  588,  582,  594,  595,  596,  597,  599,  589,
-
-      600,  582,  601,  590,  602,  603,  605,  591,  606,  607,
-      608,  609,  583,  583,  610,  611,  592,  613,  593,  614,
-      615,  594,  595,  596,  597,  599,  616,  600,  617,  601,
-      619,  602,  603,  605,  620,  606,  607,  608,  609,  621,
-      622,  610,  611,  624,  613,  627,  614,  615,  628,  630,
-      631,  632,  633,  616,  634,  617,  635,  619,  636,  636,
-      637,  620,  638,  640,  641,  642,  621,  622,  643,  644,
-      624,  645,  627,  647, 1130,  628,  630,  631,  632,  633,
-     1115,  634, 1107,  635, 1102,  636,  636,  637,  650,  638,
-      640,  641,  642,  653,  656,  643,  644,  657,  645,  658,
-
-      647,  648,  660,  661,  663,  648,  664,  648,  667,  648,
-      668,  648,  648,  669,  670,  650,  671,  648,  672,  673,
-      653,  656,  674,  675,  657,  676,  658,  677,  648,  660,
-      661,  663,  648,  664,  648,  667,  648,  668,  648,  648,
-      669,  670,  678,  671,  648,  672,  673,  680,  683,  674,
-      675,  684,  676,  686,  677,  688,  690,  691,  692,  693,
-      694,  698,  699,  700,  701,  702,  703,  704,  705,  678,
-      706,  707,  707,  707,  680,  683,  708,  709,  684,  710,
-      686,  711,  688,  690,  691,  692,  693,  694,  698,  699,
-      700,  701,  702,  703,  704,  705,  712,  706,  707,  707,
-
-      707,  713,  714,  708,  709,  715,  710,  716,  711,  717,
-      718,  719,  720,  721,  722,  723,  724,  725,  727,  728,
-      731,  732,  734,  712,  736,  737,  738,  739,  713,  714,
-      740,  741,  715,  742,  716,  743,  717,  718,  719,  720,
-      721,  722,  723,  724,  725,  727,  728,  731,  732,  734,
-      744,  736,  737,  738,  739,  745,  747,  740,  741,  748,
-      742,  749,  743,  750,  751,  753,  754,  756,  757,  758,
-      760,  761,  762,  763,  764,  765,  766,  744,  767,  768,
-      776,  777,  745,  747,  778,  782,  748,  784,  749,  767,
-      750,  751,  753,  754,  756,  757,  758,  760,  761,  762,
-
-      763,  764,  765,  766,  787,  767,  768,  776,  777,  788,
-      790,  778,  782,  791,  784,  792,  767,  793,  795,  796,
-      798,  799,  800,  801,  804,  803,  806,  807, 1076,  803,
-      808,  787,  803,  809,  811,  812,  788,  790,  805,  813,
-      791,  814,  792,  805,  793,  795,  796,  798,  799,  800,
-      801,  804,  803,  806,  807,  805,  803,  808,  815,  803,
-      809,  811,  812,  816,  818,  805,  813,  819,  814,  821,
-      805,  822,  823,  824,  825,  826,  827,  828,  829,  830,
-      831,  832,  805,  833,  835,  815,  837,  839,  840,  841,
-      816,  818,  842,  843,  819,  845,  821,  846,  822,  823,
-
-      824,  825,  826,  827,  828,  829,  830,  831,  832,  847,
-      833,  835,  850,  837,  839,  840,  841,  848,  852,  842,
-      843,  854,  845,  855,  846,  856,  857,  848,  859,  860,
-      861,  862,  863,  864,  865,  866,  847,  867,  868,  850,
-      869,  870,  871,  872,  848,  852,  873,  874,  854,  875,
-      855,  876,  856,  857,  848,  859,  860,  861,  862,  863,
-      864,  865,  866,  877,  867,  868,  878,  869,  870,  871,
-      872,  879,  880,  873,  874,  881,  875,  882,  876,  883,
-      884,  885,  886,  887,  889,  890,  891,  892,  893,  894,
-      877,  895,  896,  878,  900,  901,  904,  908,  879,  880,
-
-      909,  910,  881,  911,  882,  912,  883,  884,  885,  886,
-      887,  889,  890,  891,  892,  893,  894,  913,  895,  896,
-      914,  900,  901,  904,  908,  915,  916,  909,  910,  917,
-      911,  919,  912,  921,  922,  923,  924,  925,  926,  929,
-      930,  932,  933,  929,  913,  934,  935,  914,  937,  939,
-      940,  942,  915,  916,  943,  944,  917,  945,  919,  947,
-      921,  922,  923,  924,  925,  926,  929,  930,  932,  933,
-      929,  946,  934,  935,  948,  937,  939,  940,  942,  952,
-      946,  943,  944,  953,  945,  954,  947,  955,  946,  956,
-      957,  958,  959,  961,  963,  965,  966,  970,  946,  971,
-
-      972,  948,  973,  974,  975,  976,  952,  946,  977,  978,
-      953,  979,  954,  980,  955,  946,  956,  957,  958,  959,
-      961,  963,  965,  966,  970,  981,  971,  972,  982,  973,
-      974,  975,  976,  983,  984,  977,  978,  985,  979,  986,
-      980,  987,  988,  989,  990,  991,  992,  993,  994,  995,
-      997,  998,  981,  999, 1000,  982, 1005, 1006, 1007, 1008,
-      983,  984, 1010,  992,  985, 1011,  986, 1012,  987,  988,
-      989,  990,  991,  992,  993,  994,  995,  997,  998, 1013,
-      999, 1000, 1014, 1005, 1006, 1007, 1008, 1015, 1016, 1010,
-      992, 1017, 1011, 1018, 1012, 1019, 1020, 1021, 1022, 1023,
-
-     1024, 1026, 1028, 1029, 1030, 1031, 1013, 1032, 1033, 1014,
-     1034, 1035, 1036, 1038, 1015, 1016, 1039, 1040, 1017, 1041,
-     1018, 1043, 1019, 1020, 1021, 1022, 1023, 1024, 1026, 1028,
-     1029, 1030, 1031, 1044, 1032, 1033, 1045, 1034, 1035, 1036,
-     1038, 1046, 1047, 1039, 1040, 1048, 1041, 1050, 1043, 1051,
-     1052, 1054, 1055, 1056, 1057, 1059, 1060, 1061, 1062, 1063,
-     1044, 1065, 1066, 1045, 1067, 1068, 1073, 1074, 1046, 1047,
-     1075, 1077, 1048, 1078, 1050, 1079, 1051, 1052, 1054, 1055,
-     1056, 1057, 1059, 1060, 1061, 1062, 1063, 1080, 1065, 1066,
-     1081, 1067, 1068, 1073, 1074, 1082, 1083, 1075, 1077, 1084,
-
-     1078, 1085, 1079, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
-     1093, 1094, 1095, 1096, 1080, 1097, 1098, 1081, 1099, 1100,
-     1101, 1104, 1082, 1083, 1105, 1106, 1084, 1109, 1085, 1110,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
-     1096, 1111, 1097, 1098, 1112, 1099, 1100, 1101, 1104, 1113,
-     1114, 1105, 1106, 1116, 1109, 1118, 1110, 1119, 1120, 1121,
-     1122, 1123, 1124, 1125, 1126, 1119, 1127, 1128, 1111, 1129,
-     1131, 1112, 1132, 1134, 1135, 1136, 1113, 1114, 1138, 1139,
-     1116, 1140, 1118, 1141, 1119, 1120, 1121, 1122, 1123, 1124,
-     1125, 1126, 1142, 1127, 1128, 1143, 1129, 1131, 1144, 1132,
-
-     1134, 1135, 1136, 1145, 1144, 1138, 1139, 1146, 1140, 1148,
-     1141, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1142,
-     1162, 1163, 1143, 1164, 1165, 1144, 1166, 1167, 1168, 1169,
-     1145, 1144, 1170, 1171, 1146, 1172, 1148, 1173, 1153, 1154,
-     1155, 1156, 1157, 1158, 1159, 1160, 1175, 1162, 1163, 1176,
-     1164, 1165, 1177, 1166, 1167, 1168, 1169, 1178, 1179, 1170,
-     1171, 1180, 1172, 1181, 1173, 1182, 1183, 1184, 1185, 1187,
-     1190, 1191, 1192, 1175, 1194, 1195, 1176, 1196, 1198, 1177,
-     1199, 1202, 1204, 1205, 1178, 1179, 1207, 1209, 1180, 1210,
-     1181, 1212, 1182, 1183, 1184, 1185, 1187, 1190, 1191, 1192,
-
-     1213, 1194, 1195, 1214, 1196, 1198, 1215, 1199, 1202, 1204,
-     1205, 1216, 1217, 1207, 1209, 1220, 1210, 1221, 1212, 1222,
-     1224, 1225, 1226, 1227, 1230, 1231, 1232, 1213, 1233, 1235,
-     1214, 1236, 1243, 1215, 1244, 1245, 1247, 1248, 1216, 1217,
-     1249, 1251, 1220, 1253, 1221, 1254, 1222, 1224, 1225, 1226,
-     1227, 1230, 1231, 1232, 1255, 1233, 1235, 1256, 1236, 1243,
-     1258, 1244, 1245, 1247, 1248, 1259, 1260, 1249, 1251, 1261,
-     1253, 1262, 1254, 1263, 1265, 1267, 1268, 1258, 1270, 1271,
-     1273, 1255, 1275, 1276, 1256, 1278, 1279, 1258, 1280, 1281,
-     1283, 1277, 1259, 1260, 1284, 1287, 1261, 1289, 1262, 1290,
-
-     1263, 1265, 1267, 1268, 1258, 1270, 1271, 1273, 1277, 1275,
-     1276, 1291, 1278, 1279, 1292, 1280, 1281, 1283, 1277, 1294,
-     1295, 1284, 1287, 1296, 1289, 1297, 1290, 1298, 1299, 1300,
-     1301, 1302, 1303, 1304, 1305, 1277, 1306, 1307, 1291, 1311,
-     1312, 1292, 1313, 1314, 1317, 1318, 1294, 1295, 1319, 1320,
-     1296, 1321, 1297, 1322, 1298, 1299, 1300, 1301, 1302, 1303,
-     1304, 1305, 1323, 1306, 1307, 1326, 1311, 1312, 1329, 1313,
-     1314, 1317, 1318, 1330, 1331, 1319, 1320, 1327, 1321, 1327,
-     1322, 1332, 1333, 1334, 1335, 1337, 1338, 1339, 1341, 1323,
-     1342, 1343, 1326, 1344, 1345, 1329, 1347, 1346, 1332, 1348,
-
-     1330, 1331, 1346, 1349, 1327, 1350, 1327, 1351, 1332, 1333,
-     1334, 1335, 1337, 1338, 1339, 1341, 1352, 1342, 1343, 1354,
-     1344, 1345, 1355, 1347, 1346, 1332, 1348, 1356, 1357, 1346,
-     1349, 1358, 1350, 1359, 1351, 1360, 1361, 1362, 1363, 1365,
-     1366, 1370, 1372, 1352, 1373, 1374, 1354, 1375, 1376, 1355,
-     1377, 1378, 1380, 1381, 1356, 1357, 1382, 1383, 1358, 1386,
-     1359, 1387, 1360, 1361, 1362, 1363, 1365, 1366, 1370, 1372,
-     1388, 1373, 1374, 1389, 1375, 1376, 1390, 1377, 1378, 1380,
-     1381, 1393, 1394, 1382, 1383, 1395, 1386, 1396, 1387, 1398,
-     1401, 1402, 1403, 1404, 1405, 1409, 1411, 1388, 1412, 1413,
-
-     1389, 1414, 1415, 1390, 1416, 1417, 1418, 1419, 1393, 1394,
-     1420, 1422, 1395, 1423, 1396, 1426, 1398, 1401, 1402, 1403,
-     1404, 1405, 1409, 1411, 1427, 1412, 1413, 1428, 1414, 1415,
-     1429, 1416, 1417, 1418, 1419, 1430, 1431, 1420, 1422, 1432,
-     1423, 1433, 1426, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
-     1441, 1427, 1442, 1443, 1428, 1444, 1445, 1429, 1448, 1449,
-     1450, 1451, 1430, 1431, 1454, 1455, 1432, 1456, 1433, 1457,
-     1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1458, 1442,
-     1443, 1459, 1444, 1445, 1461, 1448, 1449, 1450, 1451, 1462,
-     1463, 1454, 1455, 1464, 1456, 1465, 1457, 1466, 1467, 1468,
-
-     1469, 1470, 1471, 1472, 1474, 1458, 1475, 1476, 1459, 1477,
-     1478, 1461, 1479, 1480, 1481, 1482, 1462, 1463, 1483, 1484,
-     1464, 1485, 1465, 1486, 1466, 1467, 1468, 1469, 1470, 1471,
-     1472, 1474, 1487, 1475, 1476, 1488, 1477, 1478, 1490, 1479,
-     1480, 1481, 1482, 1491, 1492, 1483, 1484, 1493, 1485, 1494,
-     1486, 1495, 1496, 1497, 1498, 1500, 1507, 1508, 1509, 1487,
-     1510, 1511, 1488, 1514, 1515, 1490, 1516, 1518, 1520, 1521,
-     1491, 1492, 1522, 1524, 1493, 1526, 1494, 1528, 1495, 1496,
-     1497, 1498, 1500, 1507, 1508, 1509, 1529, 1510, 1511, 1530,
-     1514, 1515, 1531, 1516, 1518, 1520, 1521, 1532, 1533, 1522,
-
-     1524, 1534, 1526, 1534, 1528, 1535, 1536, 1538, 1539, 1540,
-     1541, 1542, 1543, 1529, 1545, 1546, 1530, 1548, 1549, 1531,
-     1551, 1552, 1554, 1555, 1532, 1533, 1557, 1558, 1534, 1543,
-     1534, 1559, 1535, 1536, 1538, 1539, 1540, 1541, 1542, 1543,
-     1560, 1545, 1546, 1561, 1548, 1549, 1562, 1551, 1552, 1554,
-     1555, 1563, 1564, 1557, 1558, 1565, 1543, 1566, 1559, 1567,
-     1569, 1570, 1571, 1572, 1576, 1577, 1579, 1560, 1582, 1583,
-     1561, 1584, 1585, 1562, 1586, 1587, 1588, 1589, 1563, 1564,
-     1590, 1591, 1565, 1593, 1566, 1595, 1567, 1569, 1570, 1571,
-     1572, 1576, 1577, 1579, 1597, 1582, 1583, 1598, 1584, 1585,
-
-     1600, 1586, 1587, 1588, 1589, 1605, 1606, 1590, 1591, 1607,
-     1593, 1609, 1595, 1610, 1611, 1612, 1613, 1616, 1618, 1619,
-     1621, 1597, 1622, 1623, 1598, 1624, 1625, 1600, 1626, 1627,
-     1628, 1631, 1605, 1606, 1058, 1037, 1607, 1004, 1609, 1003,
-     1610, 1611, 1612, 1613, 1616, 1618, 1619, 1621, 1002, 1622,
-     1623, 1001, 1624, 1625,  962, 1626, 1627, 1628, 1631, 1635,
-     1635,  960,  949,  938,  931,  928,  918,  906,  903,  902,
-      899,  898,  888,  838,  834,  802,  786,  779,  775,  774,
-      773,  772,  771,  770,  769,  735,  733,  695,  689,  687,
-      685,  666,  652,  651,  646,  625,  612,  578,  576,  570,
-
-      564,  561,  539,  536,  529,  515,  510,  507,  483,  456,
-      455,  428,  423,  398,  367,  355,  352,  343,  329,  325,
-      313,  298,  283,  276,  273,  245,  231,  198,  184,  147,
-      125,   37,    5,    3, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-     1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
-
-     1633
+       27,   27, 1343,   95,   90, 1342, 1333,   97,   91,   94,
+       27,   98,   91,  909, 1327,  909,   93, 1306,   27,  100,
+       92,   96,   94,  909,   27,   92,  102,   27,   27,   30,
+       95,   96,   30,   30,   97,   30,   94,   96,   98,   30,
+
+       30,   30,   99,   30,   30, 1291,  100,  105,   96,   94,
+      101, 1289, 1283,  102,  106, 1274,   30,   99,   96,   30,
+       30,  107,   30,  101,   96,  103,   30,   30,   30,   99,
+       30,   30,   31,  103,  105,  108,  109,  101,  104,   31,
+      110,  106,   31,  112,   99, 1259, 1258,  116,  107, 1257,
+       31, 1256,  103,  117,  104,  104,   31, 1255, 1254,   31,
+      103,  113,  108,  109,  115,  104,   31,  110,  119,   31,
+      112,  120,  113,  114,  116, 1251,  113,   31,  113,  121,
+      117,  104,  104,   31,   64,   64,  115,  114,  113,   64,
+      122,  115,  123,  124,  118,  119,  126,   64,  120,  113,
+
+      114,  127,   64,  113,  118,  113,  121,  129,  130,  133,
+     1240,   64,   64,  115,  114, 1224,   64,  122,  134,  123,
+      124,  118,  132,  126,   64,  132,  136,  137,  127,   64,
+      111,  118,  111,  111,  129,  130,  133,  111,  131,  111,
+      135,  138,  111,  139,  131,  134,  141,  143,  111,  132,
+      111, 1219,  132,  136,  137,  144,  142,  111,  135,  111,
+      111, 1217, 1216,  142,  111,  131,  111,  135,  138,  111,
+      139,  131,  145,  141,  143,  111,  146,  111,  128,  148,
+      149,  128,  144,  142,  150,  135,  151,  152,  128,  128,
+      142,  153,  154,  155,  156,  128,  157,  158,  159,  145,
+
+      160,  128,  161,  146,  162,  128,  148,  149,  128,  164,
+      165,  150,  166,  151,  152,  128,  128,  167,  153,  154,
+      155,  156,  128,  157,  158,  159,  168,  160,  128,  161,
+      169,  162,  170,  171,  172,  173,  164,  165,  174,  166,
+      176,  175,  177,  178,  167,  179,  180,  181,  181,  182,
+      183,  185,  186,  168,  175,  188,  189,  169,  191,  170,
+      171,  172,  173,  190,  192,  174,  190,  176,  175,  177,
+      178,  193,  179,  180,  181,  181,  182,  183,  185,  186,
+      194,  175,  188,  189,  195,  191,  197,  199,  200,  201,
+      190,  192,  203,  190,  202,  204,  205,  206,  193,  207,
+
+      202,  208,  209,  210,  211,  212,  213,  194,  214,  215,
+      212,  195,  216,  197,  199,  200,  201,  217,  218,  203,
+      219,  202,  204,  205,  206,  220,  207,  221,  208,  209,
+      210,  211,  212,  213,  222,  214,  215,  212,  223,  216,
+      224,  225,  226,  227,  217,  218,  228,  219,  230,  231,
+      232,  231,  220,  234,  221,  235,  236,  238,  239,  241,
+      242,  222,  243,  244,  246,  223,  248,  224,  225,  226,
+      227,  249,  250,  228,  251,  230,  231,  232,  231,  253,
+      234,  254,  235,  236,  238,  239,  241,  242,  255,  243,
+      244,  246,  252,  248,  256,  257,  258,  259,  249,  250,
+
+      260,  251,  252,  261,  262,  263,  253,  264,  254,  265,
+      266,  267,  261,  268,  269,  255,  271,  272,  273,  252,
+      274,  256,  257,  258,  259,  267,  277,  260,  280,  252,
+      261,  262,  263,  281,  264,  282,  265,  266,  267,  283,
+      268,  269,  284,  271,  272,  273,  286,  274,  287,  288,
+      289,  290,  267,  277,  291,  280,  294,  295,  297,  298,
+      281,  299,  282,  301,  302,  303,  283,  304,  305,  284,
+      306,  307,  309,  286,  310,  287,  288,  289,  290,  312,
+      313,  291,  314,  294,  295,  297,  298,  316,  299,  319,
+      301,  302,  303, 1205,  304,  305,  317,  306,  307,  309,
+
+      320,  310,  317,  321,  322,  322,  312,  313,  326,  314,
+      328,  329,  330,  332,  316,  333,  319,  334, 1202, 1177,
+      317,  336,  337,  317,  338,  339, 1168,  320,  340,  317,
+      321,  322,  322,  340,  341,  326,  342,  328,  329,  330,
+      332,  345,  333,  347,  334,  335,  335,  335,  336,  337,
+      349,  338,  339,  335,  350,  340,  351,  352,  335,  356,
+      340,  341,  360,  342,  335,  361,  362,  335,  345,  353,
+      347,  363,  335,  335,  335,  364,  365,  349,  366,  367,
+      335,  350,  368,  351,  352,  335,  356,  353,  369,  360,
+      371,  335,  361,  362,  335,  353,  353,  372,  363,  373,
+
+      374,  376,  364,  365,  375,  366,  367,  377,  375,  368,
+      374,  379,  380,  375,  353,  369,  381,  371,  382,  383,
+      383,  384,  385,  386,  372,  387,  373,  374,  376,  383,
+      388,  375,  389,  391,  377,  375,  392,  393,  379,  380,
+      375,  394,  395,  381,  396,  382,  383,  383,  384,  385,
+      386,  397,  387,  399,  400,  401,  383,  388,  403,  389,
+      391,  404,  405,  392,  393,  406,  407,  408,  394,  395,
+      409,  396,  410,  411,  412,  414, 1145,  417,  397,  413,
+      399,  400,  401,  418,  413,  403,  415,  420,  404,  405,
+      421,  424,  406,  407,  408,  425,  426,  409,  429,  410,
+
+      411,  412,  414,  415,  417,  430,  413,  431,  433,  435,
+      418,  413,  436,  415,  420,  437,  438,  421,  424,  439,
+      440,  442,  425,  426,  444,  429,  445,  446,  447,  448,
+      415,  449,  430,  452,  431,  433,  435,  453,  454,  436,
+      450,  455,  437,  438,  456,  457,  439,  440,  442,  458,
+      450,  444,  461,  445,  446,  447,  448,  462,  449,  463,
+      452,  464,  465,  466,  453,  454,  467,  450,  455,  469,
+      468,  456,  457,  470,  471,  472,  458,  450,  473,  461,
+      468,  469,  474,  475,  462,  476,  463,  470,  464,  465,
+      466,  477,  478,  467,  479,  480,  469,  468,  482,  481,
+
+      470,  471,  472,  483,  484,  473,  481,  468,  469,  474,
+      475,  485,  476,  486,  470,  487,  490,  489,  477,  478,
+      492,  479,  480,  489,  491,  482,  481,  493,  494,  495,
+      483,  484,  496,  481,  497,  491,  499,  492,  485,  499,
+      486,  500,  487,  490,  489,  501,  502,  492,  503,  504,
+      489,  491,  505,  506,  493,  494,  495,  508,  509,  496,
+      510,  497,  491,  499,  492,  511,  499,  512,  500,  515,
+      519,  520,  501,  502,  522,  503,  504,  523,  518,  505,
+      506,  524,  518,  525,  508,  509,  526,  510,  518,  527,
+      528,  529,  511,  530,  512,  531,  515,  519,  520,  532,
+
+      533,  522,  534,  536,  523,  518,  537,  538,  524,  518,
+      525,  541,  544,  526,  546,  518,  527,  528,  529,  548,
+      530,  549,  531,  550,  551,  552,  532,  533,  554,  534,
+      536,  553,  555,  537,  538,  556,  557,  558,  541,  544,
+      559,  546,  560,  561,  562,  563,  548,  564,  549,  553,
+      550,  551,  552,  565,  566,  554,  569,  571,  553,  555,
+      572,  573,  556,  557,  558,  574,  575,  559,  577,  560,
+      561,  562,  563,  578,  564,  579,  580,  581,  583,  586,
+      565,  566,  587,  569,  571,  590,  588,  572,  573,  589,
+      589,  594,  574,  575,  588,  577,  595,  596,  597,  598,
+
+      578,  599,  579,  580,  581,  583,  586,  600,  601,  587,
+      602,  603,  590,  588,  605,  606,  589,  589,  594,  607,
+      608,  588,  609,  595,  596,  597,  598,  610,  599,  612,
+      613,  614,  615,  616,  600,  601,  617,  602,  603,  618,
+      620,  605,  606,  621,  622,  623,  607,  608,  624,  609,
+      626,  627,  628,  629,  610,  631,  612,  613,  614,  615,
+      616,  634,  635,  617,  637,  638,  618,  620,  639,  640,
+      621,  622,  623,  641,  642,  624,  643,  626,  627,  628,
+      629,  645,  631,  644,  644,  646,  648,  649,  634,  635,
+      650,  637,  638,  651,  652,  639,  640,  653,  655, 1130,
+
+      641,  642,  658,  643,  661, 1122,  664, 1117,  645, 1091,
+      644,  644,  646,  648,  649, 1073,  665,  650,  666,  668,
+      651,  652,  669,  671,  653,  655,  656,  672,  675,  658,
+      656,  661,  656,  664,  656,  676,  656,  656,  677,  678,
+      679,  680,  656,  665,  681,  666,  668,  682,  683,  669,
+      671,  684,  685,  656,  672,  675,  686,  656,  688,  656,
+      691,  656,  676,  656,  656,  677,  678,  679,  680,  656,
+      692,  681,  694,  696,  682,  683,  698,  699,  684,  685,
+      700,  701,  702,  686,  706,  688,  707,  691,  708,  709,
+      710,  711,  712,  713,  714, 1051, 1018,  692,  716,  694,
+
+      696,  717,  718,  698,  699,  719,  720,  700,  701,  702,
+      721,  706,  722,  707,  723,  708,  709,  710,  711,  712,
+      713,  714,  715,  715,  715,  716,  724,  725,  717,  718,
+      726,  727,  719,  720,  728,  729,  730,  721,  731,  722,
+      732,  723,  733,  736,  737,  740,  741,  743,  745,  715,
+      715,  715,  746,  724,  725,  747,  748,  726,  727,  749,
+      750,  728,  729,  730,  751,  731,  752,  732,  753,  733,
+      736,  737,  740,  741,  743,  745,  754,  756,  757,  746,
+      758,  759,  747,  748,  760,  762,  749,  750,  763,  764,
+      766,  751,  767,  752,  768,  753,  770,  771,  772,  773,
+
+      774,  775,  776,  754,  756,  757,  778,  758,  759,  777,
+      786,  760,  762,  787,  788,  763,  764,  766,  792,  767,
+      777,  768,  794,  770,  771,  772,  773,  774,  775,  776,
+      797,  798,  800,  778,  801,  802,  777,  786,  803,  805,
+      787,  788,  806,  808,  809,  792,  810,  777,  811,  794,
+      814,  816,  817,  818,  819,  821,  813,  797,  798,  800,
+      813,  801,  802,  813,  822,  803,  805,  815,  823,  806,
+      808,  809,  815,  810,  824,  811,  825,  814,  816,  817,
+      818,  819,  821,  813,  815,  826,  828,  813,  829,  831,
+      813,  822,  832,  833,  815,  823,  834,  835,  836,  815,
+
+      837,  824,  838,  825,  839,  840,  841,  842,  843,  845,
+      847,  815,  826,  828,  849,  829,  831,  850,  851,  832,
+      833,  852,  853,  834,  835,  836,  854,  837,  856,  838,
+      857,  839,  840,  841,  842,  843,  845,  847,  858,  861,
+      859,  849,  863,  865,  850,  851,  866,  867,  852,  853,
+      859,  868,  870,  854,  871,  856,  872,  857,  873,  874,
+      875,  876,  877,  878,  879,  858,  861,  859,  880,  863,
+      865,  881,  882,  866,  867,  883,  884,  859,  868,  870,
+      885,  871,  886,  872,  887,  873,  874,  875,  876,  877,
+      878,  879,  888,  889,  890,  880,  891,  892,  881,  882,
+
+      893,  894,  883,  884,  895,  896,  897,  885,  898,  886,
+      899,  887,  901,  902,  903,  904,  905,  906,  907,  888,
+      889,  890,  908,  891,  892,  912,  913,  893,  894,  916,
+      920,  895,  896,  897,  921,  898,  922,  899,  923,  901,
+      902,  903,  904,  905,  906,  907,  924,  925,  926,  908,
+      927,  928,  912,  913,  929,  931,  916,  920,  933,  934,
+      935,  921,  936,  922,  937,  923,  938,  941,  942,  944,
+      945,  941,  946,  924,  925,  926,  947,  927,  928,  949,
+      951,  929,  931,  952,  954,  933,  934,  935,  955,  936,
+      956,  937,  957,  938,  941,  942,  944,  945,  941,  946,
+
+      959,  960,  964,  947,  958,  965,  949,  951,  966,  967,
+      952,  954,  968,  958,  969,  955,  970,  956,  971,  957,
+      972,  958,  974,  976,  978,  979,  983,  959,  960,  964,
+      985,  958,  965,  986,  987,  966,  967,  988,  989,  968,
+      958,  969,  990,  970,  991,  971,  992,  972,  958,  974,
+      976,  978,  979,  983,  993,  994,  995,  985,  996,  997,
+      986,  987,  998,  999,  988,  989, 1000, 1001, 1002,  990,
+     1003,  991, 1004,  992, 1005, 1006, 1007, 1008, 1009, 1011,
+     1012,  993,  994,  995, 1013,  996,  997, 1014, 1019,  998,
+      999, 1020, 1006, 1000, 1001, 1002, 1021, 1003, 1022, 1004,
+
+     1024, 1005, 1006, 1007, 1008, 1009, 1011, 1012, 1025, 1026,
+     1027, 1013, 1028, 1029, 1014, 1019, 1030, 1031, 1020, 1006,
+     1032, 1033, 1034, 1021, 1035, 1022, 1036, 1024, 1037, 1038,
+     1040, 1042, 1043, 1044, 1045, 1025, 1026, 1027, 1046, 1028,
+     1029, 1047, 1048, 1030, 1031, 1049, 1050, 1032, 1033, 1034,
+     1052, 1035, 1053, 1036, 1054, 1037, 1038, 1040, 1042, 1043,
+     1044, 1045, 1055, 1057, 1058, 1046, 1059, 1060, 1047, 1048,
+     1061, 1062, 1049, 1050, 1064, 1065, 1066, 1052, 1067, 1053,
+     1069, 1054, 1070, 1071, 1072, 1074, 1075, 1076, 1077, 1055,
+     1057, 1058, 1078, 1059, 1060, 1080, 1081, 1061, 1062, 1082,
+
+     1083, 1064, 1065, 1066, 1088, 1067, 1089, 1069, 1090, 1070,
+     1071, 1072, 1074, 1075, 1076, 1077, 1092, 1093, 1094, 1078,
+     1095, 1096, 1080, 1081, 1097, 1098, 1082, 1083, 1099, 1100,
+     1101, 1088, 1102, 1089, 1103, 1090, 1104, 1105, 1106, 1107,
+     1108, 1109, 1110, 1092, 1093, 1094, 1111, 1095, 1096, 1112,
+     1113, 1097, 1098, 1114, 1115, 1099, 1100, 1101, 1116, 1102,
+     1119, 1103, 1120, 1104, 1105, 1106, 1107, 1108, 1109, 1110,
+     1121, 1124, 1125, 1111, 1126, 1127, 1112, 1113, 1128, 1129,
+     1114, 1115, 1131, 1133, 1134, 1116, 1135, 1119, 1136, 1120,
+     1137, 1138, 1134, 1139, 1140, 1141, 1142, 1121, 1124, 1125,
+
+     1143, 1126, 1127, 1144, 1146, 1128, 1129, 1147, 1149, 1131,
+     1133, 1134, 1150, 1135, 1151, 1136, 1153, 1137, 1138, 1154,
+     1139, 1140, 1141, 1142, 1155, 1156, 1157, 1143, 1158, 1159,
+     1144, 1146, 1160, 1161, 1147, 1149, 1162, 1164, 1160, 1150,
+     1169, 1151, 1170, 1153, 1171, 1172, 1154, 1173, 1174, 1175,
+     1176, 1155, 1156, 1157, 1178, 1158, 1159, 1179, 1180, 1160,
+     1161, 1181, 1182, 1162, 1164, 1160, 1183, 1169, 1184, 1170,
+     1185, 1171, 1172, 1186, 1173, 1174, 1175, 1176, 1187, 1188,
+     1189, 1178, 1191, 1192, 1179, 1180, 1193, 1194, 1181, 1182,
+     1195, 1196, 1197, 1183, 1198, 1184, 1199, 1185, 1200, 1201,
+
+     1186, 1203, 1206, 1207, 1208, 1187, 1188, 1189, 1210, 1191,
+     1192, 1211, 1212, 1193, 1194, 1214, 1215, 1195, 1196, 1197,
+     1218, 1198, 1220, 1199, 1221, 1200, 1201, 1223, 1203, 1206,
+     1207, 1208, 1225, 1226, 1228, 1210, 1229, 1230, 1211, 1212,
+     1231, 1232, 1214, 1215, 1233, 1234, 1237, 1218, 1238, 1220,
+     1239, 1221, 1241, 1242, 1223, 1243, 1244, 1247, 1248, 1225,
+     1226, 1228, 1249, 1229, 1230, 1250, 1252, 1231, 1232, 1253,
+     1260, 1233, 1234, 1237, 1261, 1238, 1262, 1239, 1264, 1241,
+     1242, 1265, 1243, 1244, 1247, 1248, 1266, 1268, 1270, 1249,
+     1271, 1272, 1250, 1252, 1273, 1275, 1253, 1260, 1276, 1277,
+
+     1278, 1261, 1279, 1262, 1280, 1264, 1282, 1284, 1265, 1285,
+     1287, 1288, 1275, 1266, 1268, 1270, 1290, 1271, 1272, 1292,
+     1293, 1273, 1275, 1294, 1295, 1276, 1277, 1278, 1296, 1279,
+     1297, 1280, 1298, 1282, 1284, 1300, 1285, 1287, 1288, 1275,
+     1294, 1301, 1302, 1290, 1305, 1307, 1292, 1293, 1308, 1309,
+     1294, 1295, 1310, 1312, 1313, 1296, 1314, 1297, 1315, 1298,
+     1316, 1317, 1300, 1318, 1319, 1320, 1321, 1294, 1301, 1302,
+     1322, 1305, 1307, 1323, 1324, 1308, 1309, 1325, 1329, 1310,
+     1312, 1313, 1330, 1314, 1331, 1315, 1332, 1316, 1317, 1335,
+     1318, 1319, 1320, 1321, 1336, 1337, 1338, 1322, 1339, 1340,
+
+     1323, 1324, 1341, 1344, 1325, 1329, 1345, 1347, 1345, 1330,
+     1348, 1331, 1349, 1332, 1350, 1351, 1335, 1352, 1353, 1355,
+     1356, 1336, 1337, 1338, 1357, 1339, 1340, 1359, 1360, 1341,
+     1344, 1350, 1361, 1345, 1347, 1345, 1363, 1348, 1364, 1349,
+     1366, 1350, 1351, 1365, 1352, 1353, 1355, 1356, 1365, 1367,
+     1368, 1357, 1369, 1370, 1359, 1360, 1371, 1373, 1350, 1361,
+     1374, 1375, 1376, 1363, 1377, 1364, 1378, 1366, 1379, 1380,
+     1365, 1381, 1382, 1384, 1385, 1365, 1367, 1368, 1389, 1369,
+     1370, 1391, 1392, 1371, 1373, 1393, 1394, 1374, 1375, 1376,
+     1395, 1377, 1396, 1378, 1397, 1379, 1380, 1399, 1381, 1382,
+
+     1384, 1385, 1400, 1401, 1402, 1389, 1405, 1406, 1391, 1392,
+     1407, 1408, 1393, 1394, 1409, 1412, 1413, 1395, 1414, 1396,
+     1415, 1397, 1417, 1420, 1399, 1421, 1422, 1423, 1424, 1400,
+     1401, 1402, 1428, 1405, 1406, 1430, 1431, 1407, 1408, 1432,
+     1433, 1409, 1412, 1413, 1434, 1414, 1435, 1415, 1436, 1417,
+     1420, 1437, 1421, 1422, 1423, 1424, 1438, 1439, 1441, 1428,
+     1442, 1445, 1430, 1431, 1446, 1447, 1432, 1433, 1448, 1449,
+     1450, 1434, 1451, 1435, 1452, 1436, 1453, 1454, 1437, 1455,
+     1456, 1457, 1458, 1438, 1439, 1441, 1459, 1442, 1445, 1460,
+     1461, 1446, 1447, 1462, 1463, 1448, 1449, 1450, 1464, 1451,
+
+     1467, 1452, 1468, 1453, 1454, 1469, 1455, 1456, 1457, 1458,
+     1470, 1473, 1474, 1459, 1475, 1476, 1460, 1461, 1477, 1478,
+     1462, 1463, 1480, 1481, 1482, 1464, 1483, 1467, 1484, 1468,
+     1485, 1486, 1469, 1487, 1488, 1489, 1490, 1470, 1473, 1474,
+     1491, 1475, 1476, 1493, 1494, 1477, 1478, 1495, 1496, 1480,
+     1481, 1482, 1497, 1483, 1498, 1484, 1499, 1485, 1486, 1500,
+     1487, 1488, 1489, 1490, 1501, 1502, 1503, 1491, 1504, 1505,
+     1493, 1494, 1506, 1507, 1495, 1496, 1509, 1510, 1511, 1497,
+     1512, 1498, 1513, 1499, 1514, 1515, 1500, 1516, 1517, 1519,
+     1526, 1501, 1502, 1503, 1527, 1504, 1505, 1528, 1529, 1506,
+
+     1507, 1530, 1533, 1509, 1510, 1511, 1534, 1512, 1535, 1513,
+     1537, 1514, 1515, 1539, 1516, 1517, 1519, 1526, 1540, 1541,
+     1543, 1527, 1545, 1547, 1528, 1529, 1548, 1549, 1530, 1533,
+     1550, 1551, 1552, 1534, 1553, 1535, 1553, 1537, 1554, 1555,
+     1539, 1557, 1558, 1559, 1560, 1540, 1541, 1543, 1561, 1545,
+     1547, 1564, 1565, 1548, 1549, 1562, 1567, 1550, 1551, 1552,
+     1568, 1553, 1570, 1553, 1571, 1554, 1555, 1573, 1557, 1558,
+     1559, 1560, 1562, 1574, 1576, 1561, 1577, 1578, 1564, 1565,
+     1579, 1580, 1562, 1567, 1581, 1582, 1583, 1568, 1584, 1570,
+     1585, 1571, 1586, 1588, 1573, 1589, 1590, 1591, 1595, 1562,
+
+     1574, 1576, 1596, 1577, 1578, 1598, 1601, 1579, 1580, 1602,
+     1603, 1581, 1582, 1583, 1604, 1584, 1605, 1585, 1606, 1586,
+     1588, 1607, 1589, 1590, 1591, 1595, 1608, 1609, 1610, 1596,
+     1612, 1614, 1598, 1601, 1616, 1617, 1602, 1603, 1619, 1624,
+     1625, 1604, 1626, 1605, 1628, 1606, 1629, 1630, 1607, 1631,
+     1632, 1635, 1637, 1608, 1609, 1610, 1638, 1612, 1614, 1640,
+     1641, 1616, 1617, 1642, 1643, 1619, 1624, 1625, 1644, 1626,
+     1645, 1628, 1646, 1629, 1630, 1647, 1631, 1632, 1635, 1637,
+     1650, 1017, 1016, 1638, 1015,  975, 1640, 1641,  973,  961,
+     1642, 1643,  950,  943,  940, 1644,  930, 1645,  918, 1646,
+
+      915,  914, 1647,  911,  910,  900,  848, 1650, 1654, 1654,
+      844,  812,  796,  789,  785,  784,  783,  782,  781,  780,
+      779,  744,  742,  734,  703,  697,  695,  693,  674,  660,
+      659,  654,  632,  619,  584,  582,  576,  570,  567,  545,
+      542,  535,  521,  516,  513,  488,  460,  459,  432,  427,
+      402,  370,  358,  355,  346,  331,  327,  315,  300,  285,
+      278,  275,  247,  233,  198,  184,  147,  125,   37,    5,
+        3, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+     1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1759,8 +1771,8 @@ conf_yy_fatal_error(const char *msg)
   return 0;
 }
 
-#line 1762 "conf_lexer.c"
-#line 1763 "conf_lexer.c"
+#line 1774 "conf_lexer.c"
+#line 1775 "conf_lexer.c"
 
 #define INITIAL 0
 
@@ -1977,7 +1989,7 @@ YY_DECL
 	{
 #line 85 "conf_lexer.l"
 
-#line 1980 "conf_lexer.c"
+#line 1992 "conf_lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2010,13 +2022,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1634 )
+				if ( yy_current_state >= 1653 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1633 );
+		while ( yy_current_state != 1652 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2665,142 +2677,142 @@ YY_RULE_SETUP
 case 118:
 YY_RULE_SETUP
 #line 243 "conf_lexer.l"
-{ return MIN_IDLE; }
+{ return METRICS_SOCKET; }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 244 "conf_lexer.l"
-{ return MIN_NONWILDCARD; }
+{ return MIN_IDLE; }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 245 "conf_lexer.l"
-{ return MIN_NONWILDCARD_SIMPLE; }
+{ return MIN_NONWILDCARD; }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 246 "conf_lexer.l"
-{ return MODULE; }
+{ return MIN_NONWILDCARD_SIMPLE; }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 247 "conf_lexer.l"
-{ return MODULES; }
+{ return MODULE; }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 248 "conf_lexer.l"
-{ return MOTD; }
+{ return MODULES; }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 249 "conf_lexer.l"
-{ return NAME; }
+{ return MOTD; }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 250 "conf_lexer.l"
-{ return T_NCHANGE; }
+{ return NAME; }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 251 "conf_lexer.l"
-{ return NEED_IDENT; }
+{ return T_NCHANGE; }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 252 "conf_lexer.l"
-{ return NEED_PASSWORD; }
+{ return NEED_IDENT; }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 253 "conf_lexer.l"
-{ return NETWORK_DESC; }
+{ return NEED_PASSWORD; }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 254 "conf_lexer.l"
-{ return NETWORK_NAME; }
+{ return NETWORK_DESC; }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 255 "conf_lexer.l"
-{ return NICK; }
+{ return NETWORK_NAME; }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 256 "conf_lexer.l"
-{ return NO_OPER_FLOOD; }
+{ return NICK; }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 257 "conf_lexer.l"
-{ return NO_TILDE; }
+{ return NO_OPER_FLOOD; }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 258 "conf_lexer.l"
-{ return T_NONONREG; }
+{ return NO_TILDE; }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 259 "conf_lexer.l"
-{ return NUMBER_PER_CIDR; }
+{ return T_NONONREG; }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 260 "conf_lexer.l"
-{ return NUMBER_PER_IP_GLOBAL; }
+{ return NUMBER_PER_CIDR; }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 261 "conf_lexer.l"
-{ return NUMBER_PER_IP_LOCAL; }
+{ return NUMBER_PER_IP_GLOBAL; }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 262 "conf_lexer.l"
-{ return OPERATOR; }
+{ return NUMBER_PER_IP_LOCAL; }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 263 "conf_lexer.l"
-{ return OPER_ONLY_UMODES; }
+{ return OPERATOR; }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 264 "conf_lexer.l"
-{ return OPER_UMODES; }
+{ return OPER_ONLY_UMODES; }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 265 "conf_lexer.l"
-{ return OPERATOR; }
+{ return OPER_UMODES; }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 266 "conf_lexer.l"
-{ return OPERS_BYPASS_CALLERID; }
+{ return OPERATOR; }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 267 "conf_lexer.l"
-{ return T_OPME; }
+{ return OPERS_BYPASS_CALLERID; }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 268 "conf_lexer.l"
-{ return PACE_WAIT; }
+{ return T_OPME; }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 269 "conf_lexer.l"
-{ return PACE_WAIT_SIMPLE; }
+{ return PACE_WAIT; }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 270 "conf_lexer.l"
-{ return PASSWORD; }
+{ return PACE_WAIT_SIMPLE; }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
@@ -2810,497 +2822,497 @@ YY_RULE_SETUP
 case 147:
 YY_RULE_SETUP
 #line 272 "conf_lexer.l"
-{ return PATH; }
+{ return PASSWORD; }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 273 "conf_lexer.l"
-{ return PING_COOKIE; }
+{ return PATH; }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 274 "conf_lexer.l"
-{ return PING_TIME; }
+{ return PING_COOKIE; }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 275 "conf_lexer.l"
-{ return PORT; }
+{ return PING_TIME; }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 276 "conf_lexer.l"
-{ return T_PREPEND; }
+{ return PORT; }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 277 "conf_lexer.l"
-{ return T_PSEUDO; }
+{ return T_PREPEND; }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 278 "conf_lexer.l"
-{ return RESV; }
+{ return T_PSEUDO; }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 279 "conf_lexer.l"
-{ return RANDOM_IDLE; }
+{ return RESV; }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 280 "conf_lexer.l"
-{ return REASON; }
+{ return RANDOM_IDLE; }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 281 "conf_lexer.l"
-{ return T_RECVQ; }
+{ return REASON; }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 282 "conf_lexer.l"
-{ return REDIRPORT; }
+{ return T_RECVQ; }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 283 "conf_lexer.l"
-{ return REDIRSERV; }
+{ return REDIRPORT; }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 284 "conf_lexer.l"
-{ return REHASH; }
+{ return REDIRSERV; }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 285 "conf_lexer.l"
-{ return T_REJ; }
+{ return REHASH; }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 286 "conf_lexer.l"
-{ return REMOTE; }
+{ return T_REJ; }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 287 "conf_lexer.l"
-{ return REMOTEBAN; }
+{ return REMOTE; }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 288 "conf_lexer.l"
-{ return T_RESTART; }
+{ return REMOTEBAN; }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 289 "conf_lexer.l"
-{ return RESV; }
+{ return T_RESTART; }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 290 "conf_lexer.l"
-{ return RESV_EXEMPT; }
+{ return REUSEPORT; }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 291 "conf_lexer.l"
-{ return RSA_PRIVATE_KEY_FILE; }
+{ return RESV; }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 292 "conf_lexer.l"
-{ return SEND_PASSWORD; }
+{ return RESV_EXEMPT; }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 293 "conf_lexer.l"
-{ return SENDQ; }
+{ return RSA_PRIVATE_KEY_FILE; }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 294 "conf_lexer.l"
-{ return T_SERVER; }
+{ return SEND_PASSWORD; }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 295 "conf_lexer.l"
-{ return SERVERHIDE; }
+{ return SENDQ; }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 296 "conf_lexer.l"
-{ return SERVERINFO; }
+{ return T_SERVER; }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 297 "conf_lexer.l"
-{ return T_SERVICE; }
+{ return SERVERHIDE; }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 298 "conf_lexer.l"
-{ return T_SERVNOTICE; }
+{ return SERVERINFO; }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 299 "conf_lexer.l"
-{ return T_SET; }
+{ return T_SERVICE; }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 300 "conf_lexer.l"
-{ return T_SHARED; }
+{ return T_SERVNOTICE; }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 301 "conf_lexer.l"
-{ return SHORT_MOTD; }
+{ return T_SET; }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 302 "conf_lexer.l"
-{ return IRCD_SID; }
+{ return T_SHARED; }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 303 "conf_lexer.l"
-{ return T_SIZE; }
+{ return SHORT_MOTD; }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 304 "conf_lexer.l"
-{ return T_SKILL; }
+{ return IRCD_SID; }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 305 "conf_lexer.l"
-{ return T_SOFTCALLERID; }
+{ return T_SIZE; }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 306 "conf_lexer.l"
-{ return SPOOF; }
+{ return T_SKILL; }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 307 "conf_lexer.l"
-{ return SPOOF_NOTICE; }
+{ return T_SOFTCALLERID; }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 308 "conf_lexer.l"
-{ return T_SPY; }
+{ return SPOOF; }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 309 "conf_lexer.l"
-{ return SQUIT; }
+{ return SPOOF_NOTICE; }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 310 "conf_lexer.l"
-{ return T_SSL; }
+{ return T_SPY; }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 311 "conf_lexer.l"
-{ return SSL_CERTIFICATE_FILE; }
+{ return SQUIT; }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 312 "conf_lexer.l"
-{ return SSL_CERTIFICATE_FINGERPRINT; }
+{ return T_SSL; }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 313 "conf_lexer.l"
-{ return T_SSL_CIPHER_LIST; }
+{ return SSL_CERTIFICATE_FILE; }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 314 "conf_lexer.l"
-{ return SSL_CONNECTION_REQUIRED; }
+{ return SSL_CERTIFICATE_FINGERPRINT; }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 315 "conf_lexer.l"
-{ return SSL_DH_ELLIPTIC_CURVE; }
+{ return T_SSL_CIPHER_LIST; }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 316 "conf_lexer.l"
-{ return SSL_DH_PARAM_FILE; }
+{ return SSL_CONNECTION_REQUIRED; }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 317 "conf_lexer.l"
-{ return SSL_MESSAGE_DIGEST_ALGORITHM; }
+{ return SSL_DH_ELLIPTIC_CURVE; }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 318 "conf_lexer.l"
-{ return STATS_E_DISABLED; }
+{ return SSL_DH_PARAM_FILE; }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 319 "conf_lexer.l"
-{ return STATS_I_OPER_ONLY; }
+{ return SSL_MESSAGE_DIGEST_ALGORITHM; }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 320 "conf_lexer.l"
-{ return STATS_K_OPER_ONLY; }
+{ return STATS_E_DISABLED; }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 321 "conf_lexer.l"
-{ return STATS_M_OPER_ONLY; }
+{ return STATS_I_OPER_ONLY; }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 322 "conf_lexer.l"
-{ return STATS_O_OPER_ONLY; }
+{ return STATS_K_OPER_ONLY; }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 323 "conf_lexer.l"
-{ return STATS_P_OPER_ONLY; }
+{ return STATS_M_OPER_ONLY; }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 324 "conf_lexer.l"
-{ return STATS_U_OPER_ONLY; }
+{ return STATS_O_OPER_ONLY; }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 325 "conf_lexer.l"
-{ return T_TARGET; }
+{ return STATS_P_OPER_ONLY; }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 326 "conf_lexer.l"
-{ return THROTTLE_COUNT; }
+{ return STATS_U_OPER_ONLY; }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 327 "conf_lexer.l"
-{ return THROTTLE_TIME; }
+{ return T_TARGET; }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 328 "conf_lexer.l"
-{ return TKLINE_EXPIRE_NOTICES; }
+{ return THROTTLE_COUNT; }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 329 "conf_lexer.l"
-{ return TS_MAX_DELTA; }
+{ return THROTTLE_TIME; }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 330 "conf_lexer.l"
-{ return TS_WARN_DELTA; }
+{ return TKLINE_EXPIRE_NOTICES; }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 331 "conf_lexer.l"
-{ return TYPE; }
+{ return TS_MAX_DELTA; }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 332 "conf_lexer.l"
-{ return T_UMODES; }
+{ return TS_WARN_DELTA; }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 333 "conf_lexer.l"
-{ return T_UNAUTH; }
+{ return TYPE; }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 334 "conf_lexer.l"
-{ return T_UNDLINE; }
+{ return T_UMODES; }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 335 "conf_lexer.l"
-{ return UNKLINE; }
+{ return T_UNAUTH; }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 336 "conf_lexer.l"
-{ return T_UNLIMITED; }
+{ return T_UNDLINE; }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 337 "conf_lexer.l"
-{ return T_UNRESV; }
+{ return UNKLINE; }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 338 "conf_lexer.l"
-{ return T_UNXLINE; }
+{ return T_UNLIMITED; }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 339 "conf_lexer.l"
-{ return USE_LOGGING; }
+{ return T_UNRESV; }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 340 "conf_lexer.l"
-{ return USER; }
+{ return T_UNXLINE; }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 341 "conf_lexer.l"
-{ return VHOST; }
+{ return USE_LOGGING; }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 342 "conf_lexer.l"
-{ return VHOST6; }
+{ return USER; }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 343 "conf_lexer.l"
-{ return T_WALLOP; }
+{ return VHOST; }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 344 "conf_lexer.l"
-{ return T_WALLOPS; }
+{ return VHOST6; }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 345 "conf_lexer.l"
-{ return WARN_NO_CONNECT_BLOCK; }
+{ return T_WALLOP; }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 346 "conf_lexer.l"
-{ return T_WEBIRC; }
+{ return T_WALLOPS; }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 347 "conf_lexer.l"
-{ return WHOIS; }
+{ return WARN_NO_CONNECT_BLOCK; }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 348 "conf_lexer.l"
-{ return WHOWAS_HISTORY_LENGTH; }
+{ return T_WEBIRC; }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 349 "conf_lexer.l"
-{ return XLINE; }
+{ return WHOIS; }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 350 "conf_lexer.l"
-{ return XLINE_EXEMPT; }
+{ return WHOWAS_HISTORY_LENGTH; }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 352 "conf_lexer.l"
-{ yylval.number = 1; return TBOOL; }
+#line 351 "conf_lexer.l"
+{ return XLINE; }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
-#line 353 "conf_lexer.l"
-{ yylval.number = 0; return TBOOL; }
+#line 352 "conf_lexer.l"
+{ return XLINE_EXEMPT; }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
-#line 355 "conf_lexer.l"
-{ return YEARS; }
+#line 354 "conf_lexer.l"
+{ yylval.number = 1; return TBOOL; }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
-#line 356 "conf_lexer.l"
-{ return YEARS; }
+#line 355 "conf_lexer.l"
+{ yylval.number = 0; return TBOOL; }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 357 "conf_lexer.l"
-{ return MONTHS; }
+{ return YEARS; }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 358 "conf_lexer.l"
-{ return MONTHS; }
+{ return YEARS; }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 359 "conf_lexer.l"
-{ return WEEKS; }
+{ return MONTHS; }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 360 "conf_lexer.l"
-{ return WEEKS; }
+{ return MONTHS; }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 361 "conf_lexer.l"
-{ return DAYS; }
+{ return WEEKS; }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 362 "conf_lexer.l"
-{ return DAYS; }
+{ return WEEKS; }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 363 "conf_lexer.l"
-{ return HOURS; }
+{ return DAYS; }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 364 "conf_lexer.l"
-{ return HOURS; }
+{ return DAYS; }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 365 "conf_lexer.l"
-{ return MINUTES; }
+{ return HOURS; }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 366 "conf_lexer.l"
-{ return MINUTES; }
+{ return HOURS; }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 367 "conf_lexer.l"
-{ return SECONDS; }
+{ return MINUTES; }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
 #line 368 "conf_lexer.l"
-{ return SECONDS; }
+{ return MINUTES; }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
-#line 370 "conf_lexer.l"
-{ return BYTES; }
+#line 369 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
-#line 371 "conf_lexer.l"
-{ return BYTES; }
+#line 370 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
 #line 372 "conf_lexer.l"
-{ return KBYTES; }
+{ return BYTES; }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 373 "conf_lexer.l"
-{ return KBYTES; }
+{ return BYTES; }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
@@ -3320,12 +3332,12 @@ YY_RULE_SETUP
 case 249:
 YY_RULE_SETUP
 #line 377 "conf_lexer.l"
-{ return MBYTES; }
+{ return KBYTES; }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
 #line 378 "conf_lexer.l"
-{ return MBYTES; }
+{ return KBYTES; }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
@@ -3345,23 +3357,33 @@ YY_RULE_SETUP
 case 254:
 YY_RULE_SETUP
 #line 382 "conf_lexer.l"
-{ return TWODOTS; }
+{ return MBYTES; }
 	YY_BREAK
 case 255:
 YY_RULE_SETUP
+#line 383 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 256:
+YY_RULE_SETUP
 #line 384 "conf_lexer.l"
+{ return TWODOTS; }
+	YY_BREAK
+case 257:
+YY_RULE_SETUP
+#line 386 "conf_lexer.l"
 { return yytext[0]; }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 385 "conf_lexer.l"
+#line 387 "conf_lexer.l"
 { if (ieof()) yyterminate(); }
 	YY_BREAK
-case 256:
+case 258:
 YY_RULE_SETUP
-#line 387 "conf_lexer.l"
+#line 389 "conf_lexer.l"
 ECHO;
 	YY_BREAK
-#line 3364 "conf_lexer.c"
+#line 3386 "conf_lexer.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3657,7 +3679,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1634 )
+			if ( yy_current_state >= 1653 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3685,11 +3707,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1634 )
+		if ( yy_current_state >= 1653 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1633);
+	yy_is_jam = (yy_current_state == 1652);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
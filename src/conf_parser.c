@@ -302,141 +302,143 @@ extern int yydebug;
     MAX_TARGETS = 347,
     MAX_TOPIC_LENGTH = 348,
     MAX_WATCH = 349,
-    MIN_IDLE = 350,
-    MIN_NONWILDCARD = 351,
-    MIN_NONWILDCARD_SIMPLE = 352,
-    MODULE = 353,
-    MODULES = 354,
-    MOTD = 355,
-    NAME = 356,
-    NEED_IDENT = 357,
-    NEED_PASSWORD = 358,
-    NETWORK_DESC = 359,
-    NETWORK_NAME = 360,
-    NICK = 361,
-    NO_OPER_FLOOD = 362,
-    NO_TILDE = 363,
-    NUMBER = 364,
-    NUMBER_PER_CIDR = 365,
-    NUMBER_PER_IP_GLOBAL = 366,
-    NUMBER_PER_IP_LOCAL = 367,
-    OPER_ONLY_UMODES = 368,
-    OPER_UMODES = 369,
-    OPERATOR = 370,
-    OPERS_BYPASS_CALLERID = 371,
-    PACE_WAIT = 372,
-    PACE_WAIT_SIMPLE = 373,
-    PASSWORD = 374,
-    PATH = 375,
-    PING_COOKIE = 376,
-    PING_TIME = 377,
-    PORT = 378,
-    QSTRING = 379,
-    RANDOM_IDLE = 380,
-    REASON = 381,
-    REDIRPORT = 382,
-    REDIRSERV = 383,
-    REHASH = 384,
-    REMOTE = 385,
-    REMOTEBAN = 386,
-    RESV = 387,
-    RESV_EXEMPT = 388,
-    RSA_PRIVATE_KEY_FILE = 389,
-    SECONDS = 390,
-    MINUTES = 391,
-    HOURS = 392,
-    DAYS = 393,
-    WEEKS = 394,
-    MONTHS = 395,
-    YEARS = 396,
-    SEND_PASSWORD = 397,
-    SENDQ = 398,
-    SERVERHIDE = 399,
-    SERVERINFO = 400,
-    SHORT_MOTD = 401,
-    SPOOF = 402,
-    SPOOF_NOTICE = 403,
-    SQUIT = 404,
-    SSL_CERTIFICATE_FILE = 405,
-    SSL_CERTIFICATE_FINGERPRINT = 406,
-    SSL_CONNECTION_REQUIRED = 407,
-    SSL_DH_ELLIPTIC_CURVE = 408,
-    SSL_DH_PARAM_FILE = 409,
-    SSL_MESSAGE_DIGEST_ALGORITHM = 410,
-    STATS_E_DISABLED = 411,
-    STATS_I_OPER_ONLY = 412,
-    STATS_K_OPER_ONLY = 413,
-    STATS_M_OPER_ONLY = 414,
-    STATS_O_OPER_ONLY = 415,
-    STATS_P_OPER_ONLY = 416,
-    STATS_U_OPER_ONLY = 417,
-    T_ALL = 418,
-    T_BOTS = 419,
-    T_CALLERID = 420,
-    T_CCONN = 421,
-    T_COMMAND = 422,
-    T_CLUSTER = 423,
-    T_DEAF = 424,
-    T_DEBUG = 425,
-    T_DLINE = 426,
-    T_EXTERNAL = 427,
-    T_FARCONNECT = 428,
-    T_FILE = 429,
-    T_FULL = 430,
-    T_GLOBOPS = 431,
-    T_INVISIBLE = 432,
-    T_IPV4 = 433,
-    T_IPV6 = 434,
-    T_LOCOPS = 435,
-    T_LOG = 436,
-    T_NCHANGE = 437,
-    T_NONONREG = 438,
-    T_OPME = 439,
-    T_PREPEND = 440,
-    T_PSEUDO = 441,
-    T_RECVQ = 442,
-    T_REJ = 443,
-    T_RESTART = 444,
-    T_SERVER = 445,
-    T_SERVICE = 446,
-    T_SERVNOTICE = 447,
-    T_SET = 448,
-    T_SHARED = 449,
-    T_SIZE = 450,
-    T_SKILL = 451,
-    T_SOFTCALLERID = 452,
-    T_SPY = 453,
-    T_SSL = 454,
-    T_SSL_CIPHER_LIST = 455,
-    T_TARGET = 456,
-    T_UMODES = 457,
-    T_UNAUTH = 458,
-    T_UNDLINE = 459,
-    T_UNLIMITED = 460,
-    T_UNRESV = 461,
-    T_UNXLINE = 462,
-    T_WALLOP = 463,
-    T_WALLOPS = 464,
-    T_WEBIRC = 465,
-    TBOOL = 466,
-    THROTTLE_COUNT = 467,
-    THROTTLE_TIME = 468,
-    TKLINE_EXPIRE_NOTICES = 469,
-    TMASKED = 470,
-    TS_MAX_DELTA = 471,
-    TS_WARN_DELTA = 472,
-    TWODOTS = 473,
-    TYPE = 474,
-    UNKLINE = 475,
-    USE_LOGGING = 476,
-    USER = 477,
-    VHOST = 478,
-    VHOST6 = 479,
-    WARN_NO_CONNECT_BLOCK = 480,
-    WHOIS = 481,
-    WHOWAS_HISTORY_LENGTH = 482,
-    XLINE = 483,
-    XLINE_EXEMPT = 484
+    METRICS_SOCKET = 350,
+    MIN_IDLE = 351,
+    MIN_NONWILDCARD = 352,
+    MIN_NONWILDCARD_SIMPLE = 353,
+    MODULE = 354,
+    MODULES = 355,
+    MOTD = 356,
+    NAME = 357,
+    NEED_IDENT = 358,
+    NEED_PASSWORD = 359,
+    NETWORK_DESC = 360,
+    NETWORK_NAME = 361,
+    NICK = 362,
+    NO_OPER_FLOOD = 363,
+    NO_TILDE = 364,
+    NUMBER = 365,
+    NUMBER_PER_CIDR = 366,
+    NUMBER_PER_IP_GLOBAL = 367,
+    NUMBER_PER_IP_LOCAL = 368,
+    OPER_ONLY_UMODES = 369,
+    OPER_UMODES = 370,
+    OPERATOR = 371,
+    OPERS_BYPASS_CALLERID = 372,
+    PACE_WAIT = 373,
+    PACE_WAIT_SIMPLE = 374,
+    PASSWORD = 375,
+    PATH = 376,
+    PING_COOKIE = 377,
+    PING_TIME = 378,
+    PORT = 379,
+    QSTRING = 380,
+    RANDOM_IDLE = 381,
+    REASON = 382,
+    REDIRPORT = 383,
+    REDIRSERV = 384,
+    REHASH = 385,
+    REMOTE = 386,
+    REMOTEBAN = 387,
+    RESV = 388,
+    RESV_EXEMPT = 389,
+    REUSEPORT = 390,
+    RSA_PRIVATE_KEY_FILE = 391,
+    SECONDS = 392,
+    MINUTES = 393,
+    HOURS = 394,
+    DAYS = 395,
+    WEEKS = 396,
+    MONTHS = 397,
+    YEARS = 398,
+    SEND_PASSWORD = 399,
+    SENDQ = 400,
+    SERVERHIDE = 401,
+    SERVERINFO = 402,
+    SHORT_MOTD = 403,
+    SPOOF = 404,
+    SPOOF_NOTICE = 405,
+    SQUIT = 406,
+    SSL_CERTIFICATE_FILE = 407,
+    SSL_CERTIFICATE_FINGERPRINT = 408,
+    SSL_CONNECTION_REQUIRED = 409,
+    SSL_DH_ELLIPTIC_CURVE = 410,
+    SSL_DH_PARAM_FILE = 411,
+    SSL_MESSAGE_DIGEST_ALGORITHM = 412,
+    STATS_E_DISABLED = 413,
+    STATS_I_OPER_ONLY = 414,
+    STATS_K_OPER_ONLY = 415,
+    STATS_M_OPER_ONLY = 416,
+    STATS_O_OPER_ONLY = 417,
+    STATS_P_OPER_ONLY = 418,
+    STATS_U_OPER_ONLY = 419,
+    T_ALL = 420,
+    T_BOTS = 421,
+    T_CALLERID = 422,
+    T_CCONN = 423,
+    T_COMMAND = 424,
+    T_CLUSTER = 425,
+    T_DEAF = 426,
+    T_DEBUG = 427,
+    T_DLINE = 428,
+    T_EXTERNAL = 429,
+    T_FARCONNECT = 430,
+    T_FILE = 431,
+    T_FULL = 432,
+    T_GLOBOPS = 433,
+    T_INVISIBLE = 434,
+    T_IPV4 = 435,
+    T_IPV6 = 436,
+    T_LOCOPS = 437,
+    T_LOG = 438,
+    T_NCHANGE = 439,
+    T_NONONREG = 440,
+    T_OPME = 441,
+    T_PREPEND = 442,
+    T_PSEUDO = 443,
+    T_RECVQ = 444,
+    T_REJ = 445,
+    T_RESTART = 446,
+    T_SERVER = 447,
+    T_SERVICE = 448,
+    T_SERVNOTICE = 449,
+    T_SET = 450,
+    T_SHARED = 451,
+    T_SIZE = 452,
+    T_SKILL = 453,
+    T_SOFTCALLERID = 454,
+    T_SPY = 455,
+    T_SSL = 456,
+    T_SSL_CIPHER_LIST = 457,
+    T_TARGET = 458,
+    T_UMODES = 459,
+    T_UNAUTH = 460,
+    T_UNDLINE = 461,
+    T_UNLIMITED = 462,
+    T_UNRESV = 463,
+    T_UNXLINE = 464,
+    T_WALLOP = 465,
+    T_WALLOPS = 466,
+    T_WEBIRC = 467,
+    TBOOL = 468,
+    THROTTLE_COUNT = 469,
+    THROTTLE_TIME = 470,
+    TKLINE_EXPIRE_NOTICES = 471,
+    TMASKED = 472,
+    TS_MAX_DELTA = 473,
+    TS_WARN_DELTA = 474,
+    TWODOTS = 475,
+    TYPE = 476,
+    UNKLINE = 477,
+    USE_LOGGING = 478,
+    USER = 479,
+    VHOST = 480,
+    VHOST6 = 481,
+    WARN_NO_CONNECT_BLOCK = 482,
+    WHOIS = 483,
+    WHOWAS_HISTORY_LENGTH = 484,
+    XLINE = 485,
+    XLINE_EXEMPT = 486
   };
 #endif
 /* Tokens.  */
@@ -532,141 +534,143 @@ extern int yydebug;
 #define MAX_TARGETS 347
 #define MAX_TOPIC_LENGTH 348
 #define MAX_WATCH 349
-#define MIN_IDLE 350
-#define MIN_NONWILDCARD 351
-#define MIN_NONWILDCARD_SIMPLE 352
-#define MODULE 353
-#define MODULES 354
-#define MOTD 355
-#define NAME 356
-#define NEED_IDENT 357
-#define NEED_PASSWORD 358
-#define NETWORK_DESC 359
-#define NETWORK_NAME 360
-#define NICK 361
-#define NO_OPER_FLOOD 362
-#define NO_TILDE 363
-#define NUMBER 364
-#define NUMBER_PER_CIDR 365
-#define NUMBER_PER_IP_GLOBAL 366
-#define NUMBER_PER_IP_LOCAL 367
-#define OPER_ONLY_UMODES 368
-#define OPER_UMODES 369
-#define OPERATOR 370
-#define OPERS_BYPASS_CALLERID 371
-#define PACE_WAIT 372
-#define PACE_WAIT_SIMPLE 373
-#define PASSWORD 374
-#define PATH 375
-#define PING_COOKIE 376
-#define PING_TIME 377
-#define PORT 378
-#define QSTRING 379
-#define RANDOM_IDLE 380
-#define REASON 381
-#define REDIRPORT 382
-#define REDIRSERV 383
-#define REHASH 384
-#define REMOTE 385
-#define REMOTEBAN 386
-#define RESV 387
-#define RESV_EXEMPT 388
-#define RSA_PRIVATE_KEY_FILE 389
-#define SECONDS 390
-#define MINUTES 391
-#define HOURS 392
-#define DAYS 393
-#define WEEKS 394
-#define MONTHS 395
-#define YEARS 396
-#define SEND_PASSWORD 397
-#define SENDQ 398
-#define SERVERHIDE 399
-#define SERVERINFO 400
-#define SHORT_MOTD 401
-#define SPOOF 402
-#define SPOOF_NOTICE 403
-#define SQUIT 404
-#define SSL_CERTIFICATE_FILE 405
-#define SSL_CERTIFICATE_FINGERPRINT 406
-#define SSL_CONNECTION_REQUIRED 407
-#define SSL_DH_ELLIPTIC_CURVE 408
-#define SSL_DH_PARAM_FILE 409
-#define SSL_MESSAGE_DIGEST_ALGORITHM 410
-#define STATS_E_DISABLED 411
-#define STATS_I_OPER_ONLY 412
-#define STATS_K_OPER_ONLY 413
-#define STATS_M_OPER_ONLY 414
-#define STATS_O_OPER_ONLY 415
-#define STATS_P_OPER_ONLY 416
-#define STATS_U_OPER_ONLY 417
-#define T_ALL 418
-#define T_BOTS 419
-#define T_CALLERID 420
-#define T_CCONN 421
-#define T_COMMAND 422
-#define T_CLUSTER 423
-#define T_DEAF 424
-#define T_DEBUG 425
-#define T_DLINE 426
-#define T_EXTERNAL 427
-#define T_FARCONNECT 428
-#define T_FILE 429
-#define T_FULL 430
-#define T_GLOBOPS 431
-#define T_INVISIBLE 432
-#define T_IPV4 433
-#define T_IPV6 434
-#define T_LOCOPS 435
-#define T_LOG 436
-#define T_NCHANGE 437
-#define T_NONONREG 438
-#define T_OPME 439
-#define T_PREPEND 440
-#define T_PSEUDO 441
-#define T_RECVQ 442
-#define T_REJ 443
-#define T_RESTART 444
-#define T_SERVER 445
-#define T_SERVICE 446
-#define T_SERVNOTICE 447
-#define T_SET 448
-#define T_SHARED 449
-#define T_SIZE 450
-#define T_SKILL 451
-#define T_SOFTCALLERID 452
-#define T_SPY 453
-#define T_SSL 454
-#define T_SSL_CIPHER_LIST 455
-#define T_TARGET 456
-#define T_UMODES 457
-#define T_UNAUTH 458
-#define T_UNDLINE 459
-#define T_UNLIMITED 460
-#define T_UNRESV 461
-#define T_UNXLINE 462
-#define T_WALLOP 463
-#define T_WALLOPS 464
-#define T_WEBIRC 465
-#define TBOOL 466
-#define THROTTLE_COUNT 467
-#define THROTTLE_TIME 468
-#define TKLINE_EXPIRE_NOTICES 469
-#define TMASKED 470
-#define TS_MAX_DELTA 471
-#define TS_WARN_DELTA 472
-#define TWODOTS 473
-#define TYPE 474
-#define UNKLINE 475
-#define USE_LOGGING 476
-#define USER 477
-#define VHOST 478
-#define VHOST6 479
-#define WARN_NO_CONNECT_BLOCK 480
-#define WHOIS 481
-#define WHOWAS_HISTORY_LENGTH 482
-#define XLINE 483
-#define XLINE_EXEMPT 484
+#define METRICS_SOCKET 350
+#define MIN_IDLE 351
+#define MIN_NONWILDCARD 352
+#define MIN_NONWILDCARD_SIMPLE 353
+#define MODULE 354
+#define MODULES 355
+#define MOTD 356
+#define NAME 357
+#define NEED_IDENT 358
+#define NEED_PASSWORD 359
+#define NETWORK_DESC 360
+#define NETWORK_NAME 361
+#define NICK 362
+#define NO_OPER_FLOOD 363
+#define NO_TILDE 364
+#define NUMBER 365
+#define NUMBER_PER_CIDR 366
+#define NUMBER_PER_IP_GLOBAL 367
+#define NUMBER_PER_IP_LOCAL 368
+#define OPER_ONLY_UMODES 369
+#define OPER_UMODES 370
+#define OPERATOR 371
+#define OPERS_BYPASS_CALLERID 372
+#define PACE_WAIT 373
+#define PACE_WAIT_SIMPLE 374
+#define PASSWORD 375
+#define PATH 376
+#define PING_COOKIE 377
+#define PING_TIME 378
+#define PORT 379
+#define QSTRING 380
+#define RANDOM_IDLE 381
+#define REASON 382
+#define REDIRPORT 383
+#define REDIRSERV 384
+#define REHASH 385
+#define REMOTE 386
+#define REMOTEBAN 387
+#define RESV 388
+#define RESV_EXEMPT 389
+#define REUSEPORT 390
+#define RSA_PRIVATE_KEY_FILE 391
+#define SECONDS 392
+#define MINUTES 393
+#define HOURS 394
+#define DAYS 395
+#define WEEKS 396
+#define MONTHS 397
+#define YEARS 398
+#define SEND_PASSWORD 399
+#define SENDQ 400
+#define SERVERHIDE 401
+#define SERVERINFO 402
+#define SHORT_MOTD 403
+#define SPOOF 404
+#define SPOOF_NOTICE 405
+#define SQUIT 406
+#define SSL_CERTIFICATE_FILE 407
+#define SSL_CERTIFICATE_FINGERPRINT 408
+#define SSL_CONNECTION_REQUIRED 409
+#define SSL_DH_ELLIPTIC_CURVE 410
+#define SSL_DH_PARAM_FILE 411
+#define SSL_MESSAGE_DIGEST_ALGORITHM 412
+#define STATS_E_DISABLED 413
+#define STATS_I_OPER_ONLY 414
+#define STATS_K_OPER_ONLY 415
+#define STATS_M_OPER_ONLY 416
+#define STATS_O_OPER_ONLY 417
+#define STATS_P_OPER_ONLY 418
+#define STATS_U_OPER_ONLY 419
+#define T_ALL 420
+#define T_BOTS 421
+#define T_CALLERID 422
+#define T_CCONN 423
+#define T_COMMAND 424
+#define T_CLUSTER 425
+#define T_DEAF 426
+#define T_DEBUG 427
+#define T_DLINE 428
+#define T_EXTERNAL 429
+#define T_FARCONNECT 430
+#define T_FILE 431
+#define T_FULL 432
+#define T_GLOBOPS 433
+#define T_INVISIBLE 434
+#define T_IPV4 435
+#define T_IPV6 436
+#define T_LOCOPS 437
+#define T_LOG 438
+#define T_NCHANGE 439
+#define T_NONONREG 440
+#define T_OPME 441
+#define T_PREPEND 442
+#define T_PSEUDO 443
+#define T_RECVQ 444
+#define T_REJ 445
+#define T_RESTART 446
+#define T_SERVER 447
+#define T_SERVICE 448
+#define T_SERVNOTICE 449
+#define T_SET 450
+#define T_SHARED 451
+#define T_SIZE 452
+#define T_SKILL 453
+#define T_SOFTCALLERID 454
+#define T_SPY 455
+#define T_SSL 456
+#define T_SSL_CIPHER_LIST 457
+#define T_TARGET 458
+#define T_UMODES 459
+#define T_UNAUTH 460
+#define T_UNDLINE 461
+#define T_UNLIMITED 462
+#define T_UNRESV 463
+#define T_UNXLINE 464
+#define T_WALLOP 465
+#define T_WALLOPS 466
+#define T_WEBIRC 467
+#define TBOOL 468
+#define THROTTLE_COUNT 469
+#define THROTTLE_TIME 470
+#define TKLINE_EXPIRE_NOTICES 471
+#define TMASKED 472
+#define TS_MAX_DELTA 473
+#define TS_WARN_DELTA 474
+#define TWODOTS 475
+#define TYPE 476
+#define UNKLINE 477
+#define USE_LOGGING 478
+#define USER 479
+#define VHOST 480
+#define VHOST6 481
+#define WARN_NO_CONNECT_BLOCK 482
+#define WHOIS 483
+#define WHOWAS_HISTORY_LENGTH 484
+#define XLINE 485
+#define XLINE_EXEMPT 486
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -678,7 +682,7 @@ union YYSTYPE
   int number;
   char *string;
 
-#line 682 "conf_parser.c" /* yacc.c:355  */
+#line 686 "conf_parser.c" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -695,7 +699,7 @@ int yyparse (void);
 
 /* Copy the second part of user declarations.  */
 
-#line 699 "conf_parser.c" /* yacc.c:358  */
+#line 703 "conf_parser.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -937,21 +941,21 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1348
+#define YYLAST   1257
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  236
+#define YYNTOKENS  238
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  295
+#define YYNNTS  296
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  668
+#define YYNRULES  671
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1319
+#define YYNSTATES  1325
 
 /* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
    by yylex, with out-of-bounds checking.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   484
+#define YYMAXUTOK   486
 
 #define YYTRANSLATE(YYX)                                                \
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -964,15 +968,15 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   234,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   235,   230,
-       2,   233,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   236,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   237,   232,
+       2,   235,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   232,     2,   231,     2,     2,     2,     2,
+       2,     2,     2,   234,     2,   233,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1008,80 +1012,81 @@ static const yytype_uint8 yytranslate[] =
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229
+     225,   226,   227,   228,   229,   230,   231
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   374,   374,   375,   378,   379,   380,   381,   382,   383,
-     384,   385,   386,   387,   388,   389,   390,   391,   392,   393,
-     394,   395,   396,   397,   398,   399,   400,   401,   405,   405,
-     406,   407,   408,   409,   410,   411,   412,   413,   416,   416,
-     417,   418,   419,   420,   427,   429,   429,   430,   430,   430,
-     432,   438,   448,   450,   450,   451,   452,   453,   454,   455,
-     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
-     466,   467,   468,   471,   480,   489,   498,   507,   516,   525,
-     540,   555,   565,   579,   588,   616,   644,   669,   691,   713,
-     723,   725,   725,   726,   727,   728,   729,   731,   740,   749,
-     763,   762,   780,   780,   781,   781,   781,   783,   789,   800,
-     799,   818,   818,   819,   819,   819,   819,   819,   821,   827,
-     833,   839,   861,   862,   862,   864,   864,   865,   867,   874,
-     874,   887,   888,   890,   890,   891,   891,   893,   901,   904,
-     910,   909,   915,   915,   916,   920,   924,   928,   932,   936,
-     940,   944,   955,   954,  1015,  1015,  1016,  1017,  1018,  1019,
-    1020,  1021,  1022,  1023,  1024,  1025,  1026,  1028,  1034,  1040,
-    1046,  1052,  1063,  1069,  1080,  1087,  1086,  1092,  1092,  1093,
-    1097,  1101,  1105,  1109,  1113,  1117,  1121,  1125,  1129,  1133,
-    1137,  1141,  1145,  1149,  1153,  1157,  1161,  1165,  1169,  1173,
-    1177,  1184,  1183,  1189,  1189,  1190,  1194,  1198,  1202,  1206,
-    1210,  1214,  1218,  1222,  1226,  1230,  1234,  1238,  1242,  1246,
-    1250,  1254,  1258,  1262,  1266,  1270,  1274,  1278,  1282,  1286,
-    1290,  1294,  1298,  1302,  1313,  1312,  1367,  1367,  1368,  1369,
-    1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,  1378,  1379,
-    1380,  1381,  1382,  1383,  1385,  1391,  1397,  1403,  1409,  1415,
-    1421,  1427,  1433,  1440,  1446,  1452,  1458,  1467,  1477,  1476,
-    1482,  1482,  1483,  1487,  1498,  1497,  1504,  1503,  1508,  1508,
-    1509,  1513,  1517,  1523,  1523,  1524,  1524,  1524,  1524,  1524,
-    1526,  1526,  1528,  1528,  1530,  1543,  1560,  1566,  1577,  1576,
-    1622,  1622,  1623,  1624,  1625,  1626,  1627,  1628,  1629,  1630,
-    1631,  1633,  1639,  1645,  1651,  1663,  1662,  1668,  1668,  1669,
-    1673,  1677,  1681,  1685,  1689,  1693,  1697,  1701,  1705,  1711,
-    1725,  1734,  1748,  1747,  1762,  1762,  1763,  1763,  1763,  1763,
-    1765,  1771,  1777,  1787,  1789,  1789,  1790,  1790,  1792,  1809,
-    1808,  1831,  1831,  1832,  1832,  1832,  1832,  1834,  1840,  1860,
-    1859,  1865,  1865,  1866,  1870,  1874,  1878,  1882,  1886,  1890,
-    1894,  1898,  1902,  1913,  1912,  1931,  1931,  1932,  1932,  1932,
-    1934,  1941,  1940,  1946,  1946,  1947,  1951,  1955,  1959,  1963,
-    1967,  1971,  1975,  1979,  1983,  1994,  1993,  2065,  2065,  2066,
-    2067,  2068,  2069,  2070,  2071,  2072,  2073,  2074,  2075,  2076,
-    2077,  2078,  2079,  2080,  2082,  2088,  2094,  2100,  2113,  2126,
-    2132,  2138,  2142,  2149,  2148,  2153,  2153,  2154,  2158,  2164,
-    2175,  2181,  2187,  2193,  2209,  2208,  2234,  2234,  2235,  2235,
-    2235,  2237,  2257,  2268,  2267,  2294,  2294,  2295,  2295,  2295,
-    2297,  2303,  2313,  2315,  2315,  2316,  2316,  2318,  2336,  2335,
-    2356,  2356,  2357,  2357,  2357,  2359,  2365,  2375,  2377,  2377,
-    2378,  2379,  2380,  2381,  2382,  2383,  2384,  2385,  2386,  2387,
-    2388,  2389,  2390,  2391,  2392,  2393,  2394,  2395,  2396,  2397,
-    2398,  2399,  2400,  2401,  2402,  2403,  2404,  2405,  2406,  2407,
-    2408,  2409,  2410,  2411,  2412,  2413,  2414,  2415,  2416,  2417,
-    2418,  2419,  2420,  2421,  2422,  2423,  2424,  2425,  2428,  2433,
-    2438,  2443,  2448,  2454,  2459,  2464,  2469,  2474,  2479,  2484,
-    2489,  2494,  2499,  2504,  2509,  2514,  2519,  2524,  2530,  2535,
-    2540,  2545,  2550,  2555,  2560,  2565,  2568,  2573,  2576,  2581,
-    2586,  2591,  2596,  2601,  2606,  2611,  2616,  2621,  2626,  2631,
-    2636,  2642,  2641,  2646,  2646,  2647,  2650,  2653,  2656,  2659,
-    2662,  2665,  2668,  2671,  2674,  2677,  2680,  2683,  2686,  2689,
-    2692,  2695,  2698,  2701,  2704,  2707,  2710,  2716,  2715,  2720,
-    2720,  2721,  2724,  2727,  2730,  2733,  2736,  2739,  2742,  2745,
-    2748,  2751,  2754,  2757,  2760,  2763,  2766,  2769,  2772,  2775,
-    2778,  2783,  2788,  2793,  2798,  2807,  2809,  2809,  2810,  2811,
-    2812,  2813,  2814,  2815,  2816,  2817,  2818,  2819,  2820,  2821,
-    2822,  2823,  2824,  2826,  2831,  2836,  2841,  2846,  2851,  2856,
-    2861,  2866,  2871,  2876,  2881,  2886,  2891,  2900,  2902,  2902,
-    2903,  2904,  2905,  2906,  2907,  2908,  2909,  2910,  2911,  2912,
-    2914,  2920,  2936,  2945,  2951,  2957,  2963,  2972,  2978
+       0,   376,   376,   377,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,   401,   402,   403,   407,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   418,   418,
+     419,   420,   421,   422,   429,   431,   431,   432,   432,   432,
+     434,   440,   450,   452,   452,   453,   454,   455,   456,   457,
+     458,   459,   460,   461,   462,   463,   464,   465,   466,   467,
+     468,   469,   470,   473,   482,   491,   500,   509,   518,   527,
+     542,   557,   567,   581,   590,   618,   646,   671,   693,   715,
+     725,   727,   727,   728,   729,   730,   731,   733,   742,   751,
+     765,   764,   782,   782,   783,   783,   783,   785,   791,   802,
+     801,   820,   820,   821,   821,   821,   821,   821,   823,   829,
+     835,   841,   863,   864,   864,   866,   866,   867,   869,   876,
+     876,   889,   890,   892,   892,   893,   893,   895,   903,   906,
+     912,   911,   917,   917,   918,   922,   926,   930,   934,   938,
+     942,   946,   957,   956,  1017,  1017,  1018,  1019,  1020,  1021,
+    1022,  1023,  1024,  1025,  1026,  1027,  1028,  1030,  1036,  1042,
+    1048,  1054,  1065,  1071,  1082,  1089,  1088,  1094,  1094,  1095,
+    1099,  1103,  1107,  1111,  1115,  1119,  1123,  1127,  1131,  1135,
+    1139,  1143,  1147,  1151,  1155,  1159,  1163,  1167,  1171,  1175,
+    1179,  1186,  1185,  1191,  1191,  1192,  1196,  1200,  1204,  1208,
+    1212,  1216,  1220,  1224,  1228,  1232,  1236,  1240,  1244,  1248,
+    1252,  1256,  1260,  1264,  1268,  1272,  1276,  1280,  1284,  1288,
+    1292,  1296,  1300,  1304,  1315,  1314,  1369,  1369,  1370,  1371,
+    1372,  1373,  1374,  1375,  1376,  1377,  1378,  1379,  1380,  1381,
+    1382,  1383,  1384,  1385,  1387,  1393,  1399,  1405,  1411,  1417,
+    1423,  1429,  1435,  1442,  1448,  1454,  1460,  1469,  1479,  1478,
+    1484,  1484,  1485,  1489,  1500,  1499,  1506,  1505,  1510,  1510,
+    1511,  1515,  1519,  1523,  1529,  1529,  1530,  1530,  1530,  1530,
+    1530,  1532,  1532,  1534,  1534,  1536,  1549,  1566,  1572,  1583,
+    1582,  1628,  1628,  1629,  1630,  1631,  1632,  1633,  1634,  1635,
+    1636,  1637,  1639,  1645,  1651,  1657,  1669,  1668,  1674,  1674,
+    1675,  1679,  1683,  1687,  1691,  1695,  1699,  1703,  1707,  1711,
+    1717,  1731,  1740,  1754,  1753,  1768,  1768,  1769,  1769,  1769,
+    1769,  1771,  1777,  1783,  1793,  1795,  1795,  1796,  1796,  1798,
+    1815,  1814,  1837,  1837,  1838,  1838,  1838,  1838,  1840,  1846,
+    1866,  1865,  1871,  1871,  1872,  1876,  1880,  1884,  1888,  1892,
+    1896,  1900,  1904,  1908,  1919,  1918,  1937,  1937,  1938,  1938,
+    1938,  1940,  1947,  1946,  1952,  1952,  1953,  1957,  1961,  1965,
+    1969,  1973,  1977,  1981,  1985,  1989,  2000,  1999,  2071,  2071,
+    2072,  2073,  2074,  2075,  2076,  2077,  2078,  2079,  2080,  2081,
+    2082,  2083,  2084,  2085,  2086,  2088,  2094,  2100,  2106,  2119,
+    2132,  2138,  2144,  2148,  2155,  2154,  2159,  2159,  2160,  2164,
+    2170,  2181,  2187,  2193,  2199,  2215,  2214,  2240,  2240,  2241,
+    2241,  2241,  2243,  2263,  2274,  2273,  2300,  2300,  2301,  2301,
+    2301,  2303,  2309,  2319,  2321,  2321,  2322,  2322,  2324,  2342,
+    2341,  2362,  2362,  2363,  2363,  2363,  2365,  2371,  2381,  2383,
+    2383,  2384,  2385,  2386,  2387,  2388,  2389,  2390,  2391,  2392,
+    2393,  2394,  2395,  2396,  2397,  2398,  2399,  2400,  2401,  2402,
+    2403,  2404,  2405,  2406,  2407,  2408,  2409,  2410,  2411,  2412,
+    2413,  2414,  2415,  2416,  2417,  2418,  2419,  2420,  2421,  2422,
+    2423,  2424,  2425,  2426,  2427,  2428,  2429,  2430,  2431,  2432,
+    2435,  2440,  2445,  2450,  2455,  2461,  2470,  2475,  2480,  2485,
+    2490,  2495,  2500,  2505,  2510,  2515,  2520,  2525,  2530,  2535,
+    2540,  2546,  2551,  2556,  2561,  2566,  2571,  2576,  2581,  2584,
+    2589,  2592,  2597,  2602,  2607,  2612,  2617,  2622,  2627,  2632,
+    2637,  2642,  2647,  2652,  2658,  2657,  2662,  2662,  2663,  2666,
+    2669,  2672,  2675,  2678,  2681,  2684,  2687,  2690,  2693,  2696,
+    2699,  2702,  2705,  2708,  2711,  2714,  2717,  2720,  2723,  2726,
+    2732,  2731,  2736,  2736,  2737,  2740,  2743,  2746,  2749,  2752,
+    2755,  2758,  2761,  2764,  2767,  2770,  2773,  2776,  2779,  2782,
+    2785,  2788,  2791,  2794,  2799,  2804,  2809,  2814,  2823,  2825,
+    2825,  2826,  2827,  2828,  2829,  2830,  2831,  2832,  2833,  2834,
+    2835,  2836,  2837,  2838,  2839,  2840,  2842,  2847,  2852,  2857,
+    2862,  2867,  2872,  2877,  2882,  2887,  2892,  2897,  2902,  2907,
+    2916,  2918,  2918,  2919,  2920,  2921,  2922,  2923,  2924,  2925,
+    2926,  2927,  2928,  2930,  2936,  2952,  2961,  2967,  2973,  2979,
+    2988,  2994
 };
 #endif
 
@@ -1112,20 +1117,20 @@ static const char *const yytname[] =
   "KNOCK_DELAY_CHANNEL", "LEAF_MASK", "LISTEN", "MASK", "MAX_ACCEPT",
   "MAX_BANS", "MAX_BANS_LARGE", "MAX_CHANNELS", "MAX_IDLE", "MAX_INVITES",
   "MAX_NICK_CHANGES", "MAX_NICK_LENGTH", "MAX_NICK_TIME", "MAX_NUMBER",
-  "MAX_TARGETS", "MAX_TOPIC_LENGTH", "MAX_WATCH", "MIN_IDLE",
-  "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MODULE", "MODULES", "MOTD",
-  "NAME", "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESC", "NETWORK_NAME",
-  "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER", "NUMBER_PER_CIDR",
-  "NUMBER_PER_IP_GLOBAL", "NUMBER_PER_IP_LOCAL", "OPER_ONLY_UMODES",
-  "OPER_UMODES", "OPERATOR", "OPERS_BYPASS_CALLERID", "PACE_WAIT",
-  "PACE_WAIT_SIMPLE", "PASSWORD", "PATH", "PING_COOKIE", "PING_TIME",
-  "PORT", "QSTRING", "RANDOM_IDLE", "REASON", "REDIRPORT", "REDIRSERV",
-  "REHASH", "REMOTE", "REMOTEBAN", "RESV", "RESV_EXEMPT",
-  "RSA_PRIVATE_KEY_FILE", "SECONDS", "MINUTES", "HOURS", "DAYS", "WEEKS",
-  "MONTHS", "YEARS", "SEND_PASSWORD", "SENDQ", "SERVERHIDE", "SERVERINFO",
-  "SHORT_MOTD", "SPOOF", "SPOOF_NOTICE", "SQUIT", "SSL_CERTIFICATE_FILE",
-  "SSL_CERTIFICATE_FINGERPRINT", "SSL_CONNECTION_REQUIRED",
-  "SSL_DH_ELLIPTIC_CURVE", "SSL_DH_PARAM_FILE",
+  "MAX_TARGETS", "MAX_TOPIC_LENGTH", "MAX_WATCH", "METRICS_SOCKET",
+  "MIN_IDLE", "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MODULE",
+  "MODULES", "MOTD", "NAME", "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESC",
+  "NETWORK_NAME", "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER",
+  "NUMBER_PER_CIDR", "NUMBER_PER_IP_GLOBAL", "NUMBER_PER_IP_LOCAL",
+  "OPER_ONLY_UMODES", "OPER_UMODES", "OPERATOR", "OPERS_BYPASS_CALLERID",
+  "PACE_WAIT", "PACE_WAIT_SIMPLE", "PASSWORD", "PATH", "PING_COOKIE",
+  "PING_TIME", "PORT", "QSTRING", "RANDOM_IDLE", "REASON", "REDIRPORT",
+  "REDIRSERV", "REHASH", "REMOTE", "REMOTEBAN", "RESV", "RESV_EXEMPT",
+  "REUSEPORT", "RSA_PRIVATE_KEY_FILE", "SECONDS", "MINUTES", "HOURS",
+  "DAYS", "WEEKS", "MONTHS", "YEARS", "SEND_PASSWORD", "SENDQ",
+  "SERVERHIDE", "SERVERINFO", "SHORT_MOTD", "SPOOF", "SPOOF_NOTICE",
+  "SQUIT", "SSL_CERTIFICATE_FILE", "SSL_CERTIFICATE_FINGERPRINT",
+  "SSL_CONNECTION_REQUIRED", "SSL_DH_ELLIPTIC_CURVE", "SSL_DH_PARAM_FILE",
   "SSL_MESSAGE_DIGEST_ALGORITHM", "STATS_E_DISABLED", "STATS_I_OPER_ONLY",
   "STATS_K_OPER_ONLY", "STATS_M_OPER_ONLY", "STATS_O_OPER_ONLY",
   "STATS_P_OPER_ONLY", "STATS_U_OPER_ONLY", "T_ALL", "T_BOTS",
@@ -1200,25 +1205,26 @@ static const char *const yytname[] =
   "general_entry", "general_items", "general_item", "general_away_count",
   "general_away_time", "general_max_watch",
   "general_whowas_history_length", "general_cycle_on_host_change",
-  "general_dline_min_cidr", "general_dline_min_cidr6",
-  "general_kline_min_cidr", "general_kline_min_cidr6",
-  "general_tkline_expire_notices", "general_kill_chase_time_limit",
-  "general_ignore_bogus_ts", "general_failed_oper_notice",
-  "general_anti_nick_flood", "general_max_nick_time",
-  "general_max_nick_changes", "general_max_accept",
-  "general_anti_spam_exit_message_time", "general_ts_warn_delta",
-  "general_ts_max_delta", "general_invisible_on_connect",
-  "general_warn_no_connect_block", "general_stats_e_disabled",
-  "general_stats_m_oper_only", "general_stats_o_oper_only",
-  "general_stats_P_oper_only", "general_stats_u_oper_only",
-  "general_stats_k_oper_only", "general_stats_i_oper_only",
-  "general_pace_wait", "general_caller_id_wait",
-  "general_opers_bypass_callerid", "general_pace_wait_simple",
-  "general_short_motd", "general_no_oper_flood", "general_dots_in_ident",
-  "general_max_targets", "general_ping_cookie", "general_disable_auth",
-  "general_throttle_count", "general_throttle_time", "general_oper_umodes",
-  "$@25", "umode_oitems", "umode_oitem", "general_oper_only_umodes",
-  "$@26", "umode_items", "umode_item", "general_min_nonwildcard",
+  "general_metrics_socket", "general_dline_min_cidr",
+  "general_dline_min_cidr6", "general_kline_min_cidr",
+  "general_kline_min_cidr6", "general_tkline_expire_notices",
+  "general_kill_chase_time_limit", "general_ignore_bogus_ts",
+  "general_failed_oper_notice", "general_anti_nick_flood",
+  "general_max_nick_time", "general_max_nick_changes",
+  "general_max_accept", "general_anti_spam_exit_message_time",
+  "general_ts_warn_delta", "general_ts_max_delta",
+  "general_invisible_on_connect", "general_warn_no_connect_block",
+  "general_stats_e_disabled", "general_stats_m_oper_only",
+  "general_stats_o_oper_only", "general_stats_P_oper_only",
+  "general_stats_u_oper_only", "general_stats_k_oper_only",
+  "general_stats_i_oper_only", "general_pace_wait",
+  "general_caller_id_wait", "general_opers_bypass_callerid",
+  "general_pace_wait_simple", "general_short_motd",
+  "general_no_oper_flood", "general_dots_in_ident", "general_max_targets",
+  "general_ping_cookie", "general_disable_auth", "general_throttle_count",
+  "general_throttle_time", "general_oper_umodes", "$@25", "umode_oitems",
+  "umode_oitem", "general_oper_only_umodes", "$@26", "umode_items",
+  "umode_item", "general_min_nonwildcard",
   "general_min_nonwildcard_simple", "general_default_floodcount",
   "general_default_floodtime", "channel_entry", "channel_items",
   "channel_item", "channel_disable_fake_channels",
@@ -1265,14 +1271,14 @@ static const yytype_uint16 yytoknum[] =
      455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
      465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
      475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-      59,   125,   123,    61,    44,    58
+     485,   486,    59,   125,   123,    61,    44,    58
 };
 # endif
 
-#define YYPACT_NINF -1054
+#define YYPACT_NINF -928
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-1054)))
+  (!!((Yystate) == (-928)))
 
 #define YYTABLE_NINF -130
 
@@ -1283,138 +1289,139 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-   -1054,   723, -1054,  -205,  -214,  -204, -1054, -1054, -1054,  -188,
-   -1054,  -183, -1054, -1054, -1054,  -180, -1054, -1054, -1054,  -175,
-    -165, -1054,  -159, -1054,  -144, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054,   294,   939,  -143,  -116,  -108,    21,  -107,   414,   -97,
-     -96,   -72,    33,   -58,   -57,   -39,   985,   583,   -28,    15,
-     -26,    11,   -23,  -156,  -150,    -8,     4,     3, -1054, -1054,
-   -1054, -1054, -1054,    23,    50,    52,    60,    68,    69,    71,
-      76,    85,    96,   104,   105,   106,   110,   272, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054,   729,   578,    38, -1054,   112,    19, -1054,
-   -1054,    81, -1054,   113,   114,   118,   121,   125,   128,   130,
-     133,   135,   136,   138,   139,   142,   146,   147,   152,   156,
-     157,   170,   173,   174,   175,   176,   178,   179,   180, -1054,
-   -1054,   181,   183,   185,   186,   189,   203,   207,   209,   210,
-     211,   212,   214,   219,   221,   222,   224,   225,   227,   229,
-      55, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   440,
-      41,    67,    -7,   231,   235,     2, -1054, -1054, -1054,    26,
-     386,    30, -1054,   236,   237,   238,   239,   242,   244,   245,
-     247,   248,   143, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054,    14,   249,   250,   251,   253,   257,   258,
-     259,   260,   262,   265,   266,   267,   268,   276,   282,   283,
-     285,   153, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-      16,    58,   286,    34, -1054, -1054, -1054,   100,   193, -1054,
-     287,    47, -1054, -1054,    62, -1054,   269,   339,   370,   292,
-   -1054,   168,   403,   315,   420,   403,   403,   403,   424,   403,
-     403,   425,   427,   430,   431,   311, -1054,   312,   310,   313,
-     314, -1054,   316,   317,   318,   319,   320,   321,   322,   324,
-     328,   331,   333,   230, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-     347,   336,   345,   349,   352,   353,   356, -1054,   357,   359,
-     360,   362,   363,   365,   367,   325, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054,   368,   369,    29, -1054, -1054, -1054,   421,   350,
-   -1054, -1054,   371,   372,    39, -1054, -1054, -1054,   392,   403,
-     435,   403,   403,   395,   449,   403,   396,   500,   501,   505,
-     404,   405,   407,   403,   510,   511,   512,   520,   403,   523,
-     524,   526,   528,   432,   411,   413,   436,   403,   403,   438,
-     443,   444,  -168,  -160,   445,   447,   448,   450,   529,   403,
-     452,   403,   403,   454,   551,   437, -1054,   441,   433,   442,
-   -1054,   456,   457,   458,   459,   460,    31, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054,   461,   462,    44,
-   -1054, -1054, -1054,   453,   463,   465, -1054,   470, -1054,    10,
-   -1054, -1054, -1054, -1054, -1054,   544,   546,   455, -1054,   474,
-     472,   473,    28, -1054, -1054, -1054,   477,   475,   476, -1054,
-     479,   481,   482,   485, -1054,   486,   489,   160, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   495,
-     498,   499,   502,    12, -1054, -1054, -1054, -1054,   467,   469,
-     403,   550,   515,   604,   532,   534,   537,   504, -1054, -1054,
-     631,   625,   539,   629,   645,   646,   633,   635,   638,   639,
-     641,   649,   652,   656,   657,   662,   663,   558, -1054,   561,
-     559, -1054,    20, -1054, -1054, -1054, -1054,   584,   567, -1054,
-      13,   572,   575,   576,   579,   580,    18, -1054, -1054, -1054,
-   -1054, -1054,   687,   586, -1054,   587,   588, -1054,   592,     7,
-   -1054, -1054, -1054, -1054,   589,   596,   597, -1054,   598,   261,
-     599,   601,   603,   605,   606,   612,   614,   615,   616,   617,
-     618,   619,   622, -1054, -1054,   725,   744,   403,   621,   747,
-     403,   748,   403,   708,   749,   750,   751,   403,   752,   752,
-     632, -1054, -1054,   739,  -119,   740,   654,   742,   745,   637,
-     753,   754,   762,   757,   760,   764,   765,   643, -1054,   770,
-     772,   665, -1054,   667, -1054,   775,   776,   671, -1054,   675,
-     681,   682,   685,   689,   693,   694,   697,   700,   702,   705,
-     707,   713,   715,   716,   717,   720,   726,   727,   730,   731,
-     732,   733,   737,   738,   741,   756,   602,   743,   746,   758,
-     759,   763,   766,   767,   774,   777,   779,   780,   781,   782,
-     783,   784,   788,   790,   791,   795,   797,   801, -1054, -1054,
-     831,   768,   653,   845,   861,   850,   856,   857,   802, -1054,
-     859,   863,   805, -1054, -1054,   866,   868,   761,   886,   806,
-   -1054,   807,   811, -1054, -1054,   881,   884,   812, -1054, -1054,
-     919,   833,   813,   921,   923,   924,   838,   817,   927,   928,
-     823, -1054, -1054,   930,   931,   932,   827, -1054,   828,   829,
-     830,   832,   834,   835,   836,   837,   839, -1054,   840,   841,
-     842,   843,   844,   846,   847,   848,   849,   851,   852,   853,
-     854,   855,   858,   860,   862, -1054, -1054,   937,   864,   865,
-   -1054,   869, -1054,    94, -1054,   944,   951,   956,   962,   870,
-   -1054,   871, -1054, -1054,   963,   872,   965,   873, -1054, -1054,
-   -1054, -1054, -1054,   403,   403,   403,   403,   403,   403,   403,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054,   874,   876,   877,   -29,   878,
-     879,   880,   882,   883,   885,   887,   888,   889,   279,   890,
-     891, -1054,   892,   893,   894,   895,   896,   897,   898,     6,
-     899,   900,   901,   902,   903,   904,   905, -1054,   906,   907,
-   -1054, -1054,   908,   909, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054,  -176, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054,  -158, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   910,   911,
-     608,   912,   913,   914,   915,   916, -1054,   917,   918, -1054,
-     920,   922,   -33,   875,   925, -1054, -1054, -1054, -1054,   926,
-     933, -1054,   934,   935,   493,   936,   938,   940,   941,   710,
-     942,   943, -1054,   945,   946,   947, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054,   948,   771, -1054, -1054,   949,   929,   950,
-   -1054,    45, -1054, -1054, -1054, -1054,   952,   954,   955,   957,
-   -1054, -1054,   958,   778,   959, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,  -149, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   752,
-     752,   752, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054,  -124, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   756,
-   -1054,   602, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054,   -50, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,   -12, -1054,
-     982,   886,   960, -1054, -1054, -1054, -1054, -1054, -1054,   867,
-   -1054,   961,   964, -1054, -1054,   966,   967, -1054, -1054,   968,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054,   -10, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-      -2, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,    66, -1054,
-   -1054,   970,   -85,   953,   974, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054,    80, -1054, -1054, -1054,   -29, -1054, -1054, -1054, -1054,
-       6, -1054, -1054, -1054,   608, -1054,   -33, -1054, -1054, -1054,
-     981,   984,  1019,  1021,  1024,  1025, -1054,   493, -1054,   710,
-   -1054,   771,   975,   976,   977,   295, -1054, -1054,   778, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054,    89, -1054, -1054, -1054,   295, -1054
+    -928,   704,  -928,  -215,  -207,  -190,  -928,  -928,  -928,  -179,
+    -928,  -174,  -928,  -928,  -928,  -156,  -928,  -928,  -928,  -147,
+    -144,  -928,  -137,  -928,  -126,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,   319,   989,  -124,  -114,  -112,    35,  -109,   409,   -78,
+     -57,   -49,    67,   -39,   -34,   -28,   354,   574,   -26,    14,
+     -21,    19,   -10,    -4,    -3,    41,    49,    15,  -928,  -928,
+    -928,  -928,  -928,    59,    64,    66,    68,    69,    73,    77,
+      80,    82,    87,    92,    94,    96,   100,   299,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,   696,   642,    12,  -928,   107,    24,  -928,
+    -928,    85,  -928,   108,   109,   110,   112,   115,   118,   119,
+     123,   124,   136,   139,   143,   146,   150,   159,   160,   161,
+     166,   169,   170,   171,   178,   179,   185,   187,   189,   190,
+    -928,  -928,   191,   192,   193,   194,   195,   202,   203,   204,
+     205,   207,   208,   215,   217,   218,   220,   221,   223,   225,
+     227,    56,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,   435,    10,    39,   116,   231,   232,    20,  -928,  -928,
+    -928,    13,   392,   180,  -928,   235,   237,   238,   244,   246,
+     247,   250,   252,   253,   243,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,   257,   255,   260,   263,   265,
+     270,   273,   276,   280,   283,   284,   285,   286,   287,   290,
+     295,   298,   309,   154,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,    81,   302,   312,     3,  -928,  -928,  -928,    63,
+      22,  -928,   313,    60,  -928,  -928,    58,  -928,   267,   338,
+     353,   320,  -928,   206,   382,   340,   446,   382,   382,   382,
+     451,   382,   382,   452,   468,   469,   470,   322,  -928,   349,
+     347,   348,   350,  -928,   351,   352,   356,   357,   358,   359,
+     363,   364,   365,   368,   370,   228,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,   376,   374,   375,   378,   379,   380,   383,  -928,
+     384,   386,   394,   397,   398,   402,   405,   333,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,   406,   411,    18,  -928,  -928,  -928,
+     463,   412,  -928,  -928,   413,   414,    32,  -928,  -928,  -928,
+     421,   382,   479,   382,   382,   438,   501,   382,   441,   502,
+     546,   547,   445,   447,   449,   382,   554,   555,   559,   560,
+     382,   561,   562,   548,   565,   567,   465,   448,   450,   471,
+     382,   382,   473,   475,   476,  -189,  -176,   477,   478,   480,
+     481,   572,   382,   482,   382,   382,   483,   582,   467,  -928,
+     474,   466,   472,  -928,   484,   487,   489,   492,   493,   113,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+     499,   500,    34,  -928,  -928,  -928,   485,   503,   504,  -928,
+     505,  -928,     2,  -928,  -928,  -928,  -928,  -928,   577,   578,
+     509,  -928,   510,   508,   511,   157,  -928,  -928,  -928,   515,
+     513,   514,  -928,   517,   518,   519,   520,  -928,   521,   523,
+      45,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,   529,   527,   530,   532,    30,  -928,  -928,  -928,
+    -928,   498,   524,   382,   587,   551,   590,   556,   558,   564,
+     536,  -928,  -928,   606,   611,   566,   647,   663,   665,   653,
+     655,   658,   664,   666,   669,   671,   672,   676,   677,   678,
+     553,  -928,   579,   571,  -928,    47,  -928,  -928,  -928,  -928,
+     575,   583,  -928,   580,   584,   586,   588,   589,   591,     7,
+    -928,  -928,  -928,  -928,  -928,   692,   595,  -928,   596,   594,
+    -928,   597,    31,  -928,  -928,  -928,  -928,   598,   599,   602,
+    -928,   603,   399,   604,   607,   608,   613,   614,   615,   616,
+     617,   620,   621,   622,   624,   625,  -928,  -928,   680,   708,
+     382,   623,   712,   382,   728,   382,   718,   749,   750,   751,
+     382,   752,   752,   631,  -928,  -928,   739,  -151,   740,   657,
+     746,   747,   638,   753,   754,   779,   770,   771,   773,   776,
+     670,  -928,   780,   781,   679,  -928,   681,  -928,   787,   790,
+     684,  -928,   685,   686,   688,   689,   690,   691,   693,   694,
+     695,   699,   700,   703,   706,   710,   711,   713,   716,   717,
+     719,   721,   722,   723,   725,   726,   727,   731,   732,   807,
+     709,   733,   734,   736,   737,   738,   744,   745,   748,   755,
+     756,   761,   763,   764,   766,   767,   768,   772,   777,   778,
+     782,   786,  -928,  -928,   799,   789,   705,   825,   794,   858,
+     860,   869,   791,  -928,   883,   888,   792,  -928,  -928,   894,
+     896,   793,   915,   795,  -928,   797,   798,  -928,  -928,   901,
+     906,   800,  -928,  -928,   908,   821,   801,   910,   912,   913,
+     826,   805,   916,   917,   811,  -928,  -928,   920,   923,   924,
+     822,  -928,   823,   824,   827,   829,   830,   831,   832,   837,
+     839,  -928,   843,   845,   846,   847,   848,   849,   850,   851,
+     852,   853,   854,   855,   856,   857,   859,   861,   862,  -928,
+    -928,   932,   835,   863,  -928,   864,  -928,    84,  -928,   933,
+     965,   967,   972,   866,  -928,   867,  -928,  -928,   975,   868,
+     976,   870,  -928,  -928,  -928,  -928,  -928,   382,   382,   382,
+     382,   382,   382,   382,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,   872,
+     873,   874,   -30,   875,   876,   877,   878,   879,   880,   881,
+     882,   884,    62,   885,   886,  -928,   887,   889,   890,   891,
+     892,   893,   895,     4,   897,   898,   899,   900,   902,   903,
+     904,  -928,   905,   907,  -928,  -928,   909,   911,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -194,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -193,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,   914,   918,   456,   919,   921,   922,   925,
+     926,  -928,   927,   928,  -928,   929,   930,     1,   935,   931,
+    -928,  -928,  -928,  -928,   934,   936,  -928,   937,   938,   444,
+     939,   940,   941,   942,   762,   943,   944,  -928,   945,   946,
+     947,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,   948,   660,
+    -928,  -928,   949,   950,   951,  -928,    33,  -928,  -928,  -928,
+    -928,   952,   955,   956,   957,  -928,  -928,   958,   838,   959,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -185,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,   752,   752,   752,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -182,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,   807,  -928,   709,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -180,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -160,  -928,  1005,   915,   960,  -928,
+    -928,  -928,  -928,  -928,  -928,   961,  -928,   962,   963,  -928,
+    -928,   964,   966,  -928,  -928,   968,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -129,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,   -40,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,   -35,  -928,  -928,   995,   -84,   969,
+     970,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,   -29,  -928,  -928,
+    -928,   -30,  -928,  -928,  -928,  -928,     4,  -928,  -928,  -928,
+     456,  -928,     1,  -928,  -928,  -928,   997,   993,  1002,  1007,
+    1011,  1013,  -928,   444,  -928,   762,  -928,   660,   974,   977,
+     978,   377,  -928,  -928,   838,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,    -9,
+    -928,  -928,  -928,   377,  -928
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1422,208 +1429,209 @@ static const yytype_int16 yypact[] =
      means the default is an error.  */
 static const yytype_uint16 yydefact[] =
 {
-       2,     0,     1,     0,     0,     0,   234,   395,   443,     0,
-     458,     0,   298,   434,   274,     0,   100,   152,   332,     0,
-       0,   373,     0,   109,     0,   349,     3,    23,    11,     4,
+       2,     0,     1,     0,     0,     0,   234,   396,   444,     0,
+     459,     0,   299,   435,   274,     0,   100,   152,   333,     0,
+       0,   374,     0,   109,     0,   350,     3,    23,    11,     4,
       24,    25,     5,     6,     8,     9,    10,    13,    14,    15,
       16,    17,    18,    19,    20,    22,    21,     7,    12,    26,
       27,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    92,    93,
-      95,    94,   632,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   617,   631,
-     620,   621,   622,   623,   624,   625,   626,   627,   628,   618,
-     619,   629,   630,     0,     0,     0,   456,     0,     0,   454,
-     455,     0,   517,     0,     0,     0,     0,     0,     0,     0,
+      95,    94,   635,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   620,   634,
+     623,   624,   625,   626,   627,   628,   629,   630,   631,   621,
+     622,   632,   633,     0,     0,     0,   457,     0,     0,   455,
+     456,     0,   519,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   587,
-     561,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   469,   470,   471,   515,   478,   516,   510,   511,   512,
-     513,   509,   482,   472,   473,   474,   475,   476,   477,   479,
-     480,   481,   483,   484,   514,   488,   489,   490,   491,   487,
-     486,   492,   499,   500,   493,   494,   495,   485,   497,   507,
-     508,   505,   506,   498,   496,   503,   504,   501,   502,     0,
-       0,     0,     0,     0,     0,     0,    46,    47,    48,     0,
-       0,     0,   659,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   649,   650,   651,   652,   653,   654,   655,
-     657,   656,   658,     0,     0,     0,     0,     0,     0,     0,
+     590,   564,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    54,    69,    66,    64,    70,    71,    65,    55,
-      68,    58,    59,    60,    56,    67,    61,    62,    63,    57,
-       0,     0,     0,     0,   124,   125,   126,     0,     0,   347,
-       0,     0,   345,   346,     0,    96,     0,     0,     0,     0,
-      91,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   616,     0,     0,     0,
-       0,   268,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   237,   238,   241,   243,   244,   245,
-     246,   247,   248,   249,   239,   240,   242,   250,   251,   252,
-       0,     0,     0,     0,     0,     0,     0,   423,     0,     0,
-       0,     0,     0,     0,     0,     0,   398,   399,   400,   401,
-     402,   403,   404,   406,   405,   408,   412,   409,   410,   411,
-     407,   449,     0,     0,     0,   446,   447,   448,     0,     0,
-     453,   464,     0,     0,     0,   461,   462,   463,     0,     0,
+       0,     0,   470,   471,   472,   516,   479,   517,   518,   511,
+     512,   513,   514,   510,   483,   473,   474,   475,   476,   477,
+     478,   480,   481,   482,   484,   485,   515,   489,   490,   491,
+     492,   488,   487,   493,   500,   501,   494,   495,   496,   486,
+     498,   508,   509,   506,   507,   499,   497,   504,   505,   502,
+     503,     0,     0,     0,     0,     0,     0,     0,    46,    47,
+      48,     0,     0,     0,   662,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   652,   653,   654,   655,   656,
+     657,   658,   660,   659,   661,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    54,    69,    66,    64,    70,    71,
+      65,    55,    68,    58,    59,    60,    56,    67,    61,    62,
+      63,    57,     0,     0,     0,     0,   124,   125,   126,     0,
+       0,   348,     0,     0,   346,   347,     0,    96,     0,     0,
+       0,     0,    91,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   619,     0,
+       0,     0,     0,   268,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   237,   238,   241,   243,
+     244,   245,   246,   247,   248,   249,   239,   240,   242,   250,
+     251,   252,     0,     0,     0,     0,     0,     0,     0,   424,
+       0,     0,     0,     0,     0,     0,     0,     0,   399,   400,
+     401,   402,   403,   404,   405,   407,   406,   409,   413,   410,
+     411,   412,   408,   450,     0,     0,     0,   447,   448,   449,
+       0,     0,   454,   465,     0,     0,     0,   462,   463,   464,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   468,     0,     0,     0,
-     315,     0,     0,     0,     0,     0,     0,   301,   302,   303,
-     304,   309,   305,   306,   307,   308,   440,     0,     0,     0,
-     437,   438,   439,     0,     0,     0,   276,     0,   286,     0,
-     284,   285,   287,   288,    49,     0,     0,     0,    45,     0,
-       0,     0,     0,   103,   104,   105,     0,     0,     0,   201,
-       0,     0,     0,     0,   175,     0,     0,     0,   155,   156,
-     157,   158,   159,   162,   163,   164,   161,   160,   165,     0,
-       0,     0,     0,     0,   335,   336,   337,   338,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   648,    72,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    53,     0,
-       0,   381,     0,   376,   377,   378,   127,     0,     0,   123,
-       0,     0,     0,     0,     0,     0,     0,   112,   113,   115,
-     114,   116,     0,     0,   344,     0,     0,   359,     0,     0,
-     352,   353,   354,   355,     0,     0,     0,    90,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   469,
+       0,     0,     0,   316,     0,     0,     0,     0,     0,     0,
+     302,   303,   304,   305,   310,   306,   307,   308,   309,   441,
+       0,     0,     0,   438,   439,   440,     0,     0,     0,   276,
+       0,   287,     0,   285,   286,   288,   289,    49,     0,     0,
+       0,    45,     0,     0,     0,     0,   103,   104,   105,     0,
+       0,     0,   201,     0,     0,     0,     0,   175,     0,     0,
+       0,   155,   156,   157,   158,   159,   162,   163,   164,   161,
+     160,   165,     0,     0,     0,     0,     0,   336,   337,   338,
+     339,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   651,    72,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   615,   253,     0,     0,     0,     0,     0,
+       0,    53,     0,     0,   382,     0,   377,   378,   379,   127,
+       0,     0,   123,     0,     0,     0,     0,     0,     0,     0,
+     112,   113,   115,   114,   116,     0,     0,   345,     0,     0,
+     360,     0,     0,   353,   354,   355,   356,     0,     0,     0,
+      90,     0,    28,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   618,   253,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   236,   413,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   397,     0,
-       0,     0,   445,     0,   452,     0,     0,     0,   460,     0,
+       0,     0,     0,     0,   236,   414,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   398,     0,     0,     0,   446,     0,   453,     0,     0,
+       0,   461,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   467,   310,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   300,
-       0,     0,     0,   436,   289,     0,     0,     0,     0,     0,
-     283,     0,     0,    44,   106,     0,     0,     0,   102,   166,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   154,   339,     0,     0,     0,     0,   334,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   647,     0,     0,
+       0,     0,   468,   311,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   301,     0,     0,     0,   437,   290,     0,
+       0,     0,     0,     0,   284,     0,     0,    44,   106,     0,
+       0,     0,   102,   166,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   154,   340,     0,     0,     0,
+       0,   335,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   650,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    52,
+     380,     0,     0,     0,   376,     0,   122,     0,   117,     0,
+       0,     0,     0,     0,   111,     0,   344,   357,     0,     0,
+       0,     0,   352,    99,    98,    97,   648,    28,    28,    28,
+      28,    28,    28,    28,    30,    29,   649,   636,   637,   638,
+     639,   640,   641,   642,   643,   646,   647,   644,   645,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    52,   379,     0,     0,     0,
-     375,     0,   122,     0,   117,     0,     0,     0,     0,     0,
-     111,     0,   343,   356,     0,     0,     0,     0,   351,    99,
-      98,    97,   645,    28,    28,    28,    28,    28,    28,    28,
-      30,    29,   646,   633,   634,   635,   636,   637,   638,   639,
-     640,   643,   644,   641,   642,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    38,     0,
-       0,   235,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   396,     0,     0,
-     444,   457,     0,     0,   459,   531,   535,   518,   519,   550,
-     522,   613,   614,   558,   523,   524,   555,   530,   529,   538,
-     528,   525,   526,   534,   533,   532,   556,   520,   611,   612,
-     554,   597,   591,   607,   592,   593,   594,   602,   610,   595,
-     604,   608,   598,   609,   599,   603,   596,   606,   601,   600,
-     605,     0,   590,   570,   571,   572,   565,   583,   566,   567,
-     568,   578,   586,   569,   580,   584,   574,   585,   575,   579,
-     573,   582,   577,   576,   581,     0,   564,   551,   549,   552,
-     557,   553,   540,   547,   548,   545,   546,   541,   542,   543,
-     544,   559,   560,   527,   537,   536,   539,   521,     0,     0,
-       0,     0,     0,     0,     0,     0,   299,     0,     0,   435,
-       0,     0,     0,   294,   290,   293,   275,    50,    51,     0,
-       0,   101,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   153,     0,     0,     0,   333,   663,   660,   661,
-     662,   667,   666,   668,   664,   665,    86,    81,    89,    80,
-      87,    88,    79,    83,    82,    74,    73,    78,    75,    77,
-      76,    84,    85,     0,     0,   374,   128,     0,     0,     0,
-     140,     0,   132,   133,   135,   134,     0,     0,     0,     0,
-     110,   348,     0,     0,     0,   350,    31,    32,    33,    34,
-      35,    36,    37,   263,   264,   258,   273,   272,     0,   271,
-     259,   267,   260,   266,   254,   265,   257,   256,   255,    38,
-      38,    38,    40,    39,   261,   262,   418,   421,   422,   432,
-     429,   415,   430,   427,   428,     0,   426,   431,   414,   420,
-     417,   419,   433,   416,   450,   451,   465,   466,   588,     0,
-     562,     0,   313,   314,   324,   320,   321,   323,   328,   325,
-     326,   319,   327,   322,     0,   318,   312,   331,   330,   329,
-     311,   442,   441,   297,   296,   281,   282,   280,     0,   279,
-       0,     0,     0,   107,   108,   174,   171,   221,   233,   208,
-     217,     0,   206,   211,   227,     0,   220,   225,   231,   210,
-     213,   222,   224,   228,   218,   226,   214,   232,   216,   223,
-     212,   215,     0,   204,   167,   169,   172,   173,   184,   185,
-     186,   179,   197,   180,   181,   182,   192,   200,   183,   194,
-     198,   188,   199,   189,   193,   187,   196,   191,   190,   195,
-       0,   178,   168,   170,   342,   340,   341,   380,   385,   391,
-     394,   387,   393,   388,   392,   390,   386,   389,     0,   384,
-     136,     0,     0,     0,     0,   131,   119,   118,   120,   121,
-     357,   363,   369,   372,   365,   371,   366,   370,   368,   364,
-     367,     0,   362,   358,   269,     0,    41,    42,    43,   424,
-       0,   589,   563,   316,     0,   277,     0,   295,   292,   291,
-       0,     0,     0,     0,     0,     0,   202,     0,   176,     0,
-     382,     0,     0,     0,     0,     0,   130,   360,     0,   270,
-     425,   317,   278,   207,   230,   205,   229,   219,   209,   203,
-     177,   383,   137,   139,   138,   150,   149,   145,   147,   151,
-     148,   144,   146,     0,   143,   361,   141,     0,   142
+       0,     0,    38,     0,     0,   235,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   397,     0,     0,   445,   458,     0,     0,   460,   534,
+     538,   520,   521,   553,   524,   616,   617,   561,   526,   527,
+     558,   533,   532,   541,   531,   528,   529,   537,   536,   535,
+     559,   522,   525,   614,   615,   557,   600,   594,   610,   595,
+     596,   597,   605,   613,   598,   607,   611,   601,   612,   602,
+     606,   599,   609,   604,   603,   608,     0,   593,   573,   574,
+     575,   568,   586,   569,   570,   571,   581,   589,   572,   583,
+     587,   577,   588,   578,   582,   576,   585,   580,   579,   584,
+       0,   567,   554,   552,   555,   560,   556,   543,   550,   551,
+     548,   549,   544,   545,   546,   547,   562,   563,   530,   540,
+     539,   542,   523,     0,     0,     0,     0,     0,     0,     0,
+       0,   300,     0,     0,   436,     0,     0,     0,   295,   291,
+     294,   275,    50,    51,     0,     0,   101,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   153,     0,     0,
+       0,   334,   666,   663,   664,   665,   670,   669,   671,   667,
+     668,    86,    81,    89,    80,    87,    88,    79,    83,    82,
+      74,    73,    78,    75,    77,    76,    84,    85,     0,     0,
+     375,   128,     0,     0,     0,   140,     0,   132,   133,   135,
+     134,     0,     0,     0,     0,   110,   349,     0,     0,     0,
+     351,    31,    32,    33,    34,    35,    36,    37,   263,   264,
+     258,   273,   272,     0,   271,   259,   267,   260,   266,   254,
+     265,   257,   256,   255,    38,    38,    38,    40,    39,   261,
+     262,   419,   422,   423,   433,   430,   416,   431,   428,   429,
+       0,   427,   432,   415,   421,   418,   420,   434,   417,   451,
+     452,   466,   467,   591,     0,   565,     0,   314,   315,   325,
+     321,   322,   324,   329,   326,   327,   320,   328,   323,     0,
+     319,   313,   332,   331,   330,   312,   443,   442,   298,   297,
+     281,   283,   282,   280,     0,   279,     0,     0,     0,   107,
+     108,   174,   171,   221,   233,   208,   217,     0,   206,   211,
+     227,     0,   220,   225,   231,   210,   213,   222,   224,   228,
+     218,   226,   214,   232,   216,   223,   212,   215,     0,   204,
+     167,   169,   172,   173,   184,   185,   186,   179,   197,   180,
+     181,   182,   192,   200,   183,   194,   198,   188,   199,   189,
+     193,   187,   196,   191,   190,   195,     0,   178,   168,   170,
+     343,   341,   342,   381,   386,   392,   395,   388,   394,   389,
+     393,   391,   387,   390,     0,   385,   136,     0,     0,     0,
+       0,   131,   119,   118,   120,   121,   358,   364,   370,   373,
+     366,   372,   367,   371,   369,   365,   368,     0,   363,   359,
+     269,     0,    41,    42,    43,   425,     0,   592,   566,   317,
+       0,   277,     0,   296,   293,   292,     0,     0,     0,     0,
+       0,     0,   202,     0,   176,     0,   383,     0,     0,     0,
+       0,     0,   130,   361,     0,   270,   426,   318,   278,   207,
+     230,   205,   229,   219,   209,   203,   177,   384,   137,   139,
+     138,   150,   149,   145,   147,   151,   148,   144,   146,     0,
+     143,   362,   141,     0,   142
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-   -1054, -1054, -1054,  -394,  -310, -1053,  -638, -1054, -1054,   969,
-   -1054, -1054, -1054, -1054,   792, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054,  1037, -1054, -1054, -1054, -1054, -1054,
-   -1054,   594, -1054, -1054, -1054, -1054, -1054,   565, -1054, -1054,
-   -1054, -1054, -1054, -1054,   971, -1054, -1054, -1054, -1054,   107,
-   -1054, -1054, -1054, -1054, -1054,  -219, -1054, -1054, -1054,   640,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054,  -118, -1054, -1054, -1054,  -117, -1054, -1054, -1054,   824,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054,   -86, -1054, -1054,
-   -1054, -1054, -1054,   -92, -1054,   691, -1054, -1054, -1054,    40,
-   -1054, -1054, -1054, -1054, -1054,   734, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054,   -83, -1054, -1054, -1054, -1054, -1054, -1054,
-     659, -1054, -1054, -1054, -1054, -1054,   972, -1054, -1054, -1054,
-   -1054,   609, -1054, -1054, -1054, -1054, -1054,   -95, -1054, -1054,
-   -1054,   623, -1054, -1054, -1054, -1054,   -84, -1054, -1054, -1054,
-     973, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054,   -62, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054,   735, -1054, -1054, -1054, -1054, -1054,   815, -1054, -1054,
-   -1054, -1054,  1092, -1054, -1054, -1054, -1054,   808, -1054, -1054,
-   -1054, -1054,  1041, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054,    92, -1054, -1054,
-   -1054,    97, -1054, -1054, -1054, -1054, -1054, -1054,  1118, -1054,
-   -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054,   978, -1054, -1054, -1054, -1054,
-   -1054, -1054, -1054, -1054, -1054
+    -928,  -928,  -928,  -463,  -312,  -927,  -641,  -928,  -928,   980,
+    -928,  -928,  -928,  -928,   865,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  1068,  -928,  -928,  -928,  -928,  -928,
+    -928,   643,  -928,  -928,  -928,  -928,  -928,   563,  -928,  -928,
+    -928,  -928,  -928,  -928,   953,  -928,  -928,  -928,  -928,    91,
+    -928,  -928,  -928,  -928,  -928,  -167,  -928,  -928,  -928,   629,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -122,  -928,  -928,  -928,  -119,  -928,  -928,  -928,   820,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,   -79,  -928,  -928,
+    -928,  -928,  -928,   -89,  -928,   701,  -928,  -928,  -928,    37,
+    -928,  -928,  -928,  -928,  -928,   742,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,   -75,  -928,  -928,  -928,  -928,  -928,  -928,
+     661,  -928,  -928,  -928,  -928,  -928,   954,  -928,  -928,  -928,
+    -928,   610,  -928,  -928,  -928,  -928,  -928,   -98,  -928,  -928,
+    -928,   633,  -928,  -928,  -928,  -928,   -74,  -928,  -928,  -928,
+     840,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,   -52,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,   741,  -928,  -928,  -928,  -928,  -928,   819,  -928,  -928,
+    -928,  -928,  1098,  -928,  -928,  -928,  -928,   812,  -928,  -928,
+    -928,  -928,  1048,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,    95,  -928,
+    -928,  -928,    98,  -928,  -928,  -928,  -928,  -928,  -928,  1123,
+    -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928,   981,  -928,  -928,  -928,
+    -928,  -928,  -928,  -928,  -928,  -928
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    26,   830,   831,  1092,  1093,    27,   225,   226,
-     227,   228,    28,   271,   272,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
-     288,   289,    29,    77,    78,    79,    80,    81,    30,    63,
-     502,   503,   504,   505,    31,    70,   586,   587,   588,   589,
-     590,   591,    32,   293,   294,   295,   296,   297,  1051,  1052,
-    1053,  1054,  1055,  1233,  1313,  1314,    33,    64,   517,   518,
-     519,   520,   521,   522,   523,   524,   525,   526,   527,   757,
-    1210,  1211,   528,   752,  1182,  1183,    34,    53,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   628,  1078,  1079,    35,    61,
-     488,   737,  1148,  1149,   489,   490,   491,  1152,   994,   995,
-     492,   493,    36,    59,   466,   467,   468,   469,   470,   471,
-     472,   722,  1134,  1135,   473,   474,   475,    37,    65,   533,
-     534,   535,   536,   537,    38,   301,   302,   303,    39,    72,
-     599,   600,   601,   602,   603,   815,  1251,  1252,    40,    68,
-     572,   573,   574,   575,   798,  1228,  1229,    41,    54,   375,
-     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
-     649,  1105,  1106,   386,   387,   388,   389,   390,    42,    60,
-     479,   480,   481,   482,    43,    55,   394,   395,   396,   397,
-      44,   118,   119,   120,    45,    57,   404,   405,   406,   407,
-      46,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
-     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
-     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   212,   213,   435,   955,   956,   214,   434,
-     931,   932,   215,   216,   217,   218,    47,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,   112,    48,   242,   243,   244,   245,   246,   247,
-     248,   249,   250,   251,   252
+      -1,     1,    26,   834,   835,  1097,  1098,    27,   227,   228,
+     229,   230,    28,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,    29,    77,    78,    79,    80,    81,    30,    63,
+     505,   506,   507,   508,    31,    70,   589,   590,   591,   592,
+     593,   594,    32,   295,   296,   297,   298,   299,  1056,  1057,
+    1058,  1059,  1060,  1239,  1319,  1320,    33,    64,   520,   521,
+     522,   523,   524,   525,   526,   527,   528,   529,   530,   761,
+    1216,  1217,   531,   756,  1188,  1189,    34,    53,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   361,   631,  1083,  1084,    35,    61,
+     491,   741,  1154,  1155,   492,   493,   494,  1158,   999,  1000,
+     495,   496,    36,    59,   469,   470,   471,   472,   473,   474,
+     475,   726,  1139,  1140,   476,   477,   478,    37,    65,   536,
+     537,   538,   539,   540,    38,   303,   304,   305,    39,    72,
+     602,   603,   604,   605,   606,   819,  1257,  1258,    40,    68,
+     575,   576,   577,   578,   802,  1234,  1235,    41,    54,   377,
+     378,   379,   380,   381,   382,   383,   384,   385,   386,   387,
+     652,  1110,  1111,   388,   389,   390,   391,   392,    42,    60,
+     482,   483,   484,   485,    43,    55,   396,   397,   398,   399,
+      44,   118,   119,   120,    45,    57,   406,   407,   408,   409,
+      46,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,   213,   214,   215,   438,   960,   961,   216,
+     437,   936,   937,   217,   218,   219,   220,    47,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,    48,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1631,490 +1639,474 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     859,   860,   610,   222,    73,   613,   614,   615,   595,   617,
-     618,   483,   299,   529,  1103,  1145,   291,   569,    51,   581,
-     116,   569,   116,  1076,   858,    49,    50,   499,    52,   499,
-     391,   529,   457,    74,   222,   291,  1256,  1257,  1258,   391,
-     401,    75,   476,   703,    56,   476,  1047,   704,   299,    58,
-     458,   705,    62,   530,  1118,   706,   122,    66,  1119,   863,
-     864,   123,   124,   595,   125,   126,   484,    67,   483,   127,
-     459,   530,  1120,    69,   305,   485,  1121,   486,   128,   129,
-     130,  1254,   401,   306,   117,  1255,   117,   131,    71,   113,
-     132,   133,   134,   531,   392,  1047,  1077,   135,   460,   670,
-     223,   672,   673,   392,    76,   676,  1259,   500,   596,   500,
-    1260,   531,   300,   684,   136,   137,   114,   570,   689,   582,
-    1283,   570,   224,   484,   115,   121,   138,   698,   699,   139,
-     140,   223,   485,   487,   486,   219,   220,   141,   532,   712,
-     402,   714,   715,   142,   232,   143,  1048,   144,   300,   145,
-     461,   146,   147,   224,   253,   393,   532,  1146,   462,   463,
-     221,   506,   148,   596,   393,   403,  1147,   477,   149,   150,
-     477,   151,   152,   153,   229,   230,   154,   233,   464,   507,
-    1263,   254,   402,   255,  1264,   583,   234,   235,   236,  -129,
-     487,   237,   238,   231,   581,  1048,   239,   240,   241,   508,
-     501,   155,   501,   584,   290,  1104,   298,   403,  -129,   304,
-     256,   156,   157,   158,   159,   160,   161,   162,  1265,   585,
-    1276,   257,  1266,   494,  1277,   307,   597,   509,  1278,   598,
-     770,   327,  1279,   497,   309,   571,   292,   308,   817,   571,
-    1049,   739,   258,   766,   549,   803,   259,   328,   329,   809,
-     399,   799,   330,   465,   260,   292,   311,   261,   262,   747,
-     661,   510,   728,   478,  1050,   578,   478,   163,   164,   165,
-     667,   166,   167,    82,   580,   732,  1234,   608,   593,   511,
-     168,   597,   169,   312,   598,   313,   455,   263,   576,  1049,
-    1089,  1090,  1091,   314,   582,    73,  1280,   331,    83,    84,
-    1281,   315,   316,   264,   317,    85,   265,   266,   267,   318,
-    1287,   512,   513,  1050,  1288,   332,   333,   847,   319,  1316,
-     850,   334,   852,  1317,    74,   335,   360,   857,   361,   320,
-     362,   336,    75,    86,    87,    88,    89,   321,   322,   323,
-     337,   338,   339,   324,   363,   398,   408,   409,    90,    91,
-      92,   410,   340,   268,   411,    93,    94,    95,   412,    96,
-     583,   413,   514,   414,   364,  1305,   415,  1306,   416,   417,
-     609,   418,   419,   341,   547,   420,   269,   270,   584,   421,
-     422,   365,   515,   366,   567,   423,   516,   506,   858,   424,
-     425,   760,   367,   604,   585,    76,   823,   824,   825,   826,
-     827,   828,   829,   426,   368,   507,   427,   428,   429,   430,
-    1307,   431,   432,   433,   436,   122,   437,   342,   438,   439,
-     123,   124,   440,   125,   126,   508,   369,  1308,   127,  1066,
-    1067,  1068,  1069,  1070,  1071,  1072,   441,   128,   129,   130,
-     442,   457,   443,   444,   445,   446,   131,   447,   370,   132,
-     133,   134,   448,   509,   449,   450,   135,   451,   452,   458,
-     453,   640,   454,   605,   495,  1309,  1310,   371,   496,   538,
-     539,   540,   541,   136,   137,   542,   372,   543,   544,   459,
-     545,   546,   550,   551,   552,   138,   553,   510,   139,   140,
-     554,   555,   556,   557,   606,   558,   141,  1157,   559,   560,
-     561,   562,   142,   325,   143,   511,   144,   460,   145,   563,
-     146,   147,   609,  1158,  1159,   564,   565,  1311,   566,   577,
-     592,   148,   607,  1312,  1160,   373,   611,   149,   150,   612,
-     151,   152,   153,   616,   619,   154,   620,   512,   513,   621,
-     622,   623,   624,   625,   671,   663,   626,   627,   374,   629,
-     630,   631,   632,   633,   634,   635,   657,   636,   675,   461,
-     155,   637,  1161,  1162,   638,  1163,   639,   462,   463,   643,
-     156,   157,   158,   159,   160,   161,   162,   642,   644,   360,
-     664,   361,   645,   362,   253,   646,   647,   464,   514,   648,
-     650,  1164,   651,   652,  1284,   653,   654,   363,   655,  1165,
-     656,   659,   660,   669,   665,   666,   674,   677,   515,   678,
-     679,   254,   516,   255,   680,   681,   682,   364,   683,   685,
-     686,   687,  1166,  1124,  1167,  1168,   163,   164,   165,   688,
-     166,   167,   690,   691,   365,   692,   366,   693,   711,   168,
-     256,   169,  1169,   694,   695,   367,   696,   697,  1125,   700,
-     933,   257,   934,   935,   701,   702,   707,   368,   708,   709,
-     717,   710,   465,   713,  1170,   716,   720,   718,   741,  1171,
-     742,   719,   258,  1172,   771,   721,   259,  1173,   768,   369,
-     769,  1126,  1174,   734,   260,   743,  1175,   261,   262,   723,
-     724,   725,   726,   727,   730,   731,   735,  1176,   736,  1177,
-    1178,   370,  1179,   738,   744,   745,   746,   749,   750,   751,
-    1127,  1128,   753,  1180,   754,   755,  1129,   263,   756,   758,
-     371,  1181,   759,     2,     3,   762,   772,     4,   773,   372,
-     327,   763,   764,   264,   777,   765,   265,   266,   267,     5,
-     778,  1130,     6,   774,     7,   775,   328,   329,   776,   779,
-     780,   330,     8,   781,   782,   783,  1131,   784,  1188,   785,
-    1189,  1190,   786,   787,     9,   788,   936,   937,   938,    10,
-      11,   939,   940,   789,   941,   942,   790,   943,   373,   944,
-     791,   792,   945,   268,   946,   947,   793,   794,   795,    12,
-     948,   796,   797,    13,   949,   801,   331,   802,   950,   951,
-     952,   374,   804,    14,   911,   953,   269,   270,   805,   806,
-     954,   811,   807,   808,   332,   333,   812,   813,  1132,   819,
-     334,   814,    15,    16,   335,   816,   820,   821,   822,   832,
-     336,   833,   853,   834,   845,   835,   836,  1133,    17,   337,
-     338,   339,   837,  1218,   838,   839,   840,   841,   842,   843,
-    1241,   340,   844,   846,   848,    18,   849,   851,   854,   855,
-     856,   858,   861,   862,   865,   866,   867,    19,    20,   868,
-     869,   872,   341,   877,  1191,  1192,  1193,   870,   871,  1194,
-    1195,   873,  1196,  1197,   874,  1198,   980,  1199,   875,   876,
-    1200,    21,  1201,  1202,   878,   880,   879,   881,  1203,   882,
-     883,   884,  1204,  1219,    22,   885,  1205,  1206,  1207,    23,
-    1242,   886,   887,  1208,    24,   888,   342,    25,  1209,   889,
-     912,   913,   914,   890,   891,   915,   916,   892,   917,   918,
-     893,   919,   894,   920,  1220,   895,   921,   896,   922,   923,
-      82,  1243,  1221,   897,   924,   898,   899,   900,   925,  1244,
-     901,  1222,   926,   927,   928,   978,   902,   903,  1245,   929,
-     904,   905,   906,   907,   930,    83,    84,   908,   909,   981,
-     982,   910,    85,   957,   983,  1223,   958,  1224,  1225,   979,
-     984,   985,  1246,   987,  1247,  1248,   232,   988,   959,   960,
-     990,  1226,   991,   961,   992,   993,   962,   963,  1249,  1227,
-      86,    87,    88,    89,   964,   999,  1250,   965,  1000,   966,
-     967,   968,   969,   970,   971,    90,    91,    92,   972,   233,
-     973,   974,    93,    94,    95,   975,    96,   976,   234,   235,
-     236,   977,   986,   237,   238,   989,   996,   997,   239,   240,
-     241,   998,  1001,  1002,  1003,  1005,  1004,  1006,  1007,  1008,
-    1009,  1010,  1011,  1012,  1013,  1014,  1015,  1016,  1017,  1018,
-    1019,  1043,  1020,   568,  1021,  1022,  1023,  1024,  1056,  1025,
-    1026,  1027,  1028,  1029,  1030,  1057,  1031,  1032,  1033,  1034,
-    1058,  1035,  1036,  1037,  1038,  1039,  1059,  1062,  1040,  1064,
-    1041,  1267,  1042,  1150,  1282,  1045,   748,  1044,  1318,  1046,
-    1060,  1061,  1270,  1065,  1073,  1063,  1074,  1075,  1080,  1081,
-    1082,  1293,  1083,  1084,   310,  1085,  1294,  1086,  1087,  1088,
-    1094,  1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,  1107,
-    1108,  1109,  1110,  1111,  1112,  1113,  1114,  1115,  1116,  1117,
-    1122,  1123,  1136,  1137,  1138,  1139,  1140,  1141,  1142,  1295,
-    1143,   810,  1144,  1296,  1297,  1298,  1153,   761,  1235,  1151,
-    1299,  1300,  1231,  1154,  1155,  1156,  1184,   641,  1185,  1289,
-    1186,  1187,  1212,  1213,  1292,  1214,  1215,  1216,  1217,  1230,
-     740,  1291,  1236,  1232,  1237,  1238,  1285,  1239,  1240,  1253,
-    1269,  1268,   767,  1315,   498,   800,  1271,  1301,  1290,  1272,
-     729,  1273,  1274,  1275,  1286,  1302,  1303,  1304,   818,   662,
-     400,   456,   668,  1262,   733,   326,  1261,     0,     0,     0,
-     548,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   579,     0,     0,     0,     0,     0,
-       0,     0,     0,   594,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     863,   864,   613,   486,   293,   616,   617,   618,   584,   620,
+     621,   479,  1108,   393,   502,   293,    73,    49,    50,   393,
+     301,   224,  1081,   584,   707,   116,   862,    51,   708,   867,
+     868,   532,   598,   403,  1052,   479,   116,   709,  1123,  1125,
+     486,   710,  1124,  1126,    52,    74,   509,  1260,   572,  1150,
+    1265,  1261,  1269,    75,  1266,    56,  1270,   122,   487,   598,
+      58,   301,   123,   124,   510,   125,   126,   488,   224,   489,
+     127,   533,  1271,  1094,  1095,  1096,  1272,   394,    62,   128,
+     129,   130,   572,   394,   511,  1052,   403,    66,   131,   117,
+      67,   132,   133,   134,   503,   487,  1082,    69,   135,   673,
+     117,   675,   676,  1282,   488,   679,   489,  1283,    71,   585,
+     113,   534,   512,   687,   460,   136,   137,    76,   692,   225,
+     114,   302,   115,  1289,   585,   121,   490,   138,   702,   703,
+     139,   140,   461,   599,   404,  1053,  1151,   480,   141,   395,
+     716,   226,   718,   719,   142,   395,   143,   513,   144,   573,
+     145,   146,   462,   147,   148,   255,   221,   535,   502,   405,
+     599,   480,   302,   490,   149,   514,   225,  1262,  1263,  1264,
+     150,   151,   862,   152,   153,   154,   586,   222,   155,  -129,
+     463,   532,   256,   573,   257,   223,  1053,   404,   226,   504,
+    -129,   586,  1284,  1152,   587,   231,  1285,  1286,   515,   516,
+     232,  1287,  1153,  1293,   156,  1109,   233,  1294,   292,   587,
+     588,   258,   405,   300,   157,   158,   159,   160,   161,   162,
+     163,   533,   259,  1322,   306,   588,   294,  1323,   307,   329,
+    1054,   774,   308,   464,   481,   743,   581,   294,   503,   583,
+     813,   465,   466,   260,   234,   330,   331,   261,   311,   517,
+     332,   664,   600,   500,  1055,   601,   262,   401,   481,   263,
+     264,   534,   467,   770,   821,   670,  1240,   736,   574,   518,
+     164,   165,   166,   519,   167,   168,   309,   235,   764,   600,
+     803,  1054,   601,   169,   310,   170,   236,   237,   238,   458,
+     265,   239,   240,   596,   313,   333,   241,   242,   243,   314,
+      82,   315,   574,   316,   317,  1055,   266,   535,   318,   267,
+     268,   269,   319,   334,   335,   320,   611,   321,   851,   336,
+      73,   854,   322,   856,   337,    83,    84,   323,   861,   324,
+     338,   325,    85,   504,   362,   326,   363,   468,   364,   339,
+     340,   341,   400,   410,   411,   412,   732,   413,   497,    74,
+     414,   342,   365,   415,   416,   234,   270,    75,   417,   418,
+      86,    87,    88,    89,  1071,  1072,  1073,  1074,  1075,  1076,
+    1077,   419,   366,   343,   420,    90,    91,    92,   421,   271,
+     272,   422,    93,    94,    95,   423,    96,   570,   235,   367,
+     751,   368,   607,   509,   424,   425,   426,   236,   237,   238,
+     369,   427,   239,   240,   428,   429,   430,   241,   242,   243,
+     122,   510,   370,   431,   432,   123,   124,   344,   125,   126,
+     433,    76,   434,   127,   435,   436,   439,   440,   441,   442,
+     443,   511,   128,   129,   130,   371,   460,   444,   445,   446,
+     447,   131,   448,   449,   132,   133,   134,  1311,  1163,  1312,
+     450,   135,   451,   452,   461,   453,   454,   372,   455,   512,
+     456,   643,   457,   608,  1164,  1165,   498,   499,   136,   137,
+     541,  1129,   542,   543,   462,  1166,   550,   373,   609,   544,
+     138,   545,   546,   139,   140,   547,   374,   548,   549,   552,
+     553,   141,   612,  1313,   513,   554,  1130,   142,   555,   143,
+     556,   144,   463,   145,   146,   557,   147,   148,   558,   612,
+    1314,   559,   514,  1167,  1168,   560,  1169,   149,   561,   562,
+     563,   564,   565,   150,   151,   566,   152,   153,   154,  1131,
+     567,   155,   327,   568,   579,   375,   827,   828,   829,   830,
+     831,   832,   833,  1170,   569,   515,   516,   580,   595,  1315,
+    1316,  1171,   610,   614,   626,   464,   615,   156,   376,  1132,
+    1133,   619,   622,   465,   466,  1134,   660,   157,   158,   159,
+     160,   161,   162,   163,  1172,   255,  1173,  1174,   623,   624,
+     625,   627,   628,   629,   467,   630,   632,   633,   666,   674,
+    1135,   634,   635,   636,   637,  1175,   517,  1290,   638,   639,
+     640,  1317,   256,   641,   257,   642,  1136,  1318,   645,   646,
+     647,   678,   681,   648,   649,   650,   518,  1176,   651,   653,
+     519,   654,  1177,   164,   165,   166,  1178,   167,   168,   655,
+    1179,   258,   656,   657,   672,  1180,   169,   658,   170,  1181,
+     659,   662,   259,   362,   667,   363,   663,   364,   668,   669,
+    1182,   677,  1183,  1184,   680,  1185,   682,   683,   684,   468,
+     685,   365,   686,   260,   688,   689,  1186,   261,  1137,   690,
+     691,   693,   694,   695,  1187,   696,   262,   697,   698,   263,
+     264,   366,   715,   699,   701,   700,   704,  1138,   705,   706,
+     711,   712,   721,   713,   714,   717,   720,   329,   367,   722,
+     368,   724,   745,   746,     2,     3,   723,   725,     4,   369,
+     265,   772,   775,   330,   331,   777,   782,   738,   332,   727,
+       5,   370,   728,     6,   729,     7,   266,   730,   731,   267,
+     268,   269,  1224,     8,   734,   735,   783,   773,   739,   740,
+     742,   747,   748,   749,   371,     9,   750,   753,   754,   755,
+      10,    11,   757,   758,   759,   760,   762,   938,   763,   939,
+     940,   766,   767,   333,   776,   768,   372,   769,   781,   778,
+      12,   779,   785,   786,    13,   787,   270,   780,   788,   784,
+     789,   334,   335,   790,    14,   799,   373,   336,   805,   791,
+     849,   792,   337,  1225,   793,   374,   794,   795,   338,   271,
+     272,   796,   797,   798,    15,    16,   801,   339,   340,   341,
+    1194,   800,  1195,  1196,   807,   806,   808,   815,   850,   342,
+      17,   809,   853,   810,   811,  1226,   812,   816,   817,   818,
+     823,   824,   820,  1227,   825,   826,   836,    18,   855,   837,
+     838,   343,  1228,   857,   375,   839,   840,   841,   842,   843,
+      19,    20,   844,   845,   846,   916,   847,   848,   852,   858,
+     859,   860,   862,   865,   866,   869,  1229,   376,  1230,  1231,
+     870,   871,   872,   873,    21,   941,   942,   943,   874,   875,
+     944,   945,  1232,   946,   947,   344,   948,    22,   949,   876,
+    1233,   950,    23,   951,   952,   877,   878,    24,   879,   953,
+      25,   880,   881,   954,   987,   882,   883,   955,   956,   957,
+    1247,   884,   886,   885,   958,   887,   888,   889,   890,   959,
+     891,   892,   893,   894,   983,   895,   896,   897,  1197,  1198,
+    1199,   898,   899,  1200,  1201,   900,  1202,  1203,   901,  1204,
+     985,  1205,   902,   903,  1206,   904,  1207,  1208,   905,   906,
+     986,   907,  1209,   908,   909,   910,  1210,   911,   912,   913,
+    1211,  1212,  1213,   914,   915,   962,   963,  1214,   964,   965,
+     966,  1248,  1215,   917,   918,   919,   967,   968,   920,   921,
+     969,   922,   923,   988,   924,   989,   925,   970,   971,   926,
+      82,   927,   928,   972,   990,   973,   974,   929,   975,   976,
+     977,   930,   984,  1249,   978,   931,   932,   933,   992,   979,
+     980,  1250,   934,   993,   981,    83,    84,   935,   982,   995,
+    1251,   996,    85,   991,   994,   998,  1004,  1001,   997,  1002,
+    1003,  1005,  1006,  1007,  1008,  1010,  1009,  1011,  1012,  1013,
+    1014,  1015,  1016,  1017,  1252,  1018,  1253,  1254,  1019,  1020,
+      86,    87,    88,    89,  1021,  1022,  1023,  1048,  1061,  1024,
+    1255,  1025,  1026,  1027,  1028,    90,    91,    92,  1256,  1029,
+    1049,  1030,    93,    94,    95,  1031,    96,  1032,  1033,  1034,
+    1035,  1036,  1037,  1038,  1039,  1040,  1041,  1042,  1043,  1044,
+    1062,  1045,  1063,  1046,  1047,  1050,  1051,  1064,  1065,  1066,
+    1067,  1069,  1070,  1068,  1078,  1079,  1080,  1085,  1086,  1087,
+    1088,  1089,  1090,  1091,  1092,  1273,  1093,  1099,  1100,  1101,
+    1288,  1102,  1103,  1104,  1105,  1106,  1300,  1107,  1299,  1112,
+    1113,  1114,  1115,  1301,  1116,  1117,  1118,  1119,   571,  1120,
+    1302,  1121,  1303,  1122,  1304,   312,  1127,  1241,   752,   765,
+    1128,  1141,   814,  1142,  1143,  1156,  1324,  1144,  1145,  1146,
+    1147,  1148,  1149,  1306,  1305,   644,  1159,  1157,  1160,  1161,
+    1162,  1190,  1191,  1192,  1193,  1218,  1219,  1220,  1221,  1222,
+    1223,  1236,  1295,  1298,  1242,  1237,  1238,  1243,  1244,  1245,
+    1246,  1259,  1275,   744,  1274,  1297,  1321,   771,  1276,  1277,
+    1278,  1279,  1292,  1280,  1291,  1281,  1308,   501,   804,  1309,
+    1310,   733,   822,  1307,  1296,   665,   402,   661,   671,   459,
+     328,  1268,  1267,   737,     0,   551,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   658
+       0,     0,     0,     0,     0,     0,     0,     0,   582,     0,
+       0,     0,     0,     0,     0,     0,     0,   597
 };
 
 static const yytype_int16 yycheck[] =
 {
-     638,   639,   312,     1,     1,   315,   316,   317,     1,   319,
-     320,     1,     1,     1,     8,    48,     1,     1,   232,     1,
-       1,     1,     1,    52,   109,   230,   231,     1,   232,     1,
-       1,     1,     1,    30,     1,     1,  1089,  1090,  1091,     1,
-       1,    38,     1,   211,   232,     1,     1,   215,     1,   232,
-      19,   211,   232,    41,   230,   215,     1,   232,   234,   178,
-     179,     6,     7,     1,     9,    10,    56,   232,     1,    14,
-      39,    41,   230,   232,   230,    65,   234,    67,    23,    24,
-      25,   230,     1,   233,    65,   234,    65,    32,   232,   232,
-      35,    36,    37,    81,    65,     1,   125,    42,    67,   409,
-      98,   411,   412,    65,   101,   415,   230,    81,   101,    81,
-     234,    81,   101,   423,    59,    60,   232,   101,   428,   101,
-     205,   101,   120,    56,   232,   232,    71,   437,   438,    74,
-      75,    98,    65,   123,    67,   232,   232,    82,   126,   449,
-     101,   451,   452,    88,     1,    90,   101,    92,   101,    94,
-     119,    96,    97,   120,     1,   126,   126,   190,   127,   128,
-     232,     1,   107,   101,   126,   126,   199,   126,   113,   114,
-     126,   116,   117,   118,   232,   232,   121,    34,   147,    19,
-     230,    28,   101,    30,   234,   167,    43,    44,    45,   174,
-     123,    48,    49,   232,     1,   101,    53,    54,    55,    39,
-     174,   146,   174,   185,   232,   199,   232,   126,   174,   232,
-      57,   156,   157,   158,   159,   160,   161,   162,   230,   201,
-     230,    68,   234,   230,   234,   233,   219,    67,   230,   222,
-     540,     1,   234,   231,   231,   219,   221,   233,   231,   219,
-     195,   231,    89,   231,   230,   232,    93,    17,    18,   231,
-     231,   231,    22,   222,   101,   221,   233,   104,   105,   231,
-     231,   101,   231,   222,   219,   231,   222,   212,   213,   214,
-     231,   216,   217,     1,   174,   231,   231,   109,   231,   119,
-     225,   219,   227,   233,   222,   233,   231,   134,   230,   195,
-      11,    12,    13,   233,   101,     1,   230,    67,    26,    27,
-     234,   233,   233,   150,   233,    33,   153,   154,   155,   233,
-     230,   151,   152,   219,   234,    85,    86,   627,   233,   230,
-     630,    91,   632,   234,    30,    95,     1,   637,     3,   233,
-       5,   101,    38,    61,    62,    63,    64,   233,   233,   233,
-     110,   111,   112,   233,    19,   233,   233,   233,    76,    77,
-      78,   233,   122,   200,   233,    83,    84,    85,   233,    87,
-     167,   233,   202,   233,    39,    70,   233,    72,   233,   233,
-     109,   233,   233,   143,   231,   233,   223,   224,   185,   233,
-     233,    56,   222,    58,   231,   233,   226,     1,   109,   233,
-     233,   231,    67,   124,   201,   101,   135,   136,   137,   138,
-     139,   140,   141,   233,    79,    19,   233,   233,   233,   233,
-     115,   233,   233,   233,   233,     1,   233,   187,   233,   233,
-       6,     7,   233,     9,    10,    39,   101,   132,    14,   823,
-     824,   825,   826,   827,   828,   829,   233,    23,    24,    25,
-     233,     1,   233,   233,   233,   233,    32,   233,   123,    35,
-      36,    37,   233,    67,   233,   233,    42,   233,   233,    19,
-     233,   231,   233,   124,   233,   170,   171,   142,   233,   233,
-     233,   233,   233,    59,    60,   233,   151,   233,   233,    39,
-     233,   233,   233,   233,   233,    71,   233,   101,    74,    75,
-     233,   233,   233,   233,   124,   233,    82,     4,   233,   233,
-     233,   233,    88,   231,    90,   119,    92,    67,    94,   233,
-      96,    97,   109,    20,    21,   233,   233,   222,   233,   233,
-     233,   107,   230,   228,    31,   200,   211,   113,   114,   109,
-     116,   117,   118,   109,   109,   121,   109,   151,   152,   109,
-     109,   230,   230,   233,   109,   124,   233,   233,   223,   233,
-     233,   233,   233,   233,   233,   233,   231,   233,   109,   119,
-     146,   233,    69,    70,   233,    72,   233,   127,   128,   233,
-     156,   157,   158,   159,   160,   161,   162,   230,   233,     1,
-     230,     3,   233,     5,     1,   233,   233,   147,   202,   233,
-     233,    98,   233,   233,  1232,   233,   233,    19,   233,   106,
-     233,   233,   233,   211,   233,   233,   211,   211,   222,   109,
-     109,    28,   226,    30,   109,   211,   211,    39,   211,   109,
-     109,   109,   129,    15,   131,   132,   212,   213,   214,   109,
-     216,   217,   109,   109,    56,   109,    58,   109,   109,   225,
-      57,   227,   149,   211,   233,    67,   233,   211,    40,   211,
-      48,    68,    50,    51,   211,   211,   211,    79,   211,   211,
-     109,   211,   222,   211,   171,   211,   233,   230,   124,   176,
-     124,   230,    89,   180,   124,   233,    93,   184,   211,   101,
-     211,    73,   189,   230,   101,   230,   193,   104,   105,   233,
-     233,   233,   233,   233,   233,   233,   233,   204,   233,   206,
-     207,   123,   209,   233,   230,   233,   233,   230,   233,   233,
-     102,   103,   233,   220,   233,   233,   108,   134,   233,   233,
-     142,   228,   233,     0,     1,   230,   211,     4,   124,   151,
-       1,   233,   233,   150,   230,   233,   153,   154,   155,    16,
-     109,   133,    19,   211,    21,   211,    17,    18,   211,   124,
-     211,    22,    29,   124,   109,   109,   148,   124,    48,   124,
-      50,    51,   124,   124,    41,   124,   164,   165,   166,    46,
-      47,   169,   170,   124,   172,   173,   124,   175,   200,   177,
-     124,   124,   180,   200,   182,   183,   124,   124,   230,    66,
-     188,   230,   233,    70,   192,   211,    67,   230,   196,   197,
-     198,   223,   230,    80,    48,   203,   223,   224,   233,   233,
-     208,   124,   233,   233,    85,    86,   230,   230,   210,   230,
-      91,   233,    99,   100,    95,   233,   230,   230,   230,   230,
-     101,   230,   124,   230,   109,   230,   230,   229,   115,   110,
-     111,   112,   230,    72,   230,   230,   230,   230,   230,   230,
-      72,   122,   230,   109,   233,   132,   109,   109,   109,   109,
-     109,   109,   230,   124,   124,   211,   124,   144,   145,   124,
-     233,   109,   143,   230,   164,   165,   166,   124,   124,   169,
-     170,   124,   172,   173,   124,   175,   233,   177,   124,   124,
-     180,   168,   182,   183,   124,   230,   124,   230,   188,   124,
-     124,   230,   192,   132,   181,   230,   196,   197,   198,   186,
-     132,   230,   230,   203,   191,   230,   187,   194,   208,   230,
-     164,   165,   166,   230,   230,   169,   170,   230,   172,   173,
-     230,   175,   230,   177,   163,   230,   180,   230,   182,   183,
-       1,   163,   171,   230,   188,   230,   230,   230,   192,   171,
-     230,   180,   196,   197,   198,   124,   230,   230,   180,   203,
-     230,   230,   230,   230,   208,    26,    27,   230,   230,   124,
-     109,   230,    33,   230,   124,   204,   230,   206,   207,   211,
-     124,   124,   204,   124,   206,   207,     1,   124,   230,   230,
-     124,   220,   124,   230,   233,   109,   230,   230,   220,   228,
-      61,    62,    63,    64,   230,   124,   228,   230,   124,   230,
-     230,   230,   230,   230,   230,    76,    77,    78,   230,    34,
-     230,   230,    83,    84,    85,   230,    87,   230,    43,    44,
-      45,   230,   230,    48,    49,   230,   230,   230,    53,    54,
-      55,   230,   230,   124,   211,   124,   233,   124,   124,   211,
-     233,   124,   124,   230,   124,   124,   124,   230,   230,   230,
-     230,   124,   230,   271,   230,   230,   230,   230,   124,   230,
-     230,   230,   230,   230,   230,   124,   230,   230,   230,   230,
-     124,   230,   230,   230,   230,   230,   124,   124,   230,   124,
-     230,   109,   230,   218,   124,   230,   502,   233,  1317,   230,
-     230,   230,   235,   230,   230,   233,   230,   230,   230,   230,
-     230,   130,   230,   230,    77,   230,   132,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   130,
-     230,   586,   230,   132,   130,   130,   230,   517,  1051,   234,
-    1277,  1279,   233,   230,   230,   230,   230,   343,   230,  1255,
-     230,   230,   230,   230,  1266,   230,   230,   230,   230,   230,
-     489,  1264,   230,   233,   230,   230,   233,   230,   230,   230,
-     230,  1151,   533,  1288,   225,   572,   235,  1281,  1260,   235,
-     466,   235,   235,   235,   230,   230,   230,   230,   599,   394,
-     118,   170,   404,  1121,   479,    97,  1119,    -1,    -1,    -1,
-     242,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   293,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   301,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     641,   642,   314,     1,     1,   317,   318,   319,     1,   321,
+     322,     1,     8,     1,     1,     1,     1,   232,   233,     1,
+       1,     1,    52,     1,   213,     1,   110,   234,   217,   180,
+     181,     1,     1,     1,     1,     1,     1,   213,   232,   232,
+       1,   217,   236,   236,   234,    30,     1,   232,     1,    48,
+     232,   236,   232,    38,   236,   234,   236,     1,    56,     1,
+     234,     1,     6,     7,    19,     9,    10,    65,     1,    67,
+      14,    41,   232,    11,    12,    13,   236,    65,   234,    23,
+      24,    25,     1,    65,    39,     1,     1,   234,    32,    65,
+     234,    35,    36,    37,    81,    56,   126,   234,    42,   411,
+      65,   413,   414,   232,    65,   417,    67,   236,   234,   102,
+     234,    81,    67,   425,     1,    59,    60,   102,   430,    99,
+     234,   102,   234,   207,   102,   234,   124,    71,   440,   441,
+      74,    75,    19,   102,   102,   102,   135,   127,    82,   127,
+     452,   121,   454,   455,    88,   127,    90,   102,    92,   102,
+      94,    95,    39,    97,    98,     1,   234,   127,     1,   127,
+     102,   127,   102,   124,   108,   120,    99,  1094,  1095,  1096,
+     114,   115,   110,   117,   118,   119,   169,   234,   122,   176,
+      67,     1,    28,   102,    30,   234,   102,   102,   121,   176,
+     176,   169,   232,   192,   187,   234,   236,   232,   153,   154,
+     234,   236,   201,   232,   148,   201,   234,   236,   234,   187,
+     203,    57,   127,   234,   158,   159,   160,   161,   162,   163,
+     164,    41,    68,   232,   234,   203,   223,   236,   232,     1,
+     197,   543,   235,   120,   224,   233,   233,   223,    81,   176,
+     233,   128,   129,    89,     1,    17,    18,    93,   233,   204,
+      22,   233,   221,   233,   221,   224,   102,   233,   224,   105,
+     106,    81,   149,   233,   233,   233,   233,   233,   221,   224,
+     214,   215,   216,   228,   218,   219,   235,    34,   233,   221,
+     233,   197,   224,   227,   235,   229,    43,    44,    45,   233,
+     136,    48,    49,   233,   235,    67,    53,    54,    55,   235,
+       1,   235,   221,   235,   235,   221,   152,   127,   235,   155,
+     156,   157,   235,    85,    86,   235,   110,   235,   630,    91,
+       1,   633,   235,   635,    96,    26,    27,   235,   640,   235,
+     102,   235,    33,   176,     1,   235,     3,   224,     5,   111,
+     112,   113,   235,   235,   235,   235,   233,   235,   232,    30,
+     235,   123,    19,   235,   235,     1,   202,    38,   235,   235,
+      61,    62,    63,    64,   827,   828,   829,   830,   831,   832,
+     833,   235,    39,   145,   235,    76,    77,    78,   235,   225,
+     226,   235,    83,    84,    85,   235,    87,   233,    34,    56,
+     233,    58,   125,     1,   235,   235,   235,    43,    44,    45,
+      67,   235,    48,    49,   235,   235,   235,    53,    54,    55,
+       1,    19,    79,   235,   235,     6,     7,   189,     9,    10,
+     235,   102,   235,    14,   235,   235,   235,   235,   235,   235,
+     235,    39,    23,    24,    25,   102,     1,   235,   235,   235,
+     235,    32,   235,   235,    35,    36,    37,    70,     4,    72,
+     235,    42,   235,   235,    19,   235,   235,   124,   235,    67,
+     235,   233,   235,   125,    20,    21,   235,   235,    59,    60,
+     235,    15,   235,   235,    39,    31,   233,   144,   125,   235,
+      71,   235,   235,    74,    75,   235,   153,   235,   235,   232,
+     235,    82,   110,   116,   102,   235,    40,    88,   235,    90,
+     235,    92,    67,    94,    95,   235,    97,    98,   235,   110,
+     133,   235,   120,    69,    70,   235,    72,   108,   235,   235,
+     235,   235,   235,   114,   115,   235,   117,   118,   119,    73,
+     235,   122,   233,   235,   232,   202,   137,   138,   139,   140,
+     141,   142,   143,    99,   235,   153,   154,   235,   235,   172,
+     173,   107,   232,   213,   232,   120,   110,   148,   225,   103,
+     104,   110,   110,   128,   129,   109,   233,   158,   159,   160,
+     161,   162,   163,   164,   130,     1,   132,   133,   110,   110,
+     110,   232,   235,   235,   149,   235,   235,   235,   125,   110,
+     134,   235,   235,   235,   235,   151,   204,  1238,   235,   235,
+     235,   224,    28,   235,    30,   235,   150,   230,   232,   235,
+     235,   110,   110,   235,   235,   235,   224,   173,   235,   235,
+     228,   235,   178,   214,   215,   216,   182,   218,   219,   235,
+     186,    57,   235,   235,   213,   191,   227,   235,   229,   195,
+     235,   235,    68,     1,   232,     3,   235,     5,   235,   235,
+     206,   213,   208,   209,   213,   211,   110,   110,   213,   224,
+     213,    19,   213,    89,   110,   110,   222,    93,   212,   110,
+     110,   110,   110,   125,   230,   110,   102,   110,   213,   105,
+     106,    39,   110,   235,   213,   235,   213,   231,   213,   213,
+     213,   213,   110,   213,   213,   213,   213,     1,    56,   232,
+      58,   235,   125,   125,     0,     1,   232,   235,     4,    67,
+     136,   213,   125,    17,    18,   125,   110,   232,    22,   235,
+      16,    79,   235,    19,   235,    21,   152,   235,   235,   155,
+     156,   157,    72,    29,   235,   235,   125,   213,   235,   235,
+     235,   232,   232,   235,   102,    41,   235,   232,   235,   235,
+      46,    47,   235,   235,   235,   235,   235,    48,   235,    50,
+      51,   232,   235,    67,   213,   235,   124,   235,   232,   213,
+      66,   213,   125,   110,    70,   110,   202,   213,   125,   213,
+     125,    85,    86,   125,    80,   232,   144,    91,   213,   125,
+     110,   125,    96,   133,   125,   153,   125,   125,   102,   225,
+     226,   125,   125,   125,   100,   101,   235,   111,   112,   113,
+      48,   232,    50,    51,   234,   232,   232,   125,   110,   123,
+     116,   235,   110,   235,   235,   165,   235,   232,   232,   235,
+     232,   232,   235,   173,   232,   232,   232,   133,   110,   232,
+     232,   145,   182,   125,   202,   232,   232,   232,   232,   232,
+     146,   147,   232,   232,   232,    48,   232,   232,   235,   110,
+     110,   110,   110,   232,   125,   125,   206,   225,   208,   209,
+     213,   125,   125,   235,   170,   166,   167,   168,   125,   125,
+     171,   172,   222,   174,   175,   189,   177,   183,   179,   110,
+     230,   182,   188,   184,   185,   125,   125,   193,   125,   190,
+     196,   125,   232,   194,   110,   125,   125,   198,   199,   200,
+      72,   232,   125,   232,   205,   125,   232,   232,   232,   210,
+     232,   232,   232,   232,   125,   232,   232,   232,   166,   167,
+     168,   232,   232,   171,   172,   232,   174,   175,   232,   177,
+     235,   179,   232,   232,   182,   232,   184,   185,   232,   232,
+     125,   232,   190,   232,   232,   232,   194,   232,   232,   232,
+     198,   199,   200,   232,   232,   232,   232,   205,   232,   232,
+     232,   133,   210,   166,   167,   168,   232,   232,   171,   172,
+     232,   174,   175,   125,   177,   125,   179,   232,   232,   182,
+       1,   184,   185,   232,   125,   232,   232,   190,   232,   232,
+     232,   194,   213,   165,   232,   198,   199,   200,   125,   232,
+     232,   173,   205,   125,   232,    26,    27,   210,   232,   125,
+     182,   125,    33,   232,   232,   110,   125,   232,   235,   232,
+     232,   125,   232,   125,   213,   125,   235,   125,   125,   213,
+     235,   125,   125,   232,   206,   125,   208,   209,   125,   125,
+      61,    62,    63,    64,   232,   232,   232,   125,   125,   232,
+     222,   232,   232,   232,   232,    76,    77,    78,   230,   232,
+     235,   232,    83,    84,    85,   232,    87,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     125,   232,   125,   232,   232,   232,   232,   125,   232,   232,
+     125,   125,   232,   235,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   110,   232,   232,   232,   232,
+     125,   232,   232,   232,   232,   232,   133,   232,   131,   232,
+     232,   232,   232,   131,   232,   232,   232,   232,   273,   232,
+     133,   232,   131,   232,   131,    77,   232,  1056,   505,   520,
+     232,   232,   589,   232,   232,   220,  1323,   232,   232,   232,
+     232,   232,   232,  1285,  1283,   345,   232,   236,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,  1261,  1272,   232,   235,   235,   232,   232,   232,
+     232,   232,   232,   492,  1157,  1270,  1294,   536,   237,   237,
+     237,   237,   232,   237,   235,   237,   232,   227,   575,   232,
+     232,   469,   602,  1287,  1266,   396,   118,   377,   406,   171,
+      97,  1126,  1124,   482,    -1,   244,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   375
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   295,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   303
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
      symbol of state STATE-NUM.  */
 static const yytype_uint16 yystos[] =
 {
-       0,   237,     0,     1,     4,    16,    19,    21,    29,    41,
-      46,    47,    66,    70,    80,    99,   100,   115,   132,   144,
-     145,   168,   181,   186,   191,   194,   238,   243,   248,   268,
-     274,   280,   288,   302,   322,   344,   358,   373,   380,   384,
-     394,   403,   424,   430,   436,   440,   446,   502,   519,   230,
-     231,   232,   232,   323,   404,   431,   232,   441,   232,   359,
-     425,   345,   232,   275,   303,   374,   232,   232,   395,   232,
-     281,   232,   385,     1,    30,    38,   101,   269,   270,   271,
-     272,   273,     1,    26,    27,    33,    61,    62,    63,    64,
-      76,    77,    78,    83,    84,    85,    87,   503,   504,   505,
-     506,   507,   508,   509,   510,   511,   512,   513,   514,   515,
-     516,   517,   518,   232,   232,   232,     1,    65,   437,   438,
-     439,   232,     1,     6,     7,     9,    10,    14,    23,    24,
+       0,   239,     0,     1,     4,    16,    19,    21,    29,    41,
+      46,    47,    66,    70,    80,   100,   101,   116,   133,   146,
+     147,   170,   183,   188,   193,   196,   240,   245,   250,   270,
+     276,   282,   290,   304,   324,   346,   360,   375,   382,   386,
+     396,   405,   426,   432,   438,   442,   448,   505,   522,   232,
+     233,   234,   234,   325,   406,   433,   234,   443,   234,   361,
+     427,   347,   234,   277,   305,   376,   234,   234,   397,   234,
+     283,   234,   387,     1,    30,    38,   102,   271,   272,   273,
+     274,   275,     1,    26,    27,    33,    61,    62,    63,    64,
+      76,    77,    78,    83,    84,    85,    87,   506,   507,   508,
+     509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
+     519,   520,   521,   234,   234,   234,     1,    65,   439,   440,
+     441,   234,     1,     6,     7,     9,    10,    14,    23,    24,
       25,    32,    35,    36,    37,    42,    59,    60,    71,    74,
-      75,    82,    88,    90,    92,    94,    96,    97,   107,   113,
-     114,   116,   117,   118,   121,   146,   156,   157,   158,   159,
-     160,   161,   162,   212,   213,   214,   216,   217,   225,   227,
-     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
-     457,   458,   459,   460,   461,   462,   463,   464,   465,   466,
-     467,   468,   469,   470,   471,   472,   473,   474,   475,   476,
-     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
-     487,   488,   489,   490,   494,   498,   499,   500,   501,   232,
-     232,   232,     1,    98,   120,   244,   245,   246,   247,   232,
-     232,   232,     1,    34,    43,    44,    45,    48,    49,    53,
-      54,    55,   520,   521,   522,   523,   524,   525,   526,   527,
-     528,   529,   530,     1,    28,    30,    57,    68,    89,    93,
-     101,   104,   105,   134,   150,   153,   154,   155,   200,   223,
-     224,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+      75,    82,    88,    90,    92,    94,    95,    97,    98,   108,
+     114,   115,   117,   118,   119,   122,   148,   158,   159,   160,
+     161,   162,   163,   164,   214,   215,   216,   218,   219,   227,
+     229,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   459,   460,   461,   462,   463,   464,   465,   466,   467,
+     468,   469,   470,   471,   472,   473,   474,   475,   476,   477,
+     478,   479,   480,   481,   482,   483,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   497,   501,   502,   503,
+     504,   234,   234,   234,     1,    99,   121,   246,   247,   248,
+     249,   234,   234,   234,     1,    34,    43,    44,    45,    48,
+      49,    53,    54,    55,   523,   524,   525,   526,   527,   528,
+     529,   530,   531,   532,   533,     1,    28,    30,    57,    68,
+      89,    93,   102,   105,   106,   136,   152,   155,   156,   157,
+     202,   225,   226,   251,   252,   253,   254,   255,   256,   257,
      258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
-     232,     1,   221,   289,   290,   291,   292,   293,   232,     1,
-     101,   381,   382,   383,   232,   230,   233,   233,   233,   231,
-     270,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   231,   504,     1,    17,    18,
-      22,    67,    85,    86,    91,    95,   101,   110,   111,   112,
-     122,   143,   187,   324,   325,   326,   327,   328,   329,   330,
+     268,   269,   234,     1,   223,   291,   292,   293,   294,   295,
+     234,     1,   102,   383,   384,   385,   234,   232,   235,   235,
+     235,   233,   272,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   233,   507,     1,
+      17,    18,    22,    67,    85,    86,    91,    96,   102,   111,
+     112,   113,   123,   145,   189,   326,   327,   328,   329,   330,
      331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
-       1,     3,     5,    19,    39,    56,    58,    67,    79,   101,
-     123,   142,   151,   200,   223,   405,   406,   407,   408,   409,
-     410,   411,   412,   413,   414,   415,   419,   420,   421,   422,
-     423,     1,    65,   126,   432,   433,   434,   435,   233,   231,
-     438,     1,   101,   126,   442,   443,   444,   445,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   495,   491,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   231,   448,     1,    19,    39,
-      67,   119,   127,   128,   147,   222,   360,   361,   362,   363,
-     364,   365,   366,   370,   371,   372,     1,   126,   222,   426,
-     427,   428,   429,     1,    56,    65,    67,   123,   346,   350,
-     351,   352,   356,   357,   230,   233,   233,   231,   245,     1,
-      81,   174,   276,   277,   278,   279,     1,    19,    39,    67,
-     101,   119,   151,   152,   202,   222,   226,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   318,     1,
-      41,    81,   126,   375,   376,   377,   378,   379,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   231,   521,   230,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   231,   250,     1,
-     101,   219,   396,   397,   398,   399,   230,   233,   231,   290,
-     174,     1,   101,   167,   185,   201,   282,   283,   284,   285,
-     286,   287,   233,   231,   382,     1,   101,   219,   222,   386,
-     387,   388,   389,   390,   124,   124,   124,   230,   109,   109,
-     240,   211,   109,   240,   240,   240,   109,   240,   240,   109,
-     109,   109,   109,   230,   230,   233,   233,   233,   341,   233,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     231,   325,   230,   233,   233,   233,   233,   233,   233,   416,
-     233,   233,   233,   233,   233,   233,   233,   231,   406,   233,
-     233,   231,   433,   124,   230,   233,   233,   231,   443,   211,
-     240,   109,   240,   240,   211,   109,   240,   211,   109,   109,
-     109,   211,   211,   211,   240,   109,   109,   109,   109,   240,
-     109,   109,   109,   109,   211,   233,   233,   211,   240,   240,
-     211,   211,   211,   211,   215,   211,   215,   211,   211,   211,
-     211,   109,   240,   211,   240,   240,   211,   109,   230,   230,
-     233,   233,   367,   233,   233,   233,   233,   233,   231,   361,
-     233,   233,   231,   427,   230,   233,   233,   347,   233,   231,
-     351,   124,   124,   230,   230,   233,   233,   231,   277,   230,
-     233,   233,   319,   233,   233,   233,   233,   315,   233,   233,
-     231,   305,   230,   233,   233,   233,   231,   376,   211,   211,
-     240,   124,   211,   124,   211,   211,   211,   230,   109,   124,
-     211,   124,   109,   109,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   230,   230,   233,   400,   231,
-     397,   211,   230,   232,   230,   233,   233,   233,   233,   231,
-     283,   124,   230,   230,   233,   391,   233,   231,   387,   230,
-     230,   230,   230,   135,   136,   137,   138,   139,   140,   141,
-     239,   240,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   109,   109,   240,   233,   109,
-     240,   109,   240,   124,   109,   109,   109,   240,   109,   242,
-     242,   230,   124,   178,   179,   124,   211,   124,   124,   233,
-     124,   124,   109,   124,   124,   124,   124,   230,   124,   124,
-     230,   230,   124,   124,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,    48,   164,   165,   166,   169,   170,   172,   173,   175,
-     177,   180,   182,   183,   188,   192,   196,   197,   198,   203,
-     208,   496,   497,    48,    50,    51,   164,   165,   166,   169,
-     170,   172,   173,   175,   177,   180,   182,   183,   188,   192,
-     196,   197,   198,   203,   208,   492,   493,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   124,   211,
-     233,   124,   109,   124,   124,   124,   230,   124,   124,   230,
-     124,   124,   233,   109,   354,   355,   230,   230,   230,   124,
-     124,   230,   124,   211,   233,   124,   124,   124,   211,   233,
-     124,   124,   230,   124,   124,   124,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,   124,   233,   230,   230,     1,   101,   195,
-     219,   294,   295,   296,   297,   298,   124,   124,   124,   124,
-     230,   230,   124,   233,   124,   230,   239,   239,   239,   239,
-     239,   239,   239,   230,   230,   230,    52,   125,   342,   343,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,    11,
-      12,    13,   241,   242,   230,   230,   230,   230,   230,   230,
-     230,   230,   230,     8,   199,   417,   418,   230,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   230,   234,
-     230,   234,   230,   230,    15,    40,    73,   102,   103,   108,
-     133,   148,   210,   229,   368,   369,   230,   230,   230,   230,
-     230,   230,   230,   230,   230,    48,   190,   199,   348,   349,
-     218,   234,   353,   230,   230,   230,   230,     4,    20,    21,
-      31,    69,    70,    72,    98,   106,   129,   131,   132,   149,
-     171,   176,   180,   184,   189,   193,   204,   206,   207,   209,
-     220,   228,   320,   321,   230,   230,   230,   230,    48,    50,
-      51,   164,   165,   166,   169,   170,   172,   173,   175,   177,
-     180,   182,   183,   188,   192,   196,   197,   198,   203,   208,
-     316,   317,   230,   230,   230,   230,   230,   230,    72,   132,
-     163,   171,   180,   204,   206,   207,   220,   228,   401,   402,
-     230,   233,   233,   299,   231,   295,   230,   230,   230,   230,
-     230,    72,   132,   163,   171,   180,   204,   206,   207,   220,
-     228,   392,   393,   230,   230,   234,   241,   241,   241,   230,
-     234,   497,   493,   230,   234,   230,   234,   109,   355,   230,
-     235,   235,   235,   235,   235,   235,   230,   234,   230,   234,
-     230,   234,   124,   205,   242,   233,   230,   230,   234,   343,
-     418,   369,   349,   130,   132,   130,   132,   130,   130,   321,
-     317,   402,   230,   230,   230,    70,    72,   115,   132,   170,
-     171,   222,   228,   300,   301,   393,   230,   234,   301
+     341,   342,     1,     3,     5,    19,    39,    56,    58,    67,
+      79,   102,   124,   144,   153,   202,   225,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   421,   422,
+     423,   424,   425,     1,    65,   127,   434,   435,   436,   437,
+     235,   233,   440,     1,   102,   127,   444,   445,   446,   447,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   498,   494,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   233,   450,
+       1,    19,    39,    67,   120,   128,   129,   149,   224,   362,
+     363,   364,   365,   366,   367,   368,   372,   373,   374,     1,
+     127,   224,   428,   429,   430,   431,     1,    56,    65,    67,
+     124,   348,   352,   353,   354,   358,   359,   232,   235,   235,
+     233,   247,     1,    81,   176,   278,   279,   280,   281,     1,
+      19,    39,    67,   102,   120,   153,   154,   204,   224,   228,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   320,     1,    41,    81,   127,   377,   378,   379,   380,
+     381,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     233,   524,   232,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     233,   252,     1,   102,   221,   398,   399,   400,   401,   232,
+     235,   233,   292,   176,     1,   102,   169,   187,   203,   284,
+     285,   286,   287,   288,   289,   235,   233,   384,     1,   102,
+     221,   224,   388,   389,   390,   391,   392,   125,   125,   125,
+     232,   110,   110,   242,   213,   110,   242,   242,   242,   110,
+     242,   242,   110,   110,   110,   110,   232,   232,   235,   235,
+     235,   343,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   233,   327,   232,   235,   235,   235,   235,
+     235,   235,   418,   235,   235,   235,   235,   235,   235,   235,
+     233,   408,   235,   235,   233,   435,   125,   232,   235,   235,
+     233,   445,   213,   242,   110,   242,   242,   213,   110,   242,
+     213,   110,   110,   110,   213,   213,   213,   242,   110,   110,
+     110,   110,   242,   110,   110,   125,   110,   110,   213,   235,
+     235,   213,   242,   242,   213,   213,   213,   213,   217,   213,
+     217,   213,   213,   213,   213,   110,   242,   213,   242,   242,
+     213,   110,   232,   232,   235,   235,   369,   235,   235,   235,
+     235,   235,   233,   363,   235,   235,   233,   429,   232,   235,
+     235,   349,   235,   233,   353,   125,   125,   232,   232,   235,
+     235,   233,   279,   232,   235,   235,   321,   235,   235,   235,
+     235,   317,   235,   235,   233,   307,   232,   235,   235,   235,
+     233,   378,   213,   213,   242,   125,   213,   125,   213,   213,
+     213,   232,   110,   125,   213,   125,   110,   110,   125,   125,
+     125,   125,   125,   125,   125,   125,   125,   125,   125,   232,
+     232,   235,   402,   233,   399,   213,   232,   234,   232,   235,
+     235,   235,   235,   233,   285,   125,   232,   232,   235,   393,
+     235,   233,   389,   232,   232,   232,   232,   137,   138,   139,
+     140,   141,   142,   143,   241,   242,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   110,
+     110,   242,   235,   110,   242,   110,   242,   125,   110,   110,
+     110,   242,   110,   244,   244,   232,   125,   180,   181,   125,
+     213,   125,   125,   235,   125,   125,   110,   125,   125,   125,
+     125,   232,   125,   125,   232,   232,   125,   125,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,    48,   166,   167,   168,
+     171,   172,   174,   175,   177,   179,   182,   184,   185,   190,
+     194,   198,   199,   200,   205,   210,   499,   500,    48,    50,
+      51,   166,   167,   168,   171,   172,   174,   175,   177,   179,
+     182,   184,   185,   190,   194,   198,   199,   200,   205,   210,
+     495,   496,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   125,   213,   235,   125,   110,   125,   125,
+     125,   232,   125,   125,   232,   125,   125,   235,   110,   356,
+     357,   232,   232,   232,   125,   125,   232,   125,   213,   235,
+     125,   125,   125,   213,   235,   125,   125,   232,   125,   125,
+     125,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   125,   235,
+     232,   232,     1,   102,   197,   221,   296,   297,   298,   299,
+     300,   125,   125,   125,   125,   232,   232,   125,   235,   125,
+     232,   241,   241,   241,   241,   241,   241,   241,   232,   232,
+     232,    52,   126,   344,   345,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,    11,    12,    13,   243,   244,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,     8,   201,
+     419,   420,   232,   232,   232,   232,   232,   232,   232,   232,
+     232,   232,   232,   232,   236,   232,   236,   232,   232,    15,
+      40,    73,   103,   104,   109,   134,   150,   212,   231,   370,
+     371,   232,   232,   232,   232,   232,   232,   232,   232,   232,
+      48,   135,   192,   201,   350,   351,   220,   236,   355,   232,
+     232,   232,   232,     4,    20,    21,    31,    69,    70,    72,
+      99,   107,   130,   132,   133,   151,   173,   178,   182,   186,
+     191,   195,   206,   208,   209,   211,   222,   230,   322,   323,
+     232,   232,   232,   232,    48,    50,    51,   166,   167,   168,
+     171,   172,   174,   175,   177,   179,   182,   184,   185,   190,
+     194,   198,   199,   200,   205,   210,   318,   319,   232,   232,
+     232,   232,   232,   232,    72,   133,   165,   173,   182,   206,
+     208,   209,   222,   230,   403,   404,   232,   235,   235,   301,
+     233,   297,   232,   232,   232,   232,   232,    72,   133,   165,
+     173,   182,   206,   208,   209,   222,   230,   394,   395,   232,
+     232,   236,   243,   243,   243,   232,   236,   500,   496,   232,
+     236,   232,   236,   110,   357,   232,   237,   237,   237,   237,
+     237,   237,   232,   236,   232,   236,   232,   236,   125,   207,
+     244,   235,   232,   232,   236,   345,   420,   371,   351,   131,
+     133,   131,   133,   131,   131,   323,   319,   404,   232,   232,
+     232,    70,    72,   116,   133,   172,   173,   224,   230,   302,
+     303,   395,   232,   236,   303
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint16 yyr1[] =
 {
-       0,   236,   237,   237,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   238,   238,
-     238,   238,   238,   238,   238,   238,   238,   238,   239,   239,
+       0,   238,   239,   239,   240,   240,   240,   240,   240,   240,
+     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
      240,   240,   240,   240,   240,   240,   240,   240,   241,   241,
-     242,   242,   242,   242,   243,   244,   244,   245,   245,   245,
-     246,   247,   248,   249,   249,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   251,   252,   253,   254,   255,   256,   257,
-     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
-     268,   269,   269,   270,   270,   270,   270,   271,   272,   273,
-     275,   274,   276,   276,   277,   277,   277,   278,   279,   281,
-     280,   282,   282,   283,   283,   283,   283,   283,   284,   285,
-     286,   287,   288,   289,   289,   290,   290,   290,   291,   293,
-     292,   294,   294,   295,   295,   295,   295,   296,   297,   297,
-     299,   298,   300,   300,   301,   301,   301,   301,   301,   301,
-     301,   301,   303,   302,   304,   304,   305,   305,   305,   305,
-     305,   305,   305,   305,   305,   305,   305,   306,   307,   308,
-     309,   310,   311,   312,   313,   315,   314,   316,   316,   317,
-     317,   317,   317,   317,   317,   317,   317,   317,   317,   317,
-     317,   317,   317,   317,   317,   317,   317,   317,   317,   317,
-     317,   319,   318,   320,   320,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   323,   322,   324,   324,   325,   325,
-     325,   325,   325,   325,   325,   325,   325,   325,   325,   325,
-     325,   325,   325,   325,   326,   327,   328,   329,   330,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,   341,   340,
-     342,   342,   343,   343,   345,   344,   347,   346,   348,   348,
-     349,   349,   349,   350,   350,   351,   351,   351,   351,   351,
-     353,   352,   354,   354,   355,   355,   356,   357,   359,   358,
-     360,   360,   361,   361,   361,   361,   361,   361,   361,   361,
-     361,   362,   363,   364,   365,   367,   366,   368,   368,   369,
-     369,   369,   369,   369,   369,   369,   369,   369,   369,   370,
-     371,   372,   374,   373,   375,   375,   376,   376,   376,   376,
-     377,   378,   379,   380,   381,   381,   382,   382,   383,   385,
-     384,   386,   386,   387,   387,   387,   387,   388,   389,   391,
-     390,   392,   392,   393,   393,   393,   393,   393,   393,   393,
-     393,   393,   393,   395,   394,   396,   396,   397,   397,   397,
-     398,   400,   399,   401,   401,   402,   402,   402,   402,   402,
-     402,   402,   402,   402,   402,   404,   403,   405,   405,   406,
-     406,   406,   406,   406,   406,   406,   406,   406,   406,   406,
-     406,   406,   406,   406,   407,   408,   409,   410,   411,   412,
-     413,   414,   414,   416,   415,   417,   417,   418,   418,   419,
-     420,   421,   422,   423,   425,   424,   426,   426,   427,   427,
-     427,   428,   429,   431,   430,   432,   432,   433,   433,   433,
-     434,   435,   436,   437,   437,   438,   438,   439,   441,   440,
-     442,   442,   443,   443,   443,   444,   445,   446,   447,   447,
-     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
-     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
-     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
-     448,   448,   448,   448,   448,   448,   448,   448,   448,   448,
-     448,   448,   448,   448,   448,   448,   448,   448,   449,   450,
+     242,   242,   242,   242,   242,   242,   242,   242,   243,   243,
+     244,   244,   244,   244,   245,   246,   246,   247,   247,   247,
+     248,   249,   250,   251,   251,   252,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   271,   272,   272,   272,   272,   273,   274,   275,
+     277,   276,   278,   278,   279,   279,   279,   280,   281,   283,
+     282,   284,   284,   285,   285,   285,   285,   285,   286,   287,
+     288,   289,   290,   291,   291,   292,   292,   292,   293,   295,
+     294,   296,   296,   297,   297,   297,   297,   298,   299,   299,
+     301,   300,   302,   302,   303,   303,   303,   303,   303,   303,
+     303,   303,   305,   304,   306,   306,   307,   307,   307,   307,
+     307,   307,   307,   307,   307,   307,   307,   308,   309,   310,
+     311,   312,   313,   314,   315,   317,   316,   318,   318,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   321,   320,   322,   322,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   325,   324,   326,   326,   327,   327,
+     327,   327,   327,   327,   327,   327,   327,   327,   327,   327,
+     327,   327,   327,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   343,   342,
+     344,   344,   345,   345,   347,   346,   349,   348,   350,   350,
+     351,   351,   351,   351,   352,   352,   353,   353,   353,   353,
+     353,   355,   354,   356,   356,   357,   357,   358,   359,   361,
+     360,   362,   362,   363,   363,   363,   363,   363,   363,   363,
+     363,   363,   364,   365,   366,   367,   369,   368,   370,   370,
+     371,   371,   371,   371,   371,   371,   371,   371,   371,   371,
+     372,   373,   374,   376,   375,   377,   377,   378,   378,   378,
+     378,   379,   380,   381,   382,   383,   383,   384,   384,   385,
+     387,   386,   388,   388,   389,   389,   389,   389,   390,   391,
+     393,   392,   394,   394,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   397,   396,   398,   398,   399,   399,
+     399,   400,   402,   401,   403,   403,   404,   404,   404,   404,
+     404,   404,   404,   404,   404,   404,   406,   405,   407,   407,
+     408,   408,   408,   408,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   408,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   416,   418,   417,   419,   419,   420,   420,
+     421,   422,   423,   424,   425,   427,   426,   428,   428,   429,
+     429,   429,   430,   431,   433,   432,   434,   434,   435,   435,
+     435,   436,   437,   438,   439,   439,   440,   440,   441,   443,
+     442,   444,   444,   445,   445,   445,   446,   447,   448,   449,
+     449,   450,   450,   450,   450,   450,   450,   450,   450,   450,
+     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
+     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
+     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
+     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
      451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
      461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
-     471,   472,   473,   474,   475,   476,   476,   477,   477,   478,
-     479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
-     489,   491,   490,   492,   492,   493,   493,   493,   493,   493,
-     493,   493,   493,   493,   493,   493,   493,   493,   493,   493,
-     493,   493,   493,   493,   493,   493,   493,   495,   494,   496,
-     496,   497,   497,   497,   497,   497,   497,   497,   497,   497,
-     497,   497,   497,   497,   497,   497,   497,   497,   497,   497,
-     497,   498,   499,   500,   501,   502,   503,   503,   504,   504,
-     504,   504,   504,   504,   504,   504,   504,   504,   504,   504,
-     504,   504,   504,   505,   506,   507,   508,   509,   510,   511,
-     512,   513,   514,   515,   516,   517,   518,   519,   520,   520,
-     521,   521,   521,   521,   521,   521,   521,   521,   521,   521,
-     522,   523,   524,   525,   526,   527,   528,   529,   530
+     471,   472,   473,   474,   475,   476,   477,   478,   479,   479,
+     480,   480,   481,   482,   483,   484,   485,   486,   487,   488,
+     489,   490,   491,   492,   494,   493,   495,   495,   496,   496,
+     496,   496,   496,   496,   496,   496,   496,   496,   496,   496,
+     496,   496,   496,   496,   496,   496,   496,   496,   496,   496,
+     498,   497,   499,   499,   500,   500,   500,   500,   500,   500,
+     500,   500,   500,   500,   500,   500,   500,   500,   500,   500,
+     500,   500,   500,   500,   501,   502,   503,   504,   505,   506,
+     506,   507,   507,   507,   507,   507,   507,   507,   507,   507,
+     507,   507,   507,   507,   507,   507,   508,   509,   510,   511,
+     512,   513,   514,   515,   516,   517,   518,   519,   520,   521,
+     522,   523,   523,   524,   524,   524,   524,   524,   524,   524,
+     524,   524,   524,   525,   526,   527,   528,   529,   530,   531,
+     532,   533
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -2148,45 +2140,46 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     2,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     0,     5,
        3,     1,     1,     1,     0,     6,     0,     5,     3,     1,
-       1,     1,     1,     2,     1,     1,     1,     1,     1,     2,
-       0,     5,     3,     1,     1,     3,     4,     4,     0,     6,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       2,     4,     4,     4,     4,     0,     5,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
-       4,     4,     0,     6,     2,     1,     1,     1,     1,     2,
-       4,     4,     4,     5,     2,     1,     1,     1,     4,     0,
-       6,     2,     1,     1,     1,     1,     2,     4,     4,     0,
-       5,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     6,     2,     1,     1,     1,     2,
-       4,     0,     5,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     6,     2,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     1,     1,     1,
+       2,     0,     5,     3,     1,     1,     3,     4,     4,     0,
+       6,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     4,     4,     4,     4,     0,     5,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     0,     6,     2,     1,     1,     1,     1,
+       2,     4,     4,     4,     5,     2,     1,     1,     1,     4,
+       0,     6,     2,     1,     1,     1,     1,     2,     4,     4,
+       0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     6,     2,     1,     1,     1,
+       2,     4,     0,     5,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     6,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     0,     5,     3,     1,     1,     1,
+       4,     4,     4,     4,     4,     0,     6,     2,     1,     1,
+       1,     1,     4,     4,     0,     6,     2,     1,     1,     1,
+       1,     4,     4,     5,     2,     1,     1,     1,     4,     0,
+       6,     2,     1,     1,     1,     1,     4,     4,     5,     2,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     0,     5,     3,     1,     1,     1,     4,
-       4,     4,     4,     4,     0,     6,     2,     1,     1,     1,
-       1,     4,     4,     0,     6,     2,     1,     1,     1,     1,
-       4,     4,     5,     2,     1,     1,     1,     4,     0,     6,
-       2,     1,     1,     1,     1,     4,     4,     5,     2,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     0,     5,     3,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     4,     0,     5,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     5,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     4,     4,     4,     4,     5,     2,     1,     1,     1,
+       1,     1,     1,     1,     4,     4,     4,     4,     5,     2,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       5,     2,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     5,     2,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     4,     4,     4,     4,     4,     4,     4,     4
+       4,     4
 };
 
 
@@ -2863,109 +2856,109 @@ yyreduce:
   switch (yyn)
     {
         case 28:
-#line 405 "conf_parser.y" /* yacc.c:1646  */
+#line 407 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = 0; }
-#line 2869 "conf_parser.c" /* yacc.c:1646  */
+#line 2862 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 30:
-#line 406 "conf_parser.y" /* yacc.c:1646  */
+#line 408 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2875 "conf_parser.c" /* yacc.c:1646  */
+#line 2868 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 31:
-#line 407 "conf_parser.y" /* yacc.c:1646  */
+#line 409 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2881 "conf_parser.c" /* yacc.c:1646  */
+#line 2874 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 32:
-#line 408 "conf_parser.y" /* yacc.c:1646  */
+#line 410 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
-#line 2887 "conf_parser.c" /* yacc.c:1646  */
+#line 2880 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 33:
-#line 409 "conf_parser.y" /* yacc.c:1646  */
+#line 411 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
-#line 2893 "conf_parser.c" /* yacc.c:1646  */
+#line 2886 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 34:
-#line 410 "conf_parser.y" /* yacc.c:1646  */
+#line 412 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
-#line 2899 "conf_parser.c" /* yacc.c:1646  */
+#line 2892 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 35:
-#line 411 "conf_parser.y" /* yacc.c:1646  */
+#line 413 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
-#line 2905 "conf_parser.c" /* yacc.c:1646  */
+#line 2898 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 36:
-#line 412 "conf_parser.y" /* yacc.c:1646  */
+#line 414 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
-#line 2911 "conf_parser.c" /* yacc.c:1646  */
+#line 2904 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 37:
-#line 413 "conf_parser.y" /* yacc.c:1646  */
+#line 415 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
-#line 2917 "conf_parser.c" /* yacc.c:1646  */
+#line 2910 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 38:
-#line 416 "conf_parser.y" /* yacc.c:1646  */
+#line 418 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = 0; }
-#line 2923 "conf_parser.c" /* yacc.c:1646  */
+#line 2916 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 40:
-#line 417 "conf_parser.y" /* yacc.c:1646  */
+#line 419 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2929 "conf_parser.c" /* yacc.c:1646  */
+#line 2922 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 41:
-#line 418 "conf_parser.y" /* yacc.c:1646  */
+#line 420 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2935 "conf_parser.c" /* yacc.c:1646  */
+#line 2928 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 42:
-#line 419 "conf_parser.y" /* yacc.c:1646  */
+#line 421 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
-#line 2941 "conf_parser.c" /* yacc.c:1646  */
+#line 2934 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 43:
-#line 420 "conf_parser.y" /* yacc.c:1646  */
+#line 422 "conf_parser.y" /* yacc.c:1646  */
     { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
-#line 2947 "conf_parser.c" /* yacc.c:1646  */
+#line 2940 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 50:
-#line 433 "conf_parser.y" /* yacc.c:1646  */
+#line 435 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     add_conf_module(libio_basename(yylval.string));
 }
-#line 2956 "conf_parser.c" /* yacc.c:1646  */
+#line 2949 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 51:
-#line 439 "conf_parser.y" /* yacc.c:1646  */
+#line 441 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     mod_add_path(yylval.string);
 }
-#line 2965 "conf_parser.c" /* yacc.c:1646  */
+#line 2958 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 73:
-#line 472 "conf_parser.y" /* yacc.c:1646  */
+#line 474 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -2973,11 +2966,11 @@ yyreduce:
     ConfigServerInfo.ssl_certificate_file = xstrdup(yylval.string);
   }
 }
-#line 2977 "conf_parser.c" /* yacc.c:1646  */
+#line 2970 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 74:
-#line 481 "conf_parser.y" /* yacc.c:1646  */
+#line 483 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -2985,11 +2978,11 @@ yyreduce:
     ConfigServerInfo.rsa_private_key_file = xstrdup(yylval.string);
   }
 }
-#line 2989 "conf_parser.c" /* yacc.c:1646  */
+#line 2982 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 75:
-#line 490 "conf_parser.y" /* yacc.c:1646  */
+#line 492 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -2997,11 +2990,11 @@ yyreduce:
     ConfigServerInfo.ssl_dh_param_file = xstrdup(yylval.string);
   }
 }
-#line 3001 "conf_parser.c" /* yacc.c:1646  */
+#line 2994 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 76:
-#line 499 "conf_parser.y" /* yacc.c:1646  */
+#line 501 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3009,11 +3002,11 @@ yyreduce:
     ConfigServerInfo.ssl_cipher_list = xstrdup(yylval.string);
   }
 }
-#line 3013 "conf_parser.c" /* yacc.c:1646  */
+#line 3006 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 77:
-#line 508 "conf_parser.y" /* yacc.c:1646  */
+#line 510 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3021,11 +3014,11 @@ yyreduce:
     ConfigServerInfo.ssl_message_digest_algorithm = xstrdup(yylval.string);
   }
 }
-#line 3025 "conf_parser.c" /* yacc.c:1646  */
+#line 3018 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 78:
-#line 517 "conf_parser.y" /* yacc.c:1646  */
+#line 519 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3033,11 +3026,11 @@ yyreduce:
     ConfigServerInfo.ssl_dh_elliptic_curve = xstrdup(yylval.string);
   }
 }
-#line 3037 "conf_parser.c" /* yacc.c:1646  */
+#line 3030 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 79:
-#line 526 "conf_parser.y" /* yacc.c:1646  */
+#line 528 "conf_parser.y" /* yacc.c:1646  */
     {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && !ConfigServerInfo.name)
@@ -3051,11 +3044,11 @@ yyreduce:
     }
   }
 }
-#line 3055 "conf_parser.c" /* yacc.c:1646  */
+#line 3048 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 80:
-#line 541 "conf_parser.y" /* yacc.c:1646  */
+#line 543 "conf_parser.y" /* yacc.c:1646  */
     {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && !ConfigServerInfo.sid)
@@ -3069,11 +3062,11 @@ yyreduce:
     }
   }
 }
-#line 3073 "conf_parser.c" /* yacc.c:1646  */
+#line 3066 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 81:
-#line 556 "conf_parser.y" /* yacc.c:1646  */
+#line 558 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3082,11 +3075,11 @@ yyreduce:
     strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
   }
 }
-#line 3086 "conf_parser.c" /* yacc.c:1646  */
+#line 3079 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 82:
-#line 566 "conf_parser.y" /* yacc.c:1646  */
+#line 568 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3099,11 +3092,11 @@ yyreduce:
     ConfigServerInfo.network_name = xstrdup(yylval.string);
   }
 }
-#line 3103 "conf_parser.c" /* yacc.c:1646  */
+#line 3096 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 83:
-#line 580 "conf_parser.y" /* yacc.c:1646  */
+#line 582 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3111,11 +3104,11 @@ yyreduce:
   xfree(ConfigServerInfo.network_desc);
   ConfigServerInfo.network_desc = xstrdup(yylval.string);
 }
-#line 3115 "conf_parser.c" /* yacc.c:1646  */
+#line 3108 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 84:
-#line 589 "conf_parser.y" /* yacc.c:1646  */
+#line 591 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2 && *yylval.string != '*')
   {
@@ -3142,11 +3135,11 @@ yyreduce:
     }
   }
 }
-#line 3146 "conf_parser.c" /* yacc.c:1646  */
+#line 3139 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 85:
-#line 617 "conf_parser.y" /* yacc.c:1646  */
+#line 619 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2 && *yylval.string != '*')
   {
@@ -3173,11 +3166,11 @@ yyreduce:
     }
   }
 }
-#line 3177 "conf_parser.c" /* yacc.c:1646  */
+#line 3170 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 86:
-#line 645 "conf_parser.y" /* yacc.c:1646  */
+#line 647 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3201,11 +3194,11 @@ yyreduce:
   else
     ConfigServerInfo.default_max_clients = (yyvsp[-1].number);
 }
-#line 3205 "conf_parser.c" /* yacc.c:1646  */
+#line 3198 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 87:
-#line 670 "conf_parser.y" /* yacc.c:1646  */
+#line 672 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3226,11 +3219,11 @@ yyreduce:
   else
     ConfigServerInfo.max_nick_length = (yyvsp[-1].number);
 }
-#line 3230 "conf_parser.c" /* yacc.c:1646  */
+#line 3223 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 88:
-#line 692 "conf_parser.y" /* yacc.c:1646  */
+#line 694 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3251,20 +3244,20 @@ yyreduce:
   else
     ConfigServerInfo.max_topic_length = (yyvsp[-1].number);
 }
-#line 3255 "conf_parser.c" /* yacc.c:1646  */
+#line 3248 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 89:
-#line 714 "conf_parser.y" /* yacc.c:1646  */
+#line 716 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerInfo.hub = yylval.number;
 }
-#line 3264 "conf_parser.c" /* yacc.c:1646  */
+#line 3257 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 97:
-#line 732 "conf_parser.y" /* yacc.c:1646  */
+#line 734 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3272,11 +3265,11 @@ yyreduce:
   xfree(ConfigAdminInfo.name);
   ConfigAdminInfo.name = xstrdup(yylval.string);
 }
-#line 3276 "conf_parser.c" /* yacc.c:1646  */
+#line 3269 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 98:
-#line 741 "conf_parser.y" /* yacc.c:1646  */
+#line 743 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3284,11 +3277,11 @@ yyreduce:
   xfree(ConfigAdminInfo.email);
   ConfigAdminInfo.email = xstrdup(yylval.string);
 }
-#line 3288 "conf_parser.c" /* yacc.c:1646  */
+#line 3281 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 99:
-#line 750 "conf_parser.y" /* yacc.c:1646  */
+#line 752 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3296,20 +3289,20 @@ yyreduce:
   xfree(ConfigAdminInfo.description);
   ConfigAdminInfo.description = xstrdup(yylval.string);
 }
-#line 3300 "conf_parser.c" /* yacc.c:1646  */
+#line 3293 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 100:
-#line 763 "conf_parser.y" /* yacc.c:1646  */
+#line 765 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3309 "conf_parser.c" /* yacc.c:1646  */
+#line 3302 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 101:
-#line 767 "conf_parser.y" /* yacc.c:1646  */
+#line 769 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -3322,38 +3315,38 @@ yyreduce:
   DLINK_FOREACH(node, block_state.mask.list.head)
     motd_add(node->data, block_state.file.buf);
 }
-#line 3326 "conf_parser.c" /* yacc.c:1646  */
+#line 3319 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 107:
-#line 784 "conf_parser.y" /* yacc.c:1646  */
+#line 786 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3335 "conf_parser.c" /* yacc.c:1646  */
+#line 3328 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 108:
-#line 790 "conf_parser.y" /* yacc.c:1646  */
+#line 792 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3344 "conf_parser.c" /* yacc.c:1646  */
+#line 3337 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 109:
-#line 800 "conf_parser.y" /* yacc.c:1646  */
+#line 802 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3353 "conf_parser.c" /* yacc.c:1646  */
+#line 3346 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 110:
-#line 804 "conf_parser.y" /* yacc.c:1646  */
+#line 806 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3367,38 +3360,38 @@ yyreduce:
   pseudo_register(block_state.name.buf, block_state.nick.buf, block_state.host.buf,
                   block_state.prepend.buf, block_state.command.buf);
 }
-#line 3371 "conf_parser.c" /* yacc.c:1646  */
+#line 3364 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 118:
-#line 822 "conf_parser.y" /* yacc.c:1646  */
+#line 824 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.command.buf, yylval.string, sizeof(block_state.command.buf));
 }
-#line 3380 "conf_parser.c" /* yacc.c:1646  */
+#line 3373 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 119:
-#line 828 "conf_parser.y" /* yacc.c:1646  */
+#line 830 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3389 "conf_parser.c" /* yacc.c:1646  */
+#line 3382 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 120:
-#line 834 "conf_parser.y" /* yacc.c:1646  */
+#line 836 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.prepend.buf, yylval.string, sizeof(block_state.prepend.buf));
 }
-#line 3398 "conf_parser.c" /* yacc.c:1646  */
+#line 3391 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 121:
-#line 840 "conf_parser.y" /* yacc.c:1646  */
+#line 842 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3415,29 +3408,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 3419 "conf_parser.c" /* yacc.c:1646  */
+#line 3412 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 128:
-#line 868 "conf_parser.y" /* yacc.c:1646  */
+#line 870 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigLog.use_logging = yylval.number;
 }
-#line 3428 "conf_parser.c" /* yacc.c:1646  */
+#line 3421 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 129:
-#line 874 "conf_parser.y" /* yacc.c:1646  */
+#line 876 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3437 "conf_parser.c" /* yacc.c:1646  */
+#line 3430 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 130:
-#line 878 "conf_parser.y" /* yacc.c:1646  */
+#line 880 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3446,119 +3439,119 @@ yyreduce:
     log_set_file(block_state.type.value, block_state.size.value,
                  block_state.file.buf);
 }
-#line 3450 "conf_parser.c" /* yacc.c:1646  */
+#line 3443 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 137:
-#line 894 "conf_parser.y" /* yacc.c:1646  */
+#line 896 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
 
   strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3461 "conf_parser.c" /* yacc.c:1646  */
+#line 3454 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 138:
-#line 902 "conf_parser.y" /* yacc.c:1646  */
+#line 904 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.size.value = (yyvsp[-1].number);
 }
-#line 3469 "conf_parser.c" /* yacc.c:1646  */
+#line 3462 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 139:
-#line 905 "conf_parser.y" /* yacc.c:1646  */
+#line 907 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.size.value = 0;
 }
-#line 3477 "conf_parser.c" /* yacc.c:1646  */
+#line 3470 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 140:
-#line 910 "conf_parser.y" /* yacc.c:1646  */
+#line 912 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = 0;
 }
-#line 3486 "conf_parser.c" /* yacc.c:1646  */
+#line 3479 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 144:
-#line 917 "conf_parser.y" /* yacc.c:1646  */
+#line 919 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_USER;
 }
-#line 3495 "conf_parser.c" /* yacc.c:1646  */
+#line 3488 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 145:
-#line 921 "conf_parser.y" /* yacc.c:1646  */
+#line 923 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_OPER;
 }
-#line 3504 "conf_parser.c" /* yacc.c:1646  */
+#line 3497 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 146:
-#line 925 "conf_parser.y" /* yacc.c:1646  */
+#line 927 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_XLINE;
 }
-#line 3513 "conf_parser.c" /* yacc.c:1646  */
+#line 3506 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 147:
-#line 929 "conf_parser.y" /* yacc.c:1646  */
+#line 931 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_RESV;
 }
-#line 3522 "conf_parser.c" /* yacc.c:1646  */
+#line 3515 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 148:
-#line 933 "conf_parser.y" /* yacc.c:1646  */
+#line 935 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DLINE;
 }
-#line 3531 "conf_parser.c" /* yacc.c:1646  */
+#line 3524 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 149:
-#line 937 "conf_parser.y" /* yacc.c:1646  */
+#line 939 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KLINE;
 }
-#line 3540 "conf_parser.c" /* yacc.c:1646  */
+#line 3533 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 150:
-#line 941 "conf_parser.y" /* yacc.c:1646  */
+#line 943 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KILL;
 }
-#line 3549 "conf_parser.c" /* yacc.c:1646  */
+#line 3542 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 151:
-#line 945 "conf_parser.y" /* yacc.c:1646  */
+#line 947 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DEBUG;
 }
-#line 3558 "conf_parser.c" /* yacc.c:1646  */
+#line 3551 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 152:
-#line 955 "conf_parser.y" /* yacc.c:1646  */
+#line 957 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3566,11 +3559,11 @@ yyreduce:
   reset_block_state();
   block_state.flags.value |= CONF_FLAGS_ENCRYPTED;
 }
-#line 3570 "conf_parser.c" /* yacc.c:1646  */
+#line 3563 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 153:
-#line 962 "conf_parser.y" /* yacc.c:1646  */
+#line 964 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -3623,47 +3616,47 @@ yyreduce:
     conf_add_class_to_conf(conf, block_state.class.buf);
   }
 }
-#line 3627 "conf_parser.c" /* yacc.c:1646  */
+#line 3620 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 167:
-#line 1029 "conf_parser.y" /* yacc.c:1646  */
+#line 1031 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3636 "conf_parser.c" /* yacc.c:1646  */
+#line 3629 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 168:
-#line 1035 "conf_parser.y" /* yacc.c:1646  */
+#line 1037 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3645 "conf_parser.c" /* yacc.c:1646  */
+#line 3638 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 169:
-#line 1041 "conf_parser.y" /* yacc.c:1646  */
+#line 1043 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 3654 "conf_parser.c" /* yacc.c:1646  */
+#line 3647 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 170:
-#line 1047 "conf_parser.y" /* yacc.c:1646  */
+#line 1049 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.whois.buf, yylval.string, sizeof(block_state.whois.buf));
 }
-#line 3663 "conf_parser.c" /* yacc.c:1646  */
+#line 3656 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 171:
-#line 1053 "conf_parser.y" /* yacc.c:1646  */
+#line 1055 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3673,20 +3666,20 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
 }
-#line 3677 "conf_parser.c" /* yacc.c:1646  */
+#line 3670 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 172:
-#line 1064 "conf_parser.y" /* yacc.c:1646  */
+#line 1066 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 3686 "conf_parser.c" /* yacc.c:1646  */
+#line 3679 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 173:
-#line 1070 "conf_parser.y" /* yacc.c:1646  */
+#line 1072 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3696,497 +3689,497 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_SSL;
 }
-#line 3700 "conf_parser.c" /* yacc.c:1646  */
+#line 3693 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 174:
-#line 1081 "conf_parser.y" /* yacc.c:1646  */
+#line 1083 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 3709 "conf_parser.c" /* yacc.c:1646  */
+#line 3702 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 175:
-#line 1087 "conf_parser.y" /* yacc.c:1646  */
+#line 1089 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value = 0;
 }
-#line 3718 "conf_parser.c" /* yacc.c:1646  */
+#line 3711 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 179:
-#line 1094 "conf_parser.y" /* yacc.c:1646  */
+#line 1096 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_BOTS;
 }
-#line 3727 "conf_parser.c" /* yacc.c:1646  */
+#line 3720 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 180:
-#line 1098 "conf_parser.y" /* yacc.c:1646  */
+#line 1100 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CCONN;
 }
-#line 3736 "conf_parser.c" /* yacc.c:1646  */
+#line 3729 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 181:
-#line 1102 "conf_parser.y" /* yacc.c:1646  */
+#line 1104 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEAF;
 }
-#line 3745 "conf_parser.c" /* yacc.c:1646  */
+#line 3738 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 182:
-#line 1106 "conf_parser.y" /* yacc.c:1646  */
+#line 1108 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEBUG;
 }
-#line 3754 "conf_parser.c" /* yacc.c:1646  */
+#line 3747 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 183:
-#line 1110 "conf_parser.y" /* yacc.c:1646  */
+#line 1112 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FULL;
 }
-#line 3763 "conf_parser.c" /* yacc.c:1646  */
+#line 3756 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 184:
-#line 1114 "conf_parser.y" /* yacc.c:1646  */
+#line 1116 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDDEN;
 }
-#line 3772 "conf_parser.c" /* yacc.c:1646  */
+#line 3765 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 185:
-#line 1118 "conf_parser.y" /* yacc.c:1646  */
+#line 1120 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDECHANS;
 }
-#line 3781 "conf_parser.c" /* yacc.c:1646  */
+#line 3774 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 186:
-#line 1122 "conf_parser.y" /* yacc.c:1646  */
+#line 1124 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDEIDLE;
 }
-#line 3790 "conf_parser.c" /* yacc.c:1646  */
+#line 3783 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 187:
-#line 1126 "conf_parser.y" /* yacc.c:1646  */
+#line 1128 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SKILL;
 }
-#line 3799 "conf_parser.c" /* yacc.c:1646  */
+#line 3792 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 188:
-#line 1130 "conf_parser.y" /* yacc.c:1646  */
+#line 1132 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_NCHANGE;
 }
-#line 3808 "conf_parser.c" /* yacc.c:1646  */
+#line 3801 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 189:
-#line 1134 "conf_parser.y" /* yacc.c:1646  */
+#line 1136 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REJ;
 }
-#line 3817 "conf_parser.c" /* yacc.c:1646  */
+#line 3810 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 190:
-#line 1138 "conf_parser.y" /* yacc.c:1646  */
+#line 1140 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_UNAUTH;
 }
-#line 3826 "conf_parser.c" /* yacc.c:1646  */
+#line 3819 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 191:
-#line 1142 "conf_parser.y" /* yacc.c:1646  */
+#line 1144 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SPY;
 }
-#line 3835 "conf_parser.c" /* yacc.c:1646  */
+#line 3828 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 192:
-#line 1146 "conf_parser.y" /* yacc.c:1646  */
+#line 1148 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXTERNAL;
 }
-#line 3844 "conf_parser.c" /* yacc.c:1646  */
+#line 3837 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 193:
-#line 1150 "conf_parser.y" /* yacc.c:1646  */
+#line 1152 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SERVNOTICE;
 }
-#line 3853 "conf_parser.c" /* yacc.c:1646  */
+#line 3846 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 194:
-#line 1154 "conf_parser.y" /* yacc.c:1646  */
+#line 1156 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_INVISIBLE;
 }
-#line 3862 "conf_parser.c" /* yacc.c:1646  */
+#line 3855 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 195:
-#line 1158 "conf_parser.y" /* yacc.c:1646  */
+#line 1160 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_WALLOP;
 }
-#line 3871 "conf_parser.c" /* yacc.c:1646  */
+#line 3864 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 196:
-#line 1162 "conf_parser.y" /* yacc.c:1646  */
+#line 1164 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SOFTCALLERID;
 }
-#line 3880 "conf_parser.c" /* yacc.c:1646  */
+#line 3873 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 197:
-#line 1166 "conf_parser.y" /* yacc.c:1646  */
+#line 1168 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CALLERID;
 }
-#line 3889 "conf_parser.c" /* yacc.c:1646  */
+#line 3882 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 198:
-#line 1170 "conf_parser.y" /* yacc.c:1646  */
+#line 1172 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_LOCOPS;
 }
-#line 3898 "conf_parser.c" /* yacc.c:1646  */
+#line 3891 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 199:
-#line 1174 "conf_parser.y" /* yacc.c:1646  */
+#line 1176 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REGONLY;
 }
-#line 3907 "conf_parser.c" /* yacc.c:1646  */
+#line 3900 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 200:
-#line 1178 "conf_parser.y" /* yacc.c:1646  */
+#line 1180 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FARCONNECT;
 }
-#line 3916 "conf_parser.c" /* yacc.c:1646  */
+#line 3909 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 201:
-#line 1184 "conf_parser.y" /* yacc.c:1646  */
+#line 1186 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = 0;
 }
-#line 3925 "conf_parser.c" /* yacc.c:1646  */
+#line 3918 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 205:
-#line 1191 "conf_parser.y" /* yacc.c:1646  */
+#line 1193 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL_REMOTE;
 }
-#line 3934 "conf_parser.c" /* yacc.c:1646  */
+#line 3927 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 206:
-#line 1195 "conf_parser.y" /* yacc.c:1646  */
+#line 1197 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL;
 }
-#line 3943 "conf_parser.c" /* yacc.c:1646  */
+#line 3936 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 207:
-#line 1199 "conf_parser.y" /* yacc.c:1646  */
+#line 1201 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT_REMOTE;
 }
-#line 3952 "conf_parser.c" /* yacc.c:1646  */
+#line 3945 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 208:
-#line 1203 "conf_parser.y" /* yacc.c:1646  */
+#line 1205 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT;
 }
-#line 3961 "conf_parser.c" /* yacc.c:1646  */
+#line 3954 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 209:
-#line 1207 "conf_parser.y" /* yacc.c:1646  */
+#line 1209 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT_REMOTE;
 }
-#line 3970 "conf_parser.c" /* yacc.c:1646  */
+#line 3963 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 210:
-#line 1211 "conf_parser.y" /* yacc.c:1646  */
+#line 1213 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT;
 }
-#line 3979 "conf_parser.c" /* yacc.c:1646  */
+#line 3972 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 211:
-#line 1215 "conf_parser.y" /* yacc.c:1646  */
+#line 1217 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KLINE;
 }
-#line 3988 "conf_parser.c" /* yacc.c:1646  */
+#line 3981 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 212:
-#line 1219 "conf_parser.y" /* yacc.c:1646  */
+#line 1221 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNKLINE;
 }
-#line 3997 "conf_parser.c" /* yacc.c:1646  */
+#line 3990 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 213:
-#line 1223 "conf_parser.y" /* yacc.c:1646  */
+#line 1225 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DLINE;
 }
-#line 4006 "conf_parser.c" /* yacc.c:1646  */
+#line 3999 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 214:
-#line 1227 "conf_parser.y" /* yacc.c:1646  */
+#line 1229 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNDLINE;
 }
-#line 4015 "conf_parser.c" /* yacc.c:1646  */
+#line 4008 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 215:
-#line 1231 "conf_parser.y" /* yacc.c:1646  */
+#line 1233 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_XLINE;
 }
-#line 4024 "conf_parser.c" /* yacc.c:1646  */
+#line 4017 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 216:
-#line 1235 "conf_parser.y" /* yacc.c:1646  */
+#line 1237 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNXLINE;
 }
-#line 4033 "conf_parser.c" /* yacc.c:1646  */
+#line 4026 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 217:
-#line 1239 "conf_parser.y" /* yacc.c:1646  */
+#line 1241 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DIE;
 }
-#line 4042 "conf_parser.c" /* yacc.c:1646  */
+#line 4035 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 218:
-#line 1243 "conf_parser.y" /* yacc.c:1646  */
+#line 1245 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESTART;
 }
-#line 4051 "conf_parser.c" /* yacc.c:1646  */
+#line 4044 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 219:
-#line 1247 "conf_parser.y" /* yacc.c:1646  */
+#line 1249 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH_REMOTE;
 }
-#line 4060 "conf_parser.c" /* yacc.c:1646  */
+#line 4053 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 220:
-#line 1251 "conf_parser.y" /* yacc.c:1646  */
+#line 1253 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH;
 }
-#line 4069 "conf_parser.c" /* yacc.c:1646  */
+#line 4062 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 221:
-#line 1255 "conf_parser.y" /* yacc.c:1646  */
+#line 1257 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_ADMIN;
 }
-#line 4078 "conf_parser.c" /* yacc.c:1646  */
+#line 4071 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 222:
-#line 1259 "conf_parser.y" /* yacc.c:1646  */
+#line 1261 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_GLOBOPS;
 }
-#line 4087 "conf_parser.c" /* yacc.c:1646  */
+#line 4080 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 223:
-#line 1263 "conf_parser.y" /* yacc.c:1646  */
+#line 1265 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_WALLOPS;
 }
-#line 4096 "conf_parser.c" /* yacc.c:1646  */
+#line 4089 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 224:
-#line 1267 "conf_parser.y" /* yacc.c:1646  */
+#line 1269 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_LOCOPS;
 }
-#line 4105 "conf_parser.c" /* yacc.c:1646  */
+#line 4098 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 225:
-#line 1271 "conf_parser.y" /* yacc.c:1646  */
+#line 1273 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REMOTEBAN;
 }
-#line 4114 "conf_parser.c" /* yacc.c:1646  */
+#line 4107 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 226:
-#line 1275 "conf_parser.y" /* yacc.c:1646  */
+#line 1277 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SET;
 }
-#line 4123 "conf_parser.c" /* yacc.c:1646  */
+#line 4116 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 227:
-#line 1279 "conf_parser.y" /* yacc.c:1646  */
+#line 1281 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_MODULE;
 }
-#line 4132 "conf_parser.c" /* yacc.c:1646  */
+#line 4125 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 228:
-#line 1283 "conf_parser.y" /* yacc.c:1646  */
+#line 1285 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_OPME;
 }
-#line 4141 "conf_parser.c" /* yacc.c:1646  */
+#line 4134 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 229:
-#line 1287 "conf_parser.y" /* yacc.c:1646  */
+#line 1289 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_NICK_RESV;
 }
-#line 4150 "conf_parser.c" /* yacc.c:1646  */
+#line 4143 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 230:
-#line 1291 "conf_parser.y" /* yacc.c:1646  */
+#line 1293 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_JOIN_RESV;
 }
-#line 4159 "conf_parser.c" /* yacc.c:1646  */
+#line 4152 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 231:
-#line 1295 "conf_parser.y" /* yacc.c:1646  */
+#line 1297 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESV;
 }
-#line 4168 "conf_parser.c" /* yacc.c:1646  */
+#line 4161 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 232:
-#line 1299 "conf_parser.y" /* yacc.c:1646  */
+#line 1301 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNRESV;
 }
-#line 4177 "conf_parser.c" /* yacc.c:1646  */
+#line 4170 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 233:
-#line 1303 "conf_parser.y" /* yacc.c:1646  */
+#line 1305 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CLOSE;
 }
-#line 4186 "conf_parser.c" /* yacc.c:1646  */
+#line 4179 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 234:
-#line 1313 "conf_parser.y" /* yacc.c:1646  */
+#line 1315 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4199,11 +4192,11 @@ yyreduce:
   block_state.max_sendq.value = DEFAULT_SENDQ;
   block_state.max_recvq.value = DEFAULT_RECVQ;
 }
-#line 4203 "conf_parser.c" /* yacc.c:1646  */
+#line 4196 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 235:
-#line 1325 "conf_parser.y" /* yacc.c:1646  */
+#line 1327 "conf_parser.y" /* yacc.c:1646  */
     {
   struct ClassItem *class = NULL;
 
@@ -4239,126 +4232,126 @@ yyreduce:
   class->min_idle = block_state.min_idle.value;
   class->max_idle = block_state.max_idle.value;
 
-  rebuild_cidr_list(class);
-
   class->cidr_bitlen_ipv4 = block_state.cidr_bitlen_ipv4.value;
   class->cidr_bitlen_ipv6 = block_state.cidr_bitlen_ipv6.value;
   class->number_per_cidr = block_state.number_per_cidr.value;
+
+  rebuild_cidr_list(class);
 }
-#line 4249 "conf_parser.c" /* yacc.c:1646  */
+#line 4242 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 254:
-#line 1386 "conf_parser.y" /* yacc.c:1646  */
+#line 1388 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4258 "conf_parser.c" /* yacc.c:1646  */
+#line 4251 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 255:
-#line 1392 "conf_parser.y" /* yacc.c:1646  */
+#line 1394 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.ping_freq.value = (yyvsp[-1].number);
 }
-#line 4267 "conf_parser.c" /* yacc.c:1646  */
+#line 4260 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 256:
-#line 1398 "conf_parser.y" /* yacc.c:1646  */
+#line 1400 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_local.value = (yyvsp[-1].number);
 }
-#line 4276 "conf_parser.c" /* yacc.c:1646  */
+#line 4269 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 257:
-#line 1404 "conf_parser.y" /* yacc.c:1646  */
+#line 1406 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_global.value = (yyvsp[-1].number);
 }
-#line 4285 "conf_parser.c" /* yacc.c:1646  */
+#line 4278 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 258:
-#line 1410 "conf_parser.y" /* yacc.c:1646  */
+#line 1412 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.con_freq.value = (yyvsp[-1].number);
 }
-#line 4294 "conf_parser.c" /* yacc.c:1646  */
+#line 4287 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 259:
-#line 1416 "conf_parser.y" /* yacc.c:1646  */
+#line 1418 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_channels.value = (yyvsp[-1].number);
 }
-#line 4303 "conf_parser.c" /* yacc.c:1646  */
+#line 4296 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 260:
-#line 1422 "conf_parser.y" /* yacc.c:1646  */
+#line 1424 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_total.value = (yyvsp[-1].number);
 }
-#line 4312 "conf_parser.c" /* yacc.c:1646  */
+#line 4305 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 261:
-#line 1428 "conf_parser.y" /* yacc.c:1646  */
+#line 1430 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.max_sendq.value = (yyvsp[-1].number);
 }
-#line 4321 "conf_parser.c" /* yacc.c:1646  */
+#line 4314 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 262:
-#line 1434 "conf_parser.y" /* yacc.c:1646  */
+#line 1436 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     if ((yyvsp[-1].number) >= CLIENT_FLOOD_MIN && (yyvsp[-1].number) <= CLIENT_FLOOD_MAX)
       block_state.max_recvq.value = (yyvsp[-1].number);
 }
-#line 4331 "conf_parser.c" /* yacc.c:1646  */
+#line 4324 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 263:
-#line 1441 "conf_parser.y" /* yacc.c:1646  */
+#line 1443 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv4.value = (yyvsp[-1].number) > 32 ? 32 : (yyvsp[-1].number);
 }
-#line 4340 "conf_parser.c" /* yacc.c:1646  */
+#line 4333 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 264:
-#line 1447 "conf_parser.y" /* yacc.c:1646  */
+#line 1449 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv6.value = (yyvsp[-1].number) > 128 ? 128 : (yyvsp[-1].number);
 }
-#line 4349 "conf_parser.c" /* yacc.c:1646  */
+#line 4342 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 265:
-#line 1453 "conf_parser.y" /* yacc.c:1646  */
+#line 1455 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.number_per_cidr.value = (yyvsp[-1].number);
 }
-#line 4358 "conf_parser.c" /* yacc.c:1646  */
+#line 4351 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 266:
-#line 1459 "conf_parser.y" /* yacc.c:1646  */
+#line 1461 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4366,11 +4359,11 @@ yyreduce:
   block_state.min_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4370 "conf_parser.c" /* yacc.c:1646  */
+#line 4363 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 267:
-#line 1468 "conf_parser.y" /* yacc.c:1646  */
+#line 1470 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4378,88 +4371,97 @@ yyreduce:
   block_state.max_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4382 "conf_parser.c" /* yacc.c:1646  */
+#line 4375 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 268:
-#line 1477 "conf_parser.y" /* yacc.c:1646  */
+#line 1479 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value &= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4391 "conf_parser.c" /* yacc.c:1646  */
+#line 4384 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 272:
-#line 1484 "conf_parser.y" /* yacc.c:1646  */
+#line 1486 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_RANDOM_IDLE;
 }
-#line 4400 "conf_parser.c" /* yacc.c:1646  */
+#line 4393 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 273:
-#line 1488 "conf_parser.y" /* yacc.c:1646  */
+#line 1490 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_HIDE_IDLE_FROM_OPERS;
 }
-#line 4409 "conf_parser.c" /* yacc.c:1646  */
+#line 4402 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 274:
-#line 1498 "conf_parser.y" /* yacc.c:1646  */
+#line 1500 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4418 "conf_parser.c" /* yacc.c:1646  */
+#line 4411 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 276:
-#line 1504 "conf_parser.y" /* yacc.c:1646  */
+#line 1506 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.flags.value = 0;
 }
-#line 4426 "conf_parser.c" /* yacc.c:1646  */
+#line 4419 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 280:
-#line 1510 "conf_parser.y" /* yacc.c:1646  */
+#line 1512 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_SSL;
 }
-#line 4435 "conf_parser.c" /* yacc.c:1646  */
+#line 4428 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 281:
-#line 1514 "conf_parser.y" /* yacc.c:1646  */
+#line 1516 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_HIDDEN;
 }
-#line 4444 "conf_parser.c" /* yacc.c:1646  */
+#line 4437 "conf_parser.c" /* yacc.c:1646  */
     break;
 
   case 282:
-#line 1518 "conf_parser.y" /* yacc.c:1646  */
+#line 1520 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_SERVER;
 }
-#line 4453 "conf_parser.c" /* yacc.c:1646  */
+#line 4446 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 290:
-#line 1526 "conf_parser.y" /* yacc.c:1646  */
+  case 283:
+#line 1524 "conf_parser.y" /* yacc.c:1646  */
+    {
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= LISTENER_REUSEPORT;
+}
+#line 4455 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 291:
+#line 1532 "conf_parser.y" /* yacc.c:1646  */
     { block_state.flags.value = 0; }
-#line 4459 "conf_parser.c" /* yacc.c:1646  */
+#line 4461 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 294:
-#line 1531 "conf_parser.y" /* yacc.c:1646  */
+  case 295:
+#line 1537 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4473,11 +4475,11 @@ yyreduce:
     listener_add((yyvsp[0].number), block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4477 "conf_parser.c" /* yacc.c:1646  */
+#line 4479 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 295:
-#line 1544 "conf_parser.y" /* yacc.c:1646  */
+  case 296:
+#line 1550 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4493,38 +4495,38 @@ yyreduce:
       listener_add(i, block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4497 "conf_parser.c" /* yacc.c:1646  */
+#line 4499 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 296:
-#line 1561 "conf_parser.y" /* yacc.c:1646  */
+  case 297:
+#line 1567 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4506 "conf_parser.c" /* yacc.c:1646  */
+#line 4508 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 297:
-#line 1567 "conf_parser.y" /* yacc.c:1646  */
+  case 298:
+#line 1573 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4515 "conf_parser.c" /* yacc.c:1646  */
+#line 4517 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 298:
-#line 1577 "conf_parser.y" /* yacc.c:1646  */
+  case 299:
+#line 1583 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4524 "conf_parser.c" /* yacc.c:1646  */
+#line 4526 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 299:
-#line 1581 "conf_parser.y" /* yacc.c:1646  */
+  case 300:
+#line 1587 "conf_parser.y" /* yacc.c:1646  */
     {
   dlink_node *node = NULL;
 
@@ -4565,38 +4567,38 @@ yyreduce:
     add_conf_by_address(CONF_CLIENT, conf);
   }
 }
-#line 4569 "conf_parser.c" /* yacc.c:1646  */
+#line 4571 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 311:
-#line 1634 "conf_parser.y" /* yacc.c:1646  */
+  case 312:
+#line 1640 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4578 "conf_parser.c" /* yacc.c:1646  */
+#line 4580 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 312:
-#line 1640 "conf_parser.y" /* yacc.c:1646  */
+  case 313:
+#line 1646 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4587 "conf_parser.c" /* yacc.c:1646  */
+#line 4589 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 313:
-#line 1646 "conf_parser.y" /* yacc.c:1646  */
+  case 314:
+#line 1652 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4596 "conf_parser.c" /* yacc.c:1646  */
+#line 4598 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 314:
-#line 1652 "conf_parser.y" /* yacc.c:1646  */
+  case 315:
+#line 1658 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4606,110 +4608,110 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 4610 "conf_parser.c" /* yacc.c:1646  */
+#line 4612 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 315:
-#line 1663 "conf_parser.y" /* yacc.c:1646  */
+  case 316:
+#line 1669 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value &= (CONF_FLAGS_ENCRYPTED | CONF_FLAGS_SPOOF_IP);
 }
-#line 4619 "conf_parser.c" /* yacc.c:1646  */
+#line 4621 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 319:
-#line 1670 "conf_parser.y" /* yacc.c:1646  */
+  case 320:
+#line 1676 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_SPOOF_NOTICE;
 }
-#line 4628 "conf_parser.c" /* yacc.c:1646  */
+#line 4630 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 320:
-#line 1674 "conf_parser.y" /* yacc.c:1646  */
+  case 321:
+#line 1680 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NOLIMIT;
 }
-#line 4637 "conf_parser.c" /* yacc.c:1646  */
+#line 4639 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 321:
-#line 1678 "conf_parser.y" /* yacc.c:1646  */
+  case 322:
+#line 1684 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTKLINE;
 }
-#line 4646 "conf_parser.c" /* yacc.c:1646  */
+#line 4648 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 322:
-#line 1682 "conf_parser.y" /* yacc.c:1646  */
+  case 323:
+#line 1688 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTXLINE;
 }
-#line 4655 "conf_parser.c" /* yacc.c:1646  */
+#line 4657 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 323:
-#line 1686 "conf_parser.y" /* yacc.c:1646  */
+  case 324:
+#line 1692 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_IDENTD;
 }
-#line 4664 "conf_parser.c" /* yacc.c:1646  */
+#line 4666 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 324:
-#line 1690 "conf_parser.y" /* yacc.c:1646  */
+  case 325:
+#line 1696 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_CAN_FLOOD;
 }
-#line 4673 "conf_parser.c" /* yacc.c:1646  */
+#line 4675 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 325:
-#line 1694 "conf_parser.y" /* yacc.c:1646  */
+  case 326:
+#line 1700 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NO_TILDE;
 }
-#line 4682 "conf_parser.c" /* yacc.c:1646  */
+#line 4684 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 326:
-#line 1698 "conf_parser.y" /* yacc.c:1646  */
+  case 327:
+#line 1704 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTRESV;
 }
-#line 4691 "conf_parser.c" /* yacc.c:1646  */
+#line 4693 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 327:
-#line 1702 "conf_parser.y" /* yacc.c:1646  */
+  case 328:
+#line 1708 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_WEBIRC;
 }
-#line 4700 "conf_parser.c" /* yacc.c:1646  */
+#line 4702 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 328:
-#line 1706 "conf_parser.y" /* yacc.c:1646  */
+  case 329:
+#line 1712 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_PASSWORD;
 }
-#line 4709 "conf_parser.c" /* yacc.c:1646  */
+#line 4711 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 329:
-#line 1712 "conf_parser.y" /* yacc.c:1646  */
+  case 330:
+#line 1718 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4722,11 +4724,11 @@ yyreduce:
   else
     ilog(LOG_TYPE_IRCD, "Spoof either is too long or contains invalid characters. Ignoring it.");
 }
-#line 4726 "conf_parser.c" /* yacc.c:1646  */
+#line 4728 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 330:
-#line 1726 "conf_parser.y" /* yacc.c:1646  */
+  case 331:
+#line 1732 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4734,11 +4736,11 @@ yyreduce:
   strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
   block_state.flags.value |= CONF_FLAGS_REDIR;
 }
-#line 4738 "conf_parser.c" /* yacc.c:1646  */
+#line 4740 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 331:
-#line 1735 "conf_parser.y" /* yacc.c:1646  */
+  case 332:
+#line 1741 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4746,11 +4748,11 @@ yyreduce:
   block_state.flags.value |= CONF_FLAGS_REDIR;
   block_state.port.value = (yyvsp[-1].number);
 }
-#line 4750 "conf_parser.c" /* yacc.c:1646  */
+#line 4752 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 332:
-#line 1748 "conf_parser.y" /* yacc.c:1646  */
+  case 333:
+#line 1754 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4758,49 +4760,49 @@ yyreduce:
   reset_block_state();
   strlcpy(block_state.rpass.buf, CONF_NOREASON, sizeof(block_state.rpass.buf));
 }
-#line 4762 "conf_parser.c" /* yacc.c:1646  */
+#line 4764 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 333:
-#line 1755 "conf_parser.y" /* yacc.c:1646  */
+  case 334:
+#line 1761 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
 
   resv_make(block_state.name.buf, block_state.rpass.buf, &block_state.mask.list);
 }
-#line 4773 "conf_parser.c" /* yacc.c:1646  */
+#line 4775 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 340:
-#line 1766 "conf_parser.y" /* yacc.c:1646  */
+  case 341:
+#line 1772 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4782 "conf_parser.c" /* yacc.c:1646  */
+#line 4784 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 341:
-#line 1772 "conf_parser.y" /* yacc.c:1646  */
+  case 342:
+#line 1778 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4791 "conf_parser.c" /* yacc.c:1646  */
+#line 4793 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 342:
-#line 1778 "conf_parser.y" /* yacc.c:1646  */
+  case 343:
+#line 1784 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4800 "conf_parser.c" /* yacc.c:1646  */
+#line 4802 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 348:
-#line 1793 "conf_parser.y" /* yacc.c:1646  */
+  case 349:
+#line 1799 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4811,11 +4813,11 @@ yyreduce:
     service->name = xstrdup(yylval.string);
   }
 }
-#line 4815 "conf_parser.c" /* yacc.c:1646  */
+#line 4817 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 349:
-#line 1809 "conf_parser.y" /* yacc.c:1646  */
+  case 350:
+#line 1815 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4827,11 +4829,11 @@ yyreduce:
   strlcpy(block_state.host.buf, "*", sizeof(block_state.host.buf));
   block_state.flags.value = SHARED_ALL;
 }
-#line 4831 "conf_parser.c" /* yacc.c:1646  */
+#line 4833 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 350:
-#line 1820 "conf_parser.y" /* yacc.c:1646  */
+  case 351:
+#line 1826 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4842,20 +4844,20 @@ yyreduce:
   shared->user = xstrdup(block_state.user.buf);
   shared->host = xstrdup(block_state.host.buf);
 }
-#line 4846 "conf_parser.c" /* yacc.c:1646  */
+#line 4848 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 357:
-#line 1835 "conf_parser.y" /* yacc.c:1646  */
+  case 358:
+#line 1841 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4855 "conf_parser.c" /* yacc.c:1646  */
+#line 4857 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 358:
-#line 1841 "conf_parser.y" /* yacc.c:1646  */
+  case 359:
+#line 1847 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4873,110 +4875,110 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 4877 "conf_parser.c" /* yacc.c:1646  */
+#line 4879 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 359:
-#line 1860 "conf_parser.y" /* yacc.c:1646  */
+  case 360:
+#line 1866 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 4886 "conf_parser.c" /* yacc.c:1646  */
+#line 4888 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 363:
-#line 1867 "conf_parser.y" /* yacc.c:1646  */
+  case 364:
+#line 1873 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_KLINE;
 }
-#line 4895 "conf_parser.c" /* yacc.c:1646  */
+#line 4897 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 364:
-#line 1871 "conf_parser.y" /* yacc.c:1646  */
+  case 365:
+#line 1877 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNKLINE;
 }
-#line 4904 "conf_parser.c" /* yacc.c:1646  */
+#line 4906 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 365:
-#line 1875 "conf_parser.y" /* yacc.c:1646  */
+  case 366:
+#line 1881 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_DLINE;
 }
-#line 4913 "conf_parser.c" /* yacc.c:1646  */
+#line 4915 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 366:
-#line 1879 "conf_parser.y" /* yacc.c:1646  */
+  case 367:
+#line 1885 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNDLINE;
 }
-#line 4922 "conf_parser.c" /* yacc.c:1646  */
+#line 4924 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 367:
-#line 1883 "conf_parser.y" /* yacc.c:1646  */
+  case 368:
+#line 1889 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_XLINE;
 }
-#line 4931 "conf_parser.c" /* yacc.c:1646  */
+#line 4933 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 368:
-#line 1887 "conf_parser.y" /* yacc.c:1646  */
+  case 369:
+#line 1893 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNXLINE;
 }
-#line 4940 "conf_parser.c" /* yacc.c:1646  */
+#line 4942 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 369:
-#line 1891 "conf_parser.y" /* yacc.c:1646  */
+  case 370:
+#line 1897 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_RESV;
 }
-#line 4949 "conf_parser.c" /* yacc.c:1646  */
+#line 4951 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 370:
-#line 1895 "conf_parser.y" /* yacc.c:1646  */
+  case 371:
+#line 1901 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNRESV;
 }
-#line 4958 "conf_parser.c" /* yacc.c:1646  */
+#line 4960 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 371:
-#line 1899 "conf_parser.y" /* yacc.c:1646  */
+  case 372:
+#line 1905 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_LOCOPS;
 }
-#line 4967 "conf_parser.c" /* yacc.c:1646  */
+#line 4969 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 372:
-#line 1903 "conf_parser.y" /* yacc.c:1646  */
+  case 373:
+#line 1909 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = SHARED_ALL;
 }
-#line 4976 "conf_parser.c" /* yacc.c:1646  */
+#line 4978 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 373:
-#line 1913 "conf_parser.y" /* yacc.c:1646  */
+  case 374:
+#line 1919 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4986,11 +4988,11 @@ yyreduce:
   strlcpy(block_state.name.buf, "*", sizeof(block_state.name.buf));
   block_state.flags.value = CLUSTER_ALL;
 }
-#line 4990 "conf_parser.c" /* yacc.c:1646  */
+#line 4992 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 374:
-#line 1922 "conf_parser.y" /* yacc.c:1646  */
+  case 375:
+#line 1928 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4999,119 +5001,119 @@ yyreduce:
   cluster->type = block_state.flags.value;
   cluster->server = xstrdup(block_state.name.buf);
 }
-#line 5003 "conf_parser.c" /* yacc.c:1646  */
+#line 5005 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 380:
-#line 1935 "conf_parser.y" /* yacc.c:1646  */
+  case 381:
+#line 1941 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5012 "conf_parser.c" /* yacc.c:1646  */
+#line 5014 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 381:
-#line 1941 "conf_parser.y" /* yacc.c:1646  */
+  case 382:
+#line 1947 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 5021 "conf_parser.c" /* yacc.c:1646  */
+#line 5023 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 385:
-#line 1948 "conf_parser.y" /* yacc.c:1646  */
+  case 386:
+#line 1954 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_KLINE;
 }
-#line 5030 "conf_parser.c" /* yacc.c:1646  */
+#line 5032 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 386:
-#line 1952 "conf_parser.y" /* yacc.c:1646  */
+  case 387:
+#line 1958 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNKLINE;
 }
-#line 5039 "conf_parser.c" /* yacc.c:1646  */
+#line 5041 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 387:
-#line 1956 "conf_parser.y" /* yacc.c:1646  */
+  case 388:
+#line 1962 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_DLINE;
 }
-#line 5048 "conf_parser.c" /* yacc.c:1646  */
+#line 5050 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 388:
-#line 1960 "conf_parser.y" /* yacc.c:1646  */
+  case 389:
+#line 1966 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNDLINE;
 }
-#line 5057 "conf_parser.c" /* yacc.c:1646  */
+#line 5059 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 389:
-#line 1964 "conf_parser.y" /* yacc.c:1646  */
+  case 390:
+#line 1970 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_XLINE;
 }
-#line 5066 "conf_parser.c" /* yacc.c:1646  */
+#line 5068 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 390:
-#line 1968 "conf_parser.y" /* yacc.c:1646  */
+  case 391:
+#line 1974 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNXLINE;
 }
-#line 5075 "conf_parser.c" /* yacc.c:1646  */
+#line 5077 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 391:
-#line 1972 "conf_parser.y" /* yacc.c:1646  */
+  case 392:
+#line 1978 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_RESV;
 }
-#line 5084 "conf_parser.c" /* yacc.c:1646  */
+#line 5086 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 392:
-#line 1976 "conf_parser.y" /* yacc.c:1646  */
+  case 393:
+#line 1982 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNRESV;
 }
-#line 5093 "conf_parser.c" /* yacc.c:1646  */
+#line 5095 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 393:
-#line 1980 "conf_parser.y" /* yacc.c:1646  */
+  case 394:
+#line 1986 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_LOCOPS;
 }
-#line 5102 "conf_parser.c" /* yacc.c:1646  */
+#line 5104 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 394:
-#line 1984 "conf_parser.y" /* yacc.c:1646  */
+  case 395:
+#line 1990 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = CLUSTER_ALL;
 }
-#line 5111 "conf_parser.c" /* yacc.c:1646  */
+#line 5113 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 395:
-#line 1994 "conf_parser.y" /* yacc.c:1646  */
+  case 396:
+#line 2000 "conf_parser.y" /* yacc.c:1646  */
     {
 
   if (conf_parser_ctx.pass != 2)
@@ -5121,11 +5123,11 @@ yyreduce:
   block_state.aftype.value = AF_INET;
   block_state.port.value = PORTNUM;
 }
-#line 5125 "conf_parser.c" /* yacc.c:1646  */
+#line 5127 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 396:
-#line 2003 "conf_parser.y" /* yacc.c:1646  */
+  case 397:
+#line 2009 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
   struct addrinfo hints, *res;
@@ -5187,38 +5189,38 @@ yyreduce:
   conf_add_class_to_conf(conf, block_state.class.buf);
   lookup_confhost(conf);
 }
-#line 5191 "conf_parser.c" /* yacc.c:1646  */
+#line 5193 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 414:
-#line 2083 "conf_parser.y" /* yacc.c:1646  */
+  case 415:
+#line 2089 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5200 "conf_parser.c" /* yacc.c:1646  */
+#line 5202 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 415:
-#line 2089 "conf_parser.y" /* yacc.c:1646  */
+  case 416:
+#line 2095 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.host.buf, yylval.string, sizeof(block_state.host.buf));
 }
-#line 5209 "conf_parser.c" /* yacc.c:1646  */
+#line 5211 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 416:
-#line 2095 "conf_parser.y" /* yacc.c:1646  */
+  case 417:
+#line 2101 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.bind.buf, yylval.string, sizeof(block_state.bind.buf));
 }
-#line 5218 "conf_parser.c" /* yacc.c:1646  */
+#line 5220 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 417:
-#line 2101 "conf_parser.y" /* yacc.c:1646  */
+  case 418:
+#line 2107 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5230,11 +5232,11 @@ yyreduce:
   else
     strlcpy(block_state.spass.buf, yylval.string, sizeof(block_state.spass.buf));
 }
-#line 5234 "conf_parser.c" /* yacc.c:1646  */
+#line 5236 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 418:
-#line 2114 "conf_parser.y" /* yacc.c:1646  */
+  case 419:
+#line 2120 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5246,73 +5248,73 @@ yyreduce:
   else
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5250 "conf_parser.c" /* yacc.c:1646  */
+#line 5252 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 419:
-#line 2127 "conf_parser.y" /* yacc.c:1646  */
+  case 420:
+#line 2133 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 5259 "conf_parser.c" /* yacc.c:1646  */
+#line 5261 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 420:
-#line 2133 "conf_parser.y" /* yacc.c:1646  */
+  case 421:
+#line 2139 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = (yyvsp[-1].number);
 }
-#line 5268 "conf_parser.c" /* yacc.c:1646  */
+#line 5270 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 421:
-#line 2139 "conf_parser.y" /* yacc.c:1646  */
+  case 422:
+#line 2145 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET;
 }
-#line 5277 "conf_parser.c" /* yacc.c:1646  */
+#line 5279 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 422:
-#line 2143 "conf_parser.y" /* yacc.c:1646  */
+  case 423:
+#line 2149 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET6;
 }
-#line 5286 "conf_parser.c" /* yacc.c:1646  */
+#line 5288 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 423:
-#line 2149 "conf_parser.y" /* yacc.c:1646  */
+  case 424:
+#line 2155 "conf_parser.y" /* yacc.c:1646  */
     {
   block_state.flags.value &= CONF_FLAGS_ENCRYPTED;
 }
-#line 5294 "conf_parser.c" /* yacc.c:1646  */
+#line 5296 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 427:
-#line 2155 "conf_parser.y" /* yacc.c:1646  */
+  case 428:
+#line 2161 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_ALLOW_AUTO_CONN;
 }
-#line 5303 "conf_parser.c" /* yacc.c:1646  */
+#line 5305 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 428:
-#line 2159 "conf_parser.y" /* yacc.c:1646  */
+  case 429:
+#line 2165 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_SSL;
 }
-#line 5312 "conf_parser.c" /* yacc.c:1646  */
+#line 5314 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 429:
-#line 2165 "conf_parser.y" /* yacc.c:1646  */
+  case 430:
+#line 2171 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5322,38 +5324,38 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 5326 "conf_parser.c" /* yacc.c:1646  */
+#line 5328 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 430:
-#line 2176 "conf_parser.y" /* yacc.c:1646  */
+  case 431:
+#line 2182 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.hub.list);
 }
-#line 5335 "conf_parser.c" /* yacc.c:1646  */
+#line 5337 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 431:
-#line 2182 "conf_parser.y" /* yacc.c:1646  */
+  case 432:
+#line 2188 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.leaf.list);
 }
-#line 5344 "conf_parser.c" /* yacc.c:1646  */
+#line 5346 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 432:
-#line 2188 "conf_parser.y" /* yacc.c:1646  */
+  case 433:
+#line 2194 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 5353 "conf_parser.c" /* yacc.c:1646  */
+#line 5355 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 433:
-#line 2194 "conf_parser.y" /* yacc.c:1646  */
+  case 434:
+#line 2200 "conf_parser.y" /* yacc.c:1646  */
     {
 #ifdef HAVE_TLS
   if (conf_parser_ctx.pass == 2)
@@ -5363,20 +5365,20 @@ yyreduce:
     conf_error_report("Ignoring connect::ciphers -- no TLS support");
 #endif
 }
-#line 5367 "conf_parser.c" /* yacc.c:1646  */
+#line 5369 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 434:
-#line 2209 "conf_parser.y" /* yacc.c:1646  */
+  case 435:
+#line 2215 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5376 "conf_parser.c" /* yacc.c:1646  */
+#line 5378 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 435:
-#line 2213 "conf_parser.y" /* yacc.c:1646  */
+  case 436:
+#line 2219 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
 
@@ -5397,11 +5399,11 @@ yyreduce:
     conf->reason = xstrdup(CONF_NOREASON);
   add_conf_by_address(CONF_KLINE, conf);
 }
-#line 5401 "conf_parser.c" /* yacc.c:1646  */
+#line 5403 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 441:
-#line 2238 "conf_parser.y" /* yacc.c:1646  */
+  case 442:
+#line 2244 "conf_parser.y" /* yacc.c:1646  */
     {
 
   if (conf_parser_ctx.pass == 2)
@@ -5420,29 +5422,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 5424 "conf_parser.c" /* yacc.c:1646  */
+#line 5426 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 442:
-#line 2258 "conf_parser.y" /* yacc.c:1646  */
+  case 443:
+#line 2264 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5433 "conf_parser.c" /* yacc.c:1646  */
+#line 5435 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 443:
-#line 2268 "conf_parser.y" /* yacc.c:1646  */
+  case 444:
+#line 2274 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5442 "conf_parser.c" /* yacc.c:1646  */
+#line 5444 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 444:
-#line 2272 "conf_parser.y" /* yacc.c:1646  */
+  case 445:
+#line 2278 "conf_parser.y" /* yacc.c:1646  */
     {
   struct MaskItem *conf = NULL;
 
@@ -5464,29 +5466,29 @@ yyreduce:
     add_conf_by_address(CONF_DLINE, conf);
   }
 }
-#line 5468 "conf_parser.c" /* yacc.c:1646  */
+#line 5470 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 450:
-#line 2298 "conf_parser.y" /* yacc.c:1646  */
+  case 451:
+#line 2304 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 5477 "conf_parser.c" /* yacc.c:1646  */
+#line 5479 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 451:
-#line 2304 "conf_parser.y" /* yacc.c:1646  */
+  case 452:
+#line 2310 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5486 "conf_parser.c" /* yacc.c:1646  */
+#line 5488 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 457:
-#line 2319 "conf_parser.y" /* yacc.c:1646  */
+  case 458:
+#line 2325 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5499,20 +5501,20 @@ yyreduce:
     }
   }
 }
-#line 5503 "conf_parser.c" /* yacc.c:1646  */
+#line 5505 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 458:
-#line 2336 "conf_parser.y" /* yacc.c:1646  */
+  case 459:
+#line 2342 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5512 "conf_parser.c" /* yacc.c:1646  */
+#line 5514 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 459:
-#line 2340 "conf_parser.y" /* yacc.c:1646  */
+  case 460:
+#line 2346 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5528,880 +5530,892 @@ yyreduce:
   else
     gecos->reason = xstrdup(CONF_NOREASON);
 }
-#line 5532 "conf_parser.c" /* yacc.c:1646  */
+#line 5534 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 465:
-#line 2360 "conf_parser.y" /* yacc.c:1646  */
+  case 466:
+#line 2366 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5541 "conf_parser.c" /* yacc.c:1646  */
+#line 5543 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 466:
-#line 2366 "conf_parser.y" /* yacc.c:1646  */
+  case 467:
+#line 2372 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5550 "conf_parser.c" /* yacc.c:1646  */
+#line 5552 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 518:
-#line 2429 "conf_parser.y" /* yacc.c:1646  */
+  case 520:
+#line 2436 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.away_count = (yyvsp[-1].number);
 }
-#line 5558 "conf_parser.c" /* yacc.c:1646  */
+#line 5560 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 519:
-#line 2434 "conf_parser.y" /* yacc.c:1646  */
+  case 521:
+#line 2441 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.away_time = (yyvsp[-1].number);
 }
-#line 5566 "conf_parser.c" /* yacc.c:1646  */
+#line 5568 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 520:
-#line 2439 "conf_parser.y" /* yacc.c:1646  */
+  case 522:
+#line 2446 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_watch = (yyvsp[-1].number);
 }
-#line 5574 "conf_parser.c" /* yacc.c:1646  */
+#line 5576 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 521:
-#line 2444 "conf_parser.y" /* yacc.c:1646  */
+  case 523:
+#line 2451 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.whowas_history_length = (yyvsp[-1].number);
 }
-#line 5582 "conf_parser.c" /* yacc.c:1646  */
+#line 5584 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 522:
-#line 2449 "conf_parser.y" /* yacc.c:1646  */
+  case 524:
+#line 2456 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigGeneral.cycle_on_host_change = yylval.number;
 }
-#line 5591 "conf_parser.c" /* yacc.c:1646  */
+#line 5593 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 523:
-#line 2455 "conf_parser.y" /* yacc.c:1646  */
+  case 525:
+#line 2462 "conf_parser.y" /* yacc.c:1646  */
+    {
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigGeneral.metrics_socket);
+    ConfigGeneral.metrics_socket = xstrdup(yylval.string);
+  }
+}
+#line 5605 "conf_parser.c" /* yacc.c:1646  */
+    break;
+
+  case 526:
+#line 2471 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dline_min_cidr = (yyvsp[-1].number);
 }
-#line 5599 "conf_parser.c" /* yacc.c:1646  */
+#line 5613 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 524:
-#line 2460 "conf_parser.y" /* yacc.c:1646  */
+  case 527:
+#line 2476 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5607 "conf_parser.c" /* yacc.c:1646  */
+#line 5621 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 525:
-#line 2465 "conf_parser.y" /* yacc.c:1646  */
+  case 528:
+#line 2481 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kline_min_cidr = (yyvsp[-1].number);
 }
-#line 5615 "conf_parser.c" /* yacc.c:1646  */
+#line 5629 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 526:
-#line 2470 "conf_parser.y" /* yacc.c:1646  */
+  case 529:
+#line 2486 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5623 "conf_parser.c" /* yacc.c:1646  */
+#line 5637 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 527:
-#line 2475 "conf_parser.y" /* yacc.c:1646  */
+  case 530:
+#line 2491 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.tkline_expire_notices = yylval.number;
 }
-#line 5631 "conf_parser.c" /* yacc.c:1646  */
+#line 5645 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 528:
-#line 2480 "conf_parser.y" /* yacc.c:1646  */
+  case 531:
+#line 2496 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.kill_chase_time_limit = (yyvsp[-1].number);
 }
-#line 5639 "conf_parser.c" /* yacc.c:1646  */
+#line 5653 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 529:
-#line 2485 "conf_parser.y" /* yacc.c:1646  */
+  case 532:
+#line 2501 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ignore_bogus_ts = yylval.number;
 }
-#line 5647 "conf_parser.c" /* yacc.c:1646  */
+#line 5661 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 530:
-#line 2490 "conf_parser.y" /* yacc.c:1646  */
+  case 533:
+#line 2506 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.failed_oper_notice = yylval.number;
 }
-#line 5655 "conf_parser.c" /* yacc.c:1646  */
+#line 5669 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 531:
-#line 2495 "conf_parser.y" /* yacc.c:1646  */
+  case 534:
+#line 2511 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.anti_nick_flood = yylval.number;
 }
-#line 5663 "conf_parser.c" /* yacc.c:1646  */
+#line 5677 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 532:
-#line 2500 "conf_parser.y" /* yacc.c:1646  */
+  case 535:
+#line 2516 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_nick_time = (yyvsp[-1].number);
 }
-#line 5671 "conf_parser.c" /* yacc.c:1646  */
+#line 5685 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 533:
-#line 2505 "conf_parser.y" /* yacc.c:1646  */
+  case 536:
+#line 2521 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_nick_changes = (yyvsp[-1].number);
 }
-#line 5679 "conf_parser.c" /* yacc.c:1646  */
+#line 5693 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 534:
-#line 2510 "conf_parser.y" /* yacc.c:1646  */
+  case 537:
+#line 2526 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_accept = (yyvsp[-1].number);
 }
-#line 5687 "conf_parser.c" /* yacc.c:1646  */
+#line 5701 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 535:
-#line 2515 "conf_parser.y" /* yacc.c:1646  */
+  case 538:
+#line 2531 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.anti_spam_exit_message_time = (yyvsp[-1].number);
 }
-#line 5695 "conf_parser.c" /* yacc.c:1646  */
+#line 5709 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 536:
-#line 2520 "conf_parser.y" /* yacc.c:1646  */
+  case 539:
+#line 2536 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ts_warn_delta = (yyvsp[-1].number);
 }
-#line 5703 "conf_parser.c" /* yacc.c:1646  */
+#line 5717 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 537:
-#line 2525 "conf_parser.y" /* yacc.c:1646  */
+  case 540:
+#line 2541 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigGeneral.ts_max_delta = (yyvsp[-1].number);
 }
-#line 5712 "conf_parser.c" /* yacc.c:1646  */
+#line 5726 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 538:
-#line 2531 "conf_parser.y" /* yacc.c:1646  */
+  case 541:
+#line 2547 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.invisible_on_connect = yylval.number;
 }
-#line 5720 "conf_parser.c" /* yacc.c:1646  */
+#line 5734 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 539:
-#line 2536 "conf_parser.y" /* yacc.c:1646  */
+  case 542:
+#line 2552 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.warn_no_connect_block = yylval.number;
 }
-#line 5728 "conf_parser.c" /* yacc.c:1646  */
+#line 5742 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 540:
-#line 2541 "conf_parser.y" /* yacc.c:1646  */
+  case 543:
+#line 2557 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_e_disabled = yylval.number;
 }
-#line 5736 "conf_parser.c" /* yacc.c:1646  */
+#line 5750 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 541:
-#line 2546 "conf_parser.y" /* yacc.c:1646  */
+  case 544:
+#line 2562 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_m_oper_only = yylval.number;
 }
-#line 5744 "conf_parser.c" /* yacc.c:1646  */
+#line 5758 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 542:
-#line 2551 "conf_parser.y" /* yacc.c:1646  */
+  case 545:
+#line 2567 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_o_oper_only = yylval.number;
 }
-#line 5752 "conf_parser.c" /* yacc.c:1646  */
+#line 5766 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 543:
-#line 2556 "conf_parser.y" /* yacc.c:1646  */
+  case 546:
+#line 2572 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_P_oper_only = yylval.number;
 }
-#line 5760 "conf_parser.c" /* yacc.c:1646  */
+#line 5774 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 544:
-#line 2561 "conf_parser.y" /* yacc.c:1646  */
+  case 547:
+#line 2577 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_u_oper_only = yylval.number;
 }
-#line 5768 "conf_parser.c" /* yacc.c:1646  */
+#line 5782 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 545:
-#line 2566 "conf_parser.y" /* yacc.c:1646  */
+  case 548:
+#line 2582 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_k_oper_only = 2 * yylval.number;
 }
-#line 5776 "conf_parser.c" /* yacc.c:1646  */
+#line 5790 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 546:
-#line 2569 "conf_parser.y" /* yacc.c:1646  */
+  case 549:
+#line 2585 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_k_oper_only = 1;
 }
-#line 5784 "conf_parser.c" /* yacc.c:1646  */
+#line 5798 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 547:
-#line 2574 "conf_parser.y" /* yacc.c:1646  */
+  case 550:
+#line 2590 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_i_oper_only = 2 * yylval.number;
 }
-#line 5792 "conf_parser.c" /* yacc.c:1646  */
+#line 5806 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 548:
-#line 2577 "conf_parser.y" /* yacc.c:1646  */
+  case 551:
+#line 2593 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.stats_i_oper_only = 1;
 }
-#line 5800 "conf_parser.c" /* yacc.c:1646  */
+#line 5814 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 549:
-#line 2582 "conf_parser.y" /* yacc.c:1646  */
+  case 552:
+#line 2598 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.pace_wait = (yyvsp[-1].number);
 }
-#line 5808 "conf_parser.c" /* yacc.c:1646  */
+#line 5822 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 550:
-#line 2587 "conf_parser.y" /* yacc.c:1646  */
+  case 553:
+#line 2603 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.caller_id_wait = (yyvsp[-1].number);
 }
-#line 5816 "conf_parser.c" /* yacc.c:1646  */
+#line 5830 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 551:
-#line 2592 "conf_parser.y" /* yacc.c:1646  */
+  case 554:
+#line 2608 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.opers_bypass_callerid = yylval.number;
 }
-#line 5824 "conf_parser.c" /* yacc.c:1646  */
+#line 5838 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 552:
-#line 2597 "conf_parser.y" /* yacc.c:1646  */
+  case 555:
+#line 2613 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.pace_wait_simple = (yyvsp[-1].number);
 }
-#line 5832 "conf_parser.c" /* yacc.c:1646  */
+#line 5846 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 553:
-#line 2602 "conf_parser.y" /* yacc.c:1646  */
+  case 556:
+#line 2618 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.short_motd = yylval.number;
 }
-#line 5840 "conf_parser.c" /* yacc.c:1646  */
+#line 5854 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 554:
-#line 2607 "conf_parser.y" /* yacc.c:1646  */
+  case 557:
+#line 2623 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.no_oper_flood = yylval.number;
 }
-#line 5848 "conf_parser.c" /* yacc.c:1646  */
+#line 5862 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 555:
-#line 2612 "conf_parser.y" /* yacc.c:1646  */
+  case 558:
+#line 2628 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.dots_in_ident = (yyvsp[-1].number);
 }
-#line 5856 "conf_parser.c" /* yacc.c:1646  */
+#line 5870 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 556:
-#line 2617 "conf_parser.y" /* yacc.c:1646  */
+  case 559:
+#line 2633 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.max_targets = (yyvsp[-1].number);
 }
-#line 5864 "conf_parser.c" /* yacc.c:1646  */
+#line 5878 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 557:
-#line 2622 "conf_parser.y" /* yacc.c:1646  */
+  case 560:
+#line 2638 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.ping_cookie = yylval.number;
 }
-#line 5872 "conf_parser.c" /* yacc.c:1646  */
+#line 5886 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 558:
-#line 2627 "conf_parser.y" /* yacc.c:1646  */
+  case 561:
+#line 2643 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.disable_auth = yylval.number;
 }
-#line 5880 "conf_parser.c" /* yacc.c:1646  */
+#line 5894 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 559:
-#line 2632 "conf_parser.y" /* yacc.c:1646  */
+  case 562:
+#line 2648 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.throttle_count = (yyvsp[-1].number);
 }
-#line 5888 "conf_parser.c" /* yacc.c:1646  */
+#line 5902 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 560:
-#line 2637 "conf_parser.y" /* yacc.c:1646  */
+  case 563:
+#line 2653 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.throttle_time = (yyvsp[-1].number);
 }
-#line 5896 "conf_parser.c" /* yacc.c:1646  */
+#line 5910 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 561:
-#line 2642 "conf_parser.y" /* yacc.c:1646  */
+  case 564:
+#line 2658 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes = 0;
 }
-#line 5904 "conf_parser.c" /* yacc.c:1646  */
+#line 5918 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 565:
-#line 2648 "conf_parser.y" /* yacc.c:1646  */
+  case 568:
+#line 2664 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_BOTS;
 }
-#line 5912 "conf_parser.c" /* yacc.c:1646  */
+#line 5926 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 566:
-#line 2651 "conf_parser.y" /* yacc.c:1646  */
+  case 569:
+#line 2667 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_CCONN;
 }
-#line 5920 "conf_parser.c" /* yacc.c:1646  */
+#line 5934 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 567:
-#line 2654 "conf_parser.y" /* yacc.c:1646  */
+  case 570:
+#line 2670 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_DEAF;
 }
-#line 5928 "conf_parser.c" /* yacc.c:1646  */
+#line 5942 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 568:
-#line 2657 "conf_parser.y" /* yacc.c:1646  */
+  case 571:
+#line 2673 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_DEBUG;
 }
-#line 5936 "conf_parser.c" /* yacc.c:1646  */
+#line 5950 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 569:
-#line 2660 "conf_parser.y" /* yacc.c:1646  */
+  case 572:
+#line 2676 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_FULL;
 }
-#line 5944 "conf_parser.c" /* yacc.c:1646  */
+#line 5958 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 570:
-#line 2663 "conf_parser.y" /* yacc.c:1646  */
+  case 573:
+#line 2679 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDDEN;
 }
-#line 5952 "conf_parser.c" /* yacc.c:1646  */
+#line 5966 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 571:
-#line 2666 "conf_parser.y" /* yacc.c:1646  */
+  case 574:
+#line 2682 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDECHANS;
 }
-#line 5960 "conf_parser.c" /* yacc.c:1646  */
+#line 5974 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 572:
-#line 2669 "conf_parser.y" /* yacc.c:1646  */
+  case 575:
+#line 2685 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_HIDEIDLE;
 }
-#line 5968 "conf_parser.c" /* yacc.c:1646  */
+#line 5982 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 573:
-#line 2672 "conf_parser.y" /* yacc.c:1646  */
+  case 576:
+#line 2688 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SKILL;
 }
-#line 5976 "conf_parser.c" /* yacc.c:1646  */
+#line 5990 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 574:
-#line 2675 "conf_parser.y" /* yacc.c:1646  */
+  case 577:
+#line 2691 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_NCHANGE;
 }
-#line 5984 "conf_parser.c" /* yacc.c:1646  */
+#line 5998 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 575:
-#line 2678 "conf_parser.y" /* yacc.c:1646  */
+  case 578:
+#line 2694 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_REJ;
 }
-#line 5992 "conf_parser.c" /* yacc.c:1646  */
+#line 6006 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 576:
-#line 2681 "conf_parser.y" /* yacc.c:1646  */
+  case 579:
+#line 2697 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_UNAUTH;
 }
-#line 6000 "conf_parser.c" /* yacc.c:1646  */
+#line 6014 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 577:
-#line 2684 "conf_parser.y" /* yacc.c:1646  */
+  case 580:
+#line 2700 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SPY;
 }
-#line 6008 "conf_parser.c" /* yacc.c:1646  */
+#line 6022 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 578:
-#line 2687 "conf_parser.y" /* yacc.c:1646  */
+  case 581:
+#line 2703 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_EXTERNAL;
 }
-#line 6016 "conf_parser.c" /* yacc.c:1646  */
+#line 6030 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 579:
-#line 2690 "conf_parser.y" /* yacc.c:1646  */
+  case 582:
+#line 2706 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SERVNOTICE;
 }
-#line 6024 "conf_parser.c" /* yacc.c:1646  */
+#line 6038 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 580:
-#line 2693 "conf_parser.y" /* yacc.c:1646  */
+  case 583:
+#line 2709 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_INVISIBLE;
 }
-#line 6032 "conf_parser.c" /* yacc.c:1646  */
+#line 6046 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 581:
-#line 2696 "conf_parser.y" /* yacc.c:1646  */
+  case 584:
+#line 2712 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_WALLOP;
 }
-#line 6040 "conf_parser.c" /* yacc.c:1646  */
+#line 6054 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 582:
-#line 2699 "conf_parser.y" /* yacc.c:1646  */
+  case 585:
+#line 2715 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6048 "conf_parser.c" /* yacc.c:1646  */
+#line 6062 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 583:
-#line 2702 "conf_parser.y" /* yacc.c:1646  */
+  case 586:
+#line 2718 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_CALLERID;
 }
-#line 6056 "conf_parser.c" /* yacc.c:1646  */
+#line 6070 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 584:
-#line 2705 "conf_parser.y" /* yacc.c:1646  */
+  case 587:
+#line 2721 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_LOCOPS;
 }
-#line 6064 "conf_parser.c" /* yacc.c:1646  */
+#line 6078 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 585:
-#line 2708 "conf_parser.y" /* yacc.c:1646  */
+  case 588:
+#line 2724 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_REGONLY;
 }
-#line 6072 "conf_parser.c" /* yacc.c:1646  */
+#line 6086 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 586:
-#line 2711 "conf_parser.y" /* yacc.c:1646  */
+  case 589:
+#line 2727 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_umodes |= UMODE_FARCONNECT;
 }
-#line 6080 "conf_parser.c" /* yacc.c:1646  */
+#line 6094 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 587:
-#line 2716 "conf_parser.y" /* yacc.c:1646  */
+  case 590:
+#line 2732 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes = 0;
 }
-#line 6088 "conf_parser.c" /* yacc.c:1646  */
+#line 6102 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 591:
-#line 2722 "conf_parser.y" /* yacc.c:1646  */
+  case 594:
+#line 2738 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_BOTS;
 }
-#line 6096 "conf_parser.c" /* yacc.c:1646  */
+#line 6110 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 592:
-#line 2725 "conf_parser.y" /* yacc.c:1646  */
+  case 595:
+#line 2741 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_CCONN;
 }
-#line 6104 "conf_parser.c" /* yacc.c:1646  */
+#line 6118 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 593:
-#line 2728 "conf_parser.y" /* yacc.c:1646  */
+  case 596:
+#line 2744 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_DEAF;
 }
-#line 6112 "conf_parser.c" /* yacc.c:1646  */
+#line 6126 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 594:
-#line 2731 "conf_parser.y" /* yacc.c:1646  */
+  case 597:
+#line 2747 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_DEBUG;
 }
-#line 6120 "conf_parser.c" /* yacc.c:1646  */
+#line 6134 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 595:
-#line 2734 "conf_parser.y" /* yacc.c:1646  */
+  case 598:
+#line 2750 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_FULL;
 }
-#line 6128 "conf_parser.c" /* yacc.c:1646  */
+#line 6142 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 596:
-#line 2737 "conf_parser.y" /* yacc.c:1646  */
+  case 599:
+#line 2753 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SKILL;
 }
-#line 6136 "conf_parser.c" /* yacc.c:1646  */
+#line 6150 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 597:
-#line 2740 "conf_parser.y" /* yacc.c:1646  */
+  case 600:
+#line 2756 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_HIDDEN;
 }
-#line 6144 "conf_parser.c" /* yacc.c:1646  */
+#line 6158 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 598:
-#line 2743 "conf_parser.y" /* yacc.c:1646  */
+  case 601:
+#line 2759 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_NCHANGE;
 }
-#line 6152 "conf_parser.c" /* yacc.c:1646  */
+#line 6166 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 599:
-#line 2746 "conf_parser.y" /* yacc.c:1646  */
+  case 602:
+#line 2762 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_REJ;
 }
-#line 6160 "conf_parser.c" /* yacc.c:1646  */
+#line 6174 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 600:
-#line 2749 "conf_parser.y" /* yacc.c:1646  */
+  case 603:
+#line 2765 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_UNAUTH;
 }
-#line 6168 "conf_parser.c" /* yacc.c:1646  */
+#line 6182 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 601:
-#line 2752 "conf_parser.y" /* yacc.c:1646  */
+  case 604:
+#line 2768 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SPY;
 }
-#line 6176 "conf_parser.c" /* yacc.c:1646  */
+#line 6190 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 602:
-#line 2755 "conf_parser.y" /* yacc.c:1646  */
+  case 605:
+#line 2771 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_EXTERNAL;
 }
-#line 6184 "conf_parser.c" /* yacc.c:1646  */
+#line 6198 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 603:
-#line 2758 "conf_parser.y" /* yacc.c:1646  */
+  case 606:
+#line 2774 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SERVNOTICE;
 }
-#line 6192 "conf_parser.c" /* yacc.c:1646  */
+#line 6206 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 604:
-#line 2761 "conf_parser.y" /* yacc.c:1646  */
+  case 607:
+#line 2777 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_INVISIBLE;
 }
-#line 6200 "conf_parser.c" /* yacc.c:1646  */
+#line 6214 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 605:
-#line 2764 "conf_parser.y" /* yacc.c:1646  */
+  case 608:
+#line 2780 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_WALLOP;
 }
-#line 6208 "conf_parser.c" /* yacc.c:1646  */
+#line 6222 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 606:
-#line 2767 "conf_parser.y" /* yacc.c:1646  */
+  case 609:
+#line 2783 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6216 "conf_parser.c" /* yacc.c:1646  */
+#line 6230 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 607:
-#line 2770 "conf_parser.y" /* yacc.c:1646  */
+  case 610:
+#line 2786 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_CALLERID;
 }
-#line 6224 "conf_parser.c" /* yacc.c:1646  */
+#line 6238 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 608:
-#line 2773 "conf_parser.y" /* yacc.c:1646  */
+  case 611:
+#line 2789 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_LOCOPS;
 }
-#line 6232 "conf_parser.c" /* yacc.c:1646  */
+#line 6246 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 609:
-#line 2776 "conf_parser.y" /* yacc.c:1646  */
+  case 612:
+#line 2792 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_REGONLY;
 }
-#line 6240 "conf_parser.c" /* yacc.c:1646  */
+#line 6254 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 610:
-#line 2779 "conf_parser.y" /* yacc.c:1646  */
+  case 613:
+#line 2795 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.oper_only_umodes |= UMODE_FARCONNECT;
 }
-#line 6248 "conf_parser.c" /* yacc.c:1646  */
+#line 6262 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 611:
-#line 2784 "conf_parser.y" /* yacc.c:1646  */
+  case 614:
+#line 2800 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.min_nonwildcard = (yyvsp[-1].number);
 }
-#line 6256 "conf_parser.c" /* yacc.c:1646  */
+#line 6270 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 612:
-#line 2789 "conf_parser.y" /* yacc.c:1646  */
+  case 615:
+#line 2805 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.min_nonwildcard_simple = (yyvsp[-1].number);
 }
-#line 6264 "conf_parser.c" /* yacc.c:1646  */
+#line 6278 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 613:
-#line 2794 "conf_parser.y" /* yacc.c:1646  */
+  case 616:
+#line 2810 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.default_floodcount = (yyvsp[-1].number);
 }
-#line 6272 "conf_parser.c" /* yacc.c:1646  */
+#line 6286 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 614:
-#line 2799 "conf_parser.y" /* yacc.c:1646  */
+  case 617:
+#line 2815 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigGeneral.default_floodtime = (yyvsp[-1].number);
 }
-#line 6280 "conf_parser.c" /* yacc.c:1646  */
+#line 6294 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 633:
-#line 2827 "conf_parser.y" /* yacc.c:1646  */
+  case 636:
+#line 2843 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.disable_fake_channels = yylval.number;
 }
-#line 6288 "conf_parser.c" /* yacc.c:1646  */
+#line 6302 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 634:
-#line 2832 "conf_parser.y" /* yacc.c:1646  */
+  case 637:
+#line 2848 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_client_count = (yyvsp[-1].number);
 }
-#line 6296 "conf_parser.c" /* yacc.c:1646  */
+#line 6310 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 635:
-#line 2837 "conf_parser.y" /* yacc.c:1646  */
+  case 638:
+#line 2853 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_client_time = (yyvsp[-1].number);
 }
-#line 6304 "conf_parser.c" /* yacc.c:1646  */
+#line 6318 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 636:
-#line 2842 "conf_parser.y" /* yacc.c:1646  */
+  case 639:
+#line 2858 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_delay_channel = (yyvsp[-1].number);
 }
-#line 6312 "conf_parser.c" /* yacc.c:1646  */
+#line 6326 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 637:
-#line 2847 "conf_parser.y" /* yacc.c:1646  */
+  case 640:
+#line 2863 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.invite_expire_time = (yyvsp[-1].number);
 }
-#line 6320 "conf_parser.c" /* yacc.c:1646  */
+#line 6334 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 638:
-#line 2852 "conf_parser.y" /* yacc.c:1646  */
+  case 641:
+#line 2868 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_client_count = (yyvsp[-1].number);
 }
-#line 6328 "conf_parser.c" /* yacc.c:1646  */
+#line 6342 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 639:
-#line 2857 "conf_parser.y" /* yacc.c:1646  */
+  case 642:
+#line 2873 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_client_time = (yyvsp[-1].number);
 }
-#line 6336 "conf_parser.c" /* yacc.c:1646  */
+#line 6350 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 640:
-#line 2862 "conf_parser.y" /* yacc.c:1646  */
+  case 643:
+#line 2878 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.knock_delay_channel = (yyvsp[-1].number);
 }
-#line 6344 "conf_parser.c" /* yacc.c:1646  */
+#line 6358 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 641:
-#line 2867 "conf_parser.y" /* yacc.c:1646  */
+  case 644:
+#line 2883 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_channels = (yyvsp[-1].number);
 }
-#line 6352 "conf_parser.c" /* yacc.c:1646  */
+#line 6366 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 642:
-#line 2872 "conf_parser.y" /* yacc.c:1646  */
+  case 645:
+#line 2888 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_invites = (yyvsp[-1].number);
 }
-#line 6360 "conf_parser.c" /* yacc.c:1646  */
+#line 6374 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 643:
-#line 2877 "conf_parser.y" /* yacc.c:1646  */
+  case 646:
+#line 2893 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_bans = (yyvsp[-1].number);
 }
-#line 6368 "conf_parser.c" /* yacc.c:1646  */
+#line 6382 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 644:
-#line 2882 "conf_parser.y" /* yacc.c:1646  */
+  case 647:
+#line 2898 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.max_bans_large = (yyvsp[-1].number);
 }
-#line 6376 "conf_parser.c" /* yacc.c:1646  */
+#line 6390 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 645:
-#line 2887 "conf_parser.y" /* yacc.c:1646  */
+  case 648:
+#line 2903 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.default_join_flood_count = yylval.number;
 }
-#line 6384 "conf_parser.c" /* yacc.c:1646  */
+#line 6398 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 646:
-#line 2892 "conf_parser.y" /* yacc.c:1646  */
+  case 649:
+#line 2908 "conf_parser.y" /* yacc.c:1646  */
     {
   ConfigChannel.default_join_flood_time = (yyvsp[-1].number);
 }
-#line 6392 "conf_parser.c" /* yacc.c:1646  */
+#line 6406 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 660:
-#line 2915 "conf_parser.y" /* yacc.c:1646  */
+  case 663:
+#line 2931 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.flatten_links = yylval.number;
 }
-#line 6401 "conf_parser.c" /* yacc.c:1646  */
+#line 6415 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 661:
-#line 2921 "conf_parser.y" /* yacc.c:1646  */
+  case 664:
+#line 2937 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6416,11 +6430,11 @@ yyreduce:
     ConfigServerHide.flatten_links_delay = (yyvsp[-1].number);
   }
 }
-#line 6420 "conf_parser.c" /* yacc.c:1646  */
+#line 6434 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 662:
-#line 2937 "conf_parser.y" /* yacc.c:1646  */
+  case 665:
+#line 2953 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6428,38 +6442,38 @@ yyreduce:
     ConfigServerHide.flatten_links_file = xstrdup(yylval.string);
   }
 }
-#line 6432 "conf_parser.c" /* yacc.c:1646  */
+#line 6446 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 663:
-#line 2946 "conf_parser.y" /* yacc.c:1646  */
+  case 666:
+#line 2962 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.disable_remote_commands = yylval.number;
 }
-#line 6441 "conf_parser.c" /* yacc.c:1646  */
+#line 6455 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 664:
-#line 2952 "conf_parser.y" /* yacc.c:1646  */
+  case 667:
+#line 2968 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_servers = yylval.number;
 }
-#line 6450 "conf_parser.c" /* yacc.c:1646  */
+#line 6464 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 665:
-#line 2958 "conf_parser.y" /* yacc.c:1646  */
+  case 668:
+#line 2974 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_services = yylval.number;
 }
-#line 6459 "conf_parser.c" /* yacc.c:1646  */
+#line 6473 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 666:
-#line 2964 "conf_parser.y" /* yacc.c:1646  */
+  case 669:
+#line 2980 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6467,29 +6481,29 @@ yyreduce:
     ConfigServerHide.hidden_name = xstrdup(yylval.string);
   }
 }
-#line 6471 "conf_parser.c" /* yacc.c:1646  */
+#line 6485 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 667:
-#line 2973 "conf_parser.y" /* yacc.c:1646  */
+  case 670:
+#line 2989 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hidden = yylval.number;
 }
-#line 6480 "conf_parser.c" /* yacc.c:1646  */
+#line 6494 "conf_parser.c" /* yacc.c:1646  */
     break;
 
-  case 668:
-#line 2979 "conf_parser.y" /* yacc.c:1646  */
+  case 671:
+#line 2995 "conf_parser.y" /* yacc.c:1646  */
     {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_server_ips = yylval.number;
 }
-#line 6489 "conf_parser.c" /* yacc.c:1646  */
+#line 6503 "conf_parser.c" /* yacc.c:1646  */
     break;
 
 
-#line 6493 "conf_parser.c" /* yacc.c:1646  */
+#line 6507 "conf_parser.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
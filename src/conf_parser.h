@@ -137,141 +137,143 @@ extern int yydebug;
     MAX_TARGETS = 347,
     MAX_TOPIC_LENGTH = 348,
     MAX_WATCH = 349,
-    MIN_IDLE = 350,
-    MIN_NONWILDCARD = 351,
-    MIN_NONWILDCARD_SIMPLE = 352,
-    MODULE = 353,
-    MODULES = 354,
-    MOTD = 355,
-    NAME = 356,
-    NEED_IDENT = 357,
-    NEED_PASSWORD = 358,
-    NETWORK_DESC = 359,
-    NETWORK_NAME = 360,
-    NICK = 361,
-    NO_OPER_FLOOD = 362,
-    NO_TILDE = 363,
-    NUMBER = 364,
-    NUMBER_PER_CIDR = 365,
-    NUMBER_PER_IP_GLOBAL = 366,
-    NUMBER_PER_IP_LOCAL = 367,
-    OPER_ONLY_UMODES = 368,
-    OPER_UMODES = 369,
-    OPERATOR = 370,
-    OPERS_BYPASS_CALLERID = 371,
-    PACE_WAIT = 372,
-    PACE_WAIT_SIMPLE = 373,
-    PASSWORD = 374,
-    PATH = 375,
-    PING_COOKIE = 376,
-    PING_TIME = 377,
-    PORT = 378,
-    QSTRING = 379,
-    RANDOM_IDLE = 380,
-    REASON = 381,
-    REDIRPORT = 382,
-    REDIRSERV = 383,
-    REHASH = 384,
-    REMOTE = 385,
-    REMOTEBAN = 386,
-    RESV = 387,
-    RESV_EXEMPT = 388,
-    RSA_PRIVATE_KEY_FILE = 389,
-    SECONDS = 390,
-    MINUTES = 391,
-    HOURS = 392,
-    DAYS = 393,
-    WEEKS = 394,
-    MONTHS = 395,
-    YEARS = 396,
-    SEND_PASSWORD = 397,
-    SENDQ = 398,
-    SERVERHIDE = 399,
-    SERVERINFO = 400,
-    SHORT_MOTD = 401,
-    SPOOF = 402,
-    SPOOF_NOTICE = 403,
-    SQUIT = 404,
-    SSL_CERTIFICATE_FILE = 405,
-    SSL_CERTIFICATE_FINGERPRINT = 406,
-    SSL_CONNECTION_REQUIRED = 407,
-    SSL_DH_ELLIPTIC_CURVE = 408,
-    SSL_DH_PARAM_FILE = 409,
-    SSL_MESSAGE_DIGEST_ALGORITHM = 410,
-    STATS_E_DISABLED = 411,
-    STATS_I_OPER_ONLY = 412,
-    STATS_K_OPER_ONLY = 413,
-    STATS_M_OPER_ONLY = 414,
-    STATS_O_OPER_ONLY = 415,
-    STATS_P_OPER_ONLY = 416,
-    STATS_U_OPER_ONLY = 417,
-    T_ALL = 418,
-    T_BOTS = 419,
-    T_CALLERID = 420,
-    T_CCONN = 421,
-    T_COMMAND = 422,
-    T_CLUSTER = 423,
-    T_DEAF = 424,
-    T_DEBUG = 425,
-    T_DLINE = 426,
-    T_EXTERNAL = 427,
-    T_FARCONNECT = 428,
-    T_FILE = 429,
-    T_FULL = 430,
-    T_GLOBOPS = 431,
-    T_INVISIBLE = 432,
-    T_IPV4 = 433,
-    T_IPV6 = 434,
-    T_LOCOPS = 435,
-    T_LOG = 436,
-    T_NCHANGE = 437,
-    T_NONONREG = 438,
-    T_OPME = 439,
-    T_PREPEND = 440,
-    T_PSEUDO = 441,
-    T_RECVQ = 442,
-    T_REJ = 443,
-    T_RESTART = 444,
-    T_SERVER = 445,
-    T_SERVICE = 446,
-    T_SERVNOTICE = 447,
-    T_SET = 448,
-    T_SHARED = 449,
-    T_SIZE = 450,
-    T_SKILL = 451,
-    T_SOFTCALLERID = 452,
-    T_SPY = 453,
-    T_SSL = 454,
-    T_SSL_CIPHER_LIST = 455,
-    T_TARGET = 456,
-    T_UMODES = 457,
-    T_UNAUTH = 458,
-    T_UNDLINE = 459,
-    T_UNLIMITED = 460,
-    T_UNRESV = 461,
-    T_UNXLINE = 462,
-    T_WALLOP = 463,
-    T_WALLOPS = 464,
-    T_WEBIRC = 465,
-    TBOOL = 466,
-    THROTTLE_COUNT = 467,
-    THROTTLE_TIME = 468,
-    TKLINE_EXPIRE_NOTICES = 469,
-    TMASKED = 470,
-    TS_MAX_DELTA = 471,
-    TS_WARN_DELTA = 472,
-    TWODOTS = 473,
-    TYPE = 474,
-    UNKLINE = 475,
-    USE_LOGGING = 476,
-    USER = 477,
-    VHOST = 478,
-    VHOST6 = 479,
-    WARN_NO_CONNECT_BLOCK = 480,
-    WHOIS = 481,
-    WHOWAS_HISTORY_LENGTH = 482,
-    XLINE = 483,
-    XLINE_EXEMPT = 484
+    METRICS_SOCKET = 350,
+    MIN_IDLE = 351,
+    MIN_NONWILDCARD = 352,
+    MIN_NONWILDCARD_SIMPLE = 353,
+    MODULE = 354,
+    MODULES = 355,
+    MOTD = 356,
+    NAME = 357,
+    NEED_IDENT = 358,
+    NEED_PASSWORD = 359,
+    NETWORK_DESC = 360,
+    NETWORK_NAME = 361,
+    NICK = 362,
+    NO_OPER_FLOOD = 363,
+    NO_TILDE = 364,
+    NUMBER = 365,
+    NUMBER_PER_CIDR = 366,
+    NUMBER_PER_IP_GLOBAL = 367,
+    NUMBER_PER_IP_LOCAL = 368,
+    OPER_ONLY_UMODES = 369,
+    OPER_UMODES = 370,
+    OPERATOR = 371,
+    OPERS_BYPASS_CALLERID = 372,
+    PACE_WAIT = 373,
+    PACE_WAIT_SIMPLE = 374,
+    PASSWORD = 375,
+    PATH = 376,
+    PING_COOKIE = 377,
+    PING_TIME = 378,
+    PORT = 379,
+    QSTRING = 380,
+    RANDOM_IDLE = 381,
+    REASON = 382,
+    REDIRPORT = 383,
+    REDIRSERV = 384,
+    REHASH = 385,
+    REMOTE = 386,
+    REMOTEBAN = 387,
+    RESV = 388,
+    RESV_EXEMPT = 389,
+    REUSEPORT = 390,
+    RSA_PRIVATE_KEY_FILE = 391,
+    SECONDS = 392,
+    MINUTES = 393,
+    HOURS = 394,
+    DAYS = 395,
+    WEEKS = 396,
+    MONTHS = 397,
+    YEARS = 398,
+    SEND_PASSWORD = 399,
+    SENDQ = 400,
+    SERVERHIDE = 401,
+    SERVERINFO = 402,
+    SHORT_MOTD = 403,
+    SPOOF = 404,
+    SPOOF_NOTICE = 405,
+    SQUIT = 406,
+    SSL_CERTIFICATE_FILE = 407,
+    SSL_CERTIFICATE_FINGERPRINT = 408,
+    SSL_CONNECTION_REQUIRED = 409,
+    SSL_DH_ELLIPTIC_CURVE = 410,
+    SSL_DH_PARAM_FILE = 411,
+    SSL_MESSAGE_DIGEST_ALGORITHM = 412,
+    STATS_E_DISABLED = 413,
+    STATS_I_OPER_ONLY = 414,
+    STATS_K_OPER_ONLY = 415,
+    STATS_M_OPER_ONLY = 416,
+    STATS_O_OPER_ONLY = 417,
+    STATS_P_OPER_ONLY = 418,
+    STATS_U_OPER_ONLY = 419,
+    T_ALL = 420,
+    T_BOTS = 421,
+    T_CALLERID = 422,
+    T_CCONN = 423,
+    T_COMMAND = 424,
+    T_CLUSTER = 425,
+    T_DEAF = 426,
+    T_DEBUG = 427,
+    T_DLINE = 428,
+    T_EXTERNAL = 429,
+    T_FARCONNECT = 430,
+    T_FILE = 431,
+    T_FULL = 432,
+    T_GLOBOPS = 433,
+    T_INVISIBLE = 434,
+    T_IPV4 = 435,
+    T_IPV6 = 436,
+    T_LOCOPS = 437,
+    T_LOG = 438,
+    T_NCHANGE = 439,
+    T_NONONREG = 440,
+    T_OPME = 441,
+    T_PREPEND = 442,
+    T_PSEUDO = 443,
+    T_RECVQ = 444,
+    T_REJ = 445,
+    T_RESTART = 446,
+    T_SERVER = 447,
+    T_SERVICE = 448,
+    T_SERVNOTICE = 449,
+    T_SET = 450,
+    T_SHARED = 451,
+    T_SIZE = 452,
+    T_SKILL = 453,
+    T_SOFTCALLERID = 454,
+    T_SPY = 455,
+    T_SSL = 456,
+    T_SSL_CIPHER_LIST = 457,
+    T_TARGET = 458,
+    T_UMODES = 459,
+    T_UNAUTH = 460,
+    T_UNDLINE = 461,
+    T_UNLIMITED = 462,
+    T_UNRESV = 463,
+    T_UNXLINE = 464,
+    T_WALLOP = 465,
+    T_WALLOPS = 466,
+    T_WEBIRC = 467,
+    TBOOL = 468,
+    THROTTLE_COUNT = 469,
+    THROTTLE_TIME = 470,
+    TKLINE_EXPIRE_NOTICES = 471,
+    TMASKED = 472,
+    TS_MAX_DELTA = 473,
+    TS_WARN_DELTA = 474,
+    TWODOTS = 475,
+    TYPE = 476,
+    UNKLINE = 477,
+    USE_LOGGING = 478,
+    USER = 479,
+    VHOST = 480,
+    VHOST6 = 481,
+    WARN_NO_CONNECT_BLOCK = 482,
+    WHOIS = 483,
+    WHOWAS_HISTORY_LENGTH = 484,
+    XLINE = 485,
+    XLINE_EXEMPT = 486
   };
 #endif
 /* Tokens.  */
@@ -367,141 +369,143 @@ extern int yydebug;
 #define MAX_TARGETS 347
 #define MAX_TOPIC_LENGTH 348
 #define MAX_WATCH 349
-#define MIN_IDLE 350
-#define MIN_NONWILDCARD 351
-#define MIN_NONWILDCARD_SIMPLE 352
-#define MODULE 353
-#define MODULES 354
-#define MOTD 355
-#define NAME 356
-#define NEED_IDENT 357
-#define NEED_PASSWORD 358
-#define NETWORK_DESC 359
-#define NETWORK_NAME 360
-#define NICK 361
-#define NO_OPER_FLOOD 362
-#define NO_TILDE 363
-#define NUMBER 364
-#define NUMBER_PER_CIDR 365
-#define NUMBER_PER_IP_GLOBAL 366
-#define NUMBER_PER_IP_LOCAL 367
-#define OPER_ONLY_UMODES 368
-#define OPER_UMODES 369
-#define OPERATOR 370
-#define OPERS_BYPASS_CALLERID 371
-#define PACE_WAIT 372
-#define PACE_WAIT_SIMPLE 373
-#define PASSWORD 374
-#define PATH 375
-#define PING_COOKIE 376
-#define PING_TIME 377
-#define PORT 378
-#define QSTRING 379
-#define RANDOM_IDLE 380
-#define REASON 381
-#define REDIRPORT 382
-#define REDIRSERV 383
-#define REHASH 384
-#define REMOTE 385
-#define REMOTEBAN 386
-#define RESV 387
-#define RESV_EXEMPT 388
-#define RSA_PRIVATE_KEY_FILE 389
-#define SECONDS 390
-#define MINUTES 391
-#define HOURS 392
-#define DAYS 393
-#define WEEKS 394
-#define MONTHS 395
-#define YEARS 396
-#define SEND_PASSWORD 397
-#define SENDQ 398
-#define SERVERHIDE 399
-#define SERVERINFO 400
-#define SHORT_MOTD 401
-#define SPOOF 402
-#define SPOOF_NOTICE 403
-#define SQUIT 404
-#define SSL_CERTIFICATE_FILE 405
-#define SSL_CERTIFICATE_FINGERPRINT 406
-#define SSL_CONNECTION_REQUIRED 407
-#define SSL_DH_ELLIPTIC_CURVE 408
-#define SSL_DH_PARAM_FILE 409
-#define SSL_MESSAGE_DIGEST_ALGORITHM 410
-#define STATS_E_DISABLED 411
-#define STATS_I_OPER_ONLY 412
-#define STATS_K_OPER_ONLY 413
-#define STATS_M_OPER_ONLY 414
-#define STATS_O_OPER_ONLY 415
-#define STATS_P_OPER_ONLY 416
-#define STATS_U_OPER_ONLY 417
-#define T_ALL 418
-#define T_BOTS 419
-#define T_CALLERID 420
-#define T_CCONN 421
-#define T_COMMAND 422
-#define T_CLUSTER 423
-#define T_DEAF 424
-#define T_DEBUG 425
-#define T_DLINE 426
-#define T_EXTERNAL 427
-#define T_FARCONNECT 428
-#define T_FILE 429
-#define T_FULL 430
-#define T_GLOBOPS 431
-#define T_INVISIBLE 432
-#define T_IPV4 433
-#define T_IPV6 434
-#define T_LOCOPS 435
-#define T_LOG 436
-#define T_NCHANGE 437
-#define T_NONONREG 438
-#define T_OPME 439
-#define T_PREPEND 440
-#define T_PSEUDO 441
-#define T_RECVQ 442
-#define T_REJ 443
-#define T_RESTART 444
-#define T_SERVER 445
-#define T_SERVICE 446
-#define T_SERVNOTICE 447
-#define T_SET 448
-#define T_SHARED 449
-#define T_SIZE 450
-#define T_SKILL 451
-#define T_SOFTCALLERID 452
-#define T_SPY 453
-#define T_SSL 454
-#define T_SSL_CIPHER_LIST 455
-#define T_TARGET 456
-#define T_UMODES 457
-#define T_UNAUTH 458
-#define T_UNDLINE 459
-#define T_UNLIMITED 460
-#define T_UNRESV 461
-#define T_UNXLINE 462
-#define T_WALLOP 463
-#define T_WALLOPS 464
-#define T_WEBIRC 465
-#define TBOOL 466
-#define THROTTLE_COUNT 467
-#define THROTTLE_TIME 468
-#define TKLINE_EXPIRE_NOTICES 469
-#define TMASKED 470
-#define TS_MAX_DELTA 471
-#define TS_WARN_DELTA 472
-#define TWODOTS 473
-#define TYPE 474
-#define UNKLINE 475
-#define USE_LOGGING 476
-#define USER 477
-#define VHOST 478
-#define VHOST6 479
-#define WARN_NO_CONNECT_BLOCK 480
-#define WHOIS 481
-#define WHOWAS_HISTORY_LENGTH 482
-#define XLINE 483
-#define XLINE_EXEMPT 484
+#define METRICS_SOCKET 350
+#define MIN_IDLE 351
+#define MIN_NONWILDCARD 352
+#define MIN_NONWILDCARD_SIMPLE 353
+#define MODULE 354
+#define MODULES 355
+#define MOTD 356
+#define NAME 357
+#define NEED_IDENT 358
+#define NEED_PASSWORD 359
+#define NETWORK_DESC 360
+#define NETWORK_NAME 361
+#define NICK 362
+#define NO_OPER_FLOOD 363
+#define NO_TILDE 364
+#define NUMBER 365
+#define NUMBER_PER_CIDR 366
+#define NUMBER_PER_IP_GLOBAL 367
+#define NUMBER_PER_IP_LOCAL 368
+#define OPER_ONLY_UMODES 369
+#define OPER_UMODES 370
+#define OPERATOR 371
+#define OPERS_BYPASS_CALLERID 372
+#define PACE_WAIT 373
+#define PACE_WAIT_SIMPLE 374
+#define PASSWORD 375
+#define PATH 376
+#define PING_COOKIE 377
+#define PING_TIME 378
+#define PORT 379
+#define QSTRING 380
+#define RANDOM_IDLE 381
+#define REASON 382
+#define REDIRPORT 383
+#define REDIRSERV 384
+#define REHASH 385
+#define REMOTE 386
+#define REMOTEBAN 387
+#define RESV 388
+#define RESV_EXEMPT 389
+#define REUSEPORT 390
+#define RSA_PRIVATE_KEY_FILE 391
+#define SECONDS 392
+#define MINUTES 393
+#define HOURS 394
+#define DAYS 395
+#define WEEKS 396
+#define MONTHS 397
+#define YEARS 398
+#define SEND_PASSWORD 399
+#define SENDQ 400
+#define SERVERHIDE 401
+#define SERVERINFO 402
+#define SHORT_MOTD 403
+#define SPOOF 404
+#define SPOOF_NOTICE 405
+#define SQUIT 406
+#define SSL_CERTIFICATE_FILE 407
+#define SSL_CERTIFICATE_FINGERPRINT 408
+#define SSL_CONNECTION_REQUIRED 409
+#define SSL_DH_ELLIPTIC_CURVE 410
+#define SSL_DH_PARAM_FILE 411
+#define SSL_MESSAGE_DIGEST_ALGORITHM 412
+#define STATS_E_DISABLED 413
+#define STATS_I_OPER_ONLY 414
+#define STATS_K_OPER_ONLY 415
+#define STATS_M_OPER_ONLY 416
+#define STATS_O_OPER_ONLY 417
+#define STATS_P_OPER_ONLY 418
+#define STATS_U_OPER_ONLY 419
+#define T_ALL 420
+#define T_BOTS 421
+#define T_CALLERID 422
+#define T_CCONN 423
+#define T_COMMAND 424
+#define T_CLUSTER 425
+#define T_DEAF 426
+#define T_DEBUG 427
+#define T_DLINE 428
+#define T_EXTERNAL 429
+#define T_FARCONNECT 430
+#define T_FILE 431
+#define T_FULL 432
+#define T_GLOBOPS 433
+#define T_INVISIBLE 434
+#define T_IPV4 435
+#define T_IPV6 436
+#define T_LOCOPS 437
+#define T_LOG 438
+#define T_NCHANGE 439
+#define T_NONONREG 440
+#define T_OPME 441
+#define T_PREPEND 442
+#define T_PSEUDO 443
+#define T_RECVQ 444
+#define T_REJ 445
+#define T_RESTART 446
+#define T_SERVER 447
+#define T_SERVICE 448
+#define T_SERVNOTICE 449
+#define T_SET 450
+#define T_SHARED 451
+#define T_SIZE 452
+#define T_SKILL 453
+#define T_SOFTCALLERID 454
+#define T_SPY 455
+#define T_SSL 456
+#define T_SSL_CIPHER_LIST 457
+#define T_TARGET 458
+#define T_UMODES 459
+#define T_UNAUTH 460
+#define T_UNDLINE 461
+#define T_UNLIMITED 462
+#define T_UNRESV 463
+#define T_UNXLINE 464
+#define T_WALLOP 465
+#define T_WALLOPS 466
+#define T_WEBIRC 467
+#define TBOOL 468
+#define THROTTLE_COUNT 469
+#define THROTTLE_TIME 470
+#define TKLINE_EXPIRE_NOTICES 471
+#define TMASKED 472
+#define TS_MAX_DELTA 473
+#define TS_WARN_DELTA 474
+#define TWODOTS 475
+#define TYPE 476
+#define UNKLINE 477
+#define USE_LOGGING 478
+#define USER 479
+#define VHOST 480
+#define VHOST6 481
+#define WARN_NO_CONNECT_BLOCK 482
+#define WHOIS 483
+#define WHOWAS_HISTORY_LENGTH 484
+#define XLINE 485
+#define XLINE_EXEMPT 486
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -513,7 +517,7 @@ union YYSTYPE
   int number;
   char *string;
 
-#line 517 "conf_parser.h" /* yacc.c:1909  */
+#line 521 "conf_parser.h" /* yacc.c:1909  */
 };
 
 typedef union YYSTYPE YYSTYPE;
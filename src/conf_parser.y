@@ -233,6 +233,7 @@ reset_block_state(void)
 %token  MAX_TARGETS
 %token  MAX_TOPIC_LENGTH
 %token  MAX_WATCH
+%token  METRICS_SOCKET
 %token  MIN_IDLE
 %token  MIN_NONWILDCARD
 %token  MIN_NONWILDCARD_SIMPLE
@@ -272,6 +273,7 @@ reset_block_state(void)
 %token  REMOTEBAN
 %token  RESV
 %token  RESV_EXEMPT
+%token  REUSEPORT
 %token  RSA_PRIVATE_KEY_FILE
 %token  SECONDS MINUTES HOURS DAYS WEEKS MONTHS YEARS
 %token  SEND_PASSWORD
@@ -1357,11 +1359,11 @@ class_entry: CLASS
   class->min_idle = block_state.min_idle.value;
   class->max_idle = block_state.max_idle.value;
 
-  rebuild_cidr_list(class);
-
   class->cidr_bitlen_ipv4 = block_state.cidr_bitlen_ipv4.value;
   class->cidr_bitlen_ipv6 = block_state.cidr_bitlen_ipv6.value;
   class->number_per_cidr = block_state.number_per_cidr.value;
+
+  rebuild_cidr_list(class);
 };
 
 class_items:    class_items class_item | class_item;
@@ -1518,6 +1520,10 @@ listen_flags_item: T_SSL
 {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_SERVER;
+} | REUSEPORT
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= LISTENER_REUSEPORT;
 };
 
 listen_items:   listen_items listen_item | listen_item;
@@ -2422,6 +2428,7 @@ general_item:       general_away_count |
                     general_stats_e_disabled |
                     general_max_watch |
                     general_cycle_on_host_change |
+                    general_metrics_socket |
                     error;
 
 
@@ -2451,6 +2458,15 @@ general_cycle_on_host_change: CYCLE_ON_HOST_CHANGE '=' TBOOL ';'
     ConfigGeneral.cycle_on_host_change = yylval.number;
 };
 
+general_metrics_socket: METRICS_SOCKET '=' QSTRING ';'
+{
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigGeneral.metrics_socket);
+    ConfigGeneral.metrics_socket = xstrdup(yylval.string);
+  }
+};
+
 general_dline_min_cidr: DLINE_MIN_CIDR '=' NUMBER ';'
 {
   ConfigGeneral.dline_min_cidr = $3;
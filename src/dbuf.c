@@ -116,7 +116,8 @@ dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
   {
     struct dbuf_block *block = dbuf_length(queue) ? queue->blocks.tail->data : NULL;
 
-    if (block == NULL || sizeof(block->data) - block->size == 0)
+    /* Blocks that are shared with other queues must not be appended to */
+    if (block == NULL || block->refs > 1 || sizeof(block->data) - block->size == 0)
     {
       block = dbuf_alloc();
       dlinkAddTail(block, make_dlink_node(), &queue->blocks);
@@ -29,6 +29,8 @@
 #include "ircd.h"
 #include "event.h"
 #include "rng_mt.h"
+#include "misc.h"
+#include "loop_stats.h"
 
 
 static dlink_list event_list;
@@ -106,7 +108,9 @@ event_run(void)
 
     event_delete(ev);
 
+    const uintmax_t started = clock_usec();
     ev->handler(ev->data);
+    loop_stats_operation(ev->name, clock_usec() - started);
 
     if (ev->oneshot == 0)
       event_add(ev, ev->data);
@@ -27,10 +27,11 @@
 #include "stdinc.h"
 #include "fdlist.h"
 #include "irc_string.h"
-#include "s_bsd.h"   /* comm_setselect */
+#include "s_bsd.h"   /* comm_setselect, comm_settimeout, comm_setflush */
 #include "memory.h"
 #include "misc.h"
 #include "res.h"
+#include "worker_io.h"
 
 
 fde_t *fd_table;
@@ -126,11 +127,36 @@ fd_close(fde_t *F)
 
   delete_resolver_queries(F);
 
+  /*
+   * A worker thread may still be in the middle of a TLS handshake on this
+   * descriptor. It stays open and counted in number_fd until the worker is
+   * done with it; comm_tls_handshake_done() then calls us again.
+   */
+  if (F->handshake)
+  {
+    comm_tls_handshake_cancel(F);
+    comm_settimeout(F, 0, NULL, NULL);
+    comm_setflush(F, 0, NULL, NULL);
+    fd_note(F, "Closing (TLS handshake in progress)");
+    return F;
+  }
+
+  /* Likewise, a worker thread that owns the socket has to let go of it first */
+  if (F->io)
+  {
+    worker_io_detach(F);
+    comm_settimeout(F, 0, NULL, NULL);
+    comm_setflush(F, 0, NULL, NULL);
+    fd_note(F, "Closing (owned by worker thread)");
+    return F;
+  }
+
   if (tls_isusing(&F->ssl))
     tls_free(&F->ssl);
 
   /* Unlike squid, we're actually closing the FD here! -- adrian */
   close(F->fd);
+
   F->flags.open = 0;  /* Must set F->flags.open == 0 before fdlist_update_highest_fd() */
 
   fdlist_update_highest_fd(F->fd, 0);
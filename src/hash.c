@@ -29,6 +29,7 @@
 #include "conf.h"
 #include "channel.h"
 #include "channel_mode.h"
+#include "list_index.h"
 #include "client.h"
 #include "hash.h"
 #include "id.h"
@@ -39,6 +40,7 @@
 #include "send.h"
 #include "memory.h"
 #include "dbuf.h"
+#include "misc.h"
 
 
 static unsigned int hashf_xor_key;
@@ -426,6 +428,9 @@ hash_get_bucket(int type, unsigned int hashv)
  * - Dianora
  */
 
+/* Tasks whose sendq has drained far enough for them to resume */
+static dlink_list listing_ready_list;
+
 /* exceeding_sendq()
  *
  * inputs       - pointer to client to check
@@ -452,6 +457,9 @@ free_list_task(struct Client *source_p)
 
   dlinkDelete(&lt->node, &listing_client_list);
 
+  if (lt->ready.data)
+    dlinkDelete(&lt->ready, &listing_ready_list);
+
   DLINK_FOREACH_SAFE(node, node_next, lt->show_mask.head)
   {
     xfree(node->data);
@@ -466,6 +474,7 @@ free_list_task(struct Client *source_p)
     free_dlink_node(node);
   }
 
+  xfree(lt->snapshot);
   xfree(lt);
   source_p->connection->list_task = NULL;
 }
@@ -498,17 +507,19 @@ list_allow_channel(const char *name, const struct ListTask *lt)
  *
  * inputs       - client pointer to return result to
  *              - pointer to channel to list
- *              - pointer to ListTask structure
+ *              - ":server 322 nick " prefix of the reply
+ *              - length of the prefix
  * output	- none
- * side effects -
+ * side effects - queues the channel's cached RPL_LIST line
  */
 static void
-list_one_channel(struct Client *source_p, struct Channel *chptr)
+list_one_channel(struct Client *source_p, struct Channel *chptr,
+                 const char *prefix, size_t prefix_len)
 {
   const struct ListTask *const lt = source_p->connection->list_task;
-  char listbuf[MODEBUFLEN] = "";
-  char modebuf[MODEBUFLEN] = "";
-  char parabuf[MODEBUFLEN] = "";
+  char buf[IRCD_BUFSIZE];
+  const char *reply;
+  size_t len;
 
   if (SecretChannel(chptr) &&
       !(HasUMode(source_p, UMODE_ADMIN) || IsMember(source_p, chptr)))
@@ -530,16 +541,96 @@ list_one_channel(struct Client *source_p, struct Channel *chptr)
   if (!list_allow_channel(chptr->name, lt))
     return;
 
-  channel_modes(chptr, source_p, modebuf, parabuf);
+  reply = list_index_reply(chptr, &len);
+  len = IRCD_MIN(len, IRCD_BUFSIZE - 2 - prefix_len);
+
+  memcpy(buf, prefix, prefix_len);
+  memcpy(buf + prefix_len, reply, len);
+  len += prefix_len;
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  sendto_one_deferred(source_p, buf, len);
+}
+
+/*! \brief State of a walk over one of the channel indexes */
+struct ListWalk
+{
+  struct Client *client_p;  /**< Client requesting the list */
+  struct ListTask *lt;
+  const char *prefix;       /**< ":server 322 nick " */
+  size_t prefix_len;
+};
+
+/* list_walk_one()
+ *
+ * inputs       - pointer to channel picked from an index
+ *              - pointer to the walk state
+ * output       - 0, so the walk goes on
+ * side effects - lists the channel right away, or once the sendq is
+ *                full, appends its name to the task's snapshot. Names
+ *                rather than pointers are kept, as the channel may be
+ *                gone by the time the task gets to it.
+ */
+static int
+list_walk_one(struct Channel *chptr, void *data)
+{
+  const struct ListWalk *const walk = data;
+  struct ListTask *const lt = walk->lt;
+
+  if (lt->snapshot_len == 0 && !exceeding_sendq(walk->client_p))
+  {
+    list_one_channel(walk->client_p, chptr, walk->prefix, walk->prefix_len);
+    return 0;
+  }
+
+  if (lt->snapshot_len + chptr->name_len + 1 > lt->snapshot_size)
+  {
+    lt->snapshot_size = IRCD_MAX(lt->snapshot_size * 2, lt->snapshot_len + chptr->name_len + 1);
+    lt->snapshot = xrealloc(lt->snapshot, lt->snapshot_size);
+  }
+
+  memcpy(lt->snapshot + lt->snapshot_len, chptr->name, chptr->name_len + 1);
+  lt->snapshot_len += chptr->name_len + 1;
+  return 0;
+}
+
+/* list_walk_index()
+ *
+ * inputs       - pointer to the walk state
+ * output       - 1 if an index has been used, 0 if the hash table has
+ *                to be walked instead
+ * side effects - if the task filters on member count or creation time,
+ *                picks the candidates from whichever of the two indexes
+ *                yields fewer of them. Large channels are listed first
+ *                when filtering on member count, old ones first when
+ *                filtering on creation time. Looking the rest up by name
+ *                after the sendq has filled up costs more than walking
+ *                the hash table does, so an index is only used if it
+ *                narrows the candidates down by a good margin.
+ */
+static int
+list_walk_index(struct ListWalk *walk)
+{
+  const struct ListTask *const lt = walk->lt;
+  const unsigned int total = dlink_list_length(channel_get_list());
+  unsigned int by_users = UINT_MAX, by_created = UINT_MAX;
+
+  if (lt->users_min > 1 || lt->users_max != UINT_MAX)
+    by_users = list_index_count_users(lt->users_min, lt->users_max);
 
-  if (chptr->topic[0])
-    snprintf(listbuf, sizeof(listbuf), "[%s] ", modebuf);
+  if (lt->created_min || lt->created_max != UINT_MAX)
+    by_created = list_index_count_created(lt->created_min, lt->created_max);
+
+  if (IRCD_MIN(by_users, by_created) >= total / 4)
+    return 0;
+
+  if (by_users <= by_created)
+    list_index_find_users(lt->users_min, lt->users_max, list_walk_one, walk);
   else
-    snprintf(listbuf, sizeof(listbuf), "[%s]",  modebuf);
+    list_index_find_created(lt->created_min, lt->created_max, list_walk_one, walk);
 
-  sendto_one_numeric(source_p, &me, RPL_LIST, chptr->name,
-                     dlink_list_length(&chptr->members),
-                     listbuf, chptr->topic);
+  return 1;
 }
 
 /* safe_list_channels()
@@ -558,30 +649,110 @@ safe_list_channels(struct Client *source_p, int only_unmasked_channels)
 {
   struct ListTask *const lt = source_p->connection->list_task;
   struct Channel *chptr = NULL;
+  char prefix[IRCD_BUFSIZE];
+  struct ListWalk walk = { .client_p = source_p, .lt = lt, .prefix = prefix };
 
-  if (!only_unmasked_channels)
-  {
-    for (unsigned int i = lt->hash_index; i < HASHSIZE; ++i)
-    {
-      if (exceeding_sendq(source_p))
-      {
-        lt->hash_index = i;
-        return;  /* Still more to do */
-      }
+  if (IsDead(source_p))
+    return;  /* exit_client() is going to free the task */
 
-      for (chptr = channelTable[i]; chptr; chptr = chptr->hnextch)
-        list_one_channel(source_p, chptr);
-    }
-  }
-  else
+  walk.prefix_len = snprintf(prefix, sizeof(prefix), ":%s %03d %s ",
+                             me.name, RPL_LIST, source_p->name);
+
+  if (only_unmasked_channels)
   {
     dlink_node *node;
 
     DLINK_FOREACH(node, lt->show_mask.head)
       if ((chptr = hash_find_channel(node->data)))
-        list_one_channel(source_p, chptr);
+        list_one_channel(source_p, chptr, prefix, walk.prefix_len);
+  }
+  else
+  {
+    if (!lt->started)
+    {
+      lt->started = 1;
+      lt->indexed = list_walk_index(&walk);
+    }
+
+    if (lt->indexed)
+    {
+      while (lt->snapshot_pos < lt->snapshot_len)
+      {
+        const char *const name = lt->snapshot + lt->snapshot_pos;
+
+        if (exceeding_sendq(source_p))
+        {
+          lt->blocked = 1;  /* Resumed by safe_list_unblock() */
+          return;  /* Still more to do */
+        }
+
+        lt->snapshot_pos += strlen(name) + 1;
+
+        if ((chptr = hash_find_channel(name)))
+          list_one_channel(source_p, chptr, prefix, walk.prefix_len);
+      }
+    }
+    else
+    {
+      for (unsigned int i = lt->hash_index; i < HASHSIZE; ++i)
+      {
+        if (exceeding_sendq(source_p))
+        {
+          lt->hash_index = i;
+          lt->blocked = 1;  /* Resumed by safe_list_unblock() */
+          return;  /* Still more to do */
+        }
+
+        for (chptr = channelTable[i]; chptr; chptr = chptr->hnextch)
+          list_one_channel(source_p, chptr, prefix, walk.prefix_len);
+      }
+    }
   }
 
   free_list_task(source_p);
   sendto_one_numeric(source_p, &me, RPL_LISTEND);
 }
+
+/* safe_list_unblock()
+ *
+ * inputs       - pointer to a client that has just been written to
+ * output       - NONE
+ * side effects - queues its list task to be resumed by safe_list_run()
+ *                once the sendq has drained below the limit. This may
+ *                be called from deep within the send code, so the task
+ *                isn't run right away.
+ */
+void
+safe_list_unblock(struct Client *client_p)
+{
+  struct ListTask *const lt = client_p->connection->list_task;
+
+  if (lt == NULL || lt->blocked == 0 || exceeding_sendq(client_p))
+    return;
+
+  lt->blocked = 0;
+  dlinkAddTail(client_p, &lt->ready, &listing_ready_list);
+}
+
+/* safe_list_run()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - resumes the list tasks whose sendq has drained. Tasks
+ *                that are still waiting aren't looked at.
+ */
+void
+safe_list_run(void)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, listing_ready_list.head)
+  {
+    struct Client *const client_p = node->data;
+
+    dlinkDelete(node, &listing_ready_list);
+    node->data = NULL;
+
+    safe_list_channels(client_p, 0);
+  }
+}
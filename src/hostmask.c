@@ -605,13 +605,14 @@ find_dline_conf(const struct irc_ssaddr *addr, int aftype)
   return find_conf_by_address(NULL, addr, CONF_DLINE, aftype, NULL, NULL, 1);
 }
 
-/* void add_conf_by_address(int, struct MaskItem *aconf)
- * Input:
+/* void link_conf_by_address(int, struct MaskItem *, struct AddressRec *)
+ * Input: The type of record, the MaskItem, a zeroed address record to use.
  * Output: None
- * Side-effects: Adds this entry to the hash table.
+ * Side-effects: Adds this entry to the hash table. Used by the database
+ *               loader, which allocates address records in bulk.
  */
-struct AddressRec *
-add_conf_by_address(const unsigned int type, struct MaskItem *conf)
+void
+link_conf_by_address(const unsigned int type, struct MaskItem *conf, struct AddressRec *arec)
 {
   const char *const hostname = conf->host;
   const char *const username = conf->user;
@@ -620,7 +621,6 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
 
   assert(type && !EmptyString(hostname));
 
-  struct AddressRec *arec = xcalloc(sizeof(*arec));
   arec->masktype = parse_netmask(hostname, &arec->Mask.ipa.addr, &bits);
   arec->Mask.ipa.bits = bits;
   arec->username = username;
@@ -645,22 +645,31 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
       dlinkAdd(arec, &arec->node, &atable[get_mask_hash(hostname)]);
       break;
   }
+}
+
+/* void add_conf_by_address(int, struct MaskItem *aconf)
+ * Input:
+ * Output: None
+ * Side-effects: Adds this entry to the hash table.
+ */
+struct AddressRec *
+add_conf_by_address(const unsigned int type, struct MaskItem *conf)
+{
+  struct AddressRec *arec = xcalloc(sizeof(*arec));
 
+  link_conf_by_address(type, conf, arec);
   return arec;
 }
 
-/* void delete_one_address(const char*, struct MaskItem*)
- * Input: An address string, the associated MaskItem.
- * Output: None
- * Side effects: Deletes an address record. Frees the MaskItem if there
- *               is nothing referencing it, sets it as illegal otherwise.
+/* uint32_t get_address_hash(const char *)
+ * Input: An address string.
+ * Output: The atable bucket add_conf_by_address() files that address in.
+ * Side effects: None
  */
-void
-delete_one_address_conf(const char *address, struct MaskItem *conf)
+static uint32_t
+get_address_hash(const char *address)
 {
   int bits = 0;
-  uint32_t hv = 0;
-  dlink_node *node;
   struct irc_ssaddr addr;
 
   switch (parse_netmask(address, &addr, &bits))
@@ -668,17 +677,27 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
     case HM_IPV4:
       /* We have to do this, since we do not re-hash for every bit -A1kmm. */
       bits -= bits % 8;
-      hv = hash_ipv4(&addr, bits);
-      break;
+      return hash_ipv4(&addr, bits);
     case HM_IPV6:
       /* We have to do this, since we do not re-hash for every bit -A1kmm. */
       bits -= bits % 16;
-      hv = hash_ipv6(&addr, bits);
-      break;
+      return hash_ipv6(&addr, bits);
     default: /* HM_HOST */
-      hv = get_mask_hash(address);
-      break;
+      return get_mask_hash(address);
   }
+}
+
+/* void delete_one_address(const char*, struct MaskItem*)
+ * Input: An address string, the associated MaskItem.
+ * Output: None
+ * Side effects: Deletes an address record. Frees the MaskItem if there
+ *               is nothing referencing it, sets it as illegal otherwise.
+ */
+void
+delete_one_address_conf(const char *address, struct MaskItem *conf)
+{
+  const uint32_t hv = get_address_hash(address);
+  dlink_node *node;
 
   DLINK_FOREACH(node, atable[hv].head)
   {
@@ -688,15 +707,49 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
     {
       dlinkDelete(&arec->node, &atable[hv]);
 
+      /* Records loaded from a database snapshot live in its arena */
+      if (!IsConfArena(conf))
+        xfree(arec);
+
       if (conf->ref_count == 0)
         conf_free(conf);
-
-      xfree(arec);
       return;
     }
   }
 }
 
+/* struct MaskItem *find_database_address_conf(const char *, const char *, enum maskitem_type)
+ * Input: The address and username (or NULL) a record has been added with,
+ *        the type of the record.
+ * Output: The database record added for exactly that user and address,
+ *         or NULL if there is none.
+ * Side effects: None
+ */
+struct MaskItem *
+find_database_address_conf(const char *address, const char *username,
+                           enum maskitem_type type)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, atable[get_address_hash(address)].head)
+  {
+    struct AddressRec *arec = node->data;
+
+    if (arec->type != type || !IsConfDatabase(arec->conf))
+      continue;
+
+    if (irccmp(arec->conf->host, address))
+      continue;
+
+    if (type == CONF_KLINE && irccmp(arec->conf->user, username))
+      continue;
+
+    return arec->conf;
+  }
+
+  return NULL;
+}
+
 /* void clear_out_address_conf(void)
  * Input: None
  * Output: None
@@ -766,8 +819,9 @@ hostmask_expire_temporary(void)
     DLINK_FOREACH_SAFE(node, node_next, atable[i].head)
     {
       struct AddressRec *arec = node->data;
+      struct MaskItem *conf = arec->conf;
 
-      if (arec->conf->until == 0 || arec->conf->until > CurrentTime)
+      if (conf->until == 0 || conf->until > CurrentTime)
         continue;
 
       switch (arec->type)
@@ -777,8 +831,11 @@ hostmask_expire_temporary(void)
           hostmask_send_expiration(arec);
 
           dlinkDelete(&arec->node, &atable[i]);
-          conf_free(arec->conf);
-          xfree(arec);
+
+          if (!IsConfArena(conf))
+            xfree(arec);
+
+          conf_free(conf);
           break;
         default: break;
       }
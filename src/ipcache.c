@@ -31,166 +31,418 @@
 #include "memory.h"
 #include "conf.h"
 #include "ircd.h"
+#include "rng_mt.h"
 
+#define IPCACHE_NONE UINT32_MAX
+enum { IPCACHE_EXPIRE_BATCH = 1024 };  /**< Entries expired per event run */
 
-static dlink_list ip_hash_table[IP_HASH_SIZE];
+/*
+ * Linear probing table with backward shift deletion. Addresses that
+ * are not in use by any client ("idle" entries) are only kept around
+ * for the connection throttle and are also linked on an LRU list,
+ * oldest first, which is what expiry and eviction work on.
+ */
+static struct ip_entry *ipcache_table;
+static uint32_t ipcache_size;   /* Number of slots, a power of two */
+static uint32_t ipcache_count;  /* Number of used slots */
+static uint32_t ipcache_idle;   /* Number of entries on the LRU list */
+static uint32_t lru_head = IPCACHE_NONE;
+static uint32_t lru_tail = IPCACHE_NONE;
+static uint32_t ipcache_seed;
 
 
-/* ipcache_hash_address()
+/* ipcache_pack_address()
  *
- * input        - pointer to an irc_inaddr
- * output       - integer value used as index into hash table
- * side effects - hopefully, none
+ * input        - pointer to an irc_ssaddr
+ *              - buffer of 16 bytes
+ * output       - NONE
+ * side effects - stores the address as IPv6, IPv4 addresses v4-mapped
  */
-static uint32_t
-ipcache_hash_address(const struct irc_ssaddr *addr)
+static void
+ipcache_pack_address(const struct irc_ssaddr *addr, unsigned char *key)
 {
   if (addr->ss.ss_family == AF_INET)
   {
     const struct sockaddr_in *const v4 = (const struct sockaddr_in *)addr;
-    uint32_t hash = 0, ip = ntohl(v4->sin_addr.s_addr);
 
-    hash = ((ip >> 12) + ip) & (IP_HASH_SIZE - 1);
-    return hash;
+    memset(key, 0, 10);
+    key[10] = key[11] = 0xff;
+    memcpy(key + 12, &v4->sin_addr, 4);
   }
   else
   {
     const struct sockaddr_in6 *const v6 = (const struct sockaddr_in6 *)addr;
-    uint32_t hash = 0, *const ip = (uint32_t *)&v6->sin6_addr.s6_addr;
+    memcpy(key, &v6->sin6_addr, 16);
+  }
+}
+
+/* ipcache_hash_address()
+ *
+ * input        - packed address
+ * output       - hash value; the table index is taken from the low bits
+ * side effects - hopefully, none
+ *
+ * The hash is seeded at startup so nobody can pick a range of addresses
+ * that all end up in the same probe sequence.
+ */
+static uint32_t
+ipcache_hash_address(const unsigned char *key)
+{
+  uint32_t hash = ipcache_seed;
+
+  for (unsigned int i = 0; i < 16; i += 4)
+  {
+    uint32_t word;
+
+    memcpy(&word, key + i, sizeof(word));
+    hash = (hash ^ word) * 0x9e3779b1;
+    hash ^= hash >> 15;
+  }
+
+  return hash;
+}
+
+static void
+lru_unlink(uint32_t i)
+{
+  struct ip_entry *const iptr = &ipcache_table[i];
+
+  if (iptr->lru_prev == IPCACHE_NONE)
+    lru_head = iptr->lru_next;
+  else
+    ipcache_table[iptr->lru_prev].lru_next = iptr->lru_next;
+
+  if (iptr->lru_next == IPCACHE_NONE)
+    lru_tail = iptr->lru_prev;
+  else
+    ipcache_table[iptr->lru_next].lru_prev = iptr->lru_prev;
+
+  --ipcache_idle;
+}
+
+static void
+lru_append(uint32_t i)
+{
+  struct ip_entry *const iptr = &ipcache_table[i];
+
+  iptr->lru_prev = lru_tail;
+  iptr->lru_next = IPCACHE_NONE;
+
+  if (lru_tail == IPCACHE_NONE)
+    lru_head = i;
+  else
+    ipcache_table[lru_tail].lru_next = i;
+
+  lru_tail = i;
+  ++ipcache_idle;
+}
+
+static int
+ipcache_is_idle(const struct ip_entry *iptr)
+{
+  return iptr->count_local == 0 && iptr->count_remote == 0;
+}
+
+/* ipcache_move_entry()
+ *
+ * Moves an entry to another slot and fixes up the LRU links that
+ * point to it.
+ */
+static void
+ipcache_move_entry(uint32_t from, uint32_t to)
+{
+  struct ip_entry *const iptr = &ipcache_table[to];
+
+  memcpy(iptr, &ipcache_table[from], sizeof(*iptr));
+  ipcache_table[from].used = 0;
+
+  if (!ipcache_is_idle(iptr))
+    return;
+
+  if (iptr->lru_prev == IPCACHE_NONE)
+    lru_head = to;
+  else
+    ipcache_table[iptr->lru_prev].lru_next = to;
+
+  if (iptr->lru_next == IPCACHE_NONE)
+    lru_tail = to;
+  else
+    ipcache_table[iptr->lru_next].lru_prev = to;
+}
+
+/* ipcache_delete()
+ *
+ * Frees a slot and shifts back any entry of the same probe sequence
+ * that follows it, so lookups never need tombstones.
+ */
+static void
+ipcache_delete(uint32_t i)
+{
+  const uint32_t mask = ipcache_size - 1;
+
+  if (ipcache_is_idle(&ipcache_table[i]))
+    lru_unlink(i);
+
+  ipcache_table[i].used = 0;
+  --ipcache_count;
+
+  for (uint32_t j = (i + 1) & mask; ipcache_table[j].used; j = (j + 1) & mask)
+  {
+    const uint32_t home = ipcache_table[j].hash & mask;
+
+    /* Can the entry at j live at i without breaking its probe sequence? */
+    if (((j - home) & mask) >= ((j - i) & mask))
+    {
+      ipcache_move_entry(j, i);
+      i = j;
+    }
+  }
+}
+
+static uint32_t
+ipcache_find_slot(const unsigned char *key, uint32_t hash)
+{
+  const uint32_t mask = ipcache_size - 1;
+  uint32_t i = hash & mask;
+
+  while (ipcache_table[i].used)
+  {
+    if (ipcache_table[i].hash == hash && memcmp(ipcache_table[i].addr, key, 16) == 0)
+      return i;
+    i = (i + 1) & mask;
+  }
+
+  return i;
+}
+
+/* ipcache_resize()
+ *
+ * Rehashes everything into a table of the given size. Idle entries are
+ * re-inserted in LRU order so that order is preserved.
+ */
+static void
+ipcache_resize(uint32_t size)
+{
+  struct ip_entry *const old = ipcache_table;
+  const uint32_t old_size = ipcache_size;
+  uint32_t i = lru_head;
+
+  ipcache_table = xcalloc(size * sizeof(*ipcache_table));
+  ipcache_size = size;
+  lru_head = lru_tail = IPCACHE_NONE;
+  ipcache_idle = 0;
+
+  for (uint32_t n = 0; n < old_size; ++n)
+  {
+    if (old[n].used && !ipcache_is_idle(&old[n]))
+      memcpy(&ipcache_table[ipcache_find_slot(old[n].addr, old[n].hash)], &old[n], sizeof(*old));
+  }
+
+  while (i != IPCACHE_NONE)
+  {
+    const uint32_t slot = ipcache_find_slot(old[i].addr, old[i].hash);
 
-    hash  = ip[0] ^ ip[3];
-    hash ^= hash >> 16;
-    hash ^= hash >> 8;
-    hash  = hash & (IP_HASH_SIZE - 1);
-    return hash;
+    memcpy(&ipcache_table[slot], &old[i], sizeof(*old));
+    lru_append(slot);
+    i = old[i].lru_next;
   }
+
+  xfree(old);
+}
+
+/* ipcache_expired()
+ *
+ * An idle entry can go once its throttle bucket has been refilled.
+ */
+static int
+ipcache_expired(const struct ip_entry *iptr)
+{
+  return (CurrentTime - iptr->throttle_time) >= ConfigGeneral.throttle_time;
+}
+
+/* ipcache_expire()
+ *
+ * input        - maximum number of entries to look at
+ * output       - NONE
+ * side effects - frees expired idle entries from the old end of the LRU
+ */
+static void
+ipcache_expire(unsigned int budget)
+{
+  while (budget-- && lru_head != IPCACHE_NONE && ipcache_expired(&ipcache_table[lru_head]))
+    ipcache_delete(lru_head);
 }
 
 /* ipcache_find_or_add_address()
  *
  * inputs       - pointer to struct irc_ssaddr
- * output       - pointer to a struct ip_entry
+ * output       - slot of the entry
  * side effects -
  *
- * If the ip # was not found, a new struct ip_entry is created, and the ip
- * count set to 0.
+ * If the ip # was not found, a new entry is created, and the ip
+ * count set to 0. Once IPCACHE_ENTRIES_MAX is reached, the least
+ * recently used idle entry makes room for it.
  */
-struct ip_entry *
+static uint32_t
 ipcache_find_or_add_address(const struct irc_ssaddr *addr)
 {
-  dlink_node *node;
-  const uint32_t hash_index = ipcache_hash_address(addr);
-  const struct sockaddr_in *v4 = (const struct sockaddr_in *)addr, *ptr_v4;
-  const struct sockaddr_in6 *v6 = (const struct sockaddr_in6 *)addr, *ptr_v6;
+  unsigned char key[16];
+
+  ipcache_pack_address(addr, key);
+
+  const uint32_t hash = ipcache_hash_address(key);
+  uint32_t i = ipcache_find_slot(key, hash);
+
+  if (ipcache_table[i].used)
+    return i;
+
+  /* Each insert pays for a little expiry, which bounds the idle list during floods */
+  ipcache_expire(2);
+
+  if (ipcache_idle >= IPCACHE_ENTRIES_MAX)
+    ipcache_delete(lru_head);
+
+  if ((ipcache_count + 1) * 4 > ipcache_size * 3)
+    ipcache_resize(ipcache_size * 2);
+
+  i = ipcache_find_slot(key, hash);
+
+  struct ip_entry *const iptr = &ipcache_table[i];
+  memset(iptr, 0, sizeof(*iptr));
+  memcpy(iptr->addr, key, sizeof(key));
+  iptr->hash = hash;
+  iptr->throttle_time = CurrentTime;
+  iptr->used = 1;
+
+  ++ipcache_count;
+  lru_append(i);
+
+  return i;
+}
+
+/* ipcache_throttle()
+ *
+ * inputs       - pointer to struct irc_ssaddr
+ * output       - 1 if this address is connecting too fast, 0 otherwise
+ * side effects - takes a token out of the address' bucket
+ *
+ * Every address has a bucket of throttle_count tokens that refills at
+ * throttle_count per throttle_time seconds. A connection needs a token.
+ */
+int
+ipcache_throttle(const struct irc_ssaddr *addr)
+{
+  const uint32_t i = ipcache_find_or_add_address(addr);
+  struct ip_entry *const iptr = &ipcache_table[i];
+  const uintmax_t period = ConfigGeneral.throttle_time;
+  const uintmax_t tokens = ConfigGeneral.throttle_count ? ConfigGeneral.throttle_count : 1;
 
-  DLINK_FOREACH(node, ip_hash_table[hash_index].head)
+  if (ipcache_is_idle(iptr))
   {
-    struct ip_entry *iptr = node->data;
+    lru_unlink(i);
+    lru_append(i);
+  }
 
-    if (iptr->ip.ss.ss_family != addr->ss.ss_family)
-      continue;
+  if (period == 0)
+    return 0;
 
-    if (addr->ss.ss_family == AF_INET6)
-    {
-      ptr_v6 = (const struct sockaddr_in6 *)&iptr->ip;
-      if (!memcmp(&v6->sin6_addr, &ptr_v6->sin6_addr, sizeof(struct in6_addr)))
-        return iptr;  /* Found entry already in hash, return it. */
-    }
-    else
-    {
-      ptr_v4 = (const struct sockaddr_in *)&iptr->ip;
-      if (!memcmp(&v4->sin_addr, &ptr_v4->sin_addr, sizeof(struct in_addr)))
-        return iptr;  /* Found entry already in hash, return it. */
-    }
+  const uintmax_t refill = (CurrentTime - iptr->throttle_time) * tokens / period;
+
+  if (refill >= iptr->throttle_count)
+  {
+    iptr->throttle_count = 0;
+    iptr->throttle_time = CurrentTime;
   }
+  else if (refill)
+  {
+    iptr->throttle_count -= refill;
+    iptr->throttle_time += refill * period / tokens;
+  }
+
+  if (iptr->throttle_count >= tokens)
+    return 1;
+
+  ++iptr->throttle_count;
+  return 0;
+}
 
-  struct ip_entry *iptr = xcalloc(sizeof(*iptr));
-  memcpy(&iptr->ip, addr, sizeof(struct irc_ssaddr));
+/* ipcache_add_address()
+ *
+ * inputs       - pointer to struct irc_ssaddr
+ *              - whether the client is local
+ * output       - pointer to the entry, valid until the next ipcache call
+ * side effects - counts one more client from this address
+ */
+struct ip_entry *
+ipcache_add_address(const struct irc_ssaddr *addr, int local)
+{
+  const uint32_t i = ipcache_find_or_add_address(addr);
+  struct ip_entry *const iptr = &ipcache_table[i];
 
-  dlinkAdd(iptr, &iptr->node, &ip_hash_table[hash_index]);
+  if (ipcache_is_idle(iptr))
+    lru_unlink(i);
+
+  if (local)
+    ++iptr->count_local;
+  else
+    ++iptr->count_remote;
 
   return iptr;
 }
 
-/* ipcache_remove_addres()
+/* ipcache_remove_address()
  *
- * inputs        - unsigned long IP address value
+ * inputs        - pointer to struct irc_ssaddr
+ *               - whether the client is local
  * output        - NONE
  * side effects  - The ip address given, is looked up in ip hash table
  *                 and number of ip#'s for that ip decremented.
- *                 If ip # count reaches 0 and has expired,
- *                 the struct ip_entry is returned to the ip_entry_heap
+ *                 If ip # count reaches 0 and has expired, the entry
+ *                 is freed; otherwise it goes to the end of the LRU.
  */
 void
 ipcache_remove_address(const struct irc_ssaddr *addr, int local)
 {
-  dlink_node *node;
-  const uint32_t hash_index = ipcache_hash_address(addr);
-  const struct sockaddr_in *v4 = (const struct sockaddr_in *)addr, *ptr_v4;
-  const struct sockaddr_in6 *v6 = (const struct sockaddr_in6 *)addr, *ptr_v6;
+  unsigned char key[16];
 
-  DLINK_FOREACH(node, ip_hash_table[hash_index].head)
-  {
-    struct ip_entry *iptr = node->data;
+  ipcache_pack_address(addr, key);
 
-    if (iptr->ip.ss.ss_family != addr->ss.ss_family)
-      continue;
+  const uint32_t i = ipcache_find_slot(key, ipcache_hash_address(key));
+  struct ip_entry *const iptr = &ipcache_table[i];
 
-    if (addr->ss.ss_family == AF_INET6)
-    {
-      ptr_v6 = (const struct sockaddr_in6 *)&iptr->ip;
-      if (memcmp(&v6->sin6_addr, &ptr_v6->sin6_addr, sizeof(struct in6_addr)))
-        continue;
-    }
-    else
-    {
-      ptr_v4 = (const struct sockaddr_in *)&iptr->ip;
-      if (memcmp(&v4->sin_addr, &ptr_v4->sin_addr, sizeof(struct in_addr)))
-        continue;
-    }
+  if (!iptr->used)
+    return;
 
-    assert(iptr->count_local > 0 || iptr->count_remote > 0);
+  assert(iptr->count_local > 0 || iptr->count_remote > 0);
 
-    if (local)
-      --iptr->count_local;
-    else
-      --iptr->count_remote;
+  if (local)
+    --iptr->count_local;
+  else
+    --iptr->count_remote;
 
-    if (iptr->count_local == 0 && iptr->count_remote == 0 &&
-        (CurrentTime - iptr->last_attempt) >= ConfigGeneral.throttle_time)
-    {
-      dlinkDelete(&iptr->node, &ip_hash_table[hash_index]);
-      xfree(iptr);
-      return;
-    }
+  if (!ipcache_is_idle(iptr))
+    return;
+
+  if (ipcache_expired(iptr))
+  {
+    /* Not on the LRU yet; make ipcache_delete() find it there */
+    lru_append(i);
+    ipcache_delete(i);
   }
+  else
+    lru_append(i);
 }
 
 /* ipcache_remove_expired_entries()
  *
  * input        - NONE
  * output       - NONE
- * side effects - free up all ip entries with no connections
+ * side effects - free up idle ip entries whose throttle state expired
  */
 static void
 ipcache_remove_expired_entries(void *unused)
 {
-  dlink_node *node, *node_next;
-
-  for (unsigned int i = 0; i < IP_HASH_SIZE; ++i)
-  {
-    DLINK_FOREACH_SAFE(node, node_next, ip_hash_table[i].head)
-    {
-      struct ip_entry *iptr = node->data;
-
-      if (iptr->count_local == 0 && iptr->count_remote == 0 &&
-          (CurrentTime - iptr->last_attempt) >= ConfigGeneral.throttle_time)
-      {
-        dlinkDelete(&iptr->node, &ip_hash_table[i]);
-        xfree(iptr);
-      }
-    }
-  }
+  ipcache_expire(IPCACHE_EXPIRE_BATCH);
 }
 
 /* ipcache_get_stats()
@@ -206,9 +458,8 @@ ipcache_remove_expired_entries(void *unused)
 void
 ipcache_get_stats(unsigned int *const number_ips_stored, size_t *const mem_ips_stored)
 {
-  for (unsigned int i = 0; i < IP_HASH_SIZE; ++i)
-    *number_ips_stored += dlink_list_length(&ip_hash_table[i]);
-  *mem_ips_stored = *number_ips_stored * sizeof(struct ip_entry);
+  *number_ips_stored = ipcache_count;
+  *mem_ips_stored = ipcache_size * sizeof(struct ip_entry);
 }
 
 void
@@ -218,8 +469,12 @@ ipcache_init(void)
   {
     .name = "ipcache_remove_expired_entries",
     .handler = ipcache_remove_expired_entries,
-    .when = 123
+    .when = 5
   };
 
+  ipcache_seed = genrand_int32();
+  ipcache_table = xcalloc(IPCACHE_SIZE_MIN * sizeof(*ipcache_table));
+  ipcache_size = IPCACHE_SIZE_MIN;
+
   event_add(&event_expire_ipcache, NULL);
 }
@@ -57,6 +57,8 @@
 #include "conf_class.h"
 #include "ipcache.h"
 #include "isupport.h"
+#include "worker.h"
+#include "loop_stats.h"
 
 
 struct SetOptions GlobalSetOptions;  /* /quote set variables */
@@ -94,6 +96,8 @@ static struct lgetopt myopts[] =
    STRING, "File to use for process ID" },
   { "foreground", &server_state.foreground,
    YESNO, "Run in foreground (don't detach)" },
+  { "workers",    &server_state.workers,
+   INTEGER, "Number of worker threads" },
   { "version",    &printVersion,
    YESNO, "Print version and exit" },
   { "help", NULL, USAGE, "Print this text" },
@@ -121,13 +125,20 @@ static struct event event_comm_checktimeouts =
   .when = 1
 };
 
-static struct event event_save_all_databases =
+static struct event event_compact_databases =
 {
-  .name = "save_all_databases",
-  .handler = save_all_databases,
+  .name = "compact_databases",
+  .handler = compact_databases,
   .when = DATABASE_UPDATE_TIMEOUT
 };
 
+static struct event event_journal_sync =
+{
+  .name = "journal_sync",
+  .handler = journal_sync,
+  .when = 1
+};
+
 struct event event_write_links_file =
 {
   .name = "write_links_file",
@@ -168,19 +179,26 @@ io_loop(void)
 {
   while (1)
   {
-    if (listing_client_list.head)
-    {
-      dlink_node *node = NULL, *node_next = NULL;
-      DLINK_FOREACH_SAFE(node, node_next, listing_client_list.head)
-        safe_list_channels(node->data, 0);
-    }
+    /* Resume LIST replies of clients whose sendq has drained */
+    safe_list_run();
+    loop_stats_phase(LOOP_PHASE_LIST);
 
     /* Run pending events */
     event_run();
+    loop_stats_phase(LOOP_PHASE_EVENTS);
+
+    /* Flush whatever has been queued with a deferred write before blocking */
+    send_queued_deferred();
+    loop_stats_phase(LOOP_PHASE_FLUSH);
+
+    comm_select();  /* Ends LOOP_PHASE_WAIT itself */
+    loop_stats_phase(LOOP_PHASE_IO);
 
-    comm_select();
     exit_aborted_clients();
+    loop_stats_phase(LOOP_PHASE_EXIT);
+
     free_exited_clients();
+    loop_stats_phase(LOOP_PHASE_FREE);
 
     /* Check to see whether we have to rehash the configuration. */
     if (dorehash)
@@ -196,6 +214,9 @@ io_loop(void)
                            "Got signal SIGUSR1, reloading motd file(s)");
       doremotd = 0;
     }
+
+    loop_stats_phase(LOOP_PHASE_SIGNAL);
+    loop_stats_lap();
   }
 }
 
@@ -217,6 +238,8 @@ initialize_global_set_options(void)
   GlobalSetOptions.joinfloodcount = ConfigChannel.default_join_flood_count;
   GlobalSetOptions.joinfloodtime = ConfigChannel.default_join_flood_time;
   GlobalSetOptions.ident_timeout = IDENT_TIMEOUT;
+  GlobalSetOptions.tls_handshake_queue = TLS_HANDSHAKE_QUEUE_DEFAULT;
+  GlobalSetOptions.cmdtiming = 1;
 }
 
 /* write_pidfile()
@@ -397,6 +420,8 @@ main(int argc, char *argv[])
   log_set_file(LOG_TYPE_IRCD, 0, logFileName);
 
   comm_select_init();  /* This needs to be setup early ! -- adrian */
+  worker_init(server_state.workers);  /* Threads don't survive fork(), so start them here */
+  log_init();
   tls_init();
 
   /* Check if there is pidfile and daemon already running */
@@ -479,7 +504,9 @@ main(int argc, char *argv[])
   /* Setup the timeout check. I'll shift it later :)  -- adrian */
   event_add(&event_comm_checktimeouts, NULL);
 
-  event_addish(&event_save_all_databases, NULL);
+  event_addish(&event_compact_databases, NULL);
+  event_add(&event_journal_sync, NULL);
+  loop_stats_init();
 
   if (ConfigServerHide.flatten_links_delay && event_write_links_file.active == 0)
   {
@@ -0,0 +1,558 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file list_index.c
+ * \brief Channel indexes and cached replies used by LIST.
+ * \version $Id$
+ *
+ *  - Channels are grouped by member count, and the groups are kept in
+ *    ascending order. A join or part only ever moves a channel to the
+ *    neighbouring group, and ">N" is answered by walking the groups from
+ *    the largest one down.
+ *  - Creation times are kept in a sorted table that is searched with a
+ *    binary search. New channels are collected in a pending list, and
+ *    merged into the table the next time it is searched; removals only
+ *    leave a hole behind.
+ *  - The parameters of RPL_LIST don't depend on who is asking, so they
+ *    are formatted once and reused until the topic, member count or
+ *    modes change.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "channel.h"
+#include "channel_mode.h"
+#include "memory.h"
+#include "misc.h"
+#include "list_index.h"
+
+
+struct ListCountGroup
+{
+  dlink_node node;      /**< Entry in count_groups */
+  dlink_list channels;  /**< Channels with this many members */
+  unsigned int users;
+};
+
+struct ListCreatedSlot
+{
+  uintmax_t created;
+  struct Channel *chptr;  /**< NULL if the channel has gone since the last merge */
+};
+
+static dlink_list count_groups;  /* Ordered by ascending member count */
+
+static struct ListCreatedSlot *created_table;  /* Ordered by ascending creation time */
+static unsigned int created_count;  /* Slots in use, holes included */
+static unsigned int created_holes;
+static dlink_list created_pending;
+
+
+/* list_group_new()
+ *
+ * inputs       - member count of the new group
+ *              - group node the new group goes in front of, or NULL
+ *                to append it
+ * output       - pointer to the new group
+ * side effects -
+ */
+static struct ListCountGroup *
+list_group_new(unsigned int users, dlink_node *before)
+{
+  struct ListCountGroup *group = xcalloc(sizeof(*group));
+
+  group->users = users;
+
+  if (before)
+    dlinkAddBefore(before, group, &group->node, &count_groups);
+  else
+    dlinkAddTail(group, &group->node, &count_groups);
+
+  return group;
+}
+
+/* list_group_leave()
+ *
+ * inputs       - pointer to channel
+ * output       - NONE
+ * side effects - takes the channel out of its group, and frees the
+ *                group if it has become empty
+ */
+static void
+list_group_leave(struct Channel *chptr)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+  struct ListCountGroup *const group = entry->group;
+
+  dlinkDelete(&entry->group_node, &group->channels);
+  entry->group = NULL;
+
+  if (group->channels.head == NULL)
+  {
+    dlinkDelete(&group->node, &count_groups);
+    xfree(group);
+  }
+}
+
+/* list_group_set()
+ *
+ * inputs       - pointer to channel
+ *              - its current member count
+ * output       - NONE
+ * side effects - moves the channel into the group for that member count.
+ *                The search starts at the channel's old group, which is
+ *                a neighbour unless the channel is new.
+ */
+static void
+list_group_set(struct Channel *chptr, unsigned int users)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+  struct ListCountGroup *const old = entry->group;
+  struct ListCountGroup *group = NULL;
+  dlink_node *node;
+
+  if (old && old->users == users)
+    return;
+
+  if (old && users < old->users)
+  {
+    for (node = old->node.prev; node; node = node->prev)
+      if (((struct ListCountGroup *)node->data)->users <= users)
+        break;
+
+    if (node && ((struct ListCountGroup *)node->data)->users == users)
+      group = node->data;
+    else
+      group = list_group_new(users, node ? node->next : count_groups.head);
+  }
+  else
+  {
+    for (node = old ? old->node.next : count_groups.head; node; node = node->next)
+      if (((struct ListCountGroup *)node->data)->users >= users)
+        break;
+
+    if (node && ((struct ListCountGroup *)node->data)->users == users)
+      group = node->data;
+    else
+      group = list_group_new(users, node);
+  }
+
+  if (old)
+    list_group_leave(chptr);
+
+  dlinkAdd(chptr, &entry->group_node, &group->channels);
+  entry->group = group;
+}
+
+/* list_created_lower()
+ *
+ * inputs       - creation time
+ * output       - index of the first slot that isn't older than the
+ *                given time
+ * side effects -
+ */
+static unsigned int
+list_created_lower(uintmax_t created)
+{
+  unsigned int lo = 0, hi = created_count;
+
+  while (lo < hi)
+  {
+    const unsigned int mid = lo + (hi - lo) / 2;
+
+    if (created_table[mid].created < created)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+/* list_created_upper()
+ *
+ * inputs       - creation time
+ * output       - index of the first slot that is newer than the given time
+ * side effects -
+ */
+static unsigned int
+list_created_upper(uintmax_t created)
+{
+  unsigned int lo = 0, hi = created_count;
+
+  while (lo < hi)
+  {
+    const unsigned int mid = lo + (hi - lo) / 2;
+
+    if (created_table[mid].created <= created)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+static void
+list_created_remove(struct Channel *chptr)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+
+  if (entry->pending.data)
+  {
+    dlinkDelete(&entry->pending, &created_pending);
+    entry->pending.data = NULL;
+    return;
+  }
+
+  for (unsigned int i = list_created_lower(entry->created);
+       i < created_count && created_table[i].created == entry->created; ++i)
+  {
+    if (created_table[i].chptr == chptr)
+    {
+      created_table[i].chptr = NULL;
+      ++created_holes;
+      return;
+    }
+  }
+
+  assert(0);
+}
+
+static int
+list_created_compare(const void *a_, const void *b_)
+{
+  const struct ListCreatedSlot *const a = a_;
+  const struct ListCreatedSlot *const b = b_;
+
+  if (a->created < b->created)
+    return -1;
+  return a->created > b->created;
+}
+
+/* list_created_merge()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - sorts the pending channels and merges them into the
+ *                creation time table, dropping the holes on the way.
+ *                Only slots are copied, so this stays cheap next to
+ *                looking at every channel.
+ */
+static void
+list_created_merge(void)
+{
+  const unsigned int npending = dlink_list_length(&created_pending);
+  struct ListCreatedSlot *pending = NULL, *table = NULL;
+  unsigned int size, i = 0, j = 0, k = 0;
+  dlink_node *node, *node_next;
+
+  if (npending == 0 && created_holes <= created_count / 2)
+    return;
+
+  if (npending)
+  {
+    pending = xcalloc(sizeof(*pending) * npending);
+
+    DLINK_FOREACH_SAFE(node, node_next, created_pending.head)
+    {
+      struct Channel *chptr = node->data;
+
+      pending[k].created = chptr->list_index.created;
+      pending[k++].chptr = chptr;
+
+      dlinkDelete(node, &created_pending);
+      node->data = NULL;
+    }
+
+    qsort(pending, npending, sizeof(*pending), list_created_compare);
+  }
+
+  size = created_count - created_holes + npending;
+  if (size)
+    table = xcalloc(sizeof(*table) * size);
+
+  k = 0;
+  while (i < created_count || j < npending)
+  {
+    if (i < created_count && created_table[i].chptr == NULL)
+      ++i;
+    else if (j == npending ||
+             (i < created_count && created_table[i].created <= pending[j].created))
+      table[k++] = created_table[i++];
+    else
+      table[k++] = pending[j++];
+  }
+
+  assert(k == size);
+
+  xfree(pending);
+  xfree(created_table);
+
+  created_table = table;
+  created_count = size;
+  created_holes = 0;
+}
+
+/*! \brief Adds a new channel to the indexes
+ * \param chptr Pointer to channel
+ */
+void
+list_index_add(struct Channel *chptr)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+
+  list_group_set(chptr, dlink_list_length(&chptr->members));
+
+  entry->created = chptr->creationtime;
+  dlinkAdd(chptr, &entry->pending, &created_pending);
+}
+
+/*! \brief Removes a channel that is about to be freed from the indexes
+ * \param chptr Pointer to channel
+ */
+void
+list_index_del(struct Channel *chptr)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+
+  list_group_leave(chptr);
+  list_created_remove(chptr);
+
+  xfree(entry->reply);
+  entry->reply = NULL;
+}
+
+/*! \brief Brings a channel's index entries in line with its current
+ *         member count and creation time
+ * \param chptr Pointer to channel
+ */
+void
+list_index_update(struct Channel *chptr)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+  const unsigned int users = dlink_list_length(&chptr->members);
+
+  if (entry->group->users != users)
+  {
+    list_group_set(chptr, users);
+    entry->reply_stale = 1;
+  }
+
+  if (entry->created != chptr->creationtime)
+  {
+    list_created_remove(chptr);
+
+    entry->created = chptr->creationtime;
+    dlinkAdd(chptr, &entry->pending, &created_pending);
+  }
+}
+
+/*! \brief Drops the cached reply of a channel, e.g. after a topic change
+ * \param chptr Pointer to channel
+ */
+void
+list_index_invalidate(struct Channel *chptr)
+{
+  chptr->list_index.reply_stale = 1;
+}
+
+/*! \brief Returns the parameters of a channel's RPL_LIST line, that is
+ *         everything that follows the target nick
+ * \param chptr Pointer to channel
+ * \param len   Set to the length of the reply
+ * \return Pointer to the cached reply. Mode changes are made in many
+ *         places, so instead of being told about them the cache
+ *         compares the modes it has been built with.
+ */
+const char *
+list_index_reply(struct Channel *chptr, size_t *len)
+{
+  struct ListIndexEntry *const entry = &chptr->list_index;
+
+  if (entry->reply == NULL || entry->reply_stale ||
+      entry->reply_mode != chptr->mode.mode ||
+      entry->reply_limit != (chptr->mode.limit != 0) ||
+      entry->reply_key != (chptr->mode.key[0] != '\0'))
+  {
+    char modebuf[MODEBUFLEN] = "";
+    char parabuf[MODEBUFLEN] = "";
+    char buf[IRCD_BUFSIZE] = "";
+    int n;
+
+    /* Parameters are only shown to members, and never in LIST */
+    channel_modes(chptr, &me, modebuf, parabuf);
+
+    n = snprintf(buf, sizeof(buf), "%s %u :[%s]%s%s", chptr->name,
+                 dlink_list_length(&chptr->members), modebuf,
+                 chptr->topic[0] ? " " : "", chptr->topic);
+
+    entry->reply_len = IRCD_MIN((size_t)n, sizeof(buf) - 1);
+    entry->reply = xrealloc(entry->reply, entry->reply_len + 1);
+    memcpy(entry->reply, buf, entry->reply_len + 1);
+
+    entry->reply_mode = chptr->mode.mode;
+    entry->reply_limit = chptr->mode.limit != 0;
+    entry->reply_key = chptr->mode.key[0] != '\0';
+    entry->reply_stale = 0;
+  }
+
+  *len = entry->reply_len;
+  return entry->reply;
+}
+
+/*! \brief Counts the channels whose member count is within a range
+ * \param min Minimum member count
+ * \param max Maximum member count
+ * \return Number of channels
+ */
+unsigned int
+list_index_count_users(unsigned int min, unsigned int max)
+{
+  unsigned int count = 0;
+  dlink_node *node;
+
+  DLINK_FOREACH_PREV(node, count_groups.tail)
+  {
+    const struct ListCountGroup *const group = node->data;
+
+    if (group->users < min)
+      break;
+    if (group->users <= max)
+      count += dlink_list_length(&group->channels);
+  }
+
+  return count;
+}
+
+/*! \brief Estimates the number of channels that are matched by a
+ *         creation time filter. Channels without a creation time
+ *         match any filter, just like in list_one_channel().
+ * \param min Minimum creation time
+ * \param max Maximum creation time
+ * \return Upper bound of the number of channels
+ */
+unsigned int
+list_index_count_created(uintmax_t min, uintmax_t max)
+{
+  unsigned int count;
+
+  list_created_merge();
+
+  count = list_created_upper(0) - list_created_lower(0);
+
+  if (min == 0)
+    min = 1;
+  if (min <= max)
+    count += list_created_upper(max) - list_created_lower(min);
+
+  return count;
+}
+
+/*! \brief Walks the channels whose member count is within a range,
+ *         largest channels first
+ * \param min  Minimum member count
+ * \param max  Maximum member count
+ * \param cb   Called for every channel
+ * \param data Passed to the callback
+ */
+void
+list_index_find_users(unsigned int min, unsigned int max, list_index_cb cb, void *data)
+{
+  dlink_node *node, *node2;
+
+  DLINK_FOREACH_PREV(node, count_groups.tail)
+  {
+    const struct ListCountGroup *const group = node->data;
+
+    if (group->users < min)
+      break;
+    if (group->users > max)
+      continue;
+
+    DLINK_FOREACH(node2, group->channels.head)
+      if (cb(node2->data, data))
+        return;
+  }
+}
+
+static int
+list_created_walk(unsigned int first, unsigned int last, list_index_cb cb, void *data)
+{
+  for (unsigned int i = first; i < last; ++i)
+    if (created_table[i].chptr && cb(created_table[i].chptr, data))
+      return 1;
+
+  return 0;
+}
+
+/*! \brief Walks the channels whose creation time is within a range,
+ *         oldest channels first
+ * \param min  Minimum creation time
+ * \param max  Maximum creation time
+ * \param cb   Called for every channel
+ * \param data Passed to the callback
+ */
+void
+list_index_find_created(uintmax_t min, uintmax_t max, list_index_cb cb, void *data)
+{
+  list_created_merge();
+
+  if (list_created_walk(list_created_lower(0), list_created_upper(0), cb, data))
+    return;
+
+  if (min == 0)
+    min = 1;
+  if (min <= max)
+    list_created_walk(list_created_lower(min), list_created_upper(max), cb, data);
+}
+
+/*! \brief Reports the memory used by the indexes and the reply cache
+ * \param count        Set to the number of member count groups and
+ *                     creation time slots
+ * \param memory       Set to the memory they take
+ * \param reply_count  Set to the number of cached replies
+ * \param reply_memory Set to the memory the cached replies take
+ */
+void
+list_index_count_memory(unsigned int *const count, size_t *const memory,
+                        unsigned int *const reply_count, size_t *const reply_memory)
+{
+  dlink_node *node;
+
+  *count = dlink_list_length(&count_groups) + created_count;
+  *memory = dlink_list_length(&count_groups) * sizeof(struct ListCountGroup) +
+            created_count * sizeof(struct ListCreatedSlot);
+  *reply_count = 0;
+  *reply_memory = 0;
+
+  DLINK_FOREACH(node, channel_get_list()->head)
+  {
+    const struct Channel *const chptr = node->data;
+
+    if (chptr->list_index.reply)
+    {
+      ++*reply_count;
+      *reply_memory += chptr->list_index.reply_len + 1;
+    }
+  }
+}
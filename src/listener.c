@@ -36,6 +36,7 @@
 #include "conf.h"
 #include "send.h"
 #include "memory.h"
+#include "misc.h"
 
 #define TOOFAST_WARNING "ERROR :Your host is trying to (re)connect too fast -- throttled.\r\n"
 #define DLINE_WARNING "ERROR :You have been D-lined.\r\n"
@@ -88,6 +89,38 @@ listener_count_memory(unsigned int *count, size_t *bytes)
   (*bytes) = *count * sizeof(struct Listener);
 }
 
+/*
+ * listener_count_accept - update the accept statistics of a listener
+ */
+static void
+listener_count_accept(struct Listener *listener)
+{
+  if (listener->rate_time != CurrentTime)
+  {
+    listener->rate = listener->rate_time + 1 == CurrentTime ? listener->rate_count : 0;
+    listener->rate_count = 0;
+    listener->rate_time = CurrentTime;
+  }
+
+  ++listener->accepted;
+
+  if (++listener->rate_count > listener->rate_peak)
+    listener->rate_peak = listener->rate_count;
+}
+
+/*
+ * listener_get_rate - connections accepted during the last full second
+ */
+unsigned int
+listener_get_rate(const struct Listener *listener)
+{
+  if (listener->rate_time == CurrentTime)
+    return listener->rate;
+  if (listener->rate_time + 1 == CurrentTime)
+    return listener->rate_count;
+  return 0;
+}
+
 static void
 listener_accept_connection(fde_t *F, void *data)
 {
@@ -95,12 +128,12 @@ listener_accept_connection(fde_t *F, void *data)
   struct irc_ssaddr addr;
   int fd;
   int pe;
+  unsigned int budget = LISTENER_ACCEPT_BUDGET;
   struct Listener *const listener = data;
 
   assert(listener);
-  assert(listener->fd == F);
-  assert(listener->fd);
-  assert(listener->fd->flags.open);
+  assert(F);
+  assert(F->flags.open);
 
   /* There may be many reasons for error return, but
    * in otherwise correctly working environment the
@@ -111,15 +144,24 @@ listener_accept_connection(fde_t *F, void *data)
    * Thus no specific errors are tested at this
    * point, just assume that connections cannot
    * be accepted until some old is closed first.
+   *
+   * Never accept more than LISTENER_ACCEPT_BUDGET connections in one go,
+   * so a connection storm can't starve established clients. Whatever is
+   * left in the queue is picked up on the next pass through the loop.
    */
-  while ((fd = comm_accept(listener->fd->fd, &addr)) != -1)
+  while (budget && (fd = comm_accept(F->fd, &addr)) != -1)
   {
+    const uintmax_t start = clock_usec();
+
+    --budget;
+
     /*
      * check for connection limit
      */
     if (number_fd > hard_fdlimit - 10)
     {
       ++ServerStats.is_ref;
+      ++listener->refused;
       sendto_realops_flags_ratelimited(&rate, "All connections in use. (%s)",
                                        listener_get_name(listener));
 
@@ -137,6 +179,7 @@ listener_accept_connection(fde_t *F, void *data)
     if ((pe = conf_connect_allowed(&addr, addr.ss.ss_family)))
     {
       ++ServerStats.is_ref;
+      ++listener->refused;
 
       if (!(listener->flags & LISTENER_SSL))
       {
@@ -156,19 +199,23 @@ listener_accept_connection(fde_t *F, void *data)
     }
 
     ++ServerStats.is_ac;
-    add_connection(listener, &addr, fd);
+    listener_count_accept(listener);
+    add_connection(listener, &addr, fd, start);
   }
 
+  if (budget == 0)
+    ++listener->budget_hits;
+
   /* Re-register a new IO request for the next accept .. */
-  comm_setselect(listener->fd, COMM_SELECT_READ, listener_accept_connection,
+  comm_setselect(F, COMM_SELECT_READ, listener_accept_connection,
                  listener, 0);
 }
 
 
 /*
- * inetport - create a listener socket in the AF_INET or AF_INET6 domain,
- * bind it to the port given in 'port' and listen to it
- * returns true (1) if successful false (0) on error.
+ * listener_socket - create a listener socket in the AF_INET or AF_INET6
+ * domain, bind it to the address given in 'lsin' and listen to it
+ * returns the socket, or -1 on error.
  *
  * If the operating system has a define for SOMAXCONN, use it, otherwise
  * use HYBRID_SOMAXCONN
@@ -179,17 +226,10 @@ listener_accept_connection(fde_t *F, void *data)
 #endif
 
 static int
-inetport(struct Listener *listener)
+listener_socket(struct Listener *listener, const struct irc_ssaddr *lsin, int reuseport)
 {
-  struct irc_ssaddr lsin;
   socklen_t opt = 1;
 
-  memset(&lsin, 0, sizeof(lsin));
-  memcpy(&lsin, &listener->addr, sizeof(lsin));
-
-  getnameinfo((const struct sockaddr *)&lsin, lsin.ss_len, listener->name,
-              sizeof(listener->name), NULL, 0, NI_NUMERICHOST);
-
   /*
    * At first, open a new socket
    */
@@ -198,7 +238,7 @@ inetport(struct Listener *listener)
   {
     report_error(L_ALL, "opening listener socket %s:%s",
                  listener_get_name(listener), errno);
-    return 0;
+    return -1;
   }
 
   if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
@@ -206,21 +246,25 @@ inetport(struct Listener *listener)
     report_error(L_ALL, "setting SO_REUSEADDR for listener %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return 0;
+    return -1;
   }
 
-  /*
-   * Bind a port to listen for new connections if port is non-null,
-   * else assume it is already open and try get something from it.
-   */
-  lsin.ss_port = htons(listener->port);
+#ifdef SO_REUSEPORT
+  if (reuseport && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)))
+  {
+    report_error(L_ALL, "setting SO_REUSEPORT for listener %s:%s",
+                 listener_get_name(listener), errno);
+    close(fd);
+    return -1;
+  }
+#endif
 
-  if (bind(fd, (struct sockaddr *)&lsin, lsin.ss_len))
+  if (bind(fd, (const struct sockaddr *)lsin, lsin->ss_len))
   {
     report_error(L_ALL, "binding listener socket %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return 0;
+    return -1;
   }
 
   if (listen(fd, HYBRID_SOMAXCONN))
@@ -228,14 +272,68 @@ inetport(struct Listener *listener)
     report_error(L_ALL, "listen failed for %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return 0;
+    return -1;
   }
 
+  return fd;
+}
+
+/*
+ * inetport - open the socket(s) of a listener
+ * returns true (1) if successful false (0) on error.
+ *
+ * A listener flagged reuseport binds its address with SO_REUSEPORT, once
+ * per worker thread, so the kernel can spread incoming connections over
+ * several accept queues.  The number of sockets simply follows -workers
+ * (capped at LISTENER_REUSEPORT_MAX); all of them are still polled and
+ * accepted from by the main thread, so what this buys is a deeper backlog
+ * during connection floods, not parallel accept().
+ */
+static int
+inetport(struct Listener *listener)
+{
+  struct irc_ssaddr lsin;
+  const int reuseport = (listener->flags & LISTENER_REUSEPORT) != 0;
+  unsigned int count = 1;
+
+#ifdef SO_REUSEPORT
+  if (reuseport)
+    count = IRCD_MAX(1, IRCD_MIN(server_state.workers, LISTENER_REUSEPORT_MAX));
+#endif
+
+  memset(&lsin, 0, sizeof(lsin));
+  memcpy(&lsin, &listener->addr, sizeof(lsin));
+
+  getnameinfo((const struct sockaddr *)&lsin, lsin.ss_len, listener->name,
+              sizeof(listener->name), NULL, 0, NI_NUMERICHOST);
+
+  /*
+   * Bind a port to listen for new connections if port is non-null,
+   * else assume it is already open and try get something from it.
+   */
+  lsin.ss_port = htons(listener->port);
+
+  int fd = listener_socket(listener, &lsin, reuseport);
+  if (fd == -1)
+    return 0;
+
   listener->fd = fd_open(fd, 1, "Listener socket");
 
+  for (unsigned int i = 1; i < count; ++i)
+  {
+    if ((fd = listener_socket(listener, &lsin, reuseport)) == -1)
+      break;
+
+    listener->reuseport_fd[listener->reuseport_count++] =
+      fd_open(fd, 1, "Listener socket (SO_REUSEPORT)");
+  }
+
   /* Listen completion events are READ events .. */
 
   listener_accept_connection(listener->fd, listener);
+
+  for (unsigned int i = 0; i < listener->reuseport_count; ++i)
+    listener_accept_connection(listener->reuseport_fd[i], listener);
   return 1;
 }
 
@@ -268,10 +366,10 @@ listener_find(int port, struct irc_ssaddr *addr)
 }
 
 /*
- * close_listener - close a single listener
+ * listener_close_sockets - close the socket(s) of a listener, but keep it
  */
 static void
-listener_close(struct Listener *listener)
+listener_close_sockets(struct Listener *listener)
 {
   if (listener->fd)
   {
@@ -281,6 +379,19 @@ listener_close(struct Listener *listener)
     listener->fd = NULL;
   }
 
+  for (unsigned int i = 0; i < listener->reuseport_count; ++i)
+    fd_close(listener->reuseport_fd[i]);
+  listener->reuseport_count = 0;
+}
+
+/*
+ * close_listener - close a single listener
+ */
+static void
+listener_close(struct Listener *listener)
+{
+  listener_close_sockets(listener);
+
   listener->active = 0;
 
   if (listener->ref_count)
@@ -389,13 +500,21 @@ listener_add(int port, const char *vhost_ip, unsigned int flags)
 
   if ((listener = listener_find(port, &vaddr)))
   {
-    listener->flags = flags;
-
     if (listener->fd)
     {
       assert(listener->fd->flags.open);
-      return;
+
+      /* SO_REUSEPORT can only be set before bind(), so reopen the socket(s) */
+      if (((listener->flags ^ flags) & LISTENER_REUSEPORT) == 0)
+      {
+        listener->flags = flags;
+        return;
+      }
+
+      listener_close_sockets(listener);
     }
+
+    listener->flags = flags;
   }
   else
   {
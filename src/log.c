@@ -22,6 +22,18 @@
 /*! \file log.c
  * \brief Logger functions.
  * \version $Id$
+ *
+ * ilog() only formats the message and appends it to a lock-free ring
+ * together with the time it has been logged at. A writer thread, the
+ * only consumer of the ring, owns the log file descriptors: it adds the
+ * timestamps, batches consecutive lines of the same file into one
+ * write() and rotates files that have grown beyond their size limit.
+ * Lines that don't fit into the ring are dropped and counted rather
+ * than stalling the main loop. Opening and closing files goes through
+ * the ring as well, so these are ordered with the lines around them.
+ *
+ * Without thread support, before log_init() and in forked children
+ * everything is done synchronously from within ilog().
  */
 
 #include "stdinc.h"
@@ -29,10 +41,484 @@
 #include "conf.h"
 #include "misc.h"
 #include "memory.h"
+#include "ircd.h"
+#include "ircd_defs.h"
+
+enum
+{
+  LOG_RECORD_LINE,   /**< A line to be appended */
+  LOG_RECORD_OPEN,   /**< (Re)open a file; the text is the path */
+  LOG_RECORD_CLOSE   /**< Close a file */
+};
 
+enum { LOG_BATCH_SIZE = 65536 };
+
+/*! \brief Header of a record in the ring. The text, if any, follows without padding. */
+struct LogRecord
+{
+  uint32_t len;   /**< Length of the text */
+  uint16_t type;  /**< enum log_type */
+  uint16_t kind;  /**< LOG_RECORD_* */
+  uint64_t arg;   /**< Time logged at for lines, the size limit for LOG_RECORD_OPEN */
+};
+
+/*! \brief State of an open file. Owned by the writer thread once it runs. */
+struct LogSink
+{
+  size_t size;     /**< Rotate once the file gets larger than this; 0 for never */
+  size_t written;  /**< Current length of the file */
+  char *path;
+  int fd;
+};
 
 static struct LogFile log_type_table[LOG_TYPE_LAST];
+static struct LogSink log_sink_table[LOG_TYPE_LAST] =
+{
+  [0 ... LOG_TYPE_LAST - 1] = { .fd = -1 }
+};
+
+static char log_batch[LOG_BATCH_SIZE];
+static size_t log_batch_len;
+static unsigned int log_batch_type;
+
+static uintmax_t log_lines_dropped;  /**< Written by the main thread only */
+static int log_threaded;  /**< Non-zero once the writer thread has been started */
+
+
+/*! \brief Formats a timestamp. Like date_iso8601() but usable from the
+ *         writer thread.
+ */
+static const char *
+log_date(uintmax_t lclock)
+{
+  static char buf[MAX_DATE_STRING];
+  static uintmax_t lclock_last;
+  const time_t t = lclock;
+  struct tm tm;
+
+  if (lclock_last != lclock || buf[0] == '\0')
+  {
+    lclock_last = lclock;
+    strftime(buf, sizeof(buf), "%FT%T%z", localtime_r(&t, &tm));
+  }
+
+  return buf;
+}
+
+static void
+log_sink_write(struct LogSink *sink, const char *buf, size_t len)
+{
+  while (len)
+  {
+    ssize_t ret = write(sink->fd, buf, len);
+
+    if (ret < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return;  /* Nowhere to report this to */
+    }
+
+    sink->written += ret;
+    buf += ret;
+    len -= ret;
+  }
+}
+
+static void
+log_sink_open(struct LogSink *sink)
+{
+  struct stat sb;
+
+  sink->fd = open(sink->path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+  if (sink->fd < 0)
+    return;
+
+  sink->written = fstat(sink->fd, &sb) == 0 ? (size_t)sb.st_size : 0;
+}
+
+static void
+log_sink_close(struct LogSink *sink)
+{
+  if (sink->fd < 0)
+    return;
+
+  close(sink->fd);
+  sink->fd = -1;
+}
+
+static void
+log_sink_rotate(struct LogSink *sink, uintmax_t lclock)
+{
+  char buf[LOG_BUFSIZE];
+  int len = snprintf(buf, sizeof(buf), "[%s] Rotating logfile %s\n", log_date(lclock), sink->path);
+
+  if (len > 0 && (size_t)len < sizeof(buf))
+    log_sink_write(sink, buf, len);
+
+  log_sink_close(sink);
+
+  len = snprintf(buf, sizeof(buf), "%s.old", sink->path);
+  if (len > 0 && (size_t)len < sizeof(buf))
+  {
+    unlink(buf);
+    rename(sink->path, buf);
+  }
+
+  log_sink_open(sink);
+}
+
+/*! \brief Writes out the pending batch with a single write() and
+ *         rotates the file if it has grown too large.
+ */
+static void
+log_batch_flush(void)
+{
+  struct LogSink *const sink = &log_sink_table[log_batch_type];
+
+  if (log_batch_len == 0)
+    return;
+
+  if (sink->fd >= 0)
+  {
+    log_sink_write(sink, log_batch, log_batch_len);
+
+    if (sink->size && sink->written > sink->size)
+      log_sink_rotate(sink, time(NULL));
+  }
+
+  log_batch_len = 0;
+}
+
+static void
+log_batch_line(unsigned int type, uintmax_t lclock, const char *text, size_t len)
+{
+  /* "[" date "] " text "\n" */
+  const size_t need = MAX_DATE_STRING + 4 + len;
+
+  if (log_sink_table[type].fd < 0)
+    return;
+
+  if (log_batch_len && (log_batch_type != type || log_batch_len + need > sizeof(log_batch)))
+    log_batch_flush();
+
+  log_batch_type = type;
+
+  char *p = log_batch + log_batch_len;
+  p += snprintf(p, MAX_DATE_STRING + 3, "[%s] ", log_date(lclock));
+  memcpy(p, text, len);
+  p += len;
+  *p++ = '\n';
+
+  log_batch_len = p - log_batch;
+}
+
+/*! \brief Applies one record to the log files */
+static void
+log_process(const struct LogRecord *rec, const char *text)
+{
+  struct LogSink *const sink = &log_sink_table[rec->type];
+
+  if (rec->kind == LOG_RECORD_LINE)
+  {
+    log_batch_line(rec->type, rec->arg, text, rec->len);
+    return;
+  }
+
+  if (log_batch_len && log_batch_type == rec->type)
+    log_batch_flush();
+
+  log_sink_close(sink);
+  xfree(sink->path);
+  sink->path = NULL;
+
+  if (rec->kind == LOG_RECORD_OPEN)
+  {
+    sink->path = xcalloc(rec->len + 1);
+    memcpy(sink->path, text, rec->len);
+    sink->size = rec->arg;
+    log_sink_open(sink);
+  }
+}
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+enum { CACHELINE_SIZE = 64 };
+enum { LOG_RING_SIZE = 1 << 20 };  /* Must be a power of two */
+
+struct log_ring
+{
+  unsigned int head;  /**< Offset of the next record to consume; written by the writer only */
+  char pad1[CACHELINE_SIZE - sizeof(unsigned int)];
+  unsigned int tail;  /**< Offset to append at; written by the main thread only */
+  char pad2[CACHELINE_SIZE - sizeof(unsigned int)];
+  char data[LOG_RING_SIZE];
+};
+
+static struct log_ring log_ring;
+static pthread_t log_thread;
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t log_cond = PTHREAD_COND_INITIALIZER;
+static int log_sleeping;  /**< Writer is (about to be) blocked on log_cond */
+
+
+static void
+log_ring_copy_in(unsigned int pos, const void *src, size_t len)
+{
+  const unsigned int off = pos & (LOG_RING_SIZE - 1);
+  const size_t first = LOG_RING_SIZE - off < len ? LOG_RING_SIZE - off : len;
+
+  memcpy(log_ring.data + off, src, first);
+  memcpy(log_ring.data, (const char *)src + first, len - first);
+}
+
+static void
+log_ring_copy_out(unsigned int pos, void *dst, size_t len)
+{
+  const unsigned int off = pos & (LOG_RING_SIZE - 1);
+  const size_t first = LOG_RING_SIZE - off < len ? LOG_RING_SIZE - off : len;
+
+  memcpy(dst, log_ring.data + off, first);
+  memcpy((char *)dst + first, log_ring.data, len - first);
+}
+
+static void
+log_wakeup(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&log_sleeping, __ATOMIC_SEQ_CST))
+  {
+    pthread_mutex_lock(&log_lock);
+    pthread_cond_signal(&log_cond);
+    pthread_mutex_unlock(&log_lock);
+  }
+}
+
+/*! \brief Appends a record to the ring.
+ * \return 1 on success, 0 if there isn't enough room
+ */
+static int
+log_push(const struct LogRecord *rec, const char *text)
+{
+  const unsigned int tail = __atomic_load_n(&log_ring.tail, __ATOMIC_RELAXED);
+  const unsigned int used = tail - __atomic_load_n(&log_ring.head, __ATOMIC_ACQUIRE);
+
+  if (LOG_RING_SIZE - used < sizeof(*rec) + rec->len)
+    return 0;
+
+  log_ring_copy_in(tail, rec, sizeof(*rec));
+  log_ring_copy_in(tail + sizeof(*rec), text, rec->len);
+  __atomic_store_n(&log_ring.tail, tail + sizeof(*rec) + rec->len, __ATOMIC_RELEASE);
 
+  log_wakeup();
+  return 1;
+}
+
+/*! \brief Writes a note about lines that had to be dropped since the
+ *         last one to the main log file.
+ */
+static void
+log_report_dropped(void)
+{
+  static uintmax_t reported;
+  const uintmax_t dropped = __atomic_load_n(&log_lines_dropped, __ATOMIC_RELAXED);
+  char buf[LOG_BUFSIZE];
+
+  if (dropped == reported)
+    return;
+
+  int len = snprintf(buf, sizeof(buf), "Dropped %ju log lines, the log ring was full",
+                     dropped - reported);
+  reported = dropped;
+
+  log_batch_line(LOG_TYPE_IRCD, time(NULL), buf, len);
+  log_batch_flush();
+}
+
+static void *
+log_main(void *arg)
+{
+  static char text[LOG_BUFSIZE + HYB_PATH_MAX];  /* See log_submit_open() */
+  struct LogRecord rec;
+
+  while (1)
+  {
+    unsigned int head = __atomic_load_n(&log_ring.head, __ATOMIC_RELAXED);
+    unsigned int tail = __atomic_load_n(&log_ring.tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+    {
+      log_batch_flush();
+      log_report_dropped();
+
+      pthread_mutex_lock(&log_lock);
+      __atomic_store_n(&log_sleeping, 1, __ATOMIC_SEQ_CST);
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+      while (head == (tail = __atomic_load_n(&log_ring.tail, __ATOMIC_ACQUIRE)))
+        pthread_cond_wait(&log_cond, &log_lock);
+
+      __atomic_store_n(&log_sleeping, 0, __ATOMIC_RELAXED);
+      pthread_mutex_unlock(&log_lock);
+    }
+
+    while (head != tail)
+    {
+      log_ring_copy_out(head, &rec, sizeof(rec));
+      log_ring_copy_out(head + sizeof(rec), text, rec.len);
+      head += sizeof(rec) + rec.len;
+
+      log_process(&rec, text);
+    }
+
+    /*
+     * Give the room back only once everything up to here has been
+     * written, so that log_flush() can rely on an empty ring.
+     */
+    log_batch_flush();
+    __atomic_store_n(&log_ring.head, head, __ATOMIC_RELEASE);
+  }
+
+  return NULL;
+}
+
+/*! \brief The writer thread doesn't survive fork(). Children log synchronously. */
+static void
+log_atfork_child(void)
+{
+  log_threaded = 0;
+  log_batch_len = 0;  /* Belongs to the parent's writer */
+}
+
+/*! \brief Starts the writer thread. Has to be called after any fork(). */
+void
+log_init(void)
+{
+  sigset_t set, oldset;
+
+  /* Signals are meant for the main thread only */
+  sigfillset(&set);
+  pthread_sigmask(SIG_BLOCK, &set, &oldset);
+
+  int ret = pthread_create(&log_thread, NULL, log_main, NULL);
+
+  pthread_sigmask(SIG_SETMASK, &oldset, NULL);
+
+  if (ret)
+  {
+    ilog(LOG_TYPE_IRCD, "log_init: couldn't start log writer thread: %s",
+         strerror(ret));
+    return;
+  }
+
+  pthread_atfork(NULL, NULL, log_atfork_child);
+  atexit(log_flush);
+
+  log_threaded = 1;
+}
+
+/*! \brief Waits up to two seconds for the writer to catch up. To be
+ *         called before the process exits or exec()s.
+ */
+void
+log_flush(void)
+{
+  if (log_threaded == 0)
+    return;
+
+  log_wakeup();
+
+  for (unsigned int i = 0; i < 2000; ++i)
+  {
+    if (__atomic_load_n(&log_ring.head, __ATOMIC_ACQUIRE) ==
+        __atomic_load_n(&log_ring.tail, __ATOMIC_RELAXED))
+      return;
+
+    const struct timespec ts = { .tv_sec = 0, .tv_nsec = 1000000 };
+    nanosleep(&ts, NULL);
+  }
+}
+
+unsigned int
+log_queued(void)
+{
+  return __atomic_load_n(&log_ring.tail, __ATOMIC_RELAXED) -
+         __atomic_load_n(&log_ring.head, __ATOMIC_RELAXED);
+}
+#else
+void
+log_init(void)
+{
+}
+
+void
+log_flush(void)
+{
+}
+
+unsigned int
+log_queued(void)
+{
+  return 0;
+}
+
+static int
+log_push(const struct LogRecord *rec, const char *text)
+{
+  return 0;
+}
+#endif  /* HAVE_PTHREAD_H */
+
+uintmax_t
+log_dropped(void)
+{
+  return log_lines_dropped;
+}
+
+/*! \brief Queues a record, or applies it right away if there's no writer thread.
+ * \param rec Record to be queued
+ * \param text Text following the record
+ * \param wait Whether to wait for room instead of dropping the record
+ */
+static void
+log_submit(const struct LogRecord *rec, const char *text, int wait)
+{
+  if (log_threaded == 0)
+  {
+    log_process(rec, text);
+    log_batch_flush();
+    return;
+  }
+
+  while (log_push(rec, text) == 0)
+  {
+    if (wait == 0)
+    {
+      __atomic_store_n(&log_lines_dropped, log_lines_dropped + 1, __ATOMIC_RELAXED);
+      return;
+    }
+
+    const struct timespec ts = { .tv_sec = 0, .tv_nsec = 1000000 };
+    nanosleep(&ts, NULL);
+  }
+}
+
+static void
+log_submit_open(enum log_type type, const struct LogFile *log)
+{
+  struct LogRecord rec = { .type = type, .kind = LOG_RECORD_CLOSE };
+
+  /* Longer paths couldn't be opened anyway */
+  if (log->path && strlen(log->path) < HYB_PATH_MAX)
+  {
+    rec.kind = LOG_RECORD_OPEN;
+    rec.len = strlen(log->path);
+    rec.arg = log->size;
+  }
+
+  log_submit(&rec, log->path, 1);
+}
 
 void
 log_set_file(enum log_type type, size_t size, const char *path)
@@ -46,7 +532,10 @@ log_set_file(enum log_type type, size_t size, const char *path)
   log->size = size;
 
   if (type == LOG_TYPE_IRCD)
-    log->file = fopen(log->path, "a");
+  {
+    log->active = 1;
+    log_submit_open(type, log);
+  }
 }
 
 void
@@ -59,14 +548,8 @@ log_free(struct LogFile *log)
 void
 log_reopen(struct LogFile *log)
 {
-  if (log->file)
-  {
-    fclose(log->file);
-    log->file = NULL;
-  }
-
-  if (log->path)
-    log->file = fopen(log->path, "a");
+  log->active = log->path != NULL;
+  log_submit_open(log - log_type_table, log);
 }
 
 void
@@ -77,55 +560,25 @@ log_iterate(void (*func)(struct LogFile *))
     func(&log_type_table[type]);
 }
 
-static int
-log_exceed_size(struct LogFile *log)
-{
-  struct stat sb;
-
-  if (log->size == 0)
-    return 0;
-
-  if (stat(log->path, &sb) < 0)
-    return 0;
-
-  return (size_t)sb.st_size > log->size;
-}
-
-static void
-log_write(struct LogFile *log, const char *message)
-{
-  fprintf(log->file, "[%s] %s\n", date_iso8601(0), message);
-  fflush(log->file);
-}
-
 void
 ilog(enum log_type type, const char *fmt, ...)
 {
-  struct LogFile *log = &log_type_table[type];
-  char buf[LOG_BUFSIZE] = "";
+  const struct LogFile *log = &log_type_table[type];
+  char buf[LOG_BUFSIZE];
   va_list args;
 
-  if (log->file == NULL || ConfigLog.use_logging == 0)
+  if (log->active == 0 || ConfigLog.use_logging == 0)
     return;
 
   va_start(args, fmt);
-  vsnprintf(buf, sizeof(buf), fmt, args);
+  int len = vsnprintf(buf, sizeof(buf), fmt, args);
   va_end(args);
 
-  log_write(log, buf);
-
-  if (log_exceed_size(log) == 0)
+  if (len < 0)
     return;
 
-  snprintf(buf, sizeof(buf), "Rotating logfile %s", log->path);
-  log_write(log, buf);
-
-  fclose(log->file);
-  log->file = NULL;
-
-  snprintf(buf, sizeof(buf), "%s.old", log->path);
-  unlink(buf);
-  rename(log->path, buf);
+  struct LogRecord rec = { .type = type, .kind = LOG_RECORD_LINE, .arg = CurrentTime };
+  rec.len = (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1;
 
-  log->file = fopen(log->path, "a");
+  log_submit(&rec, buf, 0);
 }
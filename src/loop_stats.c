@@ -0,0 +1,257 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file loop_stats.c
+ * \brief Timing and backlog counters of the main I/O loop.
+ * \version $Id$
+ *
+ * io_loop() calls loop_stats_phase() after each of its phases, so every
+ * phase costs one clock read. The time spent blocked waiting for I/O is
+ * reported by the comm_select() backends through loop_stats_polled().
+ * Iterations that keep the loop busy for longer than LOOP_SLOW_LAP
+ * milliseconds are logged together with the slowest operation they ran.
+ */
+
+#include "stdinc.h"
+#include "misc.h"
+#include "defaults.h"
+#include "event.h"
+#include "ircd.h"
+#include "log.h"
+#include "loop_stats.h"
+#include "probe.h"
+
+static const char *const loop_phase_names[LOOP_PHASE_COUNT] =
+{
+  [LOOP_PHASE_LIST] = "list",
+  [LOOP_PHASE_EVENTS] = "events",
+  [LOOP_PHASE_FLUSH] = "flush",
+  [LOOP_PHASE_WAIT] = "wait",
+  [LOOP_PHASE_IO] = "io",
+  [LOOP_PHASE_EXIT] = "exit",
+  [LOOP_PHASE_FREE] = "free",
+  [LOOP_PHASE_SIGNAL] = "signal"
+};
+
+static struct loop_stats loop_total;     /**< Since startup; shown by STATS w */
+static struct loop_stats loop_interval;  /**< Since the last periodic log line */
+
+static uintmax_t loop_mark;      /**< clock_usec() at the end of the previous phase */
+static uintmax_t loop_lap_busy;  /**< Time the current lap has been busy so far */
+static unsigned int loop_capacity;  /**< Size of the backend's event array */
+
+static const char *loop_slowest_name;  /**< Slowest operation of the current lap */
+static uintmax_t loop_slowest_usec;
+
+static uintmax_t loop_slow_logged;  /**< CurrentTime of the last slow lap log line */
+static unsigned int loop_slow_suppressed;
+
+
+/*! \brief Writes the counters of the last LOOP_STATS_INTERVAL seconds
+ *         to the log and starts over.
+ */
+static void
+loop_stats_report(void *unused)
+{
+  const struct loop_stats *const s = &loop_interval;
+  char buf[LOG_BUFSIZE], avg[32], max[32], sum[32];
+  int len = 0;
+
+  if (s->laps == 0)
+    return;
+
+  for (unsigned int i = 0; i < LOOP_PHASE_COUNT && len >= 0 && (size_t)len < sizeof(buf); ++i)
+    len += snprintf(buf + len, sizeof(buf) - len, " %s %s/%s", loop_phase_names[i],
+                    time_usec(s->phase[i].sum, sum, sizeof(sum)),
+                    time_usec(s->phase[i].max, max, sizeof(max)));
+
+  ilog(LOG_TYPE_IRCD, "Loop: %ju laps busy avg %s max %s, %ju polls ready avg %ju max %ju "
+       "array %u full %ju, flood deferred %ju, phases (total/max):%s",
+       s->laps,
+       time_usec(s->busy_sum / s->laps, avg, sizeof(avg)),
+       time_usec(s->busy_max, max, sizeof(max)),
+       s->polls, s->polls ? s->ready / s->polls : 0, s->ready_max,
+       loop_capacity, s->saturated, s->flood_deferred, buf);
+
+  memset(&loop_interval, 0, sizeof(loop_interval));
+}
+
+void
+loop_stats_init(void)
+{
+  static struct event event_loop_stats_report =
+  {
+    .name = "loop_stats_report",
+    .handler = loop_stats_report,
+    .when = LOOP_STATS_INTERVAL
+  };
+
+  event_add(&event_loop_stats_report, NULL);
+  loop_mark = clock_usec();
+}
+
+/*! \brief Notes an operation of the current lap, such as an event
+ *         handler, in case it turns out to be the slowest one.
+ * \param name Name of the operation; has to stay valid until the lap ends
+ * \param usec Time it has taken, in microseconds
+ */
+void
+loop_stats_operation(const char *name, uintmax_t usec)
+{
+  if (loop_slowest_name == NULL || usec > loop_slowest_usec)
+  {
+    loop_slowest_name = name;
+    loop_slowest_usec = usec;
+  }
+}
+
+/*! \brief Ends a phase of the current lap. The phase is taken to have
+ *         started when the previous one ended.
+ */
+void
+loop_stats_phase(enum loop_phase phase)
+{
+  const uintmax_t now = clock_usec();
+  const uintmax_t usec = now > loop_mark ? now - loop_mark : 0;
+
+  loop_mark = now;
+
+  struct loop_phase_stats *const total = &loop_total.phase[phase];
+  struct loop_phase_stats *const interval = &loop_interval.phase[phase];
+
+  total->sum += usec;
+  interval->sum += usec;
+
+  if (total->max < usec)
+    total->max = usec;
+  if (interval->max < usec)
+    interval->max = usec;
+
+  if (phase == LOOP_PHASE_WAIT)
+    return;
+
+  loop_lap_busy += usec;
+
+  /* Event handlers are reported one by one by event_run() */
+  if (phase != LOOP_PHASE_EVENTS)
+    loop_stats_operation(loop_phase_names[phase], usec);
+}
+
+/*! \brief Called by comm_select() once the backend returns from waiting.
+ * \param ready Number of descriptors reported ready, or -1 on error
+ * \param capacity Number of descriptors the backend could have reported
+ */
+void
+loop_stats_polled(int ready, unsigned int capacity)
+{
+  IRCD_PROBE2(select__wakeup, ready, capacity);
+  loop_stats_phase(LOOP_PHASE_WAIT);
+
+  loop_capacity = capacity;
+
+  ++loop_total.polls;
+  ++loop_interval.polls;
+
+  if (ready <= 0)
+    return;
+
+  loop_total.ready += ready;
+  loop_interval.ready += ready;
+
+  if (loop_total.ready_max < (uintmax_t)ready)
+    loop_total.ready_max = ready;
+  if (loop_interval.ready_max < (uintmax_t)ready)
+    loop_interval.ready_max = ready;
+
+  if ((unsigned int)ready >= capacity)
+  {
+    ++loop_total.saturated;
+    ++loop_interval.saturated;
+  }
+}
+
+void
+loop_stats_flood_deferred(void)
+{
+  ++loop_total.flood_deferred;
+  ++loop_interval.flood_deferred;
+}
+
+/*! \brief Ends the current lap. Laps that have been busy for longer
+ *         than LOOP_SLOW_LAP milliseconds are logged, at most once a
+ *         second.
+ */
+void
+loop_stats_lap(void)
+{
+  ++loop_total.laps;
+  ++loop_interval.laps;
+
+  loop_total.busy_sum += loop_lap_busy;
+  loop_interval.busy_sum += loop_lap_busy;
+
+  if (loop_total.busy_max < loop_lap_busy)
+    loop_total.busy_max = loop_lap_busy;
+  if (loop_interval.busy_max < loop_lap_busy)
+    loop_interval.busy_max = loop_lap_busy;
+
+  if (loop_lap_busy >= LOOP_SLOW_LAP * 1000)
+  {
+    if (loop_slow_logged == CurrentTime)
+      ++loop_slow_suppressed;
+    else
+    {
+      char busy[32], slowest[32];
+
+      ilog(LOG_TYPE_IRCD, "Slow loop iteration: busy for %s, slowest was %s with %s, "
+           "%u slow iterations not logged since the previous one",
+           time_usec(loop_lap_busy, busy, sizeof(busy)),
+           loop_slowest_name ? loop_slowest_name : "unknown",
+           time_usec(loop_slowest_usec, slowest, sizeof(slowest)),
+           loop_slow_suppressed);
+
+      loop_slow_logged = CurrentTime;
+      loop_slow_suppressed = 0;
+    }
+  }
+
+  loop_lap_busy = 0;
+  loop_slowest_name = NULL;
+  loop_slowest_usec = 0;
+}
+
+const char *
+loop_stats_phase_name(enum loop_phase phase)
+{
+  return loop_phase_names[phase];
+}
+
+const struct loop_stats *
+loop_stats_get(void)
+{
+  return &loop_total;
+}
+
+unsigned int
+loop_stats_capacity(void)
+{
+  return loop_capacity;
+}
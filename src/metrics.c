@@ -0,0 +1,725 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file metrics.c
+ * \brief Machine-readable server statistics served over a UNIX socket.
+ * \version $Id$
+ *
+ * With general::metrics_socket set, the server listens on a UNIX
+ * domain socket at that path. Every connection gets one snapshot and is
+ * closed. A request line of "json" selects JSON, anything else the
+ * Prometheus text format. HTTP requests are understood as well, so that
+ * "curl --unix-socket <path> http://localhost/metrics" and ".../metrics.json"
+ * work. The socket is created with the server's umask of 077 and
+ * therefore only accessible to the user the server runs as.
+ *
+ * Connections are served from the main loop like any other descriptor;
+ * nothing here ever blocks.
+ */
+
+#include "stdinc.h"
+#include <sys/un.h>
+#include "list.h"
+#include "client.h"
+#include "channel.h"
+#include "conf_class.h"
+#include "dbuf.h"
+#include "defaults.h"
+#include "fdlist.h"
+#include "hash.h"
+#include "ipcache.h"
+#include "ircd.h"
+#include "irc_string.h"
+#include "list_index.h"
+#include "listener.h"
+#include "log.h"
+#include "loop_stats.h"
+#include "memory.h"
+#include "metrics.h"
+#include "numeric.h"
+#include "s_bsd.h"
+#include "watch.h"
+#include "who_index.h"
+#include "whowas.h"
+#include "worker.h"
+
+enum
+{
+  METRICS_REQUEST_SIZE = 1024,  /**< Longest request accepted, including HTTP headers */
+  METRICS_MAX_CONNECTIONS = 8,  /**< Connections served at the same time */
+  METRICS_TIMEOUT = 10000       /**< Milliseconds a connection may take */
+};
+
+enum metrics_format
+{
+  METRICS_FORMAT_TEXT,  /**< Prometheus text exposition format */
+  METRICS_FORMAT_JSON
+};
+
+struct MetricsConnection
+{
+  dlink_node node;  /**< Entry in metrics_connections */
+  fde_t *fd;
+  char request[METRICS_REQUEST_SIZE];
+  size_t request_len;
+  enum metrics_format format;
+  char *buf;    /**< Reply being built or sent */
+  size_t len;   /**< Length of the reply */
+  size_t size;  /**< Allocated size of buf */
+  size_t sent;  /**< Bytes of the reply written so far */
+  unsigned int samples;  /**< Samples in the current family; JSON only */
+  const char *family;    /**< Name of the current family */
+  int labelled;          /**< Current family has a label */
+};
+
+static dlink_list metrics_connections;
+static fde_t *metrics_fd;     /**< Listening socket, if any */
+static char *metrics_path;    /**< Path metrics_fd is bound to */
+
+
+static void metrics_printf(struct MetricsConnection *, const char *, ...) AFP(2,3);
+
+static void
+metrics_printf(struct MetricsConnection *conn, const char *fmt, ...)
+{
+  va_list args;
+
+  while (1)
+  {
+    va_start(args, fmt);
+    int len = vsnprintf(conn->buf + conn->len, conn->size - conn->len, fmt, args);
+    va_end(args);
+
+    if (len < 0)
+      return;
+
+    if ((size_t)len < conn->size - conn->len)
+    {
+      conn->len += len;
+      return;
+    }
+
+    conn->size = conn->size * 2 + len;
+    conn->buf = xrealloc(conn->buf, conn->size);
+  }
+}
+
+/*! \brief Appends a label value or JSON key. Quotes and backslashes are
+ *         escaped, control characters dropped.
+ */
+static void
+metrics_quote(struct MetricsConnection *conn, const char *s)
+{
+  char buf[IRCD_BUFSIZE];
+  size_t len = 0;
+
+  for (; *s && len < sizeof(buf) - 2; ++s)
+  {
+    if (*s == '"' || *s == '\\')
+      buf[len++] = '\\';
+    else if ((unsigned char)*s < 0x20)
+      continue;
+
+    buf[len++] = *s;
+  }
+
+  buf[len] = '\0';
+  metrics_printf(conn, "\"%s\"", buf);
+}
+
+/*! \brief Starts a metric family. All samples that follow belong to it.
+ * \param conn Connection the reply is built for
+ * \param name Name of the family
+ * \param type "counter" or "gauge"
+ * \param help Description of the family
+ * \param label Name of the label that tells the samples apart; NULL if
+ *              the family consists of a single sample
+ */
+static void
+metrics_family(struct MetricsConnection *conn, const char *name, const char *type,
+               const char *help, const char *label)
+{
+  if (conn->format == METRICS_FORMAT_JSON)
+  {
+    if (conn->family)
+      metrics_printf(conn, "%s,\n", conn->labelled ? "}" : "");
+    metrics_printf(conn, "\"%s\":%s", name, label ? "{" : "");
+  }
+  else
+    metrics_printf(conn, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+
+  conn->family = name;
+  conn->labelled = label != NULL;
+  conn->samples = 0;
+}
+
+/*! \brief Adds a sample to the current family.
+ * \param label Name of the family's label; NULL for unlabelled families
+ * \param value Label value; NULL for unlabelled families
+ */
+static void
+metrics_sample(struct MetricsConnection *conn, const char *label, const char *value,
+               uintmax_t sample)
+{
+  if (conn->format == METRICS_FORMAT_JSON)
+  {
+    if (value)
+    {
+      metrics_printf(conn, "%s", conn->samples ? "," : "");
+      metrics_quote(conn, value);
+      metrics_printf(conn, ":%ju", sample);
+    }
+    else
+      metrics_printf(conn, "%ju", sample);
+  }
+  else if (value)
+  {
+    metrics_printf(conn, "%s{%s=", conn->family, label);
+    metrics_quote(conn, value);
+    metrics_printf(conn, "} %ju\n", sample);
+  }
+  else
+    metrics_printf(conn, "%s %ju\n", conn->family, sample);
+
+  ++conn->samples;
+}
+
+/*! \brief Shorthand for a family consisting of a single sample */
+static void
+metrics_single(struct MetricsConnection *conn, const char *name, const char *type,
+               const char *help, uintmax_t sample)
+{
+  metrics_family(conn, name, type, help, NULL);
+  metrics_sample(conn, NULL, NULL, sample);
+}
+
+static void
+metrics_server_stats(struct MetricsConnection *conn)
+{
+  metrics_single(conn, "ircd_uptime_seconds", "gauge", "Time since the server has been started",
+                 CurrentTime - me.connection->since);
+
+  metrics_family(conn, "ircd_bytes_sent_total", "counter", "Bytes sent", "peer");
+  metrics_sample(conn, "peer", "client", ServerStats.is_cbs);
+  metrics_sample(conn, "peer", "server", ServerStats.is_sbs);
+
+  metrics_family(conn, "ircd_bytes_received_total", "counter", "Bytes received", "peer");
+  metrics_sample(conn, "peer", "client", ServerStats.is_cbr);
+  metrics_sample(conn, "peer", "server", ServerStats.is_sbr);
+
+  metrics_family(conn, "ircd_connected_seconds_total", "counter",
+                 "Time spent connected by closed connections", "peer");
+  metrics_sample(conn, "peer", "client", ServerStats.is_cti);
+  metrics_sample(conn, "peer", "server", ServerStats.is_sti);
+
+  metrics_family(conn, "ircd_connections_closed_total", "counter", "Connections closed", "peer");
+  metrics_sample(conn, "peer", "client", ServerStats.is_cl);
+  metrics_sample(conn, "peer", "server", ServerStats.is_sv);
+  metrics_sample(conn, "peer", "unknown", ServerStats.is_ni);
+
+  metrics_single(conn, "ircd_connections_accepted_total", "counter",
+                 "Connections accepted", ServerStats.is_ac);
+  metrics_single(conn, "ircd_connections_refused_total", "counter",
+                 "Connections refused", ServerStats.is_ref);
+
+  metrics_family(conn, "ircd_messages_dropped_total", "counter",
+                 "Messages that couldn't be processed", "reason");
+  metrics_sample(conn, "reason", "unknown_command", ServerStats.is_unco);
+  metrics_sample(conn, "reason", "wrong_direction", ServerStats.is_wrdi);
+  metrics_sample(conn, "reason", "unknown_prefix", ServerStats.is_unpf);
+  metrics_sample(conn, "reason", "empty", ServerStats.is_empt);
+
+  metrics_single(conn, "ircd_numerics_total", "counter",
+                 "Numeric messages received", ServerStats.is_num);
+  metrics_single(conn, "ircd_collision_kills_total", "counter",
+                 "Kills generated on nick collisions", ServerStats.is_kill);
+
+  metrics_family(conn, "ircd_auth_total", "counter", "Finished auth requests", "result");
+  metrics_sample(conn, "result", "success", ServerStats.is_asuc);
+  metrics_sample(conn, "result", "failure", ServerStats.is_abad);
+
+  metrics_family(conn, "ircd_tls_handshakes_total", "counter", "TLS handshakes", "kind");
+  metrics_sample(conn, "kind", "resumed", ServerStats.is_tlsres);
+  metrics_sample(conn, "kind", "full", ServerStats.is_tlsfull);
+  metrics_sample(conn, "kind", "offloaded", ServerStats.is_tlsoff);
+  metrics_sample(conn, "kind", "shed", ServerStats.is_tlsshed);
+
+  metrics_family(conn, "ircd_clients", "gauge", "Clients currently connected", "scope");
+  metrics_sample(conn, "scope", "local", dlink_list_length(&local_client_list));
+  metrics_sample(conn, "scope", "global", dlink_list_length(&global_client_list));
+  metrics_sample(conn, "scope", "unknown", dlink_list_length(&unknown_list));
+  metrics_sample(conn, "scope", "local_max", Count.max_loc);
+  metrics_sample(conn, "scope", "global_max", Count.max_tot);
+
+  metrics_family(conn, "ircd_servers", "gauge", "Servers currently linked", "scope");
+  metrics_sample(conn, "scope", "local", dlink_list_length(&local_server_list));
+  metrics_sample(conn, "scope", "global", dlink_list_length(&global_server_list));
+
+  metrics_single(conn, "ircd_opers", "gauge", "Operators on the network", Count.oper);
+  metrics_single(conn, "ircd_channels", "gauge", "Channels", dlink_list_length(channel_get_list()));
+  metrics_single(conn, "ircd_descriptors", "gauge", "File descriptors in use", number_fd);
+}
+
+static void
+metrics_memory(struct MetricsConnection *conn)
+{
+  unsigned int count[8] = { 0 };
+  size_t size[8] = { 0 };
+  unsigned int list_reply_count = 0;
+  size_t list_reply_memory = 0;
+
+  watch_count_memory(&count[0], &size[0]);
+  who_index_count_memory(&count[1], &size[1]);
+  list_index_count_memory(&count[2], &size[2], &list_reply_count, &list_reply_memory);
+  whowas_count_memory(&count[3], &size[3]);
+  ipcache_get_stats(&count[4], &size[4]);
+  listener_count_memory(&count[5], &size[5]);
+
+  count[6] = dlink_list_length(&global_client_list);
+  size[6] = count[6] * sizeof(struct Client);
+  count[7] = dlink_list_length(channel_get_list());
+  size[7] = count[7] * sizeof(struct Channel);
+
+  static const char *const names[] =
+  {
+    "watch", "who_index", "list_index", "whowas", "ipcache", "listeners", "clients", "channels"
+  };
+
+  metrics_family(conn, "ircd_memory_objects", "gauge", "Objects allocated, as in STATS z", "pool");
+  for (unsigned int i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+    metrics_sample(conn, "pool", names[i], count[i]);
+  metrics_sample(conn, "pool", "list_replies", list_reply_count);
+
+  metrics_family(conn, "ircd_memory_bytes", "gauge", "Memory allocated, as in STATS z", "pool");
+  for (unsigned int i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+    metrics_sample(conn, "pool", names[i], size[i]);
+  metrics_sample(conn, "pool", "list_replies", list_reply_memory);
+}
+
+static void
+metrics_hash(struct MetricsConnection *conn)
+{
+  static const char *const names[] = { [HASH_TYPE_ID] = "id",
+                                       [HASH_TYPE_CLIENT] = "client",
+                                       [HASH_TYPE_CHANNEL] = "channel" };
+  unsigned int entries[3] = { 0 }, buckets[3] = { 0 }, max_chain[3] = { 0 };
+
+  for (unsigned int i = 0; i < HASHSIZE; ++i)
+  {
+    for (unsigned int type = HASH_TYPE_ID; type <= HASH_TYPE_CHANNEL; ++type)
+    {
+      unsigned int len = 0;
+
+      if (type == HASH_TYPE_CHANNEL)
+      {
+        for (const struct Channel *chptr = hash_get_bucket(type, i); chptr; chptr = chptr->hnextch)
+          ++len;
+      }
+      else
+      {
+        for (const struct Client *client_p = hash_get_bucket(type, i); client_p;
+             client_p = type == HASH_TYPE_ID ? client_p->idhnext : client_p->hnext)
+          ++len;
+      }
+
+      if (len == 0)
+        continue;
+
+      ++buckets[type];
+      entries[type] += len;
+
+      if (max_chain[type] < len)
+        max_chain[type] = len;
+    }
+  }
+
+  metrics_family(conn, "ircd_hash_entries", "gauge", "Entries in the hash tables", "table");
+  for (unsigned int type = HASH_TYPE_ID; type <= HASH_TYPE_CHANNEL; ++type)
+    metrics_sample(conn, "table", names[type], entries[type]);
+
+  metrics_family(conn, "ircd_hash_buckets_used", "gauge", "Non-empty buckets of the hash tables", "table");
+  for (unsigned int type = HASH_TYPE_ID; type <= HASH_TYPE_CHANNEL; ++type)
+    metrics_sample(conn, "table", names[type], buckets[type]);
+
+  metrics_family(conn, "ircd_hash_max_chain", "gauge", "Longest chain of the hash tables", "table");
+  for (unsigned int type = HASH_TYPE_ID; type <= HASH_TYPE_CHANNEL; ++type)
+    metrics_sample(conn, "table", names[type], max_chain[type]);
+
+  metrics_single(conn, "ircd_hash_buckets", "gauge", "Buckets per hash table", HASHSIZE);
+}
+
+static void
+metrics_classes(struct MetricsConnection *conn)
+{
+  dlink_node *node;
+
+  metrics_family(conn, "ircd_class_connections", "gauge", "Connections per class", "class");
+  DLINK_FOREACH(node, class_get_list()->head)
+  {
+    const struct ClassItem *const class = node->data;
+    metrics_sample(conn, "class", class->name, class->ref_count);
+  }
+
+  metrics_family(conn, "ircd_class_connections_max", "gauge", "Connection limit per class", "class");
+  DLINK_FOREACH(node, class_get_list()->head)
+  {
+    const struct ClassItem *const class = node->data;
+    metrics_sample(conn, "class", class->name, class->max_total);
+  }
+}
+
+static void
+metrics_links(struct MetricsConnection *conn)
+{
+  dlink_node *node;
+
+  metrics_family(conn, "ircd_link_sendq_bytes", "gauge", "Bytes queued for sending per server link", "server");
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    const struct Client *const target_p = node->data;
+    metrics_sample(conn, "server", target_p->name, dbuf_length(&target_p->connection->buf_sendq));
+  }
+
+  metrics_family(conn, "ircd_link_recvq_bytes", "gauge", "Bytes received but not parsed yet per server link", "server");
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    const struct Client *const target_p = node->data;
+    metrics_sample(conn, "server", target_p->name, dbuf_length(&target_p->connection->buf_recvq));
+  }
+
+  metrics_family(conn, "ircd_link_sent_bytes_total", "counter", "Bytes sent per server link", "server");
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    const struct Client *const target_p = node->data;
+    metrics_sample(conn, "server", target_p->name, target_p->connection->send.bytes);
+  }
+
+  metrics_family(conn, "ircd_link_received_bytes_total", "counter", "Bytes received per server link", "server");
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    const struct Client *const target_p = node->data;
+    metrics_sample(conn, "server", target_p->name, target_p->connection->recv.bytes);
+  }
+}
+
+static void
+metrics_loop(struct MetricsConnection *conn)
+{
+  const struct loop_stats *const s = loop_stats_get();
+
+  metrics_single(conn, "ircd_loop_laps_total", "counter", "Main loop iterations", s->laps);
+  metrics_single(conn, "ircd_loop_busy_microseconds_total", "counter",
+                 "Time the main loop has spent outside of waiting for I/O", s->busy_sum);
+  metrics_single(conn, "ircd_loop_busy_max_microseconds", "gauge",
+                 "Longest main loop iteration, not counting the wait for I/O", s->busy_max);
+
+  metrics_family(conn, "ircd_loop_phase_microseconds_total", "counter",
+                 "Time spent per main loop phase", "phase");
+  for (unsigned int i = 0; i < LOOP_PHASE_COUNT; ++i)
+    metrics_sample(conn, "phase", loop_stats_phase_name(i), s->phase[i].sum);
+
+  metrics_single(conn, "ircd_loop_polls_total", "counter", "comm_select() calls", s->polls);
+  metrics_single(conn, "ircd_loop_ready_total", "counter", "Descriptors reported ready", s->ready);
+  metrics_single(conn, "ircd_loop_flood_deferred_total", "counter",
+                 "Clients left with unparsed lines by flood control", s->flood_deferred);
+
+  metrics_single(conn, "ircd_log_dropped_total", "counter",
+                 "Log lines dropped because the log ring was full", log_dropped());
+  metrics_single(conn, "ircd_worker_jobs_total", "counter",
+                 "Jobs completed by worker threads", worker_completed());
+}
+
+/*! \brief Builds the reply for a connection. */
+static void
+metrics_build(struct MetricsConnection *conn)
+{
+  conn->size = 16384;
+  conn->buf = xcalloc(conn->size);
+
+  if (conn->format == METRICS_FORMAT_JSON)
+    metrics_printf(conn, "{\n");
+
+  metrics_server_stats(conn);
+  metrics_memory(conn);
+  metrics_hash(conn);
+  metrics_classes(conn);
+  metrics_links(conn);
+  metrics_loop(conn);
+
+  if (conn->format == METRICS_FORMAT_JSON)
+    metrics_printf(conn, "%s\n}\n", conn->labelled ? "}" : "");
+}
+
+static void
+metrics_close(struct MetricsConnection *conn)
+{
+  dlinkDelete(&conn->node, &metrics_connections);
+  fd_close(conn->fd);
+  xfree(conn->buf);
+  xfree(conn);
+}
+
+static void
+metrics_timeout(fde_t *F, void *data)
+{
+  metrics_close(data);
+}
+
+static void
+metrics_write(fde_t *F, void *data)
+{
+  struct MetricsConnection *const conn = data;
+
+  while (conn->sent < conn->len)
+  {
+    ssize_t ret = send(F->fd, conn->buf + conn->sent, conn->len - conn->sent, 0);
+
+    if (ret <= 0)
+    {
+      if (ret < 0 && comm_ignore_errno(errno))
+      {
+        comm_setselect(F, COMM_SELECT_WRITE, metrics_write, conn, 0);
+        return;
+      }
+
+      break;
+    }
+
+    conn->sent += ret;
+  }
+
+  metrics_close(conn);
+}
+
+/*! \brief Answers a request once it is complete.
+ * \return 1 if the request has been answered, 0 if more has to be read
+ */
+static int
+metrics_request(struct MetricsConnection *conn)
+{
+  const char *status = "200 OK";
+  char *eol = memchr(conn->request, '\n', conn->request_len);
+
+  if (eol == NULL)
+    return 0;
+
+  const int http = strncmp(conn->request, "GET ", 4) == 0;
+
+  /* Wait for the end of the HTTP headers, so nothing is left unread */
+  if (http && strstr(conn->request, "\r\n\r\n") == NULL && strstr(conn->request, "\n\n") == NULL)
+    return 0;
+
+  *eol = '\0';
+
+  if (http)
+  {
+    const char *path = conn->request + 4;
+
+    if (strncmp(path, "/metrics.json", 13) == 0 && (path[13] == ' ' || path[13] == '\r' || path[13] == '\0'))
+      conn->format = METRICS_FORMAT_JSON;
+    else if (strncmp(path, "/metrics", 8) || (path[8] != ' ' && path[8] != '\r' && path[8] != '\0'))
+      status = "404 Not Found";
+  }
+  else if (strncmp(conn->request, "json", 4) == 0)
+    conn->format = METRICS_FORMAT_JSON;
+
+  if (strcmp(status, "200 OK"))
+  {
+    conn->size = 64;
+    conn->buf = xcalloc(conn->size);
+  }
+  else
+    metrics_build(conn);
+
+  if (http)
+  {
+    char header[256];
+    const int len = snprintf(header, sizeof(header),
+                             "HTTP/1.0 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+                             "Connection: close\r\n\r\n", status,
+                             conn->format == METRICS_FORMAT_JSON ? "application/json" :
+                             "text/plain; version=0.0.4", conn->len);
+    char *buf = xcalloc(len + conn->len + 1);
+
+    memcpy(buf, header, len);
+    memcpy(buf + len, conn->buf, conn->len);
+    xfree(conn->buf);
+
+    conn->buf = buf;
+    conn->len += len;
+  }
+
+  metrics_write(conn->fd, conn);
+  return 1;
+}
+
+static void
+metrics_read(fde_t *F, void *data)
+{
+  struct MetricsConnection *const conn = data;
+
+  while (1)
+  {
+    /* Leave room for a terminating NUL */
+    ssize_t ret = recv(F->fd, conn->request + conn->request_len,
+                       sizeof(conn->request) - conn->request_len - 1, 0);
+
+    if (ret < 0 && comm_ignore_errno(errno))
+      break;
+
+    if (ret <= 0)
+    {
+      /* A request without a newline, such as from "nc -U -N", still gets an answer */
+      if (ret == 0 && conn->request_len < sizeof(conn->request) - 1)
+      {
+        conn->request[conn->request_len++] = '\n';
+        conn->request[conn->request_len] = '\0';
+
+        if (metrics_request(conn))
+          return;
+      }
+
+      metrics_close(conn);
+      return;
+    }
+
+    conn->request_len += ret;
+    conn->request[conn->request_len] = '\0';
+
+    if (metrics_request(conn))
+      return;
+
+    if (conn->request_len == sizeof(conn->request) - 1)
+    {
+      metrics_close(conn);
+      return;
+    }
+  }
+
+  comm_setselect(F, COMM_SELECT_READ, metrics_read, conn, 0);
+}
+
+static void
+metrics_accept(fde_t *F, void *data)
+{
+  for (unsigned int i = 0; i < LISTENER_ACCEPT_BUDGET; ++i)
+  {
+    struct irc_ssaddr addr;
+    const int fd = comm_accept(F->fd, &addr);
+
+    if (fd < 0)
+      break;
+
+    if (dlink_list_length(&metrics_connections) >= METRICS_MAX_CONNECTIONS)
+    {
+      close(fd);
+      continue;
+    }
+
+    struct MetricsConnection *conn = xcalloc(sizeof(*conn));
+    conn->fd = fd_open(fd, 1, "Metrics connection");
+    dlinkAdd(conn, &conn->node, &metrics_connections);
+
+    comm_settimeout(conn->fd, METRICS_TIMEOUT, metrics_timeout, conn);
+    metrics_read(conn->fd, conn);
+  }
+
+  comm_setselect(F, COMM_SELECT_READ, metrics_accept, NULL, 0);
+}
+
+/*! \brief Stops listening for metrics requests and removes the socket.
+ *         Connections already accepted are still answered.
+ */
+static void
+metrics_unlisten(void)
+{
+  if (metrics_fd == NULL)
+    return;
+
+  fd_close(metrics_fd);
+  metrics_fd = NULL;
+
+  unlink(metrics_path);
+  ilog(LOG_TYPE_IRCD, "No longer serving metrics on %s", metrics_path);
+
+  xfree(metrics_path);
+  metrics_path = NULL;
+}
+
+/*! \brief Makes the metrics listener match the configuration. Called after
+ *         the configuration has been read, on startup and on every rehash.
+ * \param path Path of the UNIX socket; NULL to not serve metrics
+ */
+void
+metrics_listen(const char *path)
+{
+  struct sockaddr_un addr;
+  struct stat sb;
+
+  if (metrics_fd && path && strcmp(path, metrics_path) == 0)
+    return;
+
+  metrics_unlisten();
+
+  if (path == NULL)
+    return;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+
+  if (strlcpy(addr.sun_path, path, sizeof(addr.sun_path)) >= sizeof(addr.sun_path))
+  {
+    ilog(LOG_TYPE_IRCD, "metrics_listen: socket path %s is too long", path);
+    return;
+  }
+
+  /* Only ever remove a socket, left behind by a previous run */
+  if (lstat(path, &sb) == 0)
+  {
+    if (!S_ISSOCK(sb.st_mode))
+    {
+      ilog(LOG_TYPE_IRCD, "metrics_listen: %s exists and is not a socket", path);
+      return;
+    }
+
+    unlink(path);
+  }
+
+  const int fd = comm_socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+  {
+    ilog(LOG_TYPE_IRCD, "metrics_listen: couldn't create socket: %s", strerror(errno));
+    return;
+  }
+
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) || listen(fd, METRICS_MAX_CONNECTIONS))
+  {
+    ilog(LOG_TYPE_IRCD, "metrics_listen: couldn't listen on %s: %s", path, strerror(errno));
+    close(fd);
+    return;
+  }
+
+  metrics_fd = fd_open(fd, 1, "Metrics listener");
+  metrics_path = xstrdup(path);
+
+  comm_setselect(metrics_fd, COMM_SELECT_READ, metrics_accept, NULL, 0);
+  ilog(LOG_TYPE_IRCD, "Serving metrics on %s", path);
+}
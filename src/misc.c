@@ -127,6 +127,29 @@ time_dissect(uintmax_t duration)
   return buf;
 }
 
+/*
+ * time_usec - format a duration given in microseconds as milliseconds
+ */
+const char *
+time_usec(uintmax_t usec, char *buf, size_t size)
+{
+  snprintf(buf, size, "%ju.%03jums", usec / 1000, usec % 1000);
+  return buf;
+}
+
+/*! \brief Returns a monotonic timestamp in microseconds. Unlike
+ *         SystemTime it is not cached per loop iteration, so it can
+ *         be used to time work that doesn't leave the main loop.
+ */
+uintmax_t
+clock_usec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
 void
 binary_to_hex(const unsigned char *bin, char *hex, unsigned int length)
 {
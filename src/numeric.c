@@ -43,12 +43,12 @@ static const char *const replies[] =
   /* 201 */  [RPL_TRACECONNECTING] = "Try. %s %s",
   /* 202 */  [RPL_TRACEHANDSHAKE] = "H.S. %s %s",
   /* 203 */  [RPL_TRACEUNKNOWN] = "???? %s %s (%s) %ju",
-  /* 204 */  [RPL_TRACEOPERATOR] = "Oper %s %s (%s) %ju %u",
-  /* 205 */  [RPL_TRACEUSER] = "User %s %s (%s) %ju %u",
+  /* 204 */  [RPL_TRACEOPERATOR] = "Oper %s %s (%s) %ju %u%s%s",
+  /* 205 */  [RPL_TRACEUSER] = "User %s %s (%s) %ju %u%s%s",
   /* 206 */  [RPL_TRACESERVER] = "Serv %s %uS %uC %s %s!%s@%s %ju",
   /* 208 */  [RPL_TRACENEWTYPE] = "<newtype> 0 %s",
   /* 209 */  [RPL_TRACECLASS] = "Class %s %u",
-  /* 211 */  [RPL_STATSLINKINFO] = "%s %u %u %ju %u %ju :%u %u %s",
+  /* 211 */  [RPL_STATSLINKINFO] = "%s %u %u %ju %u %ju :%u %u %s%s%s",
   /* 212 */  [RPL_STATSCOMMANDS] = "%s %u %ju :%u",
   /* 213 */  [RPL_STATSCLINE] = "%c %s %s %s %u %s",
   /* 215 */  [RPL_STATSILINE] = "%c %s * %s@%s %u %s",
@@ -56,7 +56,7 @@ static const char *const replies[] =
   /* 217 */  [RPL_STATSQLINE] = "%c %s :%s",
   /* 218 */  [RPL_STATSYLINE] = "%c %s %u %u %u %u %u %u %u/%u %u/%u %s",
   /* 219 */  [RPL_ENDOFSTATS] = "%c :End of /STATS report",
-  /* 220 */  [RPL_STATSPLINE] = "%c %d %s %d %s :%s",
+  /* 220 */  [RPL_STATSPLINE] = "%c %d %s %d %s :%s%s",
   /* 221 */  [RPL_UMODEIS] = "%s",
   /* 225 */  [RPL_STATSDLINE] = "%c %s :%s",
   /* 226 */  [RPL_STATSALINE] = "%s",
@@ -121,6 +121,7 @@ static const char *const replies[] =
   /* 351 */  [RPL_VERSION] = "%s(%s). %s :%s",
   /* 352 */  [RPL_WHOREPLY] = "%s %s %s %s %s %s :%u %s",
   /* 353 */  [RPL_NAMREPLY] = ":%s 353 %s %s %s :",
+  /* 354 */  [RPL_WHOSPCRPL] = "%s",
   /* 362 */  [RPL_CLOSING] = "%s :Closed. Status = %u",
   /* 363 */  [RPL_CLOSEEND] = "%u: Connections closed",
   /* 364 */  [RPL_LINKS] = "%s %s :%u %s",
@@ -215,7 +216,7 @@ static const char *const replies[] =
   /* 704 */  [RPL_HELPSTART] = "%s :%s",
   /* 705 */  [RPL_HELPTXT] = "%s :%s",
   /* 706 */  [RPL_ENDOFHELP] = "%s :End of /HELP.",
-  /* 709 */  [RPL_ETRACE] = "%s %s %s %s %s %s :%s",
+  /* 709 */  [RPL_ETRACE] = "%s %s %s %s %s %s%s%s :%s",
   /* 710 */  [RPL_KNOCK] = "%s %s!%s@%s :has asked for an invite.",
   /* 711 */  [RPL_KNOCKDLVR] = "%s :Your KNOCK has been delivered.",
   /* 712 */  [ERR_TOOMANYKNOCK] = "%s :Too many KNOCKs (%s).",
@@ -38,6 +38,9 @@
 #include "memory.h"
 #include "send.h"
 #include "misc.h"
+#include "loop_stats.h"
+#include "probe.h"
+#include "worker_io.h"
 
 
 enum { READBUF_SIZE = 16384 };
@@ -68,7 +71,9 @@ client_dopacket(struct Client *client_p, char *buffer, unsigned int length)
   client_p->connection->recv.bytes += length;
   me.connection->recv.bytes += length;
 
+  IRCD_PROBE3(parse__start, client_p->name, buffer, length);
   parse(client_p, buffer, buffer + length);
+  IRCD_PROBE0(parse__done);
 }
 
 /* extract_one_line()
@@ -78,7 +83,7 @@ client_dopacket(struct Client *client_p, char *buffer, unsigned int length)
  * output       - length of <buffer>
  * side effects - one line is copied and removed from the dbuf
  */
-static unsigned int
+unsigned int
 extract_one_line(struct dbuf_queue *qptr, char *buffer)
 {
   unsigned int line_bytes = 0, eol_bytes = 0;
@@ -215,8 +220,14 @@ parse_client_queued(struct Client *client_p)
        * and no 'bursts' will be permitted.
        */
       if (checkflood)
+      {
         if (client_p->connection->sent_parsed >= client_p->connection->allow_read)
+        {
+          if (dbuf_length(&client_p->connection->buf_recvq))
+            loop_stats_flood_deferred();
           break;
+        }
+      }
 
       dolen = extract_one_line(&client_p->connection->buf_recvq, readBuf);
 
@@ -281,6 +292,61 @@ flood_recalc(fde_t *F, void *data)
   }
 }
 
+/*
+ * client_read_queued - append data that has been read from a connection
+ * to its recvq and parse what is complete. Returns 0 if the client has
+ * gone away meanwhile.
+ */
+static int
+client_read_queued(struct Client *client_p, const char *buf, unsigned int length)
+{
+  dbuf_put(&client_p->connection->buf_recvq, buf, length);
+  accounting_peak(&client_p->connection->accounting.recvq_peak,
+                  dbuf_length(&client_p->connection->buf_recvq));
+
+  if (client_p->connection->lasttime < CurrentTime)
+    client_p->connection->lasttime = CurrentTime;
+
+  if (client_p->connection->lasttime > client_p->connection->since)
+    client_p->connection->since = CurrentTime;
+
+  DelFlag(client_p, FLAGS_PINGSENT);
+
+  /* Attempt to parse what we have */
+  parse_client_queued(client_p);
+
+  if (IsDefunct(client_p))
+    return 0;
+
+  /* Check to make sure we're not flooding */
+  if (!(IsServer(client_p) || IsHandshake(client_p) || IsConnecting(client_p)) &&
+      (dbuf_length(&client_p->connection->buf_recvq) >
+       get_recvq(&client_p->connection->confs)))
+  {
+    exit_client(client_p, "Excess Flood");
+    return 0;
+  }
+
+  return 1;
+}
+
+/*
+ * read_packet_received - process what a worker thread has read on
+ * behalf of a client. length is what the read returned; errno has
+ * been restored if it failed.
+ */
+void
+read_packet_received(struct Client *client_p, const char *buf, int length)
+{
+  if (IsDefunct(client_p))
+    return;
+
+  if (length <= 0)
+    dead_link_on_read(client_p, length);
+  else
+    client_read_queued(client_p, buf, length);
+}
+
 /*
  * read_packet - Read a 'packet' of data from a connection and process it.
  */
@@ -299,6 +365,10 @@ read_packet(fde_t *F, void *data)
   if (IsDefunct(client_p))
     return;
 
+  /* With worker threads, one of them does the reading from here on */
+  if (worker_io_attach(client_p))
+    return;
+
   /*
    * Read some data. We *used to* do anti-flood protection here, but
    * I personally think it makes the code too hairy to make sane.
@@ -329,30 +399,8 @@ read_packet(fde_t *F, void *data)
       return;
     }
 
-    dbuf_put(&client_p->connection->buf_recvq, readBuf, length);
-
-    if (client_p->connection->lasttime < CurrentTime)
-      client_p->connection->lasttime = CurrentTime;
-
-    if (client_p->connection->lasttime > client_p->connection->since)
-      client_p->connection->since = CurrentTime;
-
-    DelFlag(client_p, FLAGS_PINGSENT);
-
-    /* Attempt to parse what we have */
-    parse_client_queued(client_p);
-
-    if (IsDefunct(client_p))
+    if (!client_read_queued(client_p, readBuf, length))
       return;
-
-    /* Check to make sure we're not flooding */
-    if (!(IsServer(client_p) || IsHandshake(client_p) || IsConnecting(client_p)) &&
-        (dbuf_length(&client_p->connection->buf_recvq) >
-         get_recvq(&client_p->connection->confs)))
-    {
-      exit_client(client_p, "Excess Flood");
-      return;
-    }
   } while (length == sizeof(readBuf) || tls_isusing(&F->ssl));
 
   /* If we get here, we need to register for another COMM_SELECT_READ */
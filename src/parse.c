@@ -25,6 +25,7 @@
  */
 
 #include "stdinc.h"
+#include "accounting.h"
 #include "client.h"
 #include "parse.h"
 #include "channel.h"
@@ -205,6 +206,53 @@ parse_handle_numeric(unsigned int numeric, struct Client *source_p, int parc, ch
                           numeric, chptr->name, parv[2]);
 }
 
+/*! \brief Returns a timestamp in clock ticks for timing command
+ *         handlers. This is the time stamp counter where available,
+ *         which is cheap enough to be read around every command, and
+ *         nanoseconds otherwise.
+ */
+static inline uintmax_t
+message_clock(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static uintmax_t
+message_clock_nsec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Reference point for converting clock ticks into nanoseconds; taken when the first command is added */
+static uintmax_t message_clock_base_ticks;
+static uintmax_t message_clock_base_nsec;
+
+static void
+message_timing_record(struct MessageTiming *timing, uintmax_t ticks)
+{
+  unsigned int i = ticks ? 63 - __builtin_clzll(ticks) : 0;
+
+  if (i >= MESSAGE_TIMING_BUCKETS)
+    i = MESSAGE_TIMING_BUCKETS - 1;
+
+  ++timing->bucket[i];
+  ++timing->calls;
+  timing->total += ticks;
+
+  if (timing->max < ticks)
+    timing->max = ticks;
+}
+
 /* handle_command()
  *
  * inputs       - pointer to message block
@@ -219,7 +267,12 @@ static void
 parse_handle_command(struct Message *message, struct Client *source_p,
                      unsigned int i, char *para[])
 {
-  if (IsServer(source_p->from))
+  const enum message_origin origin = IsServer(source_p->from) ? MESSAGE_REMOTE : MESSAGE_LOCAL;
+  /* Clients are freed at the end of the loop iteration only, so this outlives the handler */
+  struct Connection *const connection = source_p->from->connection;
+  const uintmax_t queued = accounting_queued;
+
+  if (origin == MESSAGE_REMOTE)
     ++message->rcount;
 
   ++message->count;
@@ -227,8 +280,22 @@ parse_handle_command(struct Message *message, struct Client *source_p,
   /* Check right amount of parameters is passed... --is */
   if (i < message->args_min)
     sendto_one_numeric(source_p, &me, ERR_NEEDMOREPARAMS, message->cmd);
+  else if (GlobalSetOptions.cmdtiming == 0)
+  {
+    message->handlers[source_p->from->handler](source_p, i, para);
+    accounting_charge(&connection->accounting, 0, accounting_queued - queued);
+  }
   else
+  {
+    /* source_p may be gone once the handler returns */
+    const uintmax_t start = message_clock();
+
     message->handlers[source_p->from->handler](source_p, i, para);
+
+    const uintmax_t ticks = message_clock() - start;
+    message_timing_record(&message->timing[origin], ticks);
+    accounting_charge(&connection->accounting, ticks, accounting_queued - queued);
+  }
 }
 
 /*
@@ -564,6 +631,12 @@ mod_add_cmd(struct Message *msg)
   assert(msg);
   assert(msg->cmd);
 
+  if (message_clock_base_ticks == 0)
+  {
+    message_clock_base_ticks = message_clock();
+    message_clock_base_nsec = message_clock_nsec();
+  }
+
   /* Command already added? */
   if (msg_tree_parse(msg->cmd) == NULL)
     add_msg_element(&msg_tree, msg, msg->cmd);
@@ -597,15 +670,101 @@ find_command(const char *cmd)
   return msg_tree_parse(cmd);
 }
 
+/*! \brief Converts clock ticks into nanoseconds, using the rate the
+ *         clock has been running at since the first command was added.
+ */
+uintmax_t
+message_ticks_to_nsec(uintmax_t ticks)
+{
+  const uintmax_t elapsed_ticks = message_clock() - message_clock_base_ticks;
+  const uintmax_t elapsed_nsec = message_clock_nsec() - message_clock_base_nsec;
+
+  if (elapsed_ticks == 0)
+    return 0;
+
+  return (uintmax_t)((double)ticks * elapsed_nsec / elapsed_ticks);
+}
+
+/*! \brief Estimates a percentile of a command's handler run time.
+ * \param timing Timing of the command
+ * \param percent Percentile to compute, 1 to 100
+ * \return Upper bound of the bucket the percentile falls into, in
+ *         clock ticks, but never more than the longest run
+ */
+static uintmax_t
+message_timing_percentile(const struct MessageTiming *timing, unsigned int percent)
+{
+  const uintmax_t wanted = (timing->calls * percent + 99) / 100;
+  uintmax_t seen = 0;
+
+  for (unsigned int i = 0; i < MESSAGE_TIMING_BUCKETS; ++i)
+  {
+    seen += timing->bucket[i];
+
+    if (seen && seen >= wanted)
+    {
+      const uintmax_t bound = (uintmax_t)2 << i;
+      return bound < timing->max ? bound : timing->max;
+    }
+  }
+
+  return timing->max;
+}
+
+/*
+ * report_message_time - format a duration given in clock ticks
+ */
+static const char *
+report_message_time(uintmax_t ticks, char *buf, size_t size)
+{
+  const uintmax_t nsec = message_ticks_to_nsec(ticks);
+
+  snprintf(buf, size, "%ju.%03juus", nsec / 1000, nsec % 1000);
+  return buf;
+}
+
+static void
+report_message_timing(struct Client *source_p, const struct Message *msg)
+{
+  static const char *const origin_names[MESSAGE_ORIGIN_COUNT] =
+  {
+    [MESSAGE_LOCAL] = "local",
+    [MESSAGE_REMOTE] = "remote"
+  };
+
+  for (unsigned int i = 0; i < MESSAGE_ORIGIN_COUNT; ++i)
+  {
+    const struct MessageTiming *const timing = &msg->timing[i];
+    char total[32], avg[32], p50[32], p99[32], max[32];
+
+    if (timing->calls == 0)
+      continue;
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "m :%s %s calls %ju total %s avg %s p50 %s p99 %s max %s",
+                       msg->cmd, origin_names[i], timing->calls,
+                       report_message_time(timing->total, total, sizeof(total)),
+                       report_message_time(timing->total / timing->calls, avg, sizeof(avg)),
+                       report_message_time(message_timing_percentile(timing, 50), p50, sizeof(p50)),
+                       report_message_time(message_timing_percentile(timing, 99), p99, sizeof(p99)),
+                       report_message_time(timing->max, max, sizeof(max)));
+  }
+}
+
 static void
 recurse_report_messages(struct Client *source_p, const struct MessageTree *mtree)
 {
   if (mtree->msg)
+  {
     sendto_one_numeric(source_p, &me, RPL_STATSCOMMANDS,
                        mtree->msg->cmd,
                        mtree->msg->count, mtree->msg->bytes,
                        mtree->msg->rcount);
 
+    if (HasUMode(source_p, UMODE_OPER))
+      report_message_timing(source_p, mtree->msg);
+  }
+
   for (unsigned int i = 0; i < MAXPTRLEN; ++i)
     if (mtree->pointers[i])
       recurse_report_messages(source_p, mtree->pointers[i]);
@@ -615,7 +774,8 @@ recurse_report_messages(struct Client *source_p, const struct MessageTree *mtree
  *
  * inputs	- pointer to client to report to
  * output	- NONE
- * side effects	- client is shown list of commands
+ * side effects	- client is shown list of commands, and to opers
+ *		  also the time spent in their handlers
  */
 void
 report_messages(struct Client *source_p)
@@ -43,6 +43,10 @@
  * Apr 28, 2003 --cryogen and Dianora
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  /* recvmmsg() */
+#endif
+
 #include "stdinc.h"
 #include "list.h"
 #include "event.h"
@@ -55,6 +59,7 @@
 #include "res.h"
 #include "reslib.h"
 #include "memory.h"
+#include "probe.h"
 
 #if (CHAR_BIT != 8)
 #error this code needs to be able to address individual octets
@@ -64,6 +69,13 @@ static void res_readreply(fde_t *, void *);
 
 #define MAXPACKET      1024  /**< rfc says 512 but we expand names so ... */
 #define AR_TTL         600   /**< TTL in seconds for dns cache entries */
+#define AR_TTL_MIN     30    /**< Lower bound for the TTL of positive answers */
+#define AR_NEGATIVE_TTL 30   /**< TTL for NXDOMAIN, empty answers and timeouts */
+#define AR_CACHE_HASH_SIZE 0x1000  /**< Buckets in the answer cache */
+#define AR_CACHE_MEMORY (2 * 1024 * 1024)  /**< Memory cap of the answer cache */
+#define AR_REQUEST_HASH_SIZE 0x1000  /**< Buckets in the request id and context tables */
+#define AR_SOCKETS     4     /**< UDP sockets, each with its own random source port */
+#define AR_RECV_BATCH  32    /**< Replies read per recvmmsg() call */
 
 /*
  * RFC 1104/1105 wasn't very helpful about what these fields
@@ -78,7 +90,10 @@ static void res_readreply(fde_t *, void *);
 
 struct reslist
 {
-  dlink_node node;                           /**< Doubly linked list node. */
+  dlink_node node;                           /**< Node in the request id table. */
+  dlink_node ctx_node;                       /**< Node in the callback context table. */
+  unsigned int heap_index;                   /**< Position in the timeout heap. */
+  unsigned int sock;                         /**< Socket the query has been sent on. */
   unsigned int id;                           /**< Request ID (from request header). */
   char type;                                 /**< Current request type. */
   char retries;                              /**< Retry counter */
@@ -88,13 +103,289 @@ struct reslist
   struct irc_ssaddr addr;                    /**< Address for this request. */
   char name[RFC1035_MAX_DOMAIN_LENGTH + 1];  /**< Hostname for this request. */
   size_t namelength;                         /**< Actual hostname length. */
+  uintmax_t ttl;                             /**< TTL of the answer record. */
   dns_callback_fnc callback;                 /**< Callback function on completion. */
   void *callback_ctx;                        /**< Context pointer for callback. */
 };
 
-static fde_t *ResolverFileDescriptor;
-static dlink_list request_list;
+/*! \brief An answer, or the lack of one, kept in the resolver cache */
+struct dns_cache_entry
+{
+  dlink_node hnode;             /**< Hash bucket list node */
+  dlink_node lnode;             /**< LRU list node; most recently used first */
+  uint32_t hashv;               /**< Hash bucket of this entry */
+  char type;                    /**< T_A, T_AAAA or T_PTR */
+  unsigned int negative;        /**< The name didn't resolve */
+  uintmax_t expires;            /**< When this entry must no longer be used */
+  struct irc_ssaddr addr;       /**< Answer to A/AAAA queries */
+  char *name;                   /**< Answer to PTR queries */
+  size_t size;                  /**< Memory accounted for this entry */
+  char key[];                   /**< The name that has been queried */
+};
+
+static fde_t *ResolverFileDescriptor[AR_SOCKETS];
+static unsigned int resolver_socket_next;
+
+/* Outstanding requests, indexed by DNS id and by callback context */
+static dlink_list request_id_table[AR_REQUEST_HASH_SIZE];
+static dlink_list request_ctx_table[AR_REQUEST_HASH_SIZE];
+
+/* Binary min-heap of outstanding requests, ordered by when they time out */
+static struct reslist **request_heap;
+static unsigned int request_heap_len;
+static unsigned int request_heap_size;
+
+static dlink_list dns_cache_hash[AR_CACHE_HASH_SIZE];
+static dlink_list dns_cache_lru;
+static struct resolver_cache_stats dns_cache_stats;
+
+
+/*
+ * dns_cache_hash_key - case insensitive FNV-1a of type and name
+ */
+static uint32_t
+dns_cache_hash_key(char type, const char *key)
+{
+  uint32_t hashv = 2166136261U ^ (unsigned char)type;
+
+  hashv *= 16777619U;
+
+  for (; *key; ++key)
+  {
+    hashv ^= ToLower(*key);
+    hashv *= 16777619U;
+  }
+
+  return hashv & (AR_CACHE_HASH_SIZE - 1);
+}
+
+static void
+dns_cache_remove(struct dns_cache_entry *entry)
+{
+  dlinkDelete(&entry->hnode, &dns_cache_hash[entry->hashv]);
+  dlinkDelete(&entry->lnode, &dns_cache_lru);
+
+  dns_cache_stats.memory -= entry->size;
+  --dns_cache_stats.entries;
+
+  xfree(entry->name);
+  xfree(entry);
+}
+
+/*
+ * dns_cache_flush - drop all cached answers, e.g. since resolv.conf has changed
+ */
+static void
+dns_cache_flush(void)
+{
+  while (dns_cache_lru.head)
+    dns_cache_remove(dns_cache_lru.head->data);
+}
+
+/*
+ * dns_cache_find - look up a cached answer. Expired entries are dropped
+ * on the way. Updates the hit/miss statistics.
+ */
+static struct dns_cache_entry *
+dns_cache_find(char type, const char *key)
+{
+  const uint32_t hashv = dns_cache_hash_key(type, key);
+  dlink_node *node;
+
+  DLINK_FOREACH(node, dns_cache_hash[hashv].head)
+  {
+    struct dns_cache_entry *entry = node->data;
+
+    if (entry->type != type || irccmp(entry->key, key))
+      continue;
+
+    if (entry->expires <= CurrentTime)
+    {
+      dns_cache_remove(entry);
+      break;
+    }
+
+    /* Move to the head of the LRU list */
+    dlinkDelete(&entry->lnode, &dns_cache_lru);
+    dlinkAdd(entry, &entry->lnode, &dns_cache_lru);
+
+    if (entry->negative)
+      ++dns_cache_stats.negative_hits;
+    else
+      ++dns_cache_stats.hits;
+    return entry;
+  }
+
+  ++dns_cache_stats.misses;
+  return NULL;
+}
+
+/*
+ * dns_cache_add - remember an answer. For T_PTR, name is the answer and
+ * NULL for negative entries; for T_A/T_AAAA, addr is the answer and NULL
+ * for negative entries. Least recently used entries are evicted once the
+ * cache exceeds its memory cap.
+ */
+static void
+dns_cache_add(char type, const char *key, const struct irc_ssaddr *addr,
+              const char *name, uintmax_t ttl)
+{
+  const size_t keylen = strlen(key);
+  struct dns_cache_entry *entry;
+  dlink_node *node;
+
+  /* Replace whatever is there already */
+  const uint32_t hashv = dns_cache_hash_key(type, key);
+  DLINK_FOREACH(node, dns_cache_hash[hashv].head)
+  {
+    entry = node->data;
+
+    if (entry->type == type && irccmp(entry->key, key) == 0)
+    {
+      dns_cache_remove(entry);
+      break;
+    }
+  }
+
+  entry = xcalloc(sizeof(*entry) + keylen + 1);
+  entry->hashv = hashv;
+  entry->type = type;
+  entry->expires = CurrentTime + ttl;
+  entry->size = sizeof(*entry) + keylen + 1;
+  memcpy(entry->key, key, keylen + 1);
+
+  if (type == T_PTR)
+  {
+    if (name)
+    {
+      entry->name = xstrdup(name);
+      entry->size += strlen(name) + 1;
+    }
+    else
+      entry->negative = 1;
+  }
+  else if (addr)
+    memcpy(&entry->addr, addr, sizeof(entry->addr));
+  else
+    entry->negative = 1;
+
+  dlinkAdd(entry, &entry->hnode, &dns_cache_hash[hashv]);
+  dlinkAdd(entry, &entry->lnode, &dns_cache_lru);
+
+  dns_cache_stats.memory += entry->size;
+  ++dns_cache_stats.entries;
+
+  while (dns_cache_stats.memory > AR_CACHE_MEMORY && dns_cache_lru.tail != &entry->lnode)
+  {
+    dns_cache_remove(dns_cache_lru.tail->data);
+    ++dns_cache_stats.evictions;
+  }
+}
+
+/*
+ * resolver_get_cache_stats - report size and efficiency of the answer cache
+ */
+void
+resolver_get_cache_stats(struct resolver_cache_stats *stats)
+{
+  *stats = dns_cache_stats;
+}
+
+
+static uint32_t
+request_ctx_hash(const void *ctx)
+{
+  const uintptr_t v = (uintptr_t)ctx;
+
+  /* Callback contexts are heap pointers; the low bits carry no information */
+  return ((v >> 4) ^ (v >> 16)) & (AR_REQUEST_HASH_SIZE - 1);
+}
+
+static uintmax_t
+request_expires(const struct reslist *request)
+{
+  return request->sentat + request->timeout;
+}
+
+static void
+request_heap_set(unsigned int i, struct reslist *request)
+{
+  request_heap[i] = request;
+  request->heap_index = i;
+}
+
+static void
+request_heap_up(unsigned int i)
+{
+  struct reslist *const request = request_heap[i];
+
+  while (i > 0)
+  {
+    const unsigned int parent = (i - 1) / 2;
+
+    if (request_expires(request_heap[parent]) <= request_expires(request))
+      break;
+
+    request_heap_set(i, request_heap[parent]);
+    i = parent;
+  }
+
+  request_heap_set(i, request);
+}
+
+static void
+request_heap_down(unsigned int i)
+{
+  struct reslist *const request = request_heap[i];
+
+  while (1)
+  {
+    unsigned int child = 2 * i + 1;
+
+    if (child >= request_heap_len)
+      break;
+
+    if (child + 1 < request_heap_len &&
+        request_expires(request_heap[child + 1]) < request_expires(request_heap[child]))
+      ++child;
+
+    if (request_expires(request) <= request_expires(request_heap[child]))
+      break;
+
+    request_heap_set(i, request_heap[child]);
+    i = child;
+  }
 
+  request_heap_set(i, request);
+}
+
+static void
+request_heap_add(struct reslist *request)
+{
+  if (request_heap_len == request_heap_size)
+  {
+    request_heap_size = request_heap_size ? request_heap_size * 2 : 64;
+    request_heap = xrealloc(request_heap, request_heap_size * sizeof(*request_heap));
+  }
+
+  request_heap_set(request_heap_len, request);
+  request_heap_up(request_heap_len++);
+}
+
+static void
+request_heap_delete(struct reslist *request)
+{
+  const unsigned int i = request->heap_index;
+
+  assert(request_heap[i] == request);
+
+  if (i != --request_heap_len)
+  {
+    request_heap_set(i, request_heap[request_heap_len]);
+    request_heap_down(i);
+    request_heap_up(request_heap[i]->heap_index);
+  }
+}
 
 /*
  * rem_request - remove a request from the list.
@@ -104,7 +395,11 @@ static dlink_list request_list;
 static void
 rem_request(struct reslist *request)
 {
-  dlinkDelete(&request->node, &request_list);
+  if (request->sends)
+    dlinkDelete(&request->node, &request_id_table[request->id & (AR_REQUEST_HASH_SIZE - 1)]);
+
+  dlinkDelete(&request->ctx_node, &request_ctx_table[request_ctx_hash(request->callback_ctx)]);
+  request_heap_delete(request);
   xfree(request);
 }
 
@@ -122,7 +417,8 @@ make_request(dns_callback_fnc callback, void *ctx)
   request->callback = callback;
   request->callback_ctx = ctx;
 
-  dlinkAdd(request, &request->node, &request_list);
+  dlinkAdd(request, &request->ctx_node, &request_ctx_table[request_ctx_hash(ctx)]);
+  request_heap_add(request);
   return request;
 }
 
@@ -177,38 +473,48 @@ res_ourserver(const struct irc_ssaddr *inp)
 
 /*
  * start_resolver - do everything we need to read the resolv.conf file
- * and initialize the resolver file descriptor if needed
+ * and initialize the resolver file descriptors if needed
+ *
+ * Every socket is bound to its own ephemeral port by the kernel, so
+ * spreading queries over them makes the source port a reply has to
+ * match a lot harder to guess than with a single long-lived socket.
  */
 static void
 start_resolver(void)
 {
   irc_res_init();
 
-  if (ResolverFileDescriptor == NULL)
+  for (unsigned int i = 0; i < AR_SOCKETS; ++i)
   {
+    if (ResolverFileDescriptor[i])
+      continue;
+
     int fd = comm_socket(irc_nsaddr_list[0].ss.ss_family, SOCK_DGRAM, 0);
     if (fd == -1)
       return;
 
-    ResolverFileDescriptor = fd_open(fd, 1, "UDP resolver socket");
-
-    /* At the moment, the resolver FD data is global .. */
-    comm_setselect(ResolverFileDescriptor, COMM_SELECT_READ, res_readreply, NULL, 0);
+    ResolverFileDescriptor[i] = fd_open(fd, 1, "UDP resolver socket");
+    comm_setselect(ResolverFileDescriptor[i], COMM_SELECT_READ, res_readreply, NULL, 0);
   }
 }
 
 /*
- * restart_resolver - reread resolv.conf, reopen socket
+ * restart_resolver - reread resolv.conf, reopen sockets
  */
 void
 restart_resolver(void)
 {
-  if (ResolverFileDescriptor)
+  for (unsigned int i = 0; i < AR_SOCKETS; ++i)
   {
-    fd_close(ResolverFileDescriptor);
-    ResolverFileDescriptor = NULL;
+    if (ResolverFileDescriptor[i])
+    {
+      fd_close(ResolverFileDescriptor[i]);
+      ResolverFileDescriptor[i] = NULL;
+    }
   }
 
+  /* Answers from the previous set of nameservers may no longer apply */
+  dns_cache_flush();
   start_resolver();
 }
 
@@ -221,7 +527,7 @@ delete_resolver_queries(const void *vptr)
 {
   dlink_node *node, *node_next;
 
-  DLINK_FOREACH_SAFE(node, node_next, request_list.head)
+  DLINK_FOREACH_SAFE(node, node_next, request_ctx_table[request_ctx_hash(vptr)].head)
   {
     struct reslist *request = node->data;
 
@@ -238,7 +544,7 @@ delete_resolver_queries(const void *vptr)
  * nameservers or -1 if no successful sends.
  */
 static void
-send_res_msg(const unsigned char *msg, int len, unsigned int rcount)
+send_res_msg(const fde_t *F, const unsigned char *msg, int len, unsigned int rcount)
 {
   unsigned int max_queries = IRCD_MIN(irc_nscount, rcount);
 
@@ -249,7 +555,7 @@ send_res_msg(const unsigned char *msg, int len, unsigned int rcount)
     max_queries = 1;
 
   for (unsigned int i = 0; i < max_queries; ++i)
-    sendto(ResolverFileDescriptor->fd, msg, len, 0,
+    sendto(F->fd, msg, len, 0,
            (struct sockaddr *)&irc_nsaddr_list[i], irc_nsaddr_list[i].ss_len);
 }
 
@@ -261,7 +567,7 @@ find_id(unsigned int id)
 {
   dlink_node *node;
 
-  DLINK_FOREACH(node, request_list.head)
+  DLINK_FOREACH(node, request_id_table[id & (AR_REQUEST_HASH_SIZE - 1)].head)
   {
     struct reslist *request = node->data;
 
@@ -286,6 +592,21 @@ query_name(const char *name, int query_class, int type, struct reslist *request)
   if ((request_len = irc_res_mkquery(name, query_class, type, buf, sizeof(buf))) > 0)
   {
     HEADER *header = (HEADER *)buf;
+    fde_t *F = NULL;
+
+    /* Round-robin over the sockets that could be opened */
+    for (unsigned int i = 0; i < AR_SOCKETS && F == NULL; ++i)
+    {
+      request->sock = resolver_socket_next++ % AR_SOCKETS;
+      F = ResolverFileDescriptor[request->sock];
+    }
+
+    if (F == NULL)
+      return;
+
+    /* A resent query gets a new id */
+    if (request->sends)
+      dlinkDelete(&request->node, &request_id_table[request->id & (AR_REQUEST_HASH_SIZE - 1)]);
 
     /*
      * Generate an unique id.
@@ -299,8 +620,10 @@ query_name(const char *name, int query_class, int type, struct reslist *request)
 
     request->id = header->id;
     ++request->sends;
+    dlinkAdd(request, &request->node, &request_id_table[request->id & (AR_REQUEST_HASH_SIZE - 1)]);
 
-    send_res_msg(buf, request_len, request->sends);
+    IRCD_PROBE3(dns__query, request->id, type, name);
+    send_res_msg(F, buf, request_len, request->sends);
   }
 }
 
@@ -317,6 +640,17 @@ do_query_name(dns_callback_fnc callback, void *ctx, const char *name,
 
   if (request == NULL)
   {
+    const struct dns_cache_entry *entry = dns_cache_find(type, host_name);
+
+    if (entry)
+    {
+      if (entry->negative)
+        callback(ctx, NULL, NULL, 0);
+      else
+        callback(ctx, &entry->addr, host_name, strlen(host_name));
+      return;
+    }
+
     request = make_request(callback, ctx);
     request->type = type;
     request->namelength = strlcpy(request->name, host_name, sizeof(request->name));
@@ -327,21 +661,19 @@ do_query_name(dns_callback_fnc callback, void *ctx, const char *name,
 }
 
 /*
- * do_query_number - Use this to do reverse IP# lookups.
+ * res_reverse_name - build the in-addr.arpa/ip6.arpa name of an address
  */
 static void
-do_query_number(dns_callback_fnc callback, void *ctx,
-                const struct irc_ssaddr *addr,
-                struct reslist *request)
+res_reverse_name(const struct irc_ssaddr *addr, char *ipbuf, size_t size)
 {
-  char ipbuf[128] = "";
+  ipbuf[0] = '\0';
 
   if (addr->ss.ss_family == AF_INET)
   {
     const struct sockaddr_in *v4 = (const struct sockaddr_in *)addr;
     const unsigned char *cp = (const unsigned char *)&v4->sin_addr.s_addr;
 
-    snprintf(ipbuf, sizeof(ipbuf), "%u.%u.%u.%u.in-addr.arpa.",
+    snprintf(ipbuf, size, "%u.%u.%u.%u.in-addr.arpa.",
              (unsigned int)(cp[3]), (unsigned int)(cp[2]),
              (unsigned int)(cp[1]), (unsigned int)(cp[0]));
   }
@@ -350,7 +682,7 @@ do_query_number(dns_callback_fnc callback, void *ctx,
     const struct sockaddr_in6 *v6 = (const struct sockaddr_in6 *)addr;
     const unsigned char *cp = (const unsigned char *)&v6->sin6_addr.s6_addr;
 
-    snprintf(ipbuf, sizeof(ipbuf),
+    snprintf(ipbuf, size,
              "%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x."
              "%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.ip6.arpa.",
              (unsigned int)(cp[15] & 0xf), (unsigned int)(cp[15] >> 4),
@@ -370,9 +702,35 @@ do_query_number(dns_callback_fnc callback, void *ctx,
              (unsigned int)(cp[1] & 0xf), (unsigned int)(cp[1] >> 4),
              (unsigned int)(cp[0] & 0xf), (unsigned int)(cp[0] >> 4));
   }
+}
+
+/*
+ * do_query_number - Use this to do reverse IP# lookups.
+ */
+static void
+do_query_number(dns_callback_fnc callback, void *ctx,
+                const struct irc_ssaddr *addr,
+                struct reslist *request)
+{
+  char ipbuf[128];
+
+  res_reverse_name(addr, ipbuf, sizeof(ipbuf));
 
   if (request == NULL)
   {
+    const struct dns_cache_entry *entry = dns_cache_find(T_PTR, ipbuf);
+
+    if (entry)
+    {
+      if (entry->negative)
+        callback(ctx, NULL, NULL, 0);
+      else if (addr->ss.ss_family == AF_INET6)
+        gethost_byname_type(callback, ctx, entry->name, T_AAAA);
+      else
+        gethost_byname_type(callback, ctx, entry->name, T_A);
+      return;
+    }
+
     request = make_request(callback, ctx);
     request->type = T_PTR;
     memcpy(&request->addr, addr, sizeof(struct irc_ssaddr));
@@ -418,6 +776,30 @@ resend_query(struct reslist *request)
   }
 }
 
+/*
+ * res_cache_answer - remember the outcome of a request so the next
+ * query for the same name or address doesn't hit the network. Negative
+ * answers and timeouts are only kept for a short while.
+ */
+static void
+res_cache_answer(const struct reslist *request, int positive)
+{
+  char ipbuf[128];
+  const char *key = request->name;
+
+  if (request->type == T_PTR)
+  {
+    res_reverse_name(&request->addr, ipbuf, sizeof(ipbuf));
+    key = ipbuf;
+  }
+
+  if (positive == 0)
+    dns_cache_add(request->type, key, NULL, NULL, AR_NEGATIVE_TTL);
+  else
+    dns_cache_add(request->type, key, &request->addr, request->name,
+                  IRCD_MAX(IRCD_MIN(request->ttl, AR_TTL), AR_TTL_MIN));
+}
+
 /*
  * proc_answer - process name server reply
  */
@@ -467,6 +849,7 @@ proc_answer(struct reslist *request, HEADER *header, unsigned char *buf, unsigne
     type = irc_ns_get16(current);
     current += TYPE_SIZE;
     current += CLASS_SIZE;
+    request->ttl = irc_ns_get32(current);
     current += TTL_SIZE;
     rd_length = irc_ns_get16(current);
     current += RDLENGTH_SIZE;
@@ -533,141 +916,185 @@ proc_answer(struct reslist *request, HEADER *header, unsigned char *buf, unsigne
 }
 
 /*
- * res_readreply - read a dns reply from the nameserver and process it.
+ * res_process_reply - process a single dns reply from the nameserver.
  */
 static void
-res_readreply(fde_t *F, void *data)
+res_process_reply(const fde_t *F, unsigned char *buf, ssize_t rc,
+                  const struct irc_ssaddr *lsin)
 {
-  unsigned char buf[sizeof(HEADER) + MAXPACKET];
-  ssize_t rc = 0;
-  socklen_t len = sizeof(struct irc_ssaddr);
-  struct irc_ssaddr lsin;
+  if (rc <= (ssize_t)sizeof(HEADER))
+    return;
 
-  while ((rc = recvfrom(F->fd, buf, sizeof(buf), 0, (struct sockaddr *)&lsin, &len)) != -1)
-  {
-    if (rc <= (ssize_t)sizeof(HEADER))
-      continue;
+  /*
+   * Check against possibly fake replies
+   */
+  if (res_ourserver(lsin) == 0)
+    return;
 
-    /*
-     * Check against possibly fake replies
-     */
-    if (res_ourserver(&lsin) == 0)
-      continue;
+  /*
+   * Convert DNS reply reader from Network byte order to CPU byte order.
+   */
+  HEADER *header = (HEADER *)buf;
+  header->ancount = ntohs(header->ancount);
+  header->qdcount = ntohs(header->qdcount);
+  header->nscount = ntohs(header->nscount);
+  header->arcount = ntohs(header->arcount);
 
-    /*
-     * Convert DNS reply reader from Network byte order to CPU byte order.
-     */
-    HEADER *header = (HEADER *)buf;
-    header->ancount = ntohs(header->ancount);
-    header->qdcount = ntohs(header->qdcount);
-    header->nscount = ntohs(header->nscount);
-    header->arcount = ntohs(header->arcount);
+  /*
+   * Response for an id which we have already received an answer for
+   * just ignore this response.
+   */
+  struct reslist *request;
+  if ((request = find_id(header->id)) == NULL)
+    return;
+
+  /* Has to arrive on the socket, and thus the port, it has been sent from */
+  if (ResolverFileDescriptor[request->sock] != F)
+    return;
+
+  /* Probe arguments can't be bit-fields; <sys/sdt.h> takes their size and type */
+  const unsigned int rcode = header->rcode, ancount = header->ancount;
+  IRCD_PROBE3(dns__reply, request->id, rcode, ancount);
 
+  if (rcode != NO_ERRORS || ancount == 0)
+  {
     /*
-     * Response for an id which we have already received an answer for
-     * just ignore this response.
+     * If a bad error was returned, stop here and don't send
+     * any more (no retries granted).
      */
-    struct reslist *request;
-    if ((request = find_id(header->id)) == NULL)
-      continue;
+    if (rcode == NO_ERRORS || rcode == NXDOMAIN)
+      res_cache_answer(request, 0);
 
-    if (header->rcode != NO_ERRORS || header->ancount == 0)
+    (*request->callback)(request->callback_ctx, NULL, NULL, 0);
+    rem_request(request);
+    return;
+  }
+
+  /*
+   * If this fails there was an error decoding the received packet.
+   * We only give it one shot. If it fails, just leave the client
+   * unresolved.
+   */
+  if (proc_answer(request, header, buf, buf + rc) == 0)
+  {
+    (*request->callback)(request->callback_ctx, NULL, NULL, 0);
+    rem_request(request);
+    return;
+  }
+
+  if (request->type == T_PTR)
+  {
+    if (request->namelength == 0)
     {
       /*
-       * If a bad error was returned, stop here and don't send
-       * any more (no retries granted).
+       * Got a PTR response with no name, something bogus is happening
+       * don't bother trying again, the client address doesn't resolve
        */
+      res_cache_answer(request, 0);
       (*request->callback)(request->callback_ctx, NULL, NULL, 0);
       rem_request(request);
-      continue;
+      return;
     }
 
+    res_cache_answer(request, 1);
+
     /*
-     * If this fails there was an error decoding the received packet.
-     * We only give it one shot. If it fails, just leave the client
-     * unresolved.
+     * Lookup the 'authoritative' name that we were given for the ip#.
      */
-    if (proc_answer(request, header, buf, buf + rc) == 0)
-    {
-      (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-      rem_request(request);
-      continue;
-    }
-
-    if (request->type == T_PTR)
-    {
-      if (request->namelength == 0)
-      {
-        /*
-         * Got a PTR response with no name, something bogus is happening
-         * don't bother trying again, the client address doesn't resolve
-         */
-        (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-        rem_request(request);
-        continue;
-      }
+    if (request->addr.ss.ss_family == AF_INET6)
+      gethost_byname_type(request->callback, request->callback_ctx, request->name, T_AAAA);
+    else
+      gethost_byname_type(request->callback, request->callback_ctx, request->name, T_A);
 
-      /*
-       * Lookup the 'authoritative' name that we were given for the ip#.
-       */
-      if (request->addr.ss.ss_family == AF_INET6)
-        gethost_byname_type(request->callback, request->callback_ctx, request->name, T_AAAA);
-      else
-        gethost_byname_type(request->callback, request->callback_ctx, request->name, T_A);
+    rem_request(request);
+  }
+  else
+  {
+    /*
+     * Got a name and address response, client resolved
+     */
+    res_cache_answer(request, 1);
+    (*request->callback)(request->callback_ctx, &request->addr, request->name, request->namelength);
+    rem_request(request);
+  }
+}
 
-      rem_request(request);
-    }
-    else
+/*
+ * res_readreply - read dns replies from the nameserver and process them.
+ */
+static void
+res_readreply(fde_t *F, void *data)
+{
+#ifdef HAVE_RECVMMSG
+  static unsigned char buf[AR_RECV_BATCH][sizeof(HEADER) + MAXPACKET];
+  static struct irc_ssaddr lsin[AR_RECV_BATCH];
+  struct mmsghdr msgs[AR_RECV_BATCH];
+  struct iovec iov[AR_RECV_BATCH];
+  int n;
+
+  do
+  {
+    for (unsigned int i = 0; i < AR_RECV_BATCH; ++i)
     {
-      /*
-       * Got a name and address response, client resolved
-       */
-      (*request->callback)(request->callback_ctx, &request->addr, request->name, request->namelength);
-      rem_request(request);
+      iov[i].iov_base = buf[i];
+      iov[i].iov_len = sizeof(buf[i]);
+
+      memset(&msgs[i], 0, sizeof(msgs[i]));
+      msgs[i].msg_hdr.msg_name = &lsin[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(lsin[i]);
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
     }
 
-    continue;
-  }
+    n = recvmmsg(F->fd, msgs, AR_RECV_BATCH, MSG_DONTWAIT, NULL);
+
+    for (int i = 0; i < n; ++i)
+      res_process_reply(F, buf[i], msgs[i].msg_len, &lsin[i]);
+  } while (n == AR_RECV_BATCH);
+#else
+  unsigned char buf[sizeof(HEADER) + MAXPACKET];
+  ssize_t rc = 0;
+  socklen_t len = sizeof(struct irc_ssaddr);
+  struct irc_ssaddr lsin;
+
+  while ((rc = recvfrom(F->fd, buf, sizeof(buf), 0, (struct sockaddr *)&lsin, &len)) != -1)
+    res_process_reply(F, buf, rc, &lsin);
+#endif
 
   comm_setselect(F, COMM_SELECT_READ, res_readreply, NULL, 0);
 }
 
 /*
  * timeout_query_list - Remove queries from the list which have been
- * there too long without being resolved.
+ * there too long without being resolved. The heap keeps the request
+ * that expires first on top, so only expired ones are ever looked at.
  */
 static uintmax_t
 timeout_query_list(void)
 {
-  dlink_node *node, *node_next;
-  uintmax_t next_time = 0;
-
-  DLINK_FOREACH_SAFE(node, node_next, request_list.head)
+  while (request_heap_len)
   {
-    struct reslist *request = node->data;
-    uintmax_t timeout = request->sentat + request->timeout;
+    struct reslist *request = request_heap[0];
 
-    if (CurrentTime >= timeout)
+    if (CurrentTime < request_expires(request))
+      return request_expires(request);
+
+    if (--request->retries <= 0)
     {
-      if (--request->retries <= 0)
-      {
-        (*request->callback)(request->callback_ctx, NULL, NULL, 0);
-        rem_request(request);
-        continue;
-      }
-      else
-      {
-        request->sentat = CurrentTime;
-        request->timeout += request->timeout;
-        resend_query(request);
-      }
+      res_cache_answer(request, 0);
+      (*request->callback)(request->callback_ctx, NULL, NULL, 0);
+      rem_request(request);
+    }
+    else
+    {
+      request->sentat = CurrentTime;
+      request->timeout += request->timeout;
+      request_heap_down(request->heap_index);
+      resend_query(request);
     }
-
-    if (next_time == 0 || timeout < next_time)
-      next_time = timeout;
   }
 
-  return (next_time > CurrentTime) ? next_time : (CurrentTime + AR_TTL);
+  return CurrentTime + AR_TTL;
 }
 
 /*
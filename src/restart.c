@@ -67,6 +67,7 @@ server_die(const char *message, int action)
   close_fds();
 
   unlink(pidFileName);
+  log_flush();
 
   if (action == SERVER_RESTART)
   {
@@ -24,11 +24,17 @@
  * \version $Id$
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  /* accept4() */
+#endif
+
 #include "stdinc.h"
 #include <netinet/in_systm.h>
 #include <netinet/ip.h>
 #include <netinet/tcp.h>
 #include "list.h"
+#include "admission.h"
+#include "misc.h"
 #include "fdlist.h"
 #include "s_bsd.h"
 #include "client.h"
@@ -47,6 +53,8 @@
 #include "send.h"
 #include "memory.h"
 #include "user.h"
+#include "worker.h"
+#include "probe.h"
 
 
 static const char *const comm_err_str[] =
@@ -59,6 +67,25 @@ static const char *const comm_err_str[] =
   [COMM_ERROR] = "Comm Error"
 };
 
+/*! \brief A single tls_handshake() call that is carried out by a worker thread */
+struct tls_handshake_job
+{
+  struct worker_job job;
+  fde_t *F;  /**< Descriptor the handshake belongs to; kept open while in flight */
+  int fd;  /**< Copy of F->fd */
+  tls_data_t ssl;  /**< TLS state; owned by the job while it is in flight */
+  tls_role_t role;
+  tls_handshake_status_t status;
+  const char *errstr;
+  unsigned int cancelled;  /**< fd_close() has been called meanwhile */
+  void (*callback)(fde_t *, tls_handshake_status_t, const char *, void *);
+  void *data;
+};
+
+static unsigned int tls_handshake_pending;
+
+static void ssl_handshake(fde_t *, void *);
+
 static void comm_connect_callback(fde_t *, int);
 static void comm_connect_timeout(fde_t *, void *);
 static void comm_connect_dns_callback(void *, const struct irc_ssaddr *, const char *, size_t);
@@ -123,7 +150,7 @@ report_error(int level, const char *text, const char *who, int error)
  * Set the socket non-blocking, and other wonderful bits.
  */
 static void
-setup_socket(int fd)
+setup_socket_options(int fd)
 {
   int opt = 1;
 
@@ -133,16 +160,159 @@ setup_socket(int fd)
   opt = IPTOS_LOWDELAY;
   setsockopt(fd, IPPROTO_IP, IP_TOS, &opt, sizeof(opt));
 #endif
+}
 
+static void
+setup_socket(int fd)
+{
+  setup_socket_options(fd);
   fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
 }
 
 /*
- * ssl_handshake - let OpenSSL initialize the protocol. Register for
- * read/write events if necessary.
+ * comm_tls_handshake_run - worker side of comm_tls_handshake(). Must not
+ * touch anything but the job itself.
  */
 static void
-ssl_handshake(fde_t *F, void *data)
+comm_tls_handshake_run(struct worker_job *job)
+{
+  struct tls_handshake_job *hs = job->data;
+
+  hs->status = tls_handshake(&hs->ssl, hs->role, &hs->errstr);
+}
+
+/*
+ * comm_tls_check_ktls - remember whether the kernel took over record
+ * encryption. send_queued_write() uses plain send() in that case.
+ */
+static void
+comm_tls_check_ktls(fde_t *F)
+{
+  F->flags.ktls_send = tls_ktls_send(&F->ssl) != 0;
+  F->flags.ktls_recv = tls_ktls_recv(&F->ssl) != 0;
+}
+
+/*
+ * comm_tls_handshake_done - called from within the main loop once a worker
+ * has finished the handshake step. Hands the TLS state back to the fde and
+ * continues where comm_tls_handshake() left off.
+ */
+static void
+comm_tls_handshake_done(struct worker_job *job)
+{
+  struct tls_handshake_job *hs = job->data;
+  fde_t *F = hs->F;
+
+  --tls_handshake_pending;
+
+  F->ssl = hs->ssl;
+
+  if (hs->cancelled)
+  {
+    /* fd_close() has been called in the meantime; finish what it skipped */
+    tls_shutdown(&F->ssl);
+    fd_close(F);
+  }
+  else
+  {
+    assert(F->handshake == hs);
+
+    F->handshake = NULL;
+
+    if (hs->status == TLS_HANDSHAKE_DONE)
+      comm_tls_check_ktls(F);
+    if (hs->status == TLS_HANDSHAKE_DONE || hs->status == TLS_HANDSHAKE_ERROR)
+      IRCD_PROBE3(tls__done, hs->fd, hs->role, hs->status);
+
+    hs->callback(F, hs->status, hs->errstr, hs->data);
+  }
+
+  xfree(hs);
+}
+
+/*
+ * comm_tls_handshake - performs the next step of a TLS handshake on a worker
+ * thread if there's one available, or inline otherwise. In either case,
+ * callback is invoked from within the main loop with the result of
+ * tls_handshake(). While the step is in flight, the TLS state is detached
+ * from the fde so nothing else in the main loop can touch it.
+ */
+void
+comm_tls_handshake(fde_t *F, tls_role_t role,
+                   void (*callback)(fde_t *, tls_handshake_status_t, const char *, void *), void *data)
+{
+  const char *errstr = NULL;
+
+  if (F->handshake)
+    return;  /* Already in flight; callback will be called once it's done */
+
+  if (worker_count())
+  {
+    struct tls_handshake_job *hs = xcalloc(sizeof(*hs));
+
+    hs->job.run = comm_tls_handshake_run;
+    hs->job.done = comm_tls_handshake_done;
+    hs->job.data = hs;
+    hs->F = F;
+    hs->fd = F->fd;
+    hs->ssl = F->ssl;
+    hs->role = role;
+    hs->callback = callback;
+    hs->data = data;
+
+    if (worker_submit(&hs->job))
+    {
+      memset(&F->ssl, 0, sizeof(F->ssl));
+      F->handshake = hs;
+
+      ++tls_handshake_pending;
+      ++ServerStats.is_tlsoff;
+      return;
+    }
+
+    xfree(hs);
+  }
+
+  tls_handshake_status_t ret = tls_handshake(&F->ssl, role, &errstr);
+  if (ret == TLS_HANDSHAKE_DONE)
+    comm_tls_check_ktls(F);
+  if (ret == TLS_HANDSHAKE_DONE || ret == TLS_HANDSHAKE_ERROR)
+    IRCD_PROBE3(tls__done, F->fd, role, ret);
+
+  callback(F, ret, errstr, data);
+}
+
+/*
+ * comm_tls_handshake_cancel - called by fd_close() if a handshake step is
+ * still in flight. The worker keeps using the descriptor and the TLS state
+ * until it's done; both are released in comm_tls_handshake_done(), which
+ * closes the fde for real.
+ */
+void
+comm_tls_handshake_cancel(fde_t *F)
+{
+  assert(F->handshake);
+
+  F->handshake->cancelled = 1;
+  F->handshake = NULL;
+}
+
+/*
+ * comm_tls_handshake_pending - returns the number of handshake steps
+ * that are currently queued on or being run by worker threads.
+ */
+unsigned int
+comm_tls_handshake_pending(void)
+{
+  return tls_handshake_pending;
+}
+
+/*
+ * ssl_handshake_done - continue or finish the handshake of an incoming
+ * connection. Register for read/write events if necessary.
+ */
+static void
+ssl_handshake_done(fde_t *F, tls_handshake_status_t ret, const char *errstr, void *data)
 {
   struct Client *client_p = data;
 
@@ -151,7 +321,6 @@ ssl_handshake(fde_t *F, void *data)
   assert(client_p->connection->fd);
   assert(client_p->connection->fd == F);
 
-  tls_handshake_status_t ret = tls_handshake(&F->ssl, TLS_ROLE_SERVER, NULL);
   if (ret != TLS_HANDSHAKE_DONE)
   {
     if ((CurrentTime - client_p->connection->firsttime) > CONNECTTIMEOUT)
@@ -175,6 +344,12 @@ ssl_handshake(fde_t *F, void *data)
   }
 
   comm_settimeout(F, 0, NULL, NULL);
+  admission_record(ADMISSION_TLS, client_p->connection->admission.tls);
+
+  if (tls_session_reused(&F->ssl))
+    ++ServerStats.is_tlsres;
+  else
+    ++ServerStats.is_tlsfull;
 
   if (!tls_verify_cert(&F->ssl, ConfigServerInfo.message_digest_algorithm, &client_p->certfp))
     ilog(LOG_TYPE_IRCD, "Client %s!%s@%s gave bad TLS client certificate",
@@ -183,18 +358,29 @@ ssl_handshake(fde_t *F, void *data)
   auth_start(client_p);
 }
 
+/*
+ * ssl_handshake - let OpenSSL initialize the protocol.
+ */
+static void
+ssl_handshake(fde_t *F, void *data)
+{
+  comm_tls_handshake(F, TLS_ROLE_SERVER, ssl_handshake_done, data);
+}
+
 /*
  * add_connection - creates a client which has just connected to us on
  * the given fd. The sockhost field is initialized with the ip# of the host.
  * An unique id is calculated now, in case it is needed for auth.
  * The client is sent to the auth module for verification, and not put in
- * any client list yet.
+ * any client list yet. accepted is the clock_usec() value taken
+ * when accept() returned the connection.
  */
 void
-add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
+add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd, uintmax_t accepted)
 {
   struct Client *client_p = client_make(NULL);
 
+  client_p->connection->admission.accept = accepted;
   client_p->connection->fd = fd_open(fd, 1, (listener->flags & LISTENER_SSL) ?
                                      "Incoming SSL connection" : "Incoming connection");
 
@@ -229,10 +415,34 @@ add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
     }
 
     AddFlag(client_p, FLAGS_SSL);
+
+    if (GlobalSetOptions.ktls)
+      tls_ktls_enable(&client_p->connection->fd->ssl);
+
+    /*
+     * Shed load rather than piling up handshakes the workers can't keep
+     * up with. Handshakes that are already underway are not affected.
+     */
+    if (worker_count() && tls_handshake_pending >= GlobalSetOptions.tls_handshake_queue)
+    {
+      ++ServerStats.is_tlsshed;
+
+      SetDead(client_p);
+      exit_client(client_p, "Server is busy, try again later");
+      return;
+    }
+
+    admission_record(ADMISSION_ACCEPT, accepted);
+
+    client_p->connection->admission.tls = clock_usec();
+    IRCD_PROBE2(tls__start, fd, TLS_ROLE_SERVER);
     ssl_handshake(client_p->connection->fd, client_p);
   }
   else
+  {
+    admission_record(ADMISSION_ACCEPT, accepted);
     auth_start(client_p);
+  }
 }
 
 /*
@@ -602,6 +812,16 @@ comm_accept(int fd, struct irc_ssaddr *addr)
    * reserved fd limit, but we can deal with that when comm_open()
    * also does it. XXX -- adrian
    */
+#ifdef HAVE_ACCEPT4
+  /* Saves the fcntl() round trips setup_socket() would do */
+  int new_fd = accept4(fd, (struct sockaddr *)addr, &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (new_fd < 0)
+    return -1;
+
+  remove_ipv6_mapping(addr);
+
+  setup_socket_options(new_fd);
+#else
   int new_fd = accept(fd, (struct sockaddr *)addr, &addrlen);
   if (new_fd < 0)
     return -1;
@@ -609,6 +829,7 @@ comm_accept(int fd, struct irc_ssaddr *addr)
   remove_ipv6_mapping(addr);
 
   setup_socket(new_fd);
+#endif
 
   /* .. and return */
   return new_fd;
@@ -41,6 +41,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 static int devpoll_fd;
 
@@ -149,6 +150,7 @@ comm_select(void)
   num = ioctl(devpoll_fd, DP_POLL, &dopoll);
 
   set_time();
+  loop_stats_polled(num, dopoll.dp_nfds);
 
   if (num < 0)
   {
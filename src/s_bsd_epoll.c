@@ -30,6 +30,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 #include "memory.h"
 #include <sys/epoll.h>
 
@@ -150,6 +151,7 @@ comm_select(void)
   assert(num <= epollop->nevents);
 
   set_time();
+  loop_stats_polled(num, epollop->nevents);
 
   if (num < 0)
   {
@@ -31,6 +31,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 enum { KE_LENGTH = 128 };
 
@@ -150,6 +151,7 @@ comm_select(void)
   kqoff = 0;
 
   set_time();
+  loop_stats_polled(num, KE_LENGTH);
 
   if (num < 0)
   {
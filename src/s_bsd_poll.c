@@ -33,6 +33,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 /* I hate linux -- adrian */
 #ifndef POLLRDNORM
@@ -152,6 +153,7 @@ comm_select(void)
   num = poll(pollfds, pollnum, SELECT_DELAY);
 
   set_time();
+  loop_stats_polled(num, pollnum);
 
   if (num < 0)
   {
@@ -30,15 +30,19 @@
 #include "channel.h"
 #include "client.h"
 #include "dbuf.h"
+#include "hash.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "s_bsd.h"
 #include "server_capab.h"
 #include "conf_class.h"
 #include "log.h"
-
+#include "misc.h"
+#include "probe.h"
+#include "worker_io.h"
 
 static uintmax_t current_serial;
+static dlink_list flush_list;  /* Connections with a deferred flush */
 
 
 /* send_format()
@@ -50,7 +54,7 @@ static uintmax_t current_serial;
  * output	- number of bytes formatted output
  * side effects	- modifies sendbuf
  */
-static void
+void
 send_format(struct dbuf_block *buffer, const char *pattern, va_list args)
 {
   /*
@@ -74,6 +78,53 @@ send_format(struct dbuf_block *buffer, const char *pattern, va_list args)
   buffer->data[buffer->size++] = '\n';
 }
 
+/*
+ ** send_sendq_exceeded
+ **      Checks whether queueing another size bytes would exceed the
+ **      sendq limit of a client, and drops the link if so.
+ */
+static int
+send_sendq_exceeded(struct Client *to, size_t size)
+{
+  if (dbuf_length(&to->connection->buf_sendq) + size <= get_sendq(&to->connection->confs))
+    return 0;
+
+  if (IsServer(to))
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "Max SendQ limit exceeded for %s: %zu > %u",
+                         client_get_name(to, HIDE_IP),
+                         (dbuf_length(&to->connection->buf_sendq) + size),
+                         get_sendq(&to->connection->confs));
+
+  if (IsClient(to))
+    AddFlag(to, FLAGS_SENDQEX);
+
+  dead_link_on_write(to, 0);
+  return 1;
+}
+
+/*
+ ** send_message_flush
+ **      Writes out the sendq of a client that has just had data queued,
+ **      or, if defer is set, holds it back until the end of the current
+ **      pass through the main loop, so that everything that is queued
+ **      meanwhile goes out in as few send() calls or TLS records as
+ **      possible. Don't hold back more than what fits into a single
+ **      record though.
+ */
+static void
+send_message_flush(struct Client *to, int defer)
+{
+  if (defer && dbuf_length(&to->connection->buf_sendq) < TLS_RECORD_SIZE_MAX)
+  {
+    if (to->connection->flush_node.data == NULL)
+      dlinkAddTail(to, &to->connection->flush_node, &flush_list);
+    return;
+  }
+
+  send_queued_write(to);
+}
+
 /*
  ** send_message
  **      Internal utility which appends given buffer to the sockets
@@ -86,23 +137,13 @@ send_message(struct Client *to, struct dbuf_block *buf)
   assert(to != &me);
   assert(MyConnect(to));
 
-  if (dbuf_length(&to->connection->buf_sendq) + buf->size > get_sendq(&to->connection->confs))
-  {
-    if (IsServer(to))
-      sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
-                           "Max SendQ limit exceeded for %s: %zu > %u",
-                           client_get_name(to, HIDE_IP),
-                           (dbuf_length(&to->connection->buf_sendq) + buf->size),
-                           get_sendq(&to->connection->confs));
-
-    if (IsClient(to))
-      AddFlag(to, FLAGS_SENDQEX);
-
-    dead_link_on_write(to, 0);
+  if (send_sendq_exceeded(to, buf->size))
     return;
-  }
 
   dbuf_add(&to->connection->buf_sendq, buf);
+  accounting_queued += buf->size;
+  accounting_peak(&to->connection->accounting.sendq_peak, dbuf_length(&to->connection->buf_sendq));
+  IRCD_PROBE3(send__message, to->name, buf->size, dbuf_length(&to->connection->buf_sendq));
 
   /*
    * Update statistics. The following is slightly incorrect because
@@ -112,7 +153,11 @@ send_message(struct Client *to, struct dbuf_block *buf)
   ++to->connection->send.messages;
   ++me.connection->send.messages;
 
-  send_queued_write(to);
+  /*
+   * Encrypted connections, and those a worker thread writes to, are
+   * always flushed once the current pass is done
+   */
+  send_message_flush(to, tls_isusing(&to->connection->fd->ssl) || to->connection->fd->io);
 }
 
 /* send_message_remote()
@@ -162,6 +207,77 @@ sendq_unblocked(fde_t *F, void *data)
   send_queued_write(client_p);
 }
 
+/* send_tls_record()
+ *
+ * inputs       - pointer to a client using TLS
+ *              - pointer to want_read flag, see tls_write()
+ * output       - number of bytes written, or what send()/tls_write()
+ *                returned otherwise
+ * side effects - Coalesces as many queued dbuf blocks as fit into one TLS
+ *                record, rather than writing a record per block. Records
+ *                start out small after the connection has been idle, so
+ *                a line can be decrypted as soon as its first TCP segment
+ *                arrives, and grow for bulk transfers such as bursts.
+ */
+static int
+send_tls_record(struct Client *to, int *want_read)
+{
+  static char buf[TLS_RECORD_SIZE_MAX];
+  struct Connection *const connection = to->connection;
+  unsigned int limit, len = 0;
+  int retlen;
+  dlink_node *node;
+
+  if (connection->tls.record_size == 0 ||
+      CurrentTime - connection->tls.last_write >= TLS_RECORD_IDLE_TIME)
+    connection->tls.record_size = TLS_RECORD_SIZE_MIN;
+
+  /*
+   * A write that has to be retried must pass exactly the same data again.
+   * GnuTLS insists on the same length, so more data that has been queued
+   * in the meantime has to wait for the next record.
+   */
+  limit = connection->tls.pending ? connection->tls.pending : connection->tls.record_size;
+
+  DLINK_FOREACH(node, connection->buf_sendq.blocks.head)
+  {
+    const struct dbuf_block *block = node->data;
+    size_t pos = node == connection->buf_sendq.blocks.head ? connection->buf_sendq.pos : 0;
+    size_t n = IRCD_MIN(block->size - pos, limit - len);
+
+    memcpy(buf + len, block->data + pos, n);
+    len += n;
+
+    if (len == limit)
+      break;
+  }
+
+  /*
+   * With kernel TLS, plain send() results in properly framed and
+   * encrypted records. Reads still go through tls_read(), as OpenSSL
+   * has to handle non-application records such as alerts.
+   */
+  if (connection->fd->flags.ktls_send)
+    retlen = send(connection->fd->fd, buf, len, 0);
+  else
+    retlen = tls_write(&connection->fd->ssl, buf, len, want_read);
+
+  if (retlen <= 0)
+  {
+    connection->tls.pending = len;
+    return retlen;
+  }
+
+  connection->tls.pending = 0;
+  connection->tls.last_write = CurrentTime;
+  ++connection->tls.records;
+
+  if (len == connection->tls.record_size)
+    connection->tls.record_size = IRCD_MIN(connection->tls.record_size * 2, TLS_RECORD_SIZE_MAX);
+
+  return retlen;
+}
+
 /*
  ** send_queued_write
  **      This is called when there is a chance that some output would
@@ -173,6 +289,9 @@ send_queued_write(struct Client *to)
 {
   int retlen = 0;
   int want_read = 0;
+  size_t written = 0;
+
+  send_queued_cancel(to);
 
   /*
    ** Once socket is marked dead, we cannot start writing to it,
@@ -181,6 +300,20 @@ send_queued_write(struct Client *to)
   if (IsDead(to) || HasFlag(to, FLAGS_BLOCKED))
     return;  /* no use calling send() now */
 
+  /*
+   * The TLS state is owned by a worker thread while a handshake step is
+   * in flight; the sendq is flushed once the handshake has completed.
+   */
+  if (to->connection->fd->handshake)
+    return;
+
+  /* A worker thread owns the socket; it is handed a copy of the sendq */
+  if (to->connection->fd->io)
+  {
+    worker_io_send(to);
+    return;
+  }
+
   /* Next, lets try to write some data */
   if (dbuf_length(&to->connection->buf_sendq))
   {
@@ -188,13 +321,13 @@ send_queued_write(struct Client *to)
     {
       const struct dbuf_block *first = to->connection->buf_sendq.blocks.head->data;
 
+      /* TLS connections, kernel TLS included, write whole records */
       if (tls_isusing(&to->connection->fd->ssl))
       {
-        retlen = tls_write(&to->connection->fd->ssl, first->data + to->connection->buf_sendq.pos,
-                                                     first->size - to->connection->buf_sendq.pos, &want_read);
+        retlen = send_tls_record(to, &want_read);
 
         if (want_read)
-          return;  /* Retry later, don't register for write events */
+          break;  /* Retry later, don't register for write events */
       }
       else
         retlen = send(to->connection->fd->fd, first->data + to->connection->buf_sendq.pos,
@@ -204,12 +337,24 @@ send_queued_write(struct Client *to)
         break;
 
       dbuf_delete(&to->connection->buf_sendq, retlen);
+      written += retlen;
 
       /* We have some data written .. update counters */
       to->connection->send.bytes += retlen;
       me.connection->send.bytes += retlen;
     } while (dbuf_length(&to->connection->buf_sendq));
 
+    /* result is what the last write returned, or -errno if it failed */
+    IRCD_PROBE4(send__write, to->name, written, retlen < 0 ? -errno : retlen,
+                dbuf_length(&to->connection->buf_sendq));
+
+    if (want_read)
+      return;
+
+    /* A LIST reply may be waiting for the sendq to drain */
+    if (to->connection->list_task)
+      safe_list_unblock(to);
+
     if (retlen < 0 && comm_ignore_errno(errno))
     {
       AddFlag(to, FLAGS_BLOCKED);
@@ -225,6 +370,72 @@ send_queued_write(struct Client *to)
   }
 }
 
+/* send_queued_written()
+ *
+ * input        - pointer to a client whose socket is owned by a worker
+ *              - number of bytes the worker has written
+ *              - number of TLS records these took
+ *              - errno of a failed write, or 0
+ * output       - NONE
+ * side effects - drops what has been written from the sendq and hands
+ *                the worker the next part of it, if there's any left
+ */
+void
+send_queued_written(struct Client *to, size_t written, unsigned int records, int error)
+{
+  if (IsDead(to))
+    return;  /* sendq has been cleared already */
+
+  dbuf_delete(&to->connection->buf_sendq, written);
+  to->connection->tls.records += records;
+
+  to->connection->send.bytes += written;
+  me.connection->send.bytes += written;
+
+  IRCD_PROBE4(send__write, to->name, written, error ? -error : (int)written,
+              dbuf_length(&to->connection->buf_sendq));
+
+  /* A LIST reply may be waiting for the sendq to drain */
+  if (to->connection->list_task)
+    safe_list_unblock(to);
+
+  if (error)
+    dead_link_on_write(to, error);
+  else
+    send_queued_write(to);
+}
+
+/* send_queued_cancel()
+ *
+ * input        - pointer to client
+ * output       - NONE
+ * side effects - removes the client from the list of deferred flushes.
+ *                Must be called before its connection goes away.
+ */
+void
+send_queued_cancel(struct Client *to)
+{
+  if (to->connection->flush_node.data)
+  {
+    dlinkDelete(&to->connection->flush_node, &flush_list);
+    to->connection->flush_node.data = NULL;
+  }
+}
+
+/* send_queued_deferred()
+ *
+ * input        - NONE
+ * output       - NONE
+ * side effects - flushes the sendq of all connections that have had
+ *                data queued with a deferred flush since the last call
+ */
+void
+send_queued_deferred(void)
+{
+  while (flush_list.head)
+    send_queued_write(flush_list.head->data);
+}
+
 /* send_queued_all()
  *
  * input        - NONE
@@ -283,6 +494,40 @@ sendto_one(struct Client *to, const char *pattern, ...)
   dbuf_ref_free(buffer);
 }
 
+/* sendto_one_deferred()
+ *
+ * inputs       - pointer to destination client
+ *              - preformatted line, including the trailing CR-LF
+ *              - length of the line
+ * output       - NONE
+ * side effects - appends the line to the block at the tail of the sendq
+ *                if that one isn't shared with other clients, and holds
+ *                back the write until the end of the current pass through
+ *                the main loop. Many lines queued for the same client end
+ *                up in a few blocks and a single send().
+ */
+void
+sendto_one_deferred(struct Client *to, const char *buf, size_t len)
+{
+  assert(MyConnect(to));
+
+  if (IsDead(to))
+    return;
+
+  if (send_sendq_exceeded(to, len))
+    return;
+
+  dbuf_put(&to->connection->buf_sendq, buf, len);
+  accounting_queued += len;
+  accounting_peak(&to->connection->accounting.sendq_peak, dbuf_length(&to->connection->buf_sendq));
+  IRCD_PROBE3(send__message, to->name, len, dbuf_length(&to->connection->buf_sendq));
+
+  ++to->connection->send.messages;
+  ++me.connection->send.messages;
+
+  send_message_flush(to, 1);
+}
+
 void
 sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numerics numeric, ...)
 {
@@ -41,6 +41,7 @@
 #include "send.h"
 #include "memory.h"
 #include "parse.h"
+#include "probe.h"
 
 
 dlink_list flatten_links;
@@ -575,18 +576,18 @@ server_finish_tls_handshake(struct Client *client_p)
   read_packet(client_p->connection->fd, client_p); 
 }
 
+static void server_tls_handshake(fde_t *, void *);
+
 static void
-server_tls_handshake(fde_t *F, void *data)
+server_tls_handshake_done(fde_t *F, tls_handshake_status_t ret, const char *sslerr, void *data)
 {
   struct Client *client_p = data;
-  const char *sslerr = NULL;
 
   assert(client_p);
   assert(client_p->connection);
   assert(client_p->connection->fd);
   assert(client_p->connection->fd == F);
 
-  tls_handshake_status_t ret = tls_handshake(&F->ssl, TLS_ROLE_CLIENT, &sslerr);
   if (ret != TLS_HANDSHAKE_DONE)
   {
     if ((CurrentTime - client_p->connection->firsttime) > CONNECTTIMEOUT)
@@ -625,6 +626,12 @@ server_tls_handshake(fde_t *F, void *data)
   server_finish_tls_handshake(client_p);
 }
 
+static void
+server_tls_handshake(fde_t *F, void *data)
+{
+  comm_tls_handshake(F, TLS_ROLE_CLIENT, server_tls_handshake_done, data);
+}
+
 static void
 server_tls_connect_init(struct Client *client_p, const struct MaskItem *conf, fde_t *F)
 {
@@ -643,6 +650,10 @@ server_tls_connect_init(struct Client *client_p, const struct MaskItem *conf, fd
   if (!EmptyString(conf->cipher_list))
     tls_set_ciphers(&F->ssl, conf->cipher_list);
 
+  if (GlobalSetOptions.ktls)
+    tls_ktls_enable(&F->ssl);
+
+  IRCD_PROBE2(tls__start, F->fd, TLS_ROLE_CLIENT);
   server_tls_handshake(F, client_p);
 }
 
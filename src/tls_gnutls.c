@@ -32,11 +32,184 @@
 #include "log.h"
 #include "misc.h"
 #include "memory.h"
+#include "hash.h"
 
 #ifdef HAVE_TLS_GNUTLS
 
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+/*! \brief A session kept for resumption by session ID */
+struct tls_session_entry
+{
+  struct tls_session_entry *hnext;  /**< Next entry in the same hash bucket */
+  unsigned char id[GNUTLS_MAX_SESSION_ID_SIZE];
+  size_t id_size;
+  unsigned char *data;
+  size_t data_size;
+  time_t expires;
+};
+
 static int TLS_initialized;
 
+/*
+ * Bounded session cache shared by all listeners. The oldest entry is
+ * overwritten once it's full. Entries are found through a hash table
+ * keyed on the session ID. The db callbacks may run on a worker thread,
+ * hence the lock.
+ */
+static struct tls_session_entry tls_session_cache[TLS_SESSION_CACHE_SIZE];
+static struct tls_session_entry *tls_session_hash[TLS_SESSION_CACHE_SIZE];
+static unsigned int tls_session_cache_next;
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t tls_session_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/*
+ * Master key session ticket keys are derived from. It's generated once and
+ * kept across rehashes so that tickets stay valid for TLS_SESSION_TIMEOUT;
+ * GnuTLS rotates the derived keys on its own.
+ */
+static gnutls_datum_t tls_ticket_key;
+
+static void
+tls_session_lock_acquire(void)
+{
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&tls_session_lock);
+#endif
+}
+
+static void
+tls_session_lock_release(void)
+{
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&tls_session_lock);
+#endif
+}
+
+/*
+ * tls_session_hash_id - FNV-1 hash of a session ID, as strhash() does
+ * for names
+ */
+static unsigned int
+tls_session_hash_id(const unsigned char *id, size_t size)
+{
+  unsigned int hval = FNV1_32_INIT;
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    hval += (hval << 1) + (hval << 4) +
+            (hval << 7) + (hval << 8) + (hval << 24);
+    hval ^= id[i];
+  }
+
+  return hval % TLS_SESSION_CACHE_SIZE;
+}
+
+static struct tls_session_entry *
+tls_session_find(const gnutls_datum_t *id)
+{
+  struct tls_session_entry *entry = tls_session_hash[tls_session_hash_id(id->data, id->size)];
+
+  for (; entry; entry = entry->hnext)
+    if (entry->id_size == id->size && memcmp(entry->id, id->data, id->size) == 0)
+      return entry;
+
+  return NULL;
+}
+
+static void
+tls_session_drop(struct tls_session_entry *entry)
+{
+  if (entry->data)
+  {
+    struct tls_session_entry **prev = &tls_session_hash[tls_session_hash_id(entry->id, entry->id_size)];
+
+    while (*prev != entry)
+      prev = &(*prev)->hnext;
+    *prev = entry->hnext;
+
+    xfree(entry->data);
+  }
+
+  memset(entry, 0, sizeof(*entry));
+}
+
+static int
+tls_db_store(void *ptr, gnutls_datum_t id, gnutls_datum_t data)
+{
+  if (id.size > GNUTLS_MAX_SESSION_ID_SIZE)
+    return -1;
+
+  tls_session_lock_acquire();
+
+  struct tls_session_entry *entry = tls_session_find(&id);
+  if (entry == NULL)
+  {
+    entry = &tls_session_cache[tls_session_cache_next];
+    tls_session_cache_next = (tls_session_cache_next + 1) % TLS_SESSION_CACHE_SIZE;
+  }
+
+  tls_session_drop(entry);
+
+  memcpy(entry->id, id.data, id.size);
+  entry->id_size = id.size;
+  entry->data = xcalloc(data.size);
+  memcpy(entry->data, data.data, data.size);
+  entry->data_size = data.size;
+  entry->expires = time(NULL) + TLS_SESSION_TIMEOUT;
+
+  const unsigned int hashv = tls_session_hash_id(entry->id, entry->id_size);
+  entry->hnext = tls_session_hash[hashv];
+  tls_session_hash[hashv] = entry;
+
+  tls_session_lock_release();
+  return 0;
+}
+
+static gnutls_datum_t
+tls_db_retrieve(void *ptr, gnutls_datum_t id)
+{
+  gnutls_datum_t ret = { NULL, 0 };
+
+  tls_session_lock_acquire();
+
+  struct tls_session_entry *entry = tls_session_find(&id);
+  if (entry)
+  {
+    if (entry->expires < time(NULL))
+      tls_session_drop(entry);
+    else if ((ret.data = gnutls_malloc(entry->data_size)))
+    {
+      memcpy(ret.data, entry->data, entry->data_size);
+      ret.size = entry->data_size;
+    }
+  }
+
+  tls_session_lock_release();
+  return ret;
+}
+
+static int
+tls_db_remove(void *ptr, gnutls_datum_t id)
+{
+  int ret = -1;
+
+  tls_session_lock_acquire();
+
+  struct tls_session_entry *entry = tls_session_find(&id);
+  if (entry)
+  {
+    tls_session_drop(entry);
+    ret = 0;
+  }
+
+  tls_session_lock_release();
+  return ret;
+}
+
 int
 tls_is_initialized(void)
 {
@@ -121,6 +294,13 @@ tls_new_cred(void)
 
   gnutls_certificate_set_dh_params(context->x509_cred, context->dh_params);
 
+  if (tls_ticket_key.data == NULL)
+  {
+    ret = gnutls_session_ticket_key_generate(&tls_ticket_key);
+    if (ret != GNUTLS_E_SUCCESS)
+      ilog(LOG_TYPE_IRCD, "Could not generate TLS session ticket key -- %s", gnutls_strerror(ret));
+  }
+
   if (ConfigServerInfo.ssl_message_digest_algorithm == NULL)
     ConfigServerInfo.message_digest_algorithm = GNUTLS_DIG_SHA256;
   else
@@ -251,12 +431,51 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   gnutls_transport_set_int(tls_data->session, fd);
 
   if (role == TLS_ROLE_SERVER)
+  {
     /* Request client certificate if any. */
     gnutls_certificate_server_set_request(tls_data->session, GNUTLS_CERT_REQUEST);
 
+    gnutls_db_set_retrieve_function(tls_data->session, tls_db_retrieve);
+    gnutls_db_set_store_function(tls_data->session, tls_db_store);
+    gnutls_db_set_remove_function(tls_data->session, tls_db_remove);
+    gnutls_db_set_ptr(tls_data->session, NULL);
+    gnutls_db_set_cache_expiration(tls_data->session, TLS_SESSION_TIMEOUT);
+
+    if (tls_ticket_key.data)
+      gnutls_session_ticket_enable_server(tls_data->session, &tls_ticket_key);
+  }
+
   return 1;
 }
 
+int
+tls_session_reused(tls_data_t *tls_data)
+{
+  return gnutls_session_is_resumed(tls_data->session);
+}
+
+/*
+ * GnuTLS only enables kernel TLS through its system-wide configuration
+ * file; there is nothing to be done per session.
+ */
+int
+tls_ktls_enable(tls_data_t *tls_data)
+{
+  return 0;
+}
+
+int
+tls_ktls_send(tls_data_t *tls_data)
+{
+  return 0;
+}
+
+int
+tls_ktls_recv(tls_data_t *tls_data)
+{
+  return 0;
+}
+
 int
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -100,6 +100,30 @@ tls_handshake(tls_data_t *tls_data, tls_role_t role, const char **errstr)
   return 0;
 }
 
+int
+tls_session_reused(tls_data_t *tls_data)
+{
+  return 0;
+}
+
+int
+tls_ktls_enable(tls_data_t *tls_data)
+{
+  return 0;
+}
+
+int
+tls_ktls_send(tls_data_t *tls_data)
+{
+  return 0;
+}
+
+int
+tls_ktls_recv(tls_data_t *tls_data)
+{
+  return 0;
+}
+
 int
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -32,11 +32,49 @@
 #include "log.h"
 #include "misc.h"
 #include "memory.h"
+#include "event.h"
 
 #ifdef HAVE_TLS_OPENSSL
 
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+
+/*! \brief Key used to encrypt and authenticate session tickets */
+struct tls_ticket_key
+{
+  unsigned char name[16];
+  unsigned char aes_key[32];
+  unsigned char hmac_key[32];
+};
+
 static int TLS_initialized;
 
+/*
+ * Slot 0 holds the key new tickets are issued with; tickets that have been
+ * issued with one of the previous keys in the other slots are still
+ * accepted, and renewed. There are enough slots that no key is dropped
+ * before every ticket issued with it has expired.
+ * The ticket callback may run on a worker thread, hence the lock.
+ */
+static struct tls_ticket_key tls_ticket_keys[TLS_TICKET_KEY_SLOTS];
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t tls_ticket_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void tls_ticket_key_rotate(void *);
+
+static struct event event_tls_ticket_key_rotate =
+{
+  .name = "tls_ticket_key_rotate",
+  .handler = tls_ticket_key_rotate,
+  .when = TLS_TICKET_KEY_LIFETIME
+};
+
 /*
  * report_crypto_errors - Dump crypto error list to log
  */
@@ -61,6 +99,114 @@ tls_is_initialized(void)
   return TLS_initialized;
 }
 
+static void
+tls_ticket_key_rotate(void *unused)
+{
+  struct tls_ticket_key key;
+
+  if (RAND_bytes((unsigned char *)&key, sizeof(key)) != 1)
+  {
+    report_crypto_errors();
+    return;  /* Keep using the current key */
+  }
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&tls_ticket_lock);
+#endif
+  memmove(&tls_ticket_keys[1], &tls_ticket_keys[0],
+          sizeof(tls_ticket_keys) - sizeof(tls_ticket_keys[0]));
+  tls_ticket_keys[0] = key;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&tls_ticket_lock);
+#endif
+
+  OPENSSL_cleanse(&key, sizeof(key));
+}
+
+/*
+ * tls_ticket_key_cb - encrypts new session tickets with the current key,
+ * and looks up the key for a ticket presented by a client. Returns 2 if
+ * the ticket should be renewed, 0 if the key is gone and a full handshake
+ * has to be done.
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char *name, unsigned char *iv,
+                  EVP_CIPHER_CTX *ectx, EVP_MAC_CTX *hctx, int enc)
+#else
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char *name, unsigned char *iv,
+                  EVP_CIPHER_CTX *ectx, HMAC_CTX *hctx, int enc)
+#endif
+{
+  struct tls_ticket_key key;
+  int ret = 1;
+
+  if (enc && RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1)
+    return -1;
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&tls_ticket_lock);
+#endif
+  if (enc)
+  {
+    key = tls_ticket_keys[0];
+    memcpy(name, key.name, sizeof(key.name));
+  }
+  else if (memcmp(name, tls_ticket_keys[0].name, sizeof(key.name)) == 0)
+    key = tls_ticket_keys[0];
+  else
+  {
+    ret = 0;
+
+    for (unsigned int i = 1; i < TLS_TICKET_KEY_SLOTS; ++i)
+    {
+      if (memcmp(name, tls_ticket_keys[i].name, sizeof(key.name)) == 0)
+      {
+        key = tls_ticket_keys[i];
+        ret = 2;
+        break;
+      }
+    }
+  }
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&tls_ticket_lock);
+#endif
+
+  if (ret == 0)
+    return 0;
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  char digest[] = "SHA256";
+  OSSL_PARAM params[] =
+  {
+    OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac_key, sizeof(key.hmac_key)),
+    OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+    OSSL_PARAM_construct_end()
+  };
+
+  if (!EVP_MAC_CTX_set_params(hctx, params))
+    ret = -1;
+#else
+  if (!HMAC_Init_ex(hctx, key.hmac_key, sizeof(key.hmac_key), EVP_sha256(), NULL))
+    ret = -1;
+#endif
+
+  if (ret > 0)
+  {
+    if (enc)
+    {
+      if (!EVP_EncryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.aes_key, iv))
+        ret = -1;
+    }
+    else if (!EVP_DecryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.aes_key, iv))
+      ret = -1;
+  }
+
+  OPENSSL_cleanse(&key, sizeof(key));
+  return ret;
+}
+
 /* tls_init()
  *
  * inputs       - nothing
@@ -82,11 +228,37 @@ tls_init(void)
     return;  /* Not reached */
   }
 
-  SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_NO_SSLv2|SSL_OP_NO_SSLv3|SSL_OP_NO_TICKET);
+  SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_NO_SSLv2|SSL_OP_NO_SSLv3);
   SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_SINGLE_DH_USE|SSL_OP_CIPHER_SERVER_PREFERENCE);
   SSL_CTX_set_verify(ConfigServerInfo.tls_ctx.server_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE,
                      always_accept_verify_cb);
-  SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_OFF);
+
+  /*
+   * A write that has to be retried passes the same data, but not always
+   * from the same buffer: a worker thread that takes over the socket
+   * retries from its own copy of the sendq.
+   */
+  SSL_CTX_set_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
+  /*
+   * All listeners share the server context, and with it the session cache
+   * and the ticket keys. The session ID context is required for resumption
+   * to work with SSL_VERIFY_PEER.
+   */
+  SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_SERVER);
+  SSL_CTX_sess_set_cache_size(ConfigServerInfo.tls_ctx.server_ctx, TLS_SESSION_CACHE_SIZE);
+  SSL_CTX_set_timeout(ConfigServerInfo.tls_ctx.server_ctx, TLS_SESSION_TIMEOUT);
+  SSL_CTX_set_session_id_context(ConfigServerInfo.tls_ctx.server_ctx,
+                                 (const unsigned char *)PACKAGE_NAME, sizeof(PACKAGE_NAME) - 1);
+
+  for (unsigned int i = 0; i < TLS_TICKET_KEY_SLOTS; ++i)
+    tls_ticket_key_rotate(NULL);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#else
+  SSL_CTX_set_tlsext_ticket_key_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#endif
+  event_add(&event_tls_ticket_key_rotate, NULL);
   SSL_CTX_set_cipher_list(ConfigServerInfo.tls_ctx.server_ctx, "EECDH+HIGH:EDH+HIGH:HIGH:!aNULL");
 
 #ifndef OPENSSL_NO_ECDH
@@ -114,6 +286,7 @@ tls_init(void)
   SSL_CTX_set_options(ConfigServerInfo.tls_ctx.client_ctx, SSL_OP_SINGLE_DH_USE);
   SSL_CTX_set_verify(ConfigServerInfo.tls_ctx.client_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE,
                      always_accept_verify_cb);
+  SSL_CTX_set_mode(ConfigServerInfo.tls_ctx.client_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
   SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.client_ctx, SSL_SESS_CACHE_OFF);
 }
 
@@ -355,6 +528,50 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   return 1;
 }
 
+int
+tls_session_reused(tls_data_t *tls_data)
+{
+  SSL *ssl = *tls_data;
+  return SSL_session_reused(ssl);
+}
+
+/*
+ * tls_ktls_enable - ask OpenSSL to hand the session keys to the kernel once
+ * the handshake has completed. Has to be called before the handshake.
+ * OpenSSL silently stays in user space if the kernel lacks the tls
+ * module, or the negotiated cipher isn't supported by it.
+ */
+int
+tls_ktls_enable(tls_data_t *tls_data)
+{
+#ifdef SSL_OP_ENABLE_KTLS
+  SSL_set_options(*tls_data, SSL_OP_ENABLE_KTLS);
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int
+tls_ktls_send(tls_data_t *tls_data)
+{
+#ifdef SSL_OP_ENABLE_KTLS
+  return BIO_get_ktls_send(SSL_get_wbio(*tls_data));
+#else
+  return 0;
+#endif
+}
+
+int
+tls_ktls_recv(tls_data_t *tls_data)
+{
+#ifdef SSL_OP_ENABLE_KTLS
+  return BIO_get_ktls_recv(SSL_get_rbio(*tls_data));
+#else
+  return 0;
+#endif
+}
+
 int
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -384,7 +601,11 @@ tls_handshake(tls_data_t *tls_data, tls_role_t role, const char **errstr)
       return TLS_HANDSHAKE_WANT_READ;
     default:
     {
-      const char *error = ERR_error_string(ERR_get_error(), NULL);
+      /*
+       * ERR_error_string() would use a static buffer; this may run on
+       * a worker thread.
+       */
+      const char *error = ERR_reason_error_string(ERR_get_error());
 
       if (errstr)
         *errstr = error;
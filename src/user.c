@@ -26,6 +26,7 @@
 
 #include "stdinc.h"
 #include "list.h"
+#include "admission.h"
 #include "user.h"
 #include "channel.h"
 #include "channel_mode.h"
@@ -51,6 +52,8 @@
 #include "watch.h"
 #include "isupport.h"
 #include "tls.h"
+#include "probe.h"
+#include "worker_io.h"
 
 static char umode_buffer[UMODE_MAX_STR];
 
@@ -259,7 +262,7 @@ user_welcome(struct Client *client_p)
   {
     AddUMode(client_p, UMODE_SSL);
     sendto_one_notice(client_p, &me, ":*** Connected securely via %s",
-                      tls_get_cipher(&client_p->connection->fd->ssl));
+                      worker_io_cipher(client_p->connection->fd));
   }
 
   sendto_one_numeric(client_p, &me, RPL_WELCOME, ConfigServerInfo.network_name,
@@ -319,6 +322,9 @@ register_local_user(struct Client *client_p)
   assert(MyConnect(client_p));
   assert(IsUnknown(client_p));
 
+  IRCD_PROBE3(register__user, client_p->name, client_p->sockhost,
+              CurrentTime - client_p->connection->firsttime);
+
   if (ConfigGeneral.ping_cookie)
   {
     if (!HasFlag(client_p, FLAGS_PINGSENT) && !client_p->connection->random_ping)
@@ -340,7 +346,11 @@ register_local_user(struct Client *client_p)
   /* Straight up the maximum rate of flooding... */
   client_p->connection->allow_read = MAX_FLOOD_BURST;
 
-  if (check_client(client_p) == 0)
+  const uintmax_t access_start = clock_usec();
+  const int access_ok = check_client(client_p);
+  admission_record(ADMISSION_ACCESS, access_start);
+
+  if (access_ok == 0)
     return;
 
   conf = client_p->connection->confs.head->data;
@@ -457,6 +467,7 @@ register_local_user(struct Client *client_p)
   SetClient(client_p);
   dlinkAdd(client_p, &client_p->lnode, &client_p->servptr->serv->client_list);
   dlinkAdd(client_p, &client_p->node, &global_client_list);
+  who_index_add(client_p);
 
   assert(dlinkFind(&unknown_list, client_p));
 
@@ -485,6 +496,8 @@ register_local_user(struct Client *client_p)
   user_welcome(client_p);
 
   introduce_client(client_p);
+
+  admission_record(ADMISSION_REGISTER, client_p->connection->admission.accept);
 }
 
 /* register_remote_user()
@@ -512,6 +525,7 @@ register_remote_user(struct Client *client_p)
   SetClient(client_p);
   dlinkAdd(client_p, &client_p->lnode, &client_p->servptr->serv->client_list);
   dlinkAdd(client_p, &client_p->node, &global_client_list);
+  who_index_add(client_p);
 
   if (dlink_list_length(&global_client_list) > Count.max_tot)
     Count.max_tot = dlink_list_length(&global_client_list);
@@ -721,6 +735,7 @@ user_set_hostmask(struct Client *client_p, const char *hostname)
                                client_p->host, client_p->username, hostname);
 
   strlcpy(client_p->host, hostname, sizeof(client_p->host));
+  who_index_update(client_p);
 
   if (MyConnect(client_p))
   {
@@ -32,12 +32,14 @@
 #include "hash.h"
 #include "irc_string.h"
 #include "ircd.h"
+#include "misc.h"
 #include "numeric.h"
 #include "send.h"
 #include "watch.h"
 
 
 static dlink_list watchTable[HASHSIZE];
+static struct WatchStatistics watch_stats;
 
 
 /*
@@ -64,8 +66,31 @@ watch_count_memory(unsigned int *const count, size_t *const bytes)
   (*bytes) = *count * sizeof(struct Watch);
 }
 
+/*! \brief Returns a bucket of the watch hash table, for HASH
+ * \param i Bucket index, 0 to HASHSIZE - 1
+ */
+const dlink_list *
+watch_get_bucket(unsigned int i)
+{
+  return &watchTable[i];
+}
+
+/*! \brief Returns lookup and notification counters, for HASH */
+const struct WatchStatistics *
+watch_get_statistics(void)
+{
+  return &watch_stats;
+}
+
 /*! \brief Notifies all clients that have client_p's name on
  *         their watch list.
+ *
+ * Everything but the target is the same for each watcher, so the line is
+ * formatted once and only the watcher's name is spliced in. The lines are
+ * queued with a deferred write; during a netsplit or netburst all of the
+ * notifications a watcher gets within one pass through the main loop are
+ * packed into the same sendq blocks and written with a single send().
+ *
  * \param client_p Pointer to Client struct
  * \param reply Numeric to send. Either RPL_LOGON or RPL_LOGOFF
  */
@@ -74,20 +99,50 @@ watch_check_hash(const struct Client *client_p, const enum irc_numerics reply)
 {
   struct Watch *watch = NULL;
   dlink_node *node = NULL;
+  char prefix[HOSTLEN + 8];
+  char suffix[IRCD_BUFSIZE];
 
   assert(IsClient(client_p));
 
+  ++watch_stats.lookups;
+
   if ((watch = watch_find_hash(client_p->name)) == NULL)
     return;  /* This name isn't on watch */
 
+  ++watch_stats.hits;
+
   /* Update the time of last change to item */
   watch->lasttime = CurrentTime;
 
+  const int prefix_len = snprintf(prefix, sizeof(prefix), ":%s %03d ", me.name, reply);
+  const int suffix_len = snprintf(suffix, sizeof(suffix), numeric_form(reply),
+                                  client_p->name, client_p->username,
+                                  client_p->host, watch->lasttime);
+  const size_t suffix_max = IRCD_BUFSIZE - 2 - prefix_len - 1;
+
   /* Send notifies out to everybody on the list in header */
   DLINK_FOREACH(node, watch->watched_by.head)
-    sendto_one_numeric(node->data, &me, reply, client_p->name,
-                       client_p->username, client_p->host,
-                       watch->lasttime, client_p->info);
+  {
+    struct Client *target_p = node->data;
+    const size_t name_len = strlen(target_p->name);
+    char line[IRCD_BUFSIZE];
+    size_t len = prefix_len;
+
+    memcpy(line, prefix, prefix_len);
+    memcpy(line + len, target_p->name, name_len);
+    len += name_len;
+    line[len++] = ' ';
+
+    const size_t n = IRCD_MIN((size_t)suffix_len, suffix_max - name_len);
+    memcpy(line + len, suffix, n);
+    len += n;
+
+    line[len++] = '\r';
+    line[len++] = '\n';
+
+    sendto_one_deferred(target_p, line, len);
+    ++watch_stats.notifies;
+  }
 }
 
 /*! \brief Looks up the watch table for a given name
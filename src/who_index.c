@@ -0,0 +1,619 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file who_index.c
+ * \brief Secondary indexes of the global client list used by WHO.
+ * \version $Id$
+ *
+ * Lookups only ever return a superset of the clients that match a mask;
+ * the caller still has to run match() on each candidate. What they save
+ * is the walk over the entire global client list:
+ *
+ *  - Hosts are kept in a trie of DNS labels, read from right to left, so
+ *    "*.isp.net" is the subtree below net -> isp.
+ *  - Addresses are kept in a crit-bit tree of 16 byte keys, IPv4 being
+ *    mapped into ::ffff:0:0/96, so "1.2.3.*" is the subtree of keys that
+ *    share the first 15 bytes.
+ *  - Services accounts are hashed, and opers are kept in a plain list.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "hash.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "who_index.h"
+
+
+struct WhoHostNode
+{
+  dlink_node node;     /**< Entry in who_host_table */
+  dlink_node sibling;  /**< Entry in parent->children */
+  struct WhoHostNode *parent;
+  dlink_list children;
+  dlink_list clients;  /**< Clients whose host ends at this node */
+  unsigned int hashv;
+  char label[];        /**< Label in lower case */
+};
+
+struct WhoAddrLeaf
+{
+  unsigned char key[16];
+  dlink_list clients;
+};
+
+/*! \brief Inner node of the address tree. Pointers to inner nodes have
+ *         their lowest bit set, so they can be told apart from leaves. */
+struct WhoAddrInner
+{
+  void *child[2];
+  unsigned int byte;        /**< Index of the byte that holds the critical bit */
+  unsigned char otherbits;  /**< All bits but the critical one set */
+};
+
+static dlink_list who_host_table[HASHSIZE];
+static struct WhoHostNode who_host_root;
+static void *who_addr_root;
+static dlink_list who_addr_unknown;
+static dlink_list who_account_table[HASHSIZE];
+static dlink_list who_oper_list;
+
+static unsigned int who_host_nodes;
+static size_t who_host_bytes;  /**< Allocated by the host trie, labels included */
+static unsigned int who_addr_leaves;
+
+
+static unsigned int
+who_host_hash(const struct WhoHostNode *parent, const char *label, size_t len)
+{
+  uint32_t hval = FNV1_32_INIT ^ (uint32_t)((uintptr_t)parent >> 4);
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    hval ^= ToLower(label[i]);
+    hval *= 0x01000193;
+  }
+
+  return (hval >> FNV1_32_BITS) ^ (hval & (HASHSIZE - 1));
+}
+
+static int
+who_host_label_cmp(const struct WhoHostNode *node, const char *label, size_t len)
+{
+  for (size_t i = 0; i < len; ++i)
+    if (node->label[i] != ToLower(label[i]))
+      return 1;
+
+  return node->label[len] != '\0';
+}
+
+/*! \brief Finds the child of a trie node, optionally creating it
+ * \param parent Node to look below
+ * \param label  Label, not necessarily NUL-terminated
+ * \param len    Length of the label
+ * \param create Whether to create the child if it doesn't exist
+ */
+static struct WhoHostNode *
+who_host_child(struct WhoHostNode *parent, const char *label, size_t len, int create)
+{
+  const unsigned int hashv = who_host_hash(parent, label, len);
+  dlink_node *node;
+
+  DLINK_FOREACH(node, who_host_table[hashv].head)
+  {
+    struct WhoHostNode *child = node->data;
+
+    if (child->parent == parent && who_host_label_cmp(child, label, len) == 0)
+      return child;
+  }
+
+  if (create == 0)
+    return NULL;
+
+  struct WhoHostNode *child = xcalloc(sizeof(*child) + len + 1);
+  for (size_t i = 0; i < len; ++i)
+    child->label[i] = ToLower(label[i]);
+
+  child->parent = parent;
+  child->hashv = hashv;
+  dlinkAdd(child, &child->node, &who_host_table[hashv]);
+  dlinkAdd(child, &child->sibling, &parent->children);
+  ++who_host_nodes;
+  who_host_bytes += sizeof(*child) + len + 1;
+  return child;
+}
+
+/*! \brief Walks down the trie along the labels of a host name
+ * \param host   Host name, or a suffix of one
+ * \param len    Number of characters of host to use
+ * \param create Whether to create missing nodes
+ */
+static struct WhoHostNode *
+who_host_find(const char *host, size_t len, int create)
+{
+  struct WhoHostNode *node = &who_host_root;
+  const char *end = host + len;
+
+  while (node)
+  {
+    const char *p = end;
+
+    while (p > host && p[-1] != '.')
+      --p;
+
+    node = who_host_child(node, p, end - p, create);
+
+    if (p == host)
+      break;
+    end = p - 1;
+  }
+
+  return node;
+}
+
+/*! \brief Removes nodes that have neither clients nor children any longer,
+ *         starting at node and going up towards the root. */
+static void
+who_host_prune(struct WhoHostNode *node)
+{
+  while (node != &who_host_root && node->clients.head == NULL && node->children.head == NULL)
+  {
+    struct WhoHostNode *parent = node->parent;
+
+    dlinkDelete(&node->node, &who_host_table[node->hashv]);
+    dlinkDelete(&node->sibling, &parent->children);
+    --who_host_nodes;
+    who_host_bytes -= sizeof(*node) + strlen(node->label) + 1;
+    xfree(node);
+
+    node = parent;
+  }
+}
+
+static int
+who_host_walk(const struct WhoHostNode *node, int self, who_index_cb cb, void *data)
+{
+  dlink_node *ptr;
+
+  if (self)
+    DLINK_FOREACH(ptr, node->clients.head)
+      if (cb(ptr->data, data))
+        return 1;
+
+  DLINK_FOREACH(ptr, node->children.head)
+    if (who_host_walk(ptr->data, 1, cb, data))
+      return 1;
+
+  return 0;
+}
+
+static int
+who_addr_direction(const struct WhoAddrInner *q, const unsigned char *key)
+{
+  return (1 + (q->otherbits | key[q->byte])) >> 8;
+}
+
+static struct WhoAddrLeaf *
+who_addr_insert(const unsigned char *key)
+{
+  struct WhoAddrLeaf *best;
+  unsigned int newbyte = 0, newotherbits = 0;
+  void *p = who_addr_root;
+
+  if (p == NULL)
+  {
+    best = xcalloc(sizeof(*best));
+    memcpy(best->key, key, sizeof(best->key));
+    who_addr_root = best;
+    ++who_addr_leaves;
+    return best;
+  }
+
+  while ((uintptr_t)p & 1)
+  {
+    const struct WhoAddrInner *q = (void *)((uintptr_t)p - 1);
+    p = q->child[who_addr_direction(q, key)];
+  }
+
+  best = p;
+
+  for (; newbyte < sizeof(best->key); ++newbyte)
+    if ((newotherbits = best->key[newbyte] ^ key[newbyte]))
+      break;
+
+  if (newbyte == sizeof(best->key))
+    return best;
+
+  /* Keep the most significant differing bit only, then invert */
+  newotherbits |= newotherbits >> 1;
+  newotherbits |= newotherbits >> 2;
+  newotherbits |= newotherbits >> 4;
+  newotherbits = (newotherbits & ~(newotherbits >> 1)) ^ 255;
+
+  const int newdirection = (1 + (newotherbits | best->key[newbyte])) >> 8;
+
+  struct WhoAddrInner *inner = xcalloc(sizeof(*inner));
+  struct WhoAddrLeaf *leaf = xcalloc(sizeof(*leaf));
+  memcpy(leaf->key, key, sizeof(leaf->key));
+  ++who_addr_leaves;
+
+  inner->byte = newbyte;
+  inner->otherbits = newotherbits;
+  inner->child[1 - newdirection] = leaf;
+
+  void **wherep = &who_addr_root;
+
+  while ((uintptr_t)(p = *wherep) & 1)
+  {
+    struct WhoAddrInner *q = (void *)((uintptr_t)p - 1);
+
+    if (q->byte > newbyte)
+      break;
+    if (q->byte == newbyte && q->otherbits > newotherbits)
+      break;
+
+    wherep = &q->child[who_addr_direction(q, key)];
+  }
+
+  inner->child[newdirection] = *wherep;
+  *wherep = (void *)((uintptr_t)inner + 1);
+  return leaf;
+}
+
+static void
+who_addr_remove(struct WhoAddrLeaf *leaf)
+{
+  void **wherep = &who_addr_root, **whereq = NULL;
+  struct WhoAddrInner *q = NULL;
+  int direction = 0;
+  void *p = who_addr_root;
+
+  while ((uintptr_t)p & 1)
+  {
+    whereq = wherep;
+    q = (void *)((uintptr_t)p - 1);
+    direction = who_addr_direction(q, leaf->key);
+    wherep = &q->child[direction];
+    p = *wherep;
+  }
+
+  assert(p == leaf);
+
+  xfree(leaf);
+  --who_addr_leaves;
+
+  if (whereq == NULL)
+    who_addr_root = NULL;
+  else
+  {
+    *whereq = q->child[1 - direction];
+    xfree(q);
+  }
+}
+
+static int
+who_addr_walk(void *p, who_index_cb cb, void *data)
+{
+  if ((uintptr_t)p & 1)
+  {
+    const struct WhoAddrInner *q = (void *)((uintptr_t)p - 1);
+
+    return who_addr_walk(q->child[0], cb, data) ||
+           who_addr_walk(q->child[1], cb, data);
+  }
+
+  const struct WhoAddrLeaf *leaf = p;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, leaf->clients.head)
+    if (cb(node->data, data))
+      return 1;
+
+  return 0;
+}
+
+/*! \brief Converts an address into a tree key
+ * \return 1 on success, 0 if the address family isn't known
+ */
+static int
+who_addr_key(const struct irc_ssaddr *addr, unsigned char *key)
+{
+  if (addr->ss.ss_family == AF_INET)
+  {
+    const struct sockaddr_in *const v4 = (const struct sockaddr_in *)&addr->ss;
+
+    memset(key, 0, 10);
+    key[10] = key[11] = 0xff;
+    memcpy(key + 12, &v4->sin_addr, 4);
+    return 1;
+  }
+
+  if (addr->ss.ss_family == AF_INET6)
+  {
+    const struct sockaddr_in6 *const v6 = (const struct sockaddr_in6 *)&addr->ss;
+
+    memcpy(key, &v6->sin6_addr, 16);
+    return 1;
+  }
+
+  return 0;
+}
+
+/*! \brief Turns an IP mask into a key prefix. Understood are literal
+ *         addresses and IPv4 masks of the form "1.*", "1.2.*" and "1.2.3.*".
+ * \return Length of the prefix in bytes, or 0 if the mask isn't one of these
+ */
+static unsigned int
+who_addr_prefix(const char *mask, unsigned char *key)
+{
+  struct in_addr v4;
+  unsigned int len = 12;
+
+  if (inet_pton(AF_INET6, mask, key) == 1)
+    return 16;
+
+  memset(key, 0, 10);
+  key[10] = key[11] = 0xff;
+
+  if (inet_pton(AF_INET, mask, &v4) == 1)
+  {
+    memcpy(key + 12, &v4, 4);
+    return 16;
+  }
+
+  for (const char *p = mask; len < 15; )
+  {
+    unsigned int octet = 0;
+    const char *const start = p;
+
+    while (IsDigit(*p) && p - start < 3)
+      octet = octet * 10 + (*p++ - '0');
+
+    /* Leading zeros are octal to inet_aton(), see uid_from_server() */
+    if (p == start || octet > 255 || (*start == '0' && p - start > 1) || *p != '.')
+      return 0;
+
+    key[len++] = octet;
+
+    if (strcmp(++p, "*") == 0)
+      return len;
+  }
+
+  return 0;
+}
+
+/*! \brief Returns 1 if str contains any of the characters match() treats specially */
+static int
+who_has_wildcards(const char *str)
+{
+  return strpbrk(str, "*?\\") != NULL;
+}
+
+/*! \brief Adds a client to all indexes it qualifies for
+ * \param client_p Pointer to a registered Client
+ */
+void
+who_index_add(struct Client *client_p)
+{
+  struct WhoIndexEntry *const entry = &client_p->who_index;
+  unsigned char key[16];
+
+  assert(IsClient(client_p));
+  assert(entry->host_node == NULL);
+
+  entry->host_node = who_host_find(client_p->host, strlen(client_p->host), 1);
+  dlinkAdd(client_p, &entry->host, &entry->host_node->clients);
+
+  if (who_addr_key(&client_p->ip, key))
+  {
+    entry->addr_leaf = who_addr_insert(key);
+    dlinkAdd(client_p, &entry->addr, &entry->addr_leaf->clients);
+  }
+  else
+    dlinkAdd(client_p, &entry->addr, &who_addr_unknown);
+
+  if (strcmp(client_p->account, "*"))
+  {
+    entry->account_hash = strhash(client_p->account);
+    dlinkAdd(client_p, &entry->account, &who_account_table[entry->account_hash]);
+  }
+
+  if (HasUMode(client_p, UMODE_OPER))
+    dlinkAdd(client_p, &entry->oper, &who_oper_list);
+}
+
+/*! \brief Removes a client from all indexes. Does nothing if the client
+ *         hasn't been added.
+ * \param client_p Pointer to Client struct
+ */
+void
+who_index_del(struct Client *client_p)
+{
+  struct WhoIndexEntry *const entry = &client_p->who_index;
+
+  if (entry->host_node == NULL)
+    return;
+
+  dlinkDelete(&entry->host, &entry->host_node->clients);
+  who_host_prune(entry->host_node);
+  entry->host_node = NULL;
+
+  if (entry->addr_leaf)
+  {
+    dlinkDelete(&entry->addr, &entry->addr_leaf->clients);
+
+    if (entry->addr_leaf->clients.head == NULL)
+      who_addr_remove(entry->addr_leaf);
+    entry->addr_leaf = NULL;
+  }
+  else
+    dlinkDelete(&entry->addr, &who_addr_unknown);
+
+  if (entry->account.data)
+  {
+    dlinkDelete(&entry->account, &who_account_table[entry->account_hash]);
+    entry->account.data = NULL;
+  }
+
+  if (entry->oper.data)
+  {
+    dlinkDelete(&entry->oper, &who_oper_list);
+    entry->oper.data = NULL;
+  }
+}
+
+/*! \brief Re-indexes a client after its host, account or oper status
+ *         have changed. Does nothing for clients that aren't indexed yet.
+ * \param client_p Pointer to Client struct
+ */
+void
+who_index_update(struct Client *client_p)
+{
+  if (client_p->who_index.host_node == NULL)
+    return;
+
+  who_index_del(client_p);
+  who_index_add(client_p);
+}
+
+/*! \brief Calls cb for the clients whose host may match a mask
+ * \param mask Either a host name, or "*." followed by a domain
+ * \return -1 if the mask can't be resolved using the index, otherwise
+ *         whether the walk has been stopped by cb
+ */
+int
+who_index_find_host(const char *mask, who_index_cb cb, void *data)
+{
+  const int subtree = mask[0] == '*' && mask[1] == '.';
+  dlink_node *ptr;
+  const char *const suffix = subtree ? mask + 2 : mask;
+
+  if (*suffix == '\0' || who_has_wildcards(suffix))
+    return -1;
+
+  const struct WhoHostNode *const node = who_host_find(suffix, strlen(suffix), 0);
+  if (node == NULL)
+    return 0;
+
+  /* Hosts matching "*.isp.net" are below isp.net, but not isp.net itself */
+  if (subtree)
+    return who_host_walk(node, 0, cb, data);
+
+  DLINK_FOREACH(ptr, node->clients.head)
+    if (cb(ptr->data, data))
+      return 1;
+
+  return 0;
+}
+
+/*! \brief Calls cb for the clients whose IP address may match a mask.
+ *         Clients with an unknown address are always passed to cb.
+ * \param mask Literal address, or an IPv4 prefix such as "10.1.*"
+ * \return -1 if the mask can't be resolved using the index, otherwise
+ *         whether the walk has been stopped by cb
+ */
+int
+who_index_find_addr(const char *mask, who_index_cb cb, void *data)
+{
+  unsigned char key[16];
+  const unsigned int len = who_addr_prefix(mask, key);
+  dlink_node *node;
+
+  if (len == 0)
+    return -1;
+
+  DLINK_FOREACH(node, who_addr_unknown.head)
+    if (cb(node->data, data))
+      return 1;
+
+  void *p = who_addr_root, *top = p;
+  if (p == NULL)
+    return 0;
+
+  while ((uintptr_t)p & 1)
+  {
+    const struct WhoAddrInner *q = (void *)((uintptr_t)p - 1);
+    const unsigned char c = q->byte < len ? key[q->byte] : 0;
+
+    p = q->child[(1 + (q->otherbits | c)) >> 8];
+    if (q->byte < len)
+      top = p;
+  }
+
+  if (memcmp(((const struct WhoAddrLeaf *)p)->key, key, len))
+    return 0;  /* Nothing shares the prefix */
+
+  return who_addr_walk(top, cb, data);
+}
+
+/*! \brief Calls cb for the clients logged in to a services account
+ * \param mask Account name; must not contain wildcards
+ * \return -1 if the mask can't be resolved using the index, otherwise
+ *         whether the walk has been stopped by cb
+ */
+int
+who_index_find_account(const char *mask, who_index_cb cb, void *data)
+{
+  dlink_node *node;
+
+  if (who_has_wildcards(mask) || strcmp(mask, "*") == 0)
+    return -1;
+
+  DLINK_FOREACH(node, who_account_table[strhash(mask)].head)
+  {
+    struct Client *client_p = node->data;
+
+    if (irccmp(client_p->account, mask) == 0)
+      if (cb(client_p, data))
+        return 1;
+  }
+
+  return 0;
+}
+
+/*! \brief Calls cb for every oper on the network
+ * \return Whether the walk has been stopped by cb
+ */
+int
+who_index_find_oper(who_index_cb cb, void *data)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, who_oper_list.head)
+    if (cb(node->data, data))
+      return 1;
+
+  return 0;
+}
+
+/*! \brief Counts up memory used by the host trie and the address tree.
+ *         A crit-bit tree with n leaves has n - 1 inner nodes. */
+void
+who_index_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  const unsigned int inner = who_addr_leaves ? who_addr_leaves - 1 : 0;
+
+  *count = who_host_nodes + who_addr_leaves + inner;
+  *bytes = who_host_bytes +
+           who_addr_leaves * sizeof(struct WhoAddrLeaf) +
+           inner * sizeof(struct WhoAddrInner);
+}
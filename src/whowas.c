@@ -22,6 +22,12 @@
 /*! \file whowas.c
  * \brief WHOWAS user cache.
  * \version $Id$
+ *
+ * History entries live in a ring of whowas_history_length slots that is
+ * allocated once. Their strings are packed back to back into a second
+ * ring of bytes, so the oldest entry always owns the oldest strings and
+ * recording a name never calls the allocator: the slot and the bytes it
+ * needs are taken from the oldest entries. Hash chains link slot indices.
  */
 
 #include "stdinc.h"
@@ -34,77 +40,212 @@
 #include "ircd.h"
 #include "conf.h"
 
+#define WHOWAS_NONE UINT32_MAX
+
+/* Upper bound of the packed strings of a single entry */
+enum { WHOWAS_STRINGS_MAX = ACCOUNTLEN + NICKLEN + USERLEN + HOSTLEN * 3 + HOSTIPLEN + REALLEN + 8 };
+
+static struct Whowas *whowas_ring;  /* Slots */
+static uint32_t whowas_size;   /* Number of slots */
+static uint32_t whowas_first;  /* Oldest slot */
+static uint32_t whowas_count;  /* Slots in use */
+
+static char *whowas_strings;  /* String ring */
+static uint32_t whowas_strings_size;
+static uint32_t whowas_strings_head;  /* Where the next entry's strings go */
 
-static dlink_list whowas_list;  /*! Chain of struct Whowas pointers */
-static dlink_list whowas_hash[HASHSIZE];
+static uint32_t whowas_hash[HASHSIZE];
 
 
-/*! \brief Returns a slot of the whowas_hash by the hash value associated with it.
+/*! \brief Returns the newest entry in a slot of the whowas hash.
  * \param hashv Hash value.
  */
-const dlink_list *
+const struct Whowas *
 whowas_get_hash(unsigned int hashv)
 {
-  if (hashv >= HASHSIZE)
+  if (hashv >= HASHSIZE || whowas_hash[hashv] == WHOWAS_NONE)
+    return NULL;
+
+  return &whowas_ring[whowas_hash[hashv]];
+}
+
+/*! \brief Returns the next older entry in the same hash slot, or NULL.
+ * \param whowas Pointer to Whowas struct
+ */
+const struct Whowas *
+whowas_next(const struct Whowas *whowas)
+{
+  if (whowas->hnext == WHOWAS_NONE)
     return NULL;
 
-  return &whowas_hash[hashv];
+  return &whowas_ring[whowas->hnext];
 }
 
-/*! \brief Unlinks a Whowas struct from its associated lists.
- * \param whowas Pointer to Whowas struct to be unlinked.
+/*! \brief Drops the oldest entry and hands its slot and strings back
+ *         to the rings.
  */
-static struct Whowas *
-whowas_unlink(struct Whowas *whowas)
+static void
+whowas_evict(void)
 {
+  struct Whowas *const whowas = &whowas_ring[whowas_first];
+
+  assert(whowas_count);
+
   if (whowas->online)
     dlinkDelete(&whowas->cnode, &whowas->online->whowas_list);
 
-  dlinkDelete(&whowas->hnode, &whowas_hash[whowas->hashv]);
-  dlinkDelete(&whowas->lnode, &whowas_list);
+  /* The oldest entry is always last in its hash chain */
+  assert(whowas->hnext == WHOWAS_NONE);
 
-  return whowas;
+  if (whowas->hprev == WHOWAS_NONE)
+    whowas_hash[whowas->hashv] = WHOWAS_NONE;
+  else
+    whowas_ring[whowas->hprev].hnext = WHOWAS_NONE;
+
+  whowas_first = (whowas_first + 1) % whowas_size;
+
+  if (--whowas_count == 0)
+    whowas_strings_head = 0;
 }
 
-/*! \brief Unlinks a Whowas struct from its associated lists
- *         and frees memory.
- * \param whowas Pointer to Whowas struct to be unlinked and freed.
+/*! \brief Finds room for len bytes in the string ring, evicting the
+ *         oldest entries as far as necessary.
+ * \param len Number of bytes needed
+ * \return Offset of the reserved bytes
  */
-static void
-whowas_free(struct Whowas *whowas)
+static uint32_t
+whowas_strings_alloc(uint32_t len)
 {
-  whowas_unlink(whowas);
-  xfree(whowas);
+  while (whowas_count)
+  {
+    const uint32_t tail = whowas_ring[whowas_first].strings;
+
+    if (whowas_strings_head > tail)
+    {
+      if (whowas_strings_size - whowas_strings_head >= len)
+        break;
+
+      if (len < tail)
+      {
+        whowas_strings_head = 0;  /* Wrap around; the rest of the ring stays unused */
+        break;
+      }
+    }
+    else if (tail - whowas_strings_head > len)
+      break;
+
+    whowas_evict();
+  }
+
+  const uint32_t offset = whowas_strings_head;
+  whowas_strings_head += len;
+  return offset;
 }
 
-/*! \brief Returns a Whowas struct for further use. Either allocates
- *         a new one, or returns the oldest entry from the whowas_list
- *         if it ran over ConfigGeneral.whowas_history_length
+/*! \brief Records a history entry. Strings are copied from the template,
+ *         everything else is taken as is.
+ * \param tmpl Template of the entry to be added
  */
-static struct Whowas *
-whowas_make(void)
+static void
+whowas_insert(const struct Whowas *tmpl)
 {
-  struct Whowas *whowas;
+  const char *const src[] =
+  {
+    tmpl->account, tmpl->name, tmpl->username, tmpl->hostname,
+    tmpl->realhost, tmpl->sockhost, tmpl->realname, tmpl->servername
+  };
+  size_t len[sizeof(src) / sizeof(src[0])];
+  uint32_t total = 0;
 
-  if (dlink_list_length(&whowas_list) &&
-      dlink_list_length(&whowas_list) >= ConfigGeneral.whowas_history_length)
-    whowas = whowas_unlink(whowas_list.tail->data);  /* Re-use oldest item */
-  else
-    whowas = xcalloc(sizeof(*whowas));
+  if (whowas_size == 0)
+    return;
+
+  for (unsigned int i = 0; i < sizeof(src) / sizeof(src[0]); ++i)
+    total += (len[i] = strlen(src[i]) + 1);
 
-  return whowas;
+  assert(total <= WHOWAS_STRINGS_MAX);
+
+  if (whowas_count == whowas_size)
+    whowas_evict();
+
+  const uint32_t strings = whowas_strings_alloc(total);
+  const uint32_t slot = (whowas_first + whowas_count++) % whowas_size;
+  struct Whowas *const whowas = &whowas_ring[slot];
+  const char *dst[sizeof(src) / sizeof(src[0])];
+  char *p = whowas_strings + strings;
+
+  for (unsigned int i = 0; i < sizeof(src) / sizeof(src[0]); ++i)
+  {
+    memcpy(p, src[i], len[i]);
+    dst[i] = p;
+    p += len[i];
+  }
+
+  memset(whowas, 0, sizeof(*whowas));
+  whowas->strings = strings;
+  whowas->strings_len = total;
+  whowas->hashv = tmpl->hashv;
+  whowas->shide = tmpl->shide;
+  whowas->logoff = tmpl->logoff;
+  whowas->account = dst[0];
+  whowas->name = dst[1];
+  whowas->username = dst[2];
+  whowas->hostname = dst[3];
+  whowas->realhost = dst[4];
+  whowas->sockhost = dst[5];
+  whowas->realname = dst[6];
+  whowas->servername = dst[7];
+  whowas->online = tmpl->online;
+
+  if (whowas->online)
+    dlinkAdd(whowas, &whowas->cnode, &whowas->online->whowas_list);
+
+  whowas->hprev = WHOWAS_NONE;
+  whowas->hnext = whowas_hash[whowas->hashv];
+  if (whowas->hnext != WHOWAS_NONE)
+    whowas_ring[whowas->hnext].hprev = slot;
+  whowas_hash[whowas->hashv] = slot;
 }
 
-/*! \brief Trims the whowas_list if necessary until there are no
- *         more than ConfigGeneral.whowas_history_length Whowas
- *         struct items.
+/*! \brief Resizes the rings to ConfigGeneral.whowas_history_length
+ *         slots if that has changed. The newest entries are kept.
  */
 void
 whowas_trim(void)
 {
-  while (dlink_list_length(&whowas_list) &&
-         dlink_list_length(&whowas_list) >= ConfigGeneral.whowas_history_length)
-    whowas_free(whowas_list.tail->data);
+  struct Whowas *const old_ring = whowas_ring;
+  char *const old_strings = whowas_strings;
+  const uint32_t old_size = whowas_size;
+  const uint32_t old_first = whowas_first;
+  const uint32_t old_count = whowas_count;
+
+  if (old_ring && whowas_size == ConfigGeneral.whowas_history_length)
+    return;
+
+  whowas_size = ConfigGeneral.whowas_history_length;
+  whowas_ring = whowas_size ? xcalloc(whowas_size * sizeof(*whowas_ring)) : NULL;
+  whowas_strings_size = whowas_size * WHOWAS_STRINGS_AVG + WHOWAS_STRINGS_MAX;
+  whowas_strings = xcalloc(whowas_strings_size);
+  whowas_strings_head = 0;
+  whowas_first = 0;
+  whowas_count = 0;
+
+  for (unsigned int i = 0; i < HASHSIZE; ++i)
+    whowas_hash[i] = WHOWAS_NONE;
+
+  for (uint32_t i = 0; i < old_count; ++i)
+  {
+    struct Whowas *const whowas = &old_ring[(old_first + i) % old_size];
+
+    if (whowas->online)
+      dlinkDelete(&whowas->cnode, &whowas->online->whowas_list);
+
+    if (old_count - i <= whowas_size)
+      whowas_insert(whowas);
+  }
+
+  xfree(old_ring);
+  xfree(old_strings);
 }
 
 /*! \brief Adds the currently defined name of the client to history.
@@ -116,33 +257,24 @@ whowas_trim(void)
 void
 whowas_add_history(struct Client *client_p, const int online)
 {
-  struct Whowas *whowas = whowas_make();
+  struct Whowas whowas;
 
   assert(IsClient(client_p));
 
-  whowas->hashv = strhash(client_p->name);
-  whowas->shide = IsHidden(client_p->servptr) != 0;
-  whowas->logoff = CurrentTime;
-
-  strlcpy(whowas->account, client_p->account, sizeof(whowas->account));
-  strlcpy(whowas->name, client_p->name, sizeof(whowas->name));
-  strlcpy(whowas->username, client_p->username, sizeof(whowas->username));
-  strlcpy(whowas->hostname, client_p->host, sizeof(whowas->hostname));
-  strlcpy(whowas->realhost, client_p->realhost, sizeof(whowas->realhost));
-  strlcpy(whowas->sockhost, client_p->sockhost, sizeof(whowas->sockhost));
-  strlcpy(whowas->realname, client_p->info, sizeof(whowas->realname));
-  strlcpy(whowas->servername, client_p->servptr->name, sizeof(whowas->servername));
+  whowas.hashv = strhash(client_p->name);
+  whowas.shide = IsHidden(client_p->servptr) != 0;
+  whowas.logoff = CurrentTime;
+  whowas.account = client_p->account;
+  whowas.name = client_p->name;
+  whowas.username = client_p->username;
+  whowas.hostname = client_p->host;
+  whowas.realhost = client_p->realhost;
+  whowas.sockhost = client_p->sockhost;
+  whowas.realname = client_p->info;
+  whowas.servername = client_p->servptr->name;
+  whowas.online = online ? client_p : NULL;
 
-  if (online)
-  {
-    whowas->online = client_p;
-    dlinkAdd(whowas, &whowas->cnode, &client_p->whowas_list);
-  }
-  else
-    whowas->online = NULL;
-
-  dlinkAdd(whowas, &whowas->hnode, &whowas_hash[whowas->hashv]);
-  dlinkAdd(whowas, &whowas->lnode, &whowas_list);
+  whowas_insert(&whowas);
 }
 
 /*! \brief This must be called when the client structure is about to
@@ -171,14 +303,11 @@ whowas_off_history(struct Client *client_p)
 struct Client *
 whowas_get_history(const char *name, uintmax_t timelimit)
 {
-  dlink_node *node;
-
   timelimit = CurrentTime - timelimit;
 
-  DLINK_FOREACH(node, whowas_hash[strhash(name)].head)
+  for (const struct Whowas *whowas = whowas_get_hash(strhash(name)); whowas;
+       whowas = whowas_next(whowas))
   {
-    struct Whowas *whowas = node->data;
-
     if (whowas->logoff < timelimit)
       continue;
     if (irccmp(name, whowas->name))
@@ -189,11 +318,12 @@ whowas_get_history(const char *name, uintmax_t timelimit)
   return NULL;
 }
 
-/*! \brief For debugging. Counts allocated structures stored in whowas_list
+/*! \brief For debugging. Counts entries and the memory of both rings
+ *         and the hash table.
  */
 void
 whowas_count_memory(unsigned int *const count, size_t *const bytes)
 {
-  (*count) = dlink_list_length(&whowas_list);
-  (*bytes) = dlink_list_length(&whowas_list) * sizeof(struct Whowas);
+  (*count) = whowas_count;
+  (*bytes) = whowas_size * sizeof(struct Whowas) + whowas_strings_size + sizeof(whowas_hash);
 }
@@ -0,0 +1,596 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file worker.c
+ * \brief Worker threads for work that is moved off the main loop.
+ * \version $Id$
+ *
+ * The main loop stays single-threaded. Each worker owns two lock-free
+ * single-producer/single-consumer rings: the main thread is the only
+ * producer of the inbound ring, the worker the only producer of the
+ * outbound one. Finished jobs are announced through a pipe that is
+ * polled like any other descriptor, so done() handlers always run from
+ * within comm_select().
+ *
+ * A worker sleeps in poll() on its own wakeup pipe and on the
+ * descriptors it has been handed with worker_watch(). Neither side ever
+ * blocks on a full ring: jobs that don't fit are kept on an overflow
+ * list by their producer and moved over once there's room again.
+ */
+
+#include "stdinc.h"
+#include "fdlist.h"
+#include "s_bsd.h"
+#include "log.h"
+#include "memory.h"
+#include "worker.h"
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#include <poll.h>
+
+enum
+{
+  CACHELINE_SIZE       = 64,
+  WORKER_BACKLOG_POLL  = 10  /**< Milliseconds between attempts to flush the outbound overflow list */
+};
+
+struct spsc_ring
+{
+  unsigned int head;  /**< Next slot to consume; written by the consumer only */
+  char pad1[CACHELINE_SIZE - sizeof(unsigned int)];
+  unsigned int tail;  /**< Next slot to fill; written by the producer only */
+  char pad2[CACHELINE_SIZE - sizeof(unsigned int)];
+  struct worker_job *slot[WORKER_QUEUE_SIZE];
+};
+
+struct job_list
+{
+  struct worker_job *head;
+  struct worker_job *tail;
+};
+
+struct worker
+{
+  struct spsc_ring in;   /**< Main thread -> worker */
+  struct spsc_ring out;  /**< Worker -> main thread */
+  pthread_t thread;
+  int pipe[2];  /**< Wakes the worker up from poll() */
+  int wakeup_pending;  /**< A byte has been written to pipe and not read yet */
+  int congested;  /**< The main thread has jobs on its overflow list */
+
+  /* Main thread only */
+  struct job_list pending;  /**< Jobs that didn't fit into the inbound ring */
+  unsigned int queued;  /**< Submitted jobs that haven't come back yet */
+  unsigned int sockets;  /**< Descriptors assigned with worker_assign() */
+
+  /* Worker thread only */
+  struct job_list backlog;  /**< Jobs that didn't fit into the outbound ring */
+  struct pollfd *pfd;  /**< Poll set; slot 0 is the wakeup pipe */
+  struct worker_fd **fds;  /**< Owner of each slot of pfd */
+  unsigned int nfds;
+  unsigned int maxfds;
+};
+
+static struct worker *worker_table;
+static unsigned int worker_num;
+static unsigned int worker_next;
+static unsigned int worker_jobs_queued;
+static unsigned int worker_sockets_assigned;
+static uintmax_t worker_jobs_completed;
+
+static int worker_wakeup_pending;
+static int worker_pipe[2] = { -1, -1 };
+
+
+static int
+spsc_push(struct spsc_ring *ring, struct worker_job *job)
+{
+  const unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+
+  if (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == WORKER_QUEUE_SIZE)
+    return 0;
+
+  ring->slot[tail & (WORKER_QUEUE_SIZE - 1)] = job;
+  __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+  return 1;
+}
+
+static struct worker_job *
+spsc_pop(struct spsc_ring *ring)
+{
+  const unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+
+  if (head == __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE))
+    return NULL;
+
+  struct worker_job *job = ring->slot[head & (WORKER_QUEUE_SIZE - 1)];
+  __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+  return job;
+}
+
+static void
+job_list_add(struct job_list *list, struct worker_job *job)
+{
+  job->next = NULL;
+
+  if (list->tail)
+    list->tail->next = job;
+  else
+    list->head = job;
+  list->tail = job;
+}
+
+/*! \brief Moves as many jobs from an overflow list to a ring as fit.
+ * \return Number of jobs moved
+ */
+static unsigned int
+job_list_flush(struct job_list *list, struct spsc_ring *ring)
+{
+  unsigned int count = 0;
+
+  while (list->head && spsc_push(ring, list->head))
+  {
+    list->head = list->head->next;
+    ++count;
+  }
+
+  if (list->head == NULL)
+    list->tail = NULL;
+  return count;
+}
+
+/*! \brief Interrupts the poll() of a worker. Only the first job after
+ *         the worker has last looked at its inbound ring costs a write().
+ */
+static void
+worker_wakeup(struct worker *w)
+{
+  if (__atomic_exchange_n(&w->wakeup_pending, 1, __ATOMIC_ACQ_REL) == 0)
+  {
+    ssize_t ret = write(w->pipe[1], "", 1);
+    (void)ret;  /* EAGAIN means there's a wakeup pending already */
+  }
+}
+
+/*! \brief Tells the main loop that finished jobs are waiting. Only the
+ *         first completion after the main thread has drained the
+ *         outbound rings costs a write().
+ */
+static void
+worker_wakeup_main(void)
+{
+  if (__atomic_exchange_n(&worker_wakeup_pending, 1, __ATOMIC_ACQ_REL) == 0)
+  {
+    ssize_t ret = write(worker_pipe[1], "", 1);
+    (void)ret;  /* EAGAIN means there's a wakeup pending already */
+  }
+}
+
+/*! \brief Keeps a job on the worker after run() has returned. It is
+ *         handed back later with worker_post().
+ * \param job Job that is being run
+ */
+void
+worker_hold(struct worker_job *job)
+{
+  job->held = 1;
+}
+
+/*! \brief Hands a job from a worker over to the main loop, which then
+ *         calls its done() handler. Jobs that don't come from the main
+ *         thread have no run() handler.
+ * \param w Worker the calling thread belongs to
+ * \param job Job to be finished
+ */
+void
+worker_post(struct worker *w, struct worker_job *job)
+{
+  if (w->backlog.head == NULL && spsc_push(&w->out, job))
+  {
+    worker_wakeup_main();
+    return;
+  }
+
+  job_list_add(&w->backlog, job);
+}
+
+/*! \brief Adds a descriptor to the poll set of a worker. Must be called
+ *         from within run() of a job that has been queued on w.
+ */
+void
+worker_watch(struct worker *w, struct worker_fd *wfd)
+{
+  if (w->nfds == w->maxfds)
+  {
+    w->maxfds *= 2;
+    w->pfd = xrealloc(w->pfd, sizeof(*w->pfd) * w->maxfds);
+    w->fds = xrealloc(w->fds, sizeof(*w->fds) * w->maxfds);
+  }
+
+  wfd->index = w->nfds++;
+  w->fds[wfd->index] = wfd;
+  w->pfd[wfd->index].fd = wfd->fd;
+  w->pfd[wfd->index].events = 0;
+  w->pfd[wfd->index].revents = 0;
+}
+
+/*! \brief Removes a descriptor from the poll set of a worker. Must be
+ *         called from within run() of a job that has been queued on w.
+ */
+void
+worker_unwatch(struct worker *w, struct worker_fd *wfd)
+{
+  const unsigned int last = --w->nfds;
+
+  assert(w->fds[wfd->index] == wfd);
+
+  w->pfd[wfd->index] = w->pfd[last];
+  w->fds[wfd->index] = w->fds[last];
+  w->fds[wfd->index]->index = wfd->index;
+}
+
+static void *
+worker_main(void *arg)
+{
+  struct worker *const w = arg;
+
+  while (1)
+  {
+    if (w->backlog.head && job_list_flush(&w->backlog, &w->out))
+      worker_wakeup_main();
+
+    /*
+     * While the main thread is behind on the outbound ring, don't read
+     * any more data for it, but keep on writing what's been queued.
+     */
+    for (unsigned int i = 1; i < w->nfds; ++i)
+    {
+      const struct worker_fd *wfd = w->fds[i];
+      short events = w->backlog.head ? wfd->events & ~POLLIN : wfd->events;
+
+      w->pfd[i].fd = events ? wfd->fd : -1;
+      w->pfd[i].events = events;
+    }
+
+    if (poll(w->pfd, w->nfds, w->backlog.head ? WORKER_BACKLOG_POLL : -1) < 0)
+      continue;
+
+    if (w->pfd[0].revents)
+    {
+      char buf[128];
+
+      __atomic_exchange_n(&w->wakeup_pending, 0, __ATOMIC_ACQ_REL);
+
+      while (read(w->pipe[0], buf, sizeof(buf)) > 0)
+        ;
+    }
+
+    /* Handlers may change events, but the poll set stays as it is until the jobs are run */
+    for (unsigned int i = 1; i < w->nfds; ++i)
+      if (w->pfd[i].revents)
+        w->fds[i]->handler(w->fds[i], w->pfd[i].revents);
+
+    struct worker_job *job;
+    while ((job = spsc_pop(&w->in)))
+    {
+      job->held = 0;
+      job->run(job);
+
+      if (job->held == 0)
+        worker_post(w, job);
+    }
+
+    /* There's room in the inbound ring again; let the main thread refill it */
+    if (__atomic_load_n(&w->congested, __ATOMIC_ACQUIRE))
+      worker_wakeup_main();
+  }
+
+  return NULL;
+}
+
+/*! \brief Read handler for the wakeup pipe. Runs the done() handlers
+ *         of all jobs that have been finished in the meantime.
+ */
+static void
+worker_read_completions(fde_t *F, void *data)
+{
+  char buf[128];
+
+  __atomic_exchange_n(&worker_wakeup_pending, 0, __ATOMIC_ACQ_REL);
+
+  while (read(F->fd, buf, sizeof(buf)) > 0)
+    ;
+
+  for (unsigned int i = 0; i < worker_num; ++i)
+  {
+    struct worker *const w = &worker_table[i];
+    struct worker_job *job;
+
+    while ((job = spsc_pop(&w->out)))
+    {
+      if (job->run)
+      {
+        --w->queued;
+        --worker_jobs_queued;
+        ++worker_jobs_completed;
+      }
+
+      job->done(job);
+    }
+  }
+
+  for (unsigned int i = 0; i < worker_num; ++i)
+  {
+    struct worker *const w = &worker_table[i];
+
+    if (w->pending.head == NULL)
+      continue;
+
+    if (job_list_flush(&w->pending, &w->in))
+      worker_wakeup(w);
+
+    __atomic_store_n(&w->congested, w->pending.head != NULL, __ATOMIC_RELEASE);
+  }
+
+  comm_setselect(F, COMM_SELECT_READ, worker_read_completions, NULL, 0);
+}
+
+static int
+worker_pipe_open(int fds[2])
+{
+  if (pipe(fds))
+    return 0;
+
+  fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+  fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL, 0) | O_NONBLOCK);
+  return 1;
+}
+
+/*! \brief Starts the worker threads. Has to be called after any fork()
+ *         and once the network I/O loop has been initialized.
+ * \param count Number of threads to start; 0 disables offloading
+ */
+void
+worker_init(unsigned int count)
+{
+  sigset_t set, oldset;
+
+  if (count == 0)
+    return;
+
+  if (count > WORKER_MAX)
+    count = WORKER_MAX;
+
+  if (!worker_pipe_open(worker_pipe))
+  {
+    ilog(LOG_TYPE_IRCD, "worker_init: couldn't create wakeup pipe: %s",
+         strerror(errno));
+    return;
+  }
+
+  fd_open(worker_pipe[1], 0, "Worker wakeup pipe (write)");
+  comm_setselect(fd_open(worker_pipe[0], 0, "Worker wakeup pipe (read)"),
+                 COMM_SELECT_READ, worker_read_completions, NULL, 0);
+
+  worker_table = xcalloc(sizeof(*worker_table) * count);
+
+  /* Signals are meant for the main thread only */
+  sigfillset(&set);
+  pthread_sigmask(SIG_BLOCK, &set, &oldset);
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    struct worker *const w = &worker_table[i];
+
+    if (!worker_pipe_open(w->pipe))
+    {
+      ilog(LOG_TYPE_IRCD, "worker_init: couldn't create wakeup pipe for worker thread %u: %s",
+           i, strerror(errno));
+      break;
+    }
+
+    fd_open(w->pipe[0], 0, "Worker thread wakeup pipe (read)");
+    fd_open(w->pipe[1], 0, "Worker thread wakeup pipe (write)");
+
+    w->maxfds = 64;
+    w->pfd = xcalloc(sizeof(*w->pfd) * w->maxfds);
+    w->fds = xcalloc(sizeof(*w->fds) * w->maxfds);
+    w->pfd[0].fd = w->pipe[0];
+    w->pfd[0].events = POLLIN;
+    w->nfds = 1;
+
+    int ret = pthread_create(&w->thread, NULL, worker_main, w);
+    if (ret)
+    {
+      ilog(LOG_TYPE_IRCD, "worker_init: couldn't start worker thread %u: %s",
+           i, strerror(ret));
+      break;
+    }
+
+    ++worker_num;
+  }
+
+  pthread_sigmask(SIG_SETMASK, &oldset, NULL);
+
+  ilog(LOG_TYPE_IRCD, "Started %u worker threads", worker_num);
+}
+
+static int
+worker_push(struct worker *w, struct worker_job *job)
+{
+  job->worker = w;
+
+  if (w->pending.head || !spsc_push(&w->in, job))
+    return 0;
+
+  ++w->queued;
+  ++worker_jobs_queued;
+
+  worker_wakeup(w);
+  return 1;
+}
+
+/*! \brief Queues a job on the next worker, in round-robin order, that has room.
+ * \param job Job to be run
+ * \return 1 if the job has been queued, 0 if there's no worker
+ *         available. In the latter case the caller is expected to
+ *         do the work inline.
+ */
+int
+worker_submit(struct worker_job *job)
+{
+  for (unsigned int i = 0; i < worker_num; ++i)
+    if (worker_push(&worker_table[worker_next++ % worker_num], job))
+      return 1;
+
+  return 0;
+}
+
+/*! \brief Queues a job on a particular worker. Unlike worker_submit(),
+ *         this cannot fail: if the worker's ring is full, the job waits
+ *         on an overflow list. Jobs that are queued on the same worker
+ *         are run in the order they have been submitted.
+ * \param w Worker as returned by worker_assign()
+ * \param job Job to be run
+ */
+void
+worker_submit_to(struct worker *w, struct worker_job *job)
+{
+  if (worker_push(w, job))
+    return;
+
+  ++w->queued;
+  ++worker_jobs_queued;
+
+  job_list_add(&w->pending, job);
+  __atomic_store_n(&w->congested, 1, __ATOMIC_RELEASE);
+}
+
+/*! \brief Picks the worker with the fewest descriptors to take over a new one.
+ * \return Worker to be passed to worker_submit_to(), or NULL if there are
+ *         no worker threads
+ */
+struct worker *
+worker_assign(void)
+{
+  struct worker *best = NULL;
+
+  for (unsigned int i = 0; i < worker_num; ++i)
+    if (best == NULL || worker_table[i].sockets < best->sockets)
+      best = &worker_table[i];
+
+  if (best)
+  {
+    ++best->sockets;
+    ++worker_sockets_assigned;
+  }
+
+  return best;
+}
+
+/*! \brief Gives back a descriptor that has been assigned with worker_assign() */
+void
+worker_unassign(struct worker *w)
+{
+  --w->sockets;
+  --worker_sockets_assigned;
+}
+#else
+void
+worker_init(unsigned int count)
+{
+  if (count)
+    ilog(LOG_TYPE_IRCD, "Worker threads are not supported on this platform");
+}
+
+int
+worker_submit(struct worker_job *job)
+{
+  return 0;
+}
+
+void
+worker_submit_to(struct worker *w, struct worker_job *job)
+{
+  assert(0);
+}
+
+struct worker *
+worker_assign(void)
+{
+  return NULL;
+}
+
+void
+worker_unassign(struct worker *w)
+{
+}
+
+void
+worker_hold(struct worker_job *job)
+{
+}
+
+void
+worker_post(struct worker *w, struct worker_job *job)
+{
+}
+
+void
+worker_watch(struct worker *w, struct worker_fd *wfd)
+{
+}
+
+void
+worker_unwatch(struct worker *w, struct worker_fd *wfd)
+{
+}
+
+static const unsigned int worker_num;
+static const unsigned int worker_sockets_assigned;
+static const unsigned int worker_jobs_queued;
+static const uintmax_t worker_jobs_completed;
+#endif  /* HAVE_PTHREAD_H */
+
+unsigned int
+worker_count(void)
+{
+  return worker_num;
+}
+
+unsigned int
+worker_sockets(void)
+{
+  return worker_sockets_assigned;
+}
+
+unsigned int
+worker_queued(void)
+{
+  return worker_jobs_queued;
+}
+
+uintmax_t
+worker_completed(void)
+{
+  return worker_jobs_completed;
+}
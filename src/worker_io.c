@@ -0,0 +1,580 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file worker_io.c
+ * \brief Client sockets that are read from and written to by worker threads.
+ * \version $Id$
+ *
+ * With worker threads, read_packet() hands every connection over to one
+ * of them once it has been accepted, the TLS handshake is done and the
+ * connection is ready to be read from. The worker then does all recv(),
+ * send() and TLS record processing on that socket.
+ *
+ * Complete lines travel to the main thread in batches through the
+ * worker's outbound ring, where they're appended to the recvq and parsed
+ * as before. For output, the main thread copies a block off the head of
+ * the sendq and queues it on the inbound ring; the sendq is only trimmed
+ * once the worker reports what it has written. Sendq limits, flood
+ * control and the parser itself therefore don't notice the difference.
+ *
+ * Jobs on the same worker are run in order, and so are the ones it hands
+ * back, so the detach job of a closing connection always comes back last.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "fdlist.h"
+#include "s_bsd.h"
+#include "send.h"
+#include "packet.h"
+#include "memory.h"
+#include "irc_string.h"
+#include "misc.h"
+#include "worker.h"
+#include "worker_io.h"
+
+#ifdef HAVE_PTHREAD_H
+#include <poll.h>
+
+/*! \brief A block of the sendq, or what's left of it once the connection is closed */
+struct worker_io_block
+{
+  struct worker_job job;
+  struct worker_io *io;
+  size_t length;
+  size_t written;   /**< Bytes the worker has written so far */
+  unsigned int records;  /**< TLS records these took */
+  int error;  /**< errno of a failed write */
+  char data[];
+};
+
+/*! \brief Lines a worker has read, or the result of a failed read */
+struct worker_io_lines
+{
+  struct worker_job job;
+  struct worker_io *io;
+  int length;  /**< What the read returned if 0 or less */
+  int error;
+  char data[];
+};
+
+struct worker_io
+{
+  struct worker_fd wfd;  /**< Must be first */
+  struct worker *worker;
+  struct worker_job attach;
+
+  /* Main thread only */
+  fde_t *F;
+  struct Client *client;  /**< NULL once the connection is being closed */
+  char *cipher;  /**< TLS cipher, as it can't be looked up once the worker owns the state */
+  size_t sending;  /**< Size of the block the worker is writing, if any */
+
+  /* Worker thread only, once attached */
+  tls_data_t *tls;  /**< NULL for plain connections */
+  unsigned int ktls_send;
+  unsigned int eof;  /**< A failed read has been reported; don't read any more */
+  unsigned int read_wants_write;
+  unsigned int write_wants_read;
+  unsigned int record_size;  /**< See send_tls_record() */
+  unsigned int pending;
+  time_t last_write;
+  struct worker_io_block *block;  /**< Block that's being written */
+  unsigned int readlen;
+  char readbuf[WORKER_IO_READBUF_SIZE];
+};
+
+static void worker_io_lines_done(struct worker_job *);
+
+
+static void
+worker_io_post_lines(struct worker_io *io, const char *buf, int length, int error)
+{
+  struct worker_io_lines *lines = xcalloc(sizeof(*lines) + (length > 0 ? length : 0));
+
+  lines->job.done = worker_io_lines_done;
+  lines->job.data = lines;
+  lines->io = io;
+  lines->length = length;
+  lines->error = error;
+
+  if (length > 0)
+    memcpy(lines->data, buf, length);
+
+  worker_post(io->worker, &lines->job);
+}
+
+/*
+ * worker_io_split - hands everything up to and including the last end of
+ * line in readbuf over to the main thread. Overlong lines are passed on
+ * as they are; extract_one_line() truncates them anyway.
+ */
+static void
+worker_io_split(struct worker_io *io)
+{
+  unsigned int length = io->readlen;
+
+  while (length && !IsEol(io->readbuf[length - 1]))
+    --length;
+
+  if (length == 0)
+  {
+    if (io->readlen < IRCD_BUFSIZE)
+      return;
+    length = io->readlen;
+  }
+
+  worker_io_post_lines(io, io->readbuf, length, 0);
+
+  io->readlen -= length;
+  memmove(io->readbuf, io->readbuf + length, io->readlen);
+}
+
+/*
+ * worker_io_read - worker side of read_packet()
+ */
+static void
+worker_io_read(struct worker_io *io)
+{
+  unsigned int space;
+  int length = 0;
+
+  do
+  {
+    int want_write = 0;
+
+    space = sizeof(io->readbuf) - io->readlen;
+
+    if (io->tls)
+    {
+      length = tls_read(io->tls, io->readbuf + io->readlen, space, &want_write);
+      io->read_wants_write = want_write;
+    }
+    else
+      length = recv(io->wfd.fd, io->readbuf + io->readlen, space, 0);
+
+    if (length <= 0)
+    {
+      if (length < 0 && comm_ignore_errno(errno))
+        break;
+
+      io->eof = 1;
+      worker_io_post_lines(io, NULL, length, errno);
+      return;
+    }
+
+    io->readlen += length;
+    worker_io_split(io);
+  } while ((unsigned int)length == space || io->tls);
+}
+
+/*
+ * worker_io_tls_record - worker side of send_tls_record(). Writes as much
+ * of the block as fits into one TLS record.
+ */
+static int
+worker_io_tls_record(struct worker_io *io, struct worker_io_block *block, int *want_read)
+{
+  const time_t now = time(NULL);
+  size_t len;
+  int retlen;
+
+  if (io->record_size == 0 || now - io->last_write >= TLS_RECORD_IDLE_TIME)
+    io->record_size = TLS_RECORD_SIZE_MIN;
+
+  /* A write that has to be retried must pass exactly the same data again */
+  if (io->pending)
+    len = io->pending;
+  else
+    len = IRCD_MIN(block->length - block->written, io->record_size);
+
+  if (io->ktls_send)
+    retlen = send(io->wfd.fd, block->data + block->written, len, 0);
+  else
+    retlen = tls_write(io->tls, block->data + block->written, len, want_read);
+
+  if (retlen <= 0)
+  {
+    io->pending = len;
+    return retlen;
+  }
+
+  io->pending = 0;
+  io->last_write = now;
+  ++block->records;
+
+  if (len == io->record_size)
+    io->record_size = IRCD_MIN(io->record_size * 2, TLS_RECORD_SIZE_MAX);
+
+  return retlen;
+}
+
+/*
+ * worker_io_write - worker side of send_queued_write(). Returns 0 if the
+ * socket is blocked and the rest of the block has to wait, 1 otherwise.
+ */
+static int
+worker_io_write(struct worker_io *io, struct worker_io_block *block)
+{
+  while (block->written < block->length)
+  {
+    int want_read = 0;
+    int retlen;
+
+    if (io->tls)
+    {
+      retlen = worker_io_tls_record(io, block, &want_read);
+      io->write_wants_read = want_read;
+
+      if (want_read)
+        return 0;
+    }
+    else
+      retlen = send(io->wfd.fd, block->data + block->written, block->length - block->written, 0);
+
+    if (retlen <= 0)
+    {
+      if (retlen < 0 && comm_ignore_errno(errno))
+        return 0;
+
+      block->error = errno ? errno : EPIPE;
+      return 1;
+    }
+
+    block->written += retlen;
+  }
+
+  return 1;
+}
+
+static void
+worker_io_set_events(struct worker_io *io)
+{
+  short events = 0;
+
+  if (!io->eof)
+    events |= POLLIN;
+  if ((io->block && !io->write_wants_read) || io->read_wants_write)
+    events |= POLLOUT;
+
+  io->wfd.events = events;
+}
+
+/*
+ * worker_io_event - poll() handler on the worker thread
+ */
+static void
+worker_io_event(struct worker_fd *wfd, short revents)
+{
+  struct worker_io *const io = (struct worker_io *)wfd;
+
+  if (io->block && (revents & (POLLOUT | POLLERR | POLLHUP) ||
+                    (io->write_wants_read && (revents & POLLIN))))
+  {
+    if (worker_io_write(io, io->block))
+    {
+      worker_post(io->worker, &io->block->job);
+      io->block = NULL;
+    }
+  }
+
+  if (!io->eof && (revents & (POLLIN | POLLERR | POLLHUP) ||
+                   (io->read_wants_write && (revents & POLLOUT))))
+    worker_io_read(io);
+
+  worker_io_set_events(io);
+}
+
+static void
+worker_io_attach_run(struct worker_job *job)
+{
+  struct worker_io *const io = job->data;
+
+  worker_watch(io->worker, &io->wfd);
+
+  /* The TLS library may hold on to data it has read along with the handshake */
+  worker_io_read(io);
+  worker_io_set_events(io);
+}
+
+static void
+worker_io_attach_done(struct worker_job *job)
+{
+}
+
+static void
+worker_io_block_run(struct worker_job *job)
+{
+  struct worker_io_block *const block = job->data;
+  struct worker_io *const io = block->io;
+
+  assert(io->block == NULL);
+
+  if (!worker_io_write(io, block))
+  {
+    io->block = block;
+    worker_hold(job);
+  }
+
+  worker_io_set_events(io);
+}
+
+static void
+worker_io_block_done(struct worker_job *job)
+{
+  struct worker_io_block *const block = job->data;
+  struct worker_io *const io = block->io;
+
+  if (io->client)
+  {
+    io->sending = 0;
+    send_queued_written(io->client, block->written, block->records, block->error);
+  }
+
+  xfree(block);
+}
+
+static void
+worker_io_lines_done(struct worker_job *job)
+{
+  struct worker_io_lines *const lines = job->data;
+  struct Client *const client_p = lines->io->client;
+
+  if (client_p)
+  {
+    errno = lines->error;
+    read_packet_received(client_p, lines->data, lines->length);
+  }
+
+  xfree(lines);
+}
+
+/*
+ * worker_io_detach_run - gives up the socket. Whatever the block that's
+ * being written and what's left of the sendq don't get out right away
+ * is lost, just like with close_connection() in the main thread.
+ */
+static void
+worker_io_detach_run(struct worker_job *job)
+{
+  struct worker_io_block *const block = job->data;
+  struct worker_io *const io = block->io;
+  int done = 1;
+
+  if (io->block)
+  {
+    done = worker_io_write(io, io->block) && io->block->error == 0;
+
+    worker_post(io->worker, &io->block->job);
+    io->block = NULL;
+  }
+
+  if (done && block->length)
+    worker_io_write(io, block);
+
+  worker_unwatch(io->worker, &io->wfd);
+}
+
+static void
+worker_io_detach_done(struct worker_job *job)
+{
+  struct worker_io_block *const block = job->data;
+  struct worker_io *const io = block->io;
+  fde_t *const F = io->F;
+
+  assert(F->io == io);
+
+  F->io = NULL;
+
+  if (tls_isusing(&F->ssl))
+    tls_shutdown(&F->ssl);
+
+  worker_unassign(io->worker);
+  xfree(io->cipher);
+  xfree(io);
+  xfree(block);
+
+  fd_close(F);
+}
+
+/*! \brief Copies up to WORKER_IO_BLOCK_SIZE bytes of a sendq, starting at offset */
+static struct worker_io_block *
+worker_io_block_new(struct worker_io *io, const struct dbuf_queue *queue, size_t offset)
+{
+  size_t length = 0, pos = queue->pos + offset;
+  size_t size = dbuf_length(queue) > offset ? dbuf_length(queue) - offset : 0;
+  struct worker_io_block *block;
+  dlink_node *node;
+
+  size = IRCD_MIN(size, WORKER_IO_BLOCK_SIZE);
+  block = xcalloc(sizeof(*block) + size);
+  block->job.data = block;
+  block->io = io;
+
+  DLINK_FOREACH(node, queue->blocks.head)
+  {
+    const struct dbuf_block *buf = node->data;
+
+    if (length == size)
+      break;
+
+    if (pos >= buf->size)
+    {
+      pos -= buf->size;
+      continue;
+    }
+
+    size_t n = IRCD_MIN(buf->size - pos, size - length);
+    memcpy(block->data + length, buf->data + pos, n);
+    length += n;
+    pos = 0;
+  }
+
+  block->length = length;
+  return block;
+}
+
+/*! \brief Hands a connection over to a worker thread, which does all
+ *         reading and writing from now on.
+ * \param client_p Client whose socket is ready to be read from
+ * \return 1 if a worker has taken over the socket, 0 if there are no
+ *         worker threads
+ */
+int
+worker_io_attach(struct Client *client_p)
+{
+  fde_t *const F = client_p->connection->fd;
+  struct worker_io *io;
+
+  if (worker_count() == 0)
+    return 0;
+
+  assert(F->io == NULL);
+  assert(F->handshake == NULL);
+
+  io = xcalloc(sizeof(*io));
+  io->worker = worker_assign();
+  io->F = F;
+  io->client = client_p;
+  io->wfd.fd = F->fd;
+  io->wfd.handler = worker_io_event;
+
+  if (tls_isusing(&F->ssl))
+  {
+    io->tls = &F->ssl;
+    io->ktls_send = F->flags.ktls_send;
+    io->cipher = xstrdup(tls_get_cipher(&F->ssl));
+
+    /* Carry on where send_tls_record() has left off */
+    io->record_size = client_p->connection->tls.record_size;
+    io->pending = client_p->connection->tls.pending;
+  }
+
+  /* The main loop doesn't poll the socket any more */
+  comm_setselect(F, COMM_SELECT_READ | COMM_SELECT_WRITE, NULL, NULL, 0);
+  F->io = io;
+
+  io->attach.run = worker_io_attach_run;
+  io->attach.done = worker_io_attach_done;
+  io->attach.data = io;
+  worker_submit_to(io->worker, &io->attach);
+
+  /* Anything that's still queued from before goes out through the worker */
+  DelFlag(client_p, FLAGS_BLOCKED);
+  send_queued_write(client_p);
+  return 1;
+}
+
+/*! \brief Called by fd_close(). Lets the worker write out what it can and
+ *         give up the socket, which is then closed for real.
+ * \param F Descriptor owned by a worker thread
+ */
+void
+worker_io_detach(fde_t *F)
+{
+  struct worker_io *const io = F->io;
+  struct worker_io_block *block;
+
+  if (io->client && !IsDead(io->client))
+    block = worker_io_block_new(io, &io->client->connection->buf_sendq, io->sending);
+  else
+    block = xcalloc(sizeof(*block));
+
+  block->job.run = worker_io_detach_run;
+  block->job.done = worker_io_detach_done;
+  block->job.data = block;
+  block->io = io;
+
+  io->client = NULL;
+  worker_submit_to(io->worker, &block->job);
+}
+
+/*! \brief Hands the next part of a sendq to the worker that owns the
+ *         socket, unless it is still busy with the previous one.
+ * \param to Client whose socket is owned by a worker thread
+ */
+void
+worker_io_send(struct Client *to)
+{
+  struct worker_io *const io = to->connection->fd->io;
+  struct worker_io_block *block;
+
+  if (io->sending || dbuf_length(&to->connection->buf_sendq) == 0)
+    return;
+
+  block = worker_io_block_new(io, &to->connection->buf_sendq, 0);
+  block->job.run = worker_io_block_run;
+  block->job.done = worker_io_block_done;
+
+  io->sending = block->length;
+  worker_submit_to(io->worker, &block->job);
+}
+#else
+int
+worker_io_attach(struct Client *client_p)
+{
+  return 0;
+}
+
+void
+worker_io_detach(fde_t *F)
+{
+}
+
+void
+worker_io_send(struct Client *to)
+{
+}
+#endif  /* HAVE_PTHREAD_H */
+
+/*! \brief Returns the TLS cipher of a connection, whether or not a worker
+ *         thread owns it.
+ */
+const char *
+worker_io_cipher(const fde_t *F)
+{
+#ifdef HAVE_PTHREAD_H
+  if (F->io)
+    return F->io->cipher;
+#endif
+  return tls_get_cipher(&F->ssl);
+}
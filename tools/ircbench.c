@@ -0,0 +1,1090 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2018 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file ircbench.c
+ * \brief Load generator for benchmarking an ircd on the local machine.
+ * \version $Id$
+ *
+ * Opens any number of non-blocking client connections, registers them,
+ * joins them to a set of channels and then issues commands at a fixed
+ * total rate, picked from a configurable mix of PRIVMSG, JOIN, NICK, WHO
+ * and LIST. Every PRIVMSG carries the time it has been sent at, so the
+ * clients receiving it can measure the delivery latency. Optionally the
+ * program also links as a server, bursts users and channels and relays
+ * channel messages from these users, or replays captured traffic.
+ *
+ * Linux only: it uses epoll, and the latency measurement relies on
+ * CLOCK_MONOTONIC being shared by all processes on the machine.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+
+#ifdef __IOPOLL_MECHANISM_EPOLL
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+enum
+{
+  READBUF_SIZE = 4096,
+  HIST_BUCKETS = 496,  /* See hist_index() */
+  MAX_EVENTS = 1024
+};
+
+enum op_type
+{
+  OP_PRIVMSG,
+  OP_JOIN,
+  OP_NICK,
+  OP_WHO,
+  OP_LIST,
+  OP_REMOTE,  /* PRIVMSG from a user of the fake server */
+  OP_COUNT
+};
+
+static const char *const op_names[OP_COUNT] =
+{
+  [OP_PRIVMSG] = "privmsg",
+  [OP_JOIN] = "join",
+  [OP_NICK] = "nick",
+  [OP_WHO] = "who",
+  [OP_LIST] = "list",
+  [OP_REMOTE] = "remote"
+};
+
+enum conn_state
+{
+  STATE_UNUSED,
+  STATE_CONNECTING,
+  STATE_REGISTERING,
+  STATE_ACTIVE,
+  STATE_DEAD
+};
+
+struct conn
+{
+  int fd;
+  unsigned int id;
+  enum conn_state state;
+  int is_server;
+  int want_write;     /* EPOLLOUT is enabled */
+  uint64_t started;   /* When connect() has been called, in nanoseconds */
+  unsigned int channel;   /* Channel the client is in */
+  unsigned int nick_gen;  /* Bumped on every nick change */
+  char nick[32];
+  char rbuf[READBUF_SIZE];
+  size_t rlen;
+  char *wbuf;
+  size_t wlen;
+  size_t wsize;
+};
+
+/* Latency histogram. Values are nanoseconds, buckets have a precision of 12.5%. */
+struct hist
+{
+  uint64_t bucket[HIST_BUCKETS];
+  uint64_t count;
+  uint64_t sum;
+  uint64_t max;
+};
+
+struct counters
+{
+  uint64_t sent[OP_COUNT];
+  uint64_t replayed;
+  uint64_t lines_received;
+  uint64_t delivered;  /* PRIVMSGs carrying a timestamp that have arrived */
+  struct hist latency;
+  struct hist registration;
+};
+
+struct replay_line
+{
+  uint64_t at;  /* Offset from the start of the replay, in nanoseconds */
+  unsigned int client;
+  char *line;
+};
+
+static struct
+{
+  const char *host;
+  unsigned int port;
+  unsigned int clients;
+  unsigned int sources;       /* Number of 127.0.0.x source addresses to spread clients over */
+  unsigned int connect_rate;  /* Connections started per second */
+  unsigned int rate;          /* Commands per second, all clients together */
+  unsigned int channels;
+  unsigned int duration;      /* Seconds to run once all clients are connected */
+  unsigned int interval;      /* Seconds between reports */
+  unsigned int weight[OP_COUNT];
+  const char *replay;
+  const char *server_name;    /* Fake server to link as; NULL for none */
+  const char *server_sid;
+  const char *server_password;
+  unsigned int server_users;
+} config =
+{
+  .host = "127.0.0.1",
+  .port = 6667,
+  .clients = 1000,
+  .sources = 1,
+  .connect_rate = 1000,
+  .rate = 1000,
+  .channels = 100,
+  .duration = 30,
+  .interval = 1,
+  .weight = { [OP_PRIVMSG] = 80, [OP_JOIN] = 5, [OP_NICK] = 5, [OP_WHO] = 9, [OP_LIST] = 1 },
+  .server_sid = "9BE",
+  .server_password = "bench",
+  .server_users = 10000
+};
+
+static struct conn *conn_table;
+static struct conn *server_conn;
+static int epoll_fd;
+static struct sockaddr_in server_addr;
+
+static unsigned int clients_started;
+static unsigned int clients_active;
+static unsigned int clients_dead;
+
+static struct counters total;
+static struct counters interval;
+
+static struct replay_line *replay_table;
+static unsigned int replay_count;
+static unsigned int replay_next;
+
+static uint64_t burst_sent;  /* When the fake server has sent EOB */
+static uint64_t burst_done;  /* When the PONG following EOB has arrived */
+static volatile sig_atomic_t stop;
+
+
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static unsigned int
+hist_index(uint64_t v)
+{
+  if (v < 8)
+    return v;
+
+  const unsigned int msb = 63 - __builtin_clzll(v);
+  return ((msb - 2) << 3) | ((v >> (msb - 3)) & 7);
+}
+
+/* Lowest value that falls into bucket i */
+static uint64_t
+hist_value(unsigned int i)
+{
+  if (i < 8)
+    return i;
+
+  const unsigned int msb = (i >> 3) + 2;
+  return (uint64_t)(8 | (i & 7)) << (msb - 3);
+}
+
+static void
+hist_add(struct hist *h, uint64_t v)
+{
+  ++h->bucket[hist_index(v)];
+  ++h->count;
+  h->sum += v;
+
+  if (h->max < v)
+    h->max = v;
+}
+
+static uint64_t
+hist_percentile(const struct hist *h, double percent)
+{
+  const uint64_t rank = (uint64_t)(h->count * percent / 100.0 + 0.5);
+  uint64_t seen = 0;
+
+  for (unsigned int i = 0; i < HIST_BUCKETS; ++i)
+  {
+    seen += h->bucket[i];
+
+    if (seen && seen >= rank)
+      return hist_value(i) < h->max ? hist_value(i) : h->max;
+  }
+
+  return h->max;
+}
+
+static void
+hist_print(const char *name, const struct hist *h)
+{
+  if (h->count == 0)
+  {
+    printf("  %-12s no samples\n", name);
+    return;
+  }
+
+  printf("  %-12s n=%llu avg %.3fms p50 %.3fms p90 %.3fms p99 %.3fms p99.9 %.3fms max %.3fms\n",
+         name, (unsigned long long)h->count, h->sum / (double)h->count / 1e6,
+         hist_percentile(h, 50) / 1e6, hist_percentile(h, 90) / 1e6,
+         hist_percentile(h, 99) / 1e6, hist_percentile(h, 99.9) / 1e6, h->max / 1e6);
+}
+
+static void
+conn_update_events(struct conn *c)
+{
+  const int want_write = c->wlen || c->state == STATE_CONNECTING;
+
+  if (want_write == c->want_write)
+    return;
+
+  struct epoll_event ev = { .events = EPOLLIN | (want_write ? EPOLLOUT : 0), .data.ptr = c };
+  epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+  c->want_write = want_write;
+}
+
+static void
+conn_close(struct conn *c)
+{
+  if (c->state == STATE_ACTIVE && !c->is_server)
+    --clients_active;
+
+  if (c->state != STATE_UNUSED && c->state != STATE_DEAD && !c->is_server)
+    ++clients_dead;
+
+  if (c->fd >= 0)
+  {
+    close(c->fd);
+    c->fd = -1;
+  }
+
+  c->state = STATE_DEAD;
+  c->wlen = 0;
+}
+
+static void
+conn_flush(struct conn *c)
+{
+  size_t done = 0;
+
+  while (done < c->wlen)
+  {
+    ssize_t ret = send(c->fd, c->wbuf + done, c->wlen - done, MSG_NOSIGNAL);
+
+    if (ret < 0)
+    {
+      if (errno == EAGAIN || errno == EINTR)
+        break;
+
+      conn_close(c);
+      return;
+    }
+
+    done += ret;
+  }
+
+  memmove(c->wbuf, c->wbuf + done, c->wlen - done);
+  c->wlen -= done;
+  conn_update_events(c);
+}
+
+static void conn_send(struct conn *, const char *, ...) __attribute__((format(printf, 2, 3)));
+
+/* Queues a line and tries to write it right away */
+static void
+conn_send(struct conn *c, const char *fmt, ...)
+{
+  va_list args;
+  char buf[1024];
+
+  if (c->state == STATE_DEAD || c->fd < 0)
+    return;
+
+  va_start(args, fmt);
+  int len = vsnprintf(buf, sizeof(buf) - 2, fmt, args);
+  va_end(args);
+
+  if (len < 0)
+    return;
+  if ((size_t)len > sizeof(buf) - 3)
+    len = sizeof(buf) - 3;
+
+  buf[len++] = '\r';
+  buf[len++] = '\n';
+
+  if (c->wlen + len > c->wsize)
+  {
+    c->wsize = (c->wlen + len) * 2;
+    c->wbuf = realloc(c->wbuf, c->wsize);
+
+    if (c->wbuf == NULL)
+    {
+      perror("realloc");
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  memcpy(c->wbuf + c->wlen, buf, len);
+  c->wlen += len;
+
+  /* Collect the burst in the buffer; it's flushed from the event loop */
+  if (c->state != STATE_CONNECTING && c->wlen < 65536)
+    conn_flush(c);
+  else
+    conn_update_events(c);
+}
+
+static void
+conn_start(struct conn *c)
+{
+  c->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  c->state = STATE_CONNECTING;
+
+  if (c->fd < 0)
+  {
+    conn_close(c);
+    return;
+  }
+
+  if (config.sources > 1)
+  {
+    /* 127.0.0.0/8 is all loopback, use it to get around the ephemeral port limit */
+    struct sockaddr_in local = { .sin_family = AF_INET };
+    local.sin_addr.s_addr = htonl(0x7f000001 + c->id % config.sources);
+    bind(c->fd, (struct sockaddr *)&local, sizeof(local));
+  }
+
+  const int opt = 1;
+  setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+  c->started = now_ns();
+  c->want_write = 1;
+
+  struct epoll_event ev = { .events = EPOLLIN | EPOLLOUT, .data.ptr = c };
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, c->fd, &ev);
+
+  if (connect(c->fd, (struct sockaddr *)&server_addr, sizeof(server_addr)) && errno != EINPROGRESS)
+    conn_close(c);
+}
+
+/* Builds the UID of user number i of the fake server */
+static const char *
+server_uid(unsigned int i)
+{
+  static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  static char uid[16];
+
+  snprintf(uid, sizeof(uid), "%.3s", config.server_sid);
+
+  for (unsigned int j = 0; j < 6; ++j, i /= 36)
+    uid[8 - j] = chars[i % 36];
+  uid[9] = '\0';
+
+  return uid;
+}
+
+/* Sends the fake server's burst: users first, then the channels they are in */
+static void
+server_burst(struct conn *c)
+{
+  const unsigned long ts = time(NULL);
+
+  for (unsigned int i = 0; i < config.server_users; ++i)
+    conn_send(c, ":%s UID r%u 1 %lu + bench%u u%u.bench.test 10.%u.%u.%u %s * :ircbench remote user %u",
+              config.server_sid, i, ts, i % 97, i, (i >> 16) & 255, (i >> 8) & 255, i & 255,
+              server_uid(i), i);
+
+  /* Spread the users over the same channels the clients join */
+  for (unsigned int chan = 0; chan < config.channels; ++chan)
+  {
+    char members[400] = "";
+    size_t len = 0;
+
+    for (unsigned int i = chan; i < config.server_users; i += config.channels)
+    {
+      len += snprintf(members + len, sizeof(members) - len, "%s%s", len ? " " : "",
+                      server_uid(i));
+
+      if (len > sizeof(members) - 20)
+      {
+        conn_send(c, ":%s SJOIN %lu #bench%u +nt :%s", config.server_sid, ts, chan, members);
+        len = 0;
+        members[0] = '\0';
+      }
+    }
+
+    if (len)
+      conn_send(c, ":%s SJOIN %lu #bench%u +nt :%s", config.server_sid, ts, chan, members);
+  }
+
+  conn_send(c, ":%s EOB", config.server_sid);
+  /* The PONG tells when the server is done with the burst */
+  conn_send(c, ":%s PING %s", config.server_sid, config.server_name);
+  burst_sent = now_ns();
+}
+
+static void
+conn_connected(struct conn *c)
+{
+  int err = 0;
+  socklen_t len = sizeof(err);
+
+  if (getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &err, &len) || err)
+  {
+    conn_close(c);
+    return;
+  }
+
+  c->state = STATE_REGISTERING;
+
+  if (c->is_server)
+  {
+    conn_send(c, "PASS %s TS 6 %s", config.server_password, config.server_sid);
+    conn_send(c, "CAPAB :QS EX IE ENCAP TBURST SVS CHW");
+    conn_send(c, "SERVER %s 1 :ircbench", config.server_name);
+    conn_send(c, "SVINFO 6 6 0 :%lu", (unsigned long)time(NULL));
+    server_burst(c);
+    return;
+  }
+
+  snprintf(c->nick, sizeof(c->nick), "b%u", c->id);
+  conn_send(c, "NICK %s", c->nick);
+  conn_send(c, "USER bench 0 * :ircbench client %u", c->id);
+}
+
+static void
+client_registered(struct conn *c)
+{
+  c->state = STATE_ACTIVE;
+  ++clients_active;
+
+  const uint64_t elapsed = now_ns() - c->started;
+  hist_add(&total.registration, elapsed);
+  hist_add(&interval.registration, elapsed);
+
+  c->channel = c->id % config.channels;
+  conn_send(c, "JOIN #bench%u", c->channel);
+}
+
+static void
+client_message(const char *text)
+{
+  const char *p = strstr(text, " :lat ");
+
+  if (p == NULL)
+    return;
+
+  const uint64_t sent = strtoull(p + 6, NULL, 10);
+  const uint64_t now = now_ns();
+
+  if (sent == 0 || sent > now)
+    return;
+
+  ++total.delivered;
+  ++interval.delivered;
+  hist_add(&total.latency, now - sent);
+  hist_add(&interval.latency, now - sent);
+}
+
+static void
+conn_line(struct conn *c, char *line)
+{
+  char *command = line;
+
+  ++total.lines_received;
+  ++interval.lines_received;
+
+  if (*command == ':')
+  {
+    command = strchr(command, ' ');
+    if (command == NULL)
+      return;
+    ++command;
+  }
+
+  if (strncmp(command, "PING ", 5) == 0)
+  {
+    if (c->is_server)
+    {
+      const char *origin = strrchr(command, ':');
+      conn_send(c, ":%s PONG %s %s", config.server_sid, config.server_name,
+                origin ? origin + 1 : "");
+    }
+    else
+      conn_send(c, "PONG %s", command + 5);
+    return;
+  }
+
+  if (strncmp(command, "ERROR ", 6) == 0)
+  {
+    fprintf(stderr, "%s %u: %s\n", c->is_server ? "server" : "client", c->id, command);
+    conn_close(c);
+    return;
+  }
+
+  if (c->is_server)
+  {
+    if (strncmp(command, "PONG ", 5) == 0 && burst_sent && burst_done == 0)
+    {
+      burst_done = now_ns();
+      c->state = STATE_ACTIVE;
+    }
+
+    return;
+  }
+
+  if (strncmp(command, "PRIVMSG ", 8) == 0)
+    client_message(command);
+  else if (strncmp(command, "001 ", 4) == 0 && c->state == STATE_REGISTERING)
+    client_registered(c);
+  else if (strncmp(command, "433 ", 4) == 0)
+  {
+    snprintf(c->nick, sizeof(c->nick), "b%ux%u", c->id, ++c->nick_gen);
+    conn_send(c, "NICK %s", c->nick);
+  }
+}
+
+static void
+conn_read(struct conn *c)
+{
+  while (1)
+  {
+    ssize_t ret = recv(c->fd, c->rbuf + c->rlen, sizeof(c->rbuf) - c->rlen - 1, 0);
+
+    if (ret < 0 && (errno == EAGAIN || errno == EINTR))
+      return;
+
+    if (ret <= 0)
+    {
+      conn_close(c);
+      return;
+    }
+
+    c->rlen += ret;
+    c->rbuf[c->rlen] = '\0';
+
+    char *line = c->rbuf, *eol;
+    while ((eol = memchr(line, '\n', c->rlen - (line - c->rbuf))))
+    {
+      *eol = '\0';
+      if (eol > line && eol[-1] == '\r')
+        eol[-1] = '\0';
+
+      conn_line(c, line);
+
+      if (c->state == STATE_DEAD)
+        return;
+
+      line = eol + 1;
+    }
+
+    c->rlen -= line - c->rbuf;
+    memmove(c->rbuf, line, c->rlen);
+
+    /* A line that doesn't fit is a protocol violation; drop it */
+    if (c->rlen == sizeof(c->rbuf) - 1)
+      c->rlen = 0;
+  }
+}
+
+static void
+conn_event(struct conn *c, uint32_t events)
+{
+  if (c->state == STATE_CONNECTING)
+  {
+    if (!(events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+      return;
+
+    conn_connected(c);
+  }
+
+  if (c->state != STATE_DEAD && (events & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+    conn_read(c);
+
+  if (c->state != STATE_DEAD && c->wlen)
+    conn_flush(c);
+}
+
+static struct conn *
+random_active_client(void)
+{
+  if (clients_active == 0)
+    return NULL;
+
+  for (unsigned int tries = 0; tries < 16; ++tries)
+  {
+    struct conn *c = &conn_table[(unsigned int)random() % config.clients];
+
+    if (c->state == STATE_ACTIVE)
+      return c;
+  }
+
+  return NULL;
+}
+
+static enum op_type
+random_op(void)
+{
+  unsigned int sum = 0;
+
+  for (unsigned int i = 0; i < OP_COUNT; ++i)
+    sum += config.weight[i];
+
+  unsigned int n = (unsigned int)random() % sum;
+
+  for (unsigned int i = 0; i < OP_COUNT; ++i)
+  {
+    if (n < config.weight[i])
+      return i;
+    n -= config.weight[i];
+  }
+
+  return OP_PRIVMSG;
+}
+
+static void
+run_op(void)
+{
+  const enum op_type op = random_op();
+  struct conn *c;
+
+  if (op == OP_REMOTE)
+  {
+    if (server_conn == NULL || server_conn->state != STATE_ACTIVE)
+      return;
+
+    const unsigned int user = (unsigned int)random() % config.server_users;
+    conn_send(server_conn, ":%s PRIVMSG #bench%u :lat %llu", server_uid(user),
+              user % config.channels, (unsigned long long)now_ns());
+  }
+  else
+  {
+    if ((c = random_active_client()) == NULL)
+      return;
+
+    switch (op)
+    {
+      case OP_PRIVMSG:
+        conn_send(c, "PRIVMSG #bench%u :lat %llu", c->channel, (unsigned long long)now_ns());
+        break;
+      case OP_JOIN:
+        conn_send(c, "PART #bench%u", c->channel);
+        c->channel = (unsigned int)random() % config.channels;
+        conn_send(c, "JOIN #bench%u", c->channel);
+        break;
+      case OP_NICK:
+        snprintf(c->nick, sizeof(c->nick), "b%ux%u", c->id, ++c->nick_gen);
+        conn_send(c, "NICK %s", c->nick);
+        break;
+      case OP_WHO:
+        conn_send(c, "WHO #bench%u", c->channel);
+        break;
+      case OP_LIST:
+        conn_send(c, "LIST");
+        break;
+      default:
+        break;
+    }
+  }
+
+  ++total.sent[op];
+  ++interval.sent[op];
+}
+
+/* Sends the replayed lines that are due */
+static void
+run_replay(uint64_t elapsed)
+{
+  while (replay_next < replay_count && replay_table[replay_next].at <= elapsed)
+  {
+    const struct replay_line *const r = &replay_table[replay_next++];
+    struct conn *const c = &conn_table[r->client % config.clients];
+    char buf[1024];
+    size_t len = 0;
+
+    if (c->state != STATE_ACTIVE)
+      continue;
+
+    /* Expand %n to the client's nick and %t to the current time, for latency measurements */
+    for (const char *p = r->line; *p && len < sizeof(buf) - 32; ++p)
+    {
+      if (p[0] == '%' && p[1] == 'n')
+        len += snprintf(buf + len, sizeof(buf) - len, "%s", c->nick), ++p;
+      else if (p[0] == '%' && p[1] == 't')
+        len += snprintf(buf + len, sizeof(buf) - len, "%llu", (unsigned long long)now_ns()), ++p;
+      else
+        buf[len++] = *p;
+    }
+
+    buf[len] = '\0';
+    conn_send(c, "%s", buf);
+
+    ++total.replayed;
+    ++interval.replayed;
+  }
+}
+
+/*
+ * Replay files have one line per command: the time to send it at, in
+ * milliseconds since the start of the replay, the number of the client
+ * to send it from, and the raw IRC line. Lines starting with '#' are
+ * ignored.
+ *
+ *   1500 42 PRIVMSG #bench3 :lat %t
+ */
+static void
+replay_load(const char *path)
+{
+  FILE *f = fopen(path, "r");
+  char line[1024];
+  unsigned int size = 0;
+
+  if (f == NULL)
+  {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+
+  while (fgets(line, sizeof(line), f))
+  {
+    unsigned long long at;
+    unsigned int client;
+    int pos = 0;
+
+    line[strcspn(line, "\r\n")] = '\0';
+
+    if (line[0] == '#' || sscanf(line, "%llu %u %n", &at, &client, &pos) != 2 || line[pos] == '\0')
+      continue;
+
+    if (replay_count == size)
+    {
+      size = size ? size * 2 : 1024;
+      replay_table = realloc(replay_table, size * sizeof(*replay_table));
+
+      if (replay_table == NULL)
+      {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    replay_table[replay_count].at = at * 1000000;
+    replay_table[replay_count].client = client;
+    replay_table[replay_count].line = strdup(line + pos);
+    ++replay_count;
+  }
+
+  fclose(f);
+  printf("Loaded %u lines to replay from %s\n", replay_count, path);
+}
+
+static void
+report(const struct counters *c, double seconds, const char *title)
+{
+  uint64_t sent = c->replayed;
+
+  for (unsigned int i = 0; i < OP_COUNT; ++i)
+    sent += c->sent[i];
+
+  printf("%s: clients %u/%u active, %u dead; sent %.0f/s received %.0f lines/s delivered %.0f/s\n",
+         title, clients_active, config.clients, clients_dead, sent / seconds,
+         c->lines_received / seconds, c->delivered / seconds);
+  hist_print("latency", &c->latency);
+}
+
+static void
+summary(double seconds)
+{
+  printf("\n=== Summary over %.1f seconds ===\n", seconds);
+  report(&total, seconds, "total");
+
+  printf("  commands    ");
+  for (unsigned int i = 0; i < OP_COUNT; ++i)
+    printf(" %s %llu", op_names[i], (unsigned long long)total.sent[i]);
+  printf(" replayed %llu\n", (unsigned long long)total.replayed);
+
+  hist_print("registration", &total.registration);
+
+  if (burst_done)
+    printf("  burst of %u users processed in %.3f ms\n", config.server_users,
+           (burst_done - burst_sent) / 1e6);
+}
+
+static int
+parse_mix(const char *mix)
+{
+  char *copy = strdup(mix), *save = NULL;
+
+  memset(config.weight, 0, sizeof(config.weight));
+
+  for (char *item = strtok_r(copy, ",", &save); item; item = strtok_r(NULL, ",", &save))
+  {
+    char *colon = strchr(item, ':');
+    unsigned int i;
+
+    if (colon == NULL)
+      return 0;
+
+    *colon = '\0';
+
+    for (i = 0; i < OP_COUNT; ++i)
+      if (strcmp(item, op_names[i]) == 0)
+        break;
+
+    if (i == OP_COUNT)
+      return 0;
+
+    config.weight[i] = atoi(colon + 1);
+  }
+
+  free(copy);
+
+  unsigned int sum = 0;
+  for (unsigned int i = 0; i < OP_COUNT; ++i)
+    sum += config.weight[i];
+
+  return sum > 0;
+}
+
+static void
+usage(void)
+{
+  fprintf(stderr,
+          "usage: ircbench [options]\n"
+          "  -h host      IPv4 address of the server (127.0.0.1)\n"
+          "  -p port      port of the server (6667)\n"
+          "  -c count     number of clients (1000)\n"
+          "  -a count     spread clients over 127.0.0.1 .. 127.0.0.<count> (1)\n"
+          "  -C rate      connections started per second (1000)\n"
+          "  -r rate      commands per second, all clients together (1000)\n"
+          "  -m mix       command weights (privmsg:80,join:5,nick:5,who:9,list:1);\n"
+          "               \"remote\" sends PRIVMSGs from users of the fake server\n"
+          "  -n count     number of channels (100)\n"
+          "  -t seconds   run time once all clients are connected (30)\n"
+          "  -i seconds   report interval (1)\n"
+          "  -f file      replay the commands in file instead of the mix\n"
+          "  -s name      also link as server name and burst users into the channels\n"
+          "  -S sid       SID of the fake server (9BE)\n"
+          "  -P password  password of the fake server (bench)\n"
+          "  -u count     users to burst from the fake server (10000)\n");
+  exit(EXIT_FAILURE);
+}
+
+static void
+on_signal(int sig)
+{
+  stop = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct epoll_event events[MAX_EVENTS];
+  int ch;
+
+  while ((ch = getopt(argc, argv, "h:p:c:a:C:r:m:n:t:i:f:s:S:P:u:")) != -1)
+  {
+    switch (ch)
+    {
+      case 'h': config.host = optarg; break;
+      case 'p': config.port = atoi(optarg); break;
+      case 'c': config.clients = atoi(optarg); break;
+      case 'a': config.sources = atoi(optarg); break;
+      case 'C': config.connect_rate = atoi(optarg); break;
+      case 'r': config.rate = atoi(optarg); break;
+      case 'm': if (!parse_mix(optarg)) usage(); break;
+      case 'n': config.channels = atoi(optarg); break;
+      case 't': config.duration = atoi(optarg); break;
+      case 'i': config.interval = atoi(optarg); break;
+      case 'f': config.replay = optarg; break;
+      case 's': config.server_name = optarg; break;
+      case 'S': config.server_sid = optarg; break;
+      case 'P': config.server_password = optarg; break;
+      case 'u': config.server_users = atoi(optarg); break;
+      default: usage();
+    }
+  }
+
+  if (config.channels == 0 || config.interval == 0 || config.connect_rate == 0 ||
+      config.sources == 0 || config.sources > 254)
+    usage();
+
+  if (config.server_name == NULL)
+    config.weight[OP_REMOTE] = 0;
+
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_port = htons(config.port);
+
+  if (inet_pton(AF_INET, config.host, &server_addr.sin_addr) != 1)
+  {
+    fprintf(stderr, "ircbench: %s is not an IPv4 address\n", config.host);
+    return EXIT_FAILURE;
+  }
+
+  /* Every client needs a descriptor */
+  struct rlimit rl;
+  if (getrlimit(RLIMIT_NOFILE, &rl) == 0)
+  {
+    rl.rlim_cur = rl.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rl);
+
+    if (rl.rlim_cur < config.clients + 16)
+      fprintf(stderr, "ircbench: warning: descriptor limit %llu is below the number of clients\n",
+              (unsigned long long)rl.rlim_cur);
+  }
+
+  if (config.replay)
+    replay_load(config.replay);
+
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  conn_table = calloc(config.clients + 1, sizeof(*conn_table));
+
+  if (epoll_fd < 0 || conn_table == NULL)
+  {
+    perror("ircbench");
+    return EXIT_FAILURE;
+  }
+
+  for (unsigned int i = 0; i <= config.clients; ++i)
+  {
+    conn_table[i].fd = -1;
+    conn_table[i].id = i;
+  }
+
+  signal(SIGINT, on_signal);
+  signal(SIGTERM, on_signal);
+  signal(SIGPIPE, SIG_IGN);
+  srandom(getpid());
+
+  const uint64_t start = now_ns();
+  uint64_t active_since = 0;  /* When all clients have registered and the load has been started */
+  uint64_t last_report = start;
+  uint64_t ops_done = 0;
+
+  if (config.server_name)
+  {
+    server_conn = &conn_table[config.clients];
+    server_conn->is_server = 1;
+    conn_start(server_conn);
+  }
+
+  while (!stop)
+  {
+    const uint64_t now = now_ns();
+
+    /* Start new connections at the configured rate */
+    const uint64_t due = (now - start) / 1000 * config.connect_rate / 1000000 + 1;
+    while (clients_started < config.clients && clients_started < due)
+      conn_start(&conn_table[clients_started++]);
+
+    /* Measure from the moment everything is set up, including the burst of the fake server */
+    if (active_since == 0 && clients_active + clients_dead == config.clients &&
+        (server_conn == NULL || server_conn->state != STATE_REGISTERING))
+    {
+      active_since = now;
+      printf("%u clients registered after %.3f s, %u failed\n", clients_active,
+             (now - start) / 1e9, clients_dead);
+
+      if (burst_done)
+        printf("Burst of %u users processed in %.3f ms\n", config.server_users,
+               (burst_done - burst_sent) / 1e6);
+
+      const struct hist registration = total.registration;
+      memset(&total, 0, sizeof(total));
+      memset(&interval, 0, sizeof(interval));
+      total.registration = registration;
+      last_report = now;
+    }
+
+    /* Issue commands at the configured rate */
+    if (active_since && config.replay)
+      run_replay(now - active_since);
+    else if (active_since && clients_active)
+    {
+      const uint64_t ops_due = (now - active_since) / 1000 * config.rate / 1000000;
+
+      /* Don't catch up on what couldn't be sent while no client was ready */
+      if (ops_due > ops_done + config.rate)
+        ops_done = ops_due - config.rate;
+
+      while (ops_done < ops_due)
+      {
+        run_op();
+        ++ops_done;
+      }
+    }
+
+    if (now - last_report >= (uint64_t)config.interval * 1000000000)
+    {
+      char title[32];
+
+      snprintf(title, sizeof(title), "%6.1fs", (now - start) / 1e9);
+      if (active_since == 0)
+        printf("%s: %u clients connecting, %u registered\n", title, clients_started, clients_active);
+      else
+        report(&interval, (now - last_report) / 1e9, title);
+      memset(&interval, 0, sizeof(interval));
+      last_report = now;
+    }
+
+    if (active_since && now - active_since >= (uint64_t)config.duration * 1000000000)
+      break;
+
+    const int n = epoll_wait(epoll_fd, events, MAX_EVENTS, 1);
+
+    for (int i = 0; i < n; ++i)
+      conn_event(events[i].data.ptr, events[i].events);
+  }
+
+  if (active_since)
+    summary((now_ns() - active_since) / 1e9);
+
+  for (unsigned int i = 0; i <= config.clients; ++i)
+    if (conn_table[i].fd >= 0)
+      close(conn_table[i].fd);
+
+  return EXIT_SUCCESS;
+}
+#else
+int
+main(int argc, char *argv[])
+{
+  fprintf(stderr, "ircbench: this program requires epoll\n");
+  return EXIT_FAILURE;
+}
+#endif  /* __IOPOLL_MECHANISM_EPOLL */